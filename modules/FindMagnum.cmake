@@ -62,11 +62,13 @@
 #  MAGNUM_BUILD_DEPRECATED      - Defined if compiled with deprecated APIs
 #   included
 #  MAGNUM_BUILD_STATIC          - Defined if compiled as static libraries
+#  MAGNUM_BUILD_THREADS         - Defined if compiled with worker threads
 #  MAGNUM_TARGET_GLES           - Defined if compiled for OpenGL ES
 #  MAGNUM_TARGET_GLES2          - Defined if compiled for OpenGL ES 2.0
 #  MAGNUM_TARGET_GLES3          - Defined if compiled for OpenGL ES 3.0
 #  MAGNUM_TARGET_DESKTOP_GLES   - Defined if compiled with OpenGL ES
 #   emulation on desktop OpenGL
+#  MAGNUM_TARGET_SSE2           - Defined if compiled with SSE2 math code
 #
 # Additionally these variables are defined for internal usage:
 #  MAGNUM_INCLUDE_DIR                   - Root include dir (w/o
@@ -140,6 +142,10 @@ string(FIND "${_magnumConfigure}" "#define MAGNUM_BUILD_STATIC" _BUILD_STATIC)
 if(NOT _BUILD_STATIC EQUAL -1)
     set(MAGNUM_BUILD_STATIC 1)
 endif()
+string(FIND "${_magnumConfigure}" "#define MAGNUM_BUILD_THREADS" _BUILD_THREADS)
+if(NOT _BUILD_THREADS EQUAL -1)
+    set(MAGNUM_BUILD_THREADS 1)
+endif()
 string(FIND "${_magnumConfigure}" "#define MAGNUM_TARGET_GLES" _TARGET_GLES)
 if(NOT _TARGET_GLES EQUAL -1)
     set(MAGNUM_TARGET_GLES 1)
@@ -156,6 +162,10 @@ string(FIND "${_magnumConfigure}" "#define MAGNUM_TARGET_DESKTOP_GLES" _TARGET_D
 if(NOT _TARGET_DESKTOP_GLES EQUAL -1)
     set(MAGNUM_TARGET_DESKTOP_GLES 1)
 endif()
+string(FIND "${_magnumConfigure}" "#define MAGNUM_TARGET_SSE2" _TARGET_SSE2)
+if(NOT _TARGET_SSE2 EQUAL -1)
+    set(MAGNUM_TARGET_SSE2 1)
+endif()
 
 if(NOT MAGNUM_TARGET_GLES OR MAGNUM_TARGET_DESKTOP_GLES)
     find_package(OpenGL REQUIRED)
@@ -364,6 +374,10 @@ if(NOT MAGNUM_TARGET_GLES OR MAGNUM_TARGET_DESKTOP_GLES)
 else()
     set(MAGNUM_LIBRARIES ${MAGNUM_LIBRARIES} ${OPENGLES2_LIBRARY})
 endif()
+if(MAGNUM_BUILD_THREADS)
+    find_package(Threads REQUIRED)
+    set(MAGNUM_LIBRARIES ${MAGNUM_LIBRARIES} ${CMAKE_THREAD_LIBS_INIT})
+endif()
 
 # Installation dirs
 include(CorradeLibSuffix)
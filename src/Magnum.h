@@ -85,6 +85,20 @@ Defined if built as static libraries. Default are shared libraries.
 #define MAGNUM_BUILD_STATIC
 #undef MAGNUM_BUILD_STATIC
 
+/**
+@brief Worker threads
+
+Defined if the engine is built with a worker thread pool. Matrix arrays in
+@ref Math::Algorithms, distance field computation in @ref TextureTools,
+animables in @ref SceneGraph::AnimableGroup and rigid body islands in
+@ref Shapes::RigidBodyWorld are then processed in parallel if more than one
+thread is requested, otherwise everything runs on the calling thread. Not
+available on NaCl and Emscripten.
+@see @ref building
+*/
+#define MAGNUM_BUILD_THREADS
+#undef MAGNUM_BUILD_THREADS
+
 /**
 @brief OpenGL ES target
 
@@ -124,6 +138,20 @@ within standard desktop OpenGL. Implies also @ref MAGNUM_TARGET_GLES.
 */
 #define MAGNUM_TARGET_DESKTOP_GLES
 #undef MAGNUM_TARGET_DESKTOP_GLES
+
+/**
+@brief SSE2 math code
+
+Defined if the math code is built with SSE2 intrinsics. Arithmetic of
+four-component float vectors, 4x4 float matrix products, inversion and point
+transformation and quaternion multiplication are then done using SSE2
+without changing the memory layout of the types. The binary arithmetic
+operators of four-component float vectors are then not usable in constant
+expressions, other types are not affected.
+@see @ref building
+*/
+#define MAGNUM_TARGET_SSE2
+#undef MAGNUM_TARGET_SSE2
 #endif
 
 /** @{ @name Basic type definitions
@@ -158,6 +186,9 @@ typedef std::int64_t Long;
 /** @brief Float (32bit) */
 typedef float Float;
 
+/** @brief Half (16bit) */
+typedef Math::Half Half;
+
 /** @brief Two-component float vector */
 typedef Math::Vector2<Float> Vector2;
 
@@ -185,6 +216,15 @@ typedef Math::Vector3<Int> Vector3i;
 /** @brief Four-component signed integer vector */
 typedef Math::Vector4<Int> Vector4i;
 
+/** @brief Two-component half-float vector */
+typedef Math::Vector2<Half> Vector2h;
+
+/** @brief Three-component half-float vector */
+typedef Math::Vector3<Half> Vector3h;
+
+/** @brief Four-component half-float vector */
+typedef Math::Vector4<Half> Vector4h;
+
 /**
 @brief 3x3 float transformation matrix
 
@@ -307,6 +347,9 @@ typedef Math::Geometry::Rectangle<Float> Rectangle;
 /** @brief Signed integer rectangle */
 typedef Math::Geometry::Rectangle<Int> Rectanglei;
 
+/** @brief Float frustum */
+typedef Math::Geometry::Frustum<Float> Frustum;
+
 /*@}*/
 
 #ifndef MAGNUM_TARGET_GLES
@@ -447,6 +490,9 @@ typedef Math::Rad<Double> Radd;
 /** @brief Double rectangle */
 typedef Math::Geometry::Rectangle<Double> Rectangled;
 
+/** @brief Double frustum */
+typedef Math::Geometry::Frustum<Double> Frustumd;
+
 /*@}*/
 #endif
 
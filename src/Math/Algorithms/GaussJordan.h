@@ -28,6 +28,11 @@
  * @brief Function Magnum::Math::Algorithms::gaussJordanInPlaceTransposed(), Magnum::Math::Algorithms::gaussJordanInPlace()
  */
 
+#include <algorithm>
+#include <vector>
+
+#include "Math/Batch.h"
+#include "Math/BoolVector.h"
 #include "Math/RectangularMatrix.h"
 
 namespace Magnum { namespace Math { namespace Algorithms {
@@ -90,6 +95,176 @@ template<std::size_t size, std::size_t rows, class T> bool gaussJordanInPlaceTra
     return true;
 }
 
+/**
+@brief In-place Gauss-Jordan elimination of multiple transposed matrices at once
+@param a     Transposed left sides of augmented matrices
+@param t     Transposed right sides of augmented matrices
+@return Bit set for each lane where @p a is regular. Contents of @p t in lanes
+    where @p a is singular are undefined.
+
+Structure-of-arrays variant of the above, each element of the matrices contains
+given element of @p lanes independent matrices. Pivots are chosen for each
+lane separately, so the results are the same as when solving each matrix with
+gaussJordanInPlaceTransposed() above, but all lanes are computed with the
+same instructions. With @ref MAGNUM_TARGET_SSE2 the elimination and
+backsubstitution of four float lanes use the SSE2 vector arithmetic, pivot
+search is done for each lane separately. Other lane counts are left for the
+compiler to vectorize. See also
+gaussJordanInPlaceTransposed(Batch::StridedArrayReference<RectangularMatrix<size, size, T>>, Batch::StridedArrayReference<RectangularMatrix<size, rows, T>>, Batch::StridedArrayReference<bool>, UnsignedInt)
+which solves arrays of matrices.
+*/
+template<std::size_t lanes, std::size_t size, std::size_t rows, class T> BoolVector<lanes> gaussJordanInPlaceTransposed(RectangularMatrix<size, size, Vector<lanes, T>>& a, RectangularMatrix<size, rows, Vector<lanes, T>>& t) {
+    typedef Vector<lanes, T> Lanes;
+
+    BoolVector<lanes> regular(true);
+    for(std::size_t row = 0; row != size; ++row) {
+        /* Find max pivot in each lane */
+        std::size_t rowMax[lanes];
+        for(std::size_t i = 0; i != lanes; ++i) {
+            rowMax[i] = row;
+            for(std::size_t row2 = row+1; row2 != size; ++row2)
+                if(std::abs(a[row2][row][i]) > std::abs(a[rowMax[i]][row][i]))
+                    rowMax[i] = row2;
+        }
+
+        /* Swap the rows in each lane */
+        for(std::size_t i = 0; i != lanes; ++i) {
+            if(rowMax[i] == row) continue;
+            for(std::size_t col = 0; col != size; ++col)
+                std::swap(a[row][col][i], a[rowMax[i]][col][i]);
+            for(std::size_t col = 0; col != rows; ++col)
+                std::swap(t[row][col][i], t[rowMax[i]][col][i]);
+        }
+
+        /* Singular lanes, replace the pivot to avoid division by zero */
+        for(std::size_t i = 0; i != lanes; ++i) {
+            if(!TypeTraits<T>::equals(a[row][row][i], T(0))) continue;
+            regular.set(i, false);
+            a[row][row][i] = T(1);
+        }
+
+        /* Eliminate column */
+        for(std::size_t row2 = row+1; row2 != size; ++row2) {
+            const Lanes c = a[row2][row]/a[row][row];
+
+            a[row2] -= a[row]*c;
+            t[row2] -= t[row]*c;
+        }
+    }
+
+    /* Backsubstitute */
+    for(std::size_t row = size; row != 0; --row) {
+        const Lanes c = Lanes(T(1))/a[row-1][row-1];
+
+        for(std::size_t row2 = 0; row2 != row-1; ++row2)
+            t[row2] -= t[row-1]*a[row2][row-1]*c;
+
+        /* Normalize the row */
+        t[row-1] *= c;
+    }
+
+    return regular;
+}
+
+namespace Implementation {
+
+/* Lane count used for solving arrays of matrices */
+constexpr std::size_t GaussJordanLanes = 4;
+
+/* Element of matrix in transposed layout */
+template<bool transposed> struct GaussJordanElement;
+template<> struct GaussJordanElement<true> {
+    template<class T> static auto get(T& matrix, std::size_t col, std::size_t row) -> decltype(matrix[col][row]) {
+        return matrix[col][row];
+    }
+};
+template<> struct GaussJordanElement<false> {
+    template<class T> static auto get(T& matrix, std::size_t col, std::size_t row) -> decltype(matrix[row][col]) {
+        return matrix[row][col];
+    }
+};
+
+/* Solves given range of matrices in groups of GaussJordanLanes. The matrices
+   are transposed when copying them into lanes if transposed is false, the
+   last incomplete group is padded with identity. */
+template<bool transposed, std::size_t size, std::size_t rows, class T, class U, class V> bool gaussJordanRange(Batch::StridedArrayReference<U> a, Batch::StridedArrayReference<V> t, Batch::StridedArrayReference<bool> regular, const std::size_t begin, const std::size_t end) {
+    typedef GaussJordanElement<transposed> Element;
+    constexpr std::size_t lanes = GaussJordanLanes;
+
+    bool allRegular = true;
+    for(std::size_t first = begin; first < end; first += lanes) {
+        const std::size_t count = std::min(lanes, end - first);
+
+        RectangularMatrix<size, size, Vector<lanes, T>> aLanes;
+        RectangularMatrix<size, rows, Vector<lanes, T>> tLanes;
+        for(std::size_t i = 0; i != lanes; ++i) for(std::size_t col = 0; col != size; ++col) {
+            for(std::size_t row = 0; row != size; ++row)
+                aLanes[col][row][i] = i < count ? Element::get(a[first + i], col, row) : T(col == row ? 1 : 0);
+            for(std::size_t row = 0; row != rows; ++row)
+                tLanes[col][row][i] = i < count ? Element::get(t[first + i], col, row) : T(0);
+        }
+
+        const BoolVector<lanes> regularLanes = gaussJordanInPlaceTransposed(aLanes, tLanes);
+
+        for(std::size_t i = 0; i != count; ++i) {
+            for(std::size_t col = 0; col != size; ++col) {
+                for(std::size_t row = 0; row != size; ++row)
+                    Element::get(a[first + i], col, row) = aLanes[col][row][i];
+                for(std::size_t row = 0; row != rows; ++row)
+                    Element::get(t[first + i], col, row) = tLanes[col][row][i];
+            }
+
+            if(!regular.empty()) regular[first + i] = regularLanes[i];
+            allRegular = allRegular && regularLanes[i];
+        }
+    }
+
+    return allRegular;
+}
+
+template<bool transposed, std::size_t size, std::size_t rows, class T, class U, class V> bool gaussJordanArray(Batch::StridedArrayReference<U> a, Batch::StridedArrayReference<V> t, Batch::StridedArrayReference<bool> regular, const UnsignedInt threadCount) {
+    /* Not std::vector<bool>, each thread writes its own item */
+    std::vector<UnsignedByte> allRegular(std::max(threadCount, 1u), 1);
+    Batch::Implementation::parallelRanges(a.size(), GaussJordanLanes, threadCount, [&](std::size_t index, std::size_t begin, std::size_t end) {
+        allRegular[index] = gaussJordanRange<transposed, size, rows, T>(a, t, regular, begin, end);
+    });
+    return std::find(allRegular.begin(), allRegular.end(), 0) == allRegular.end();
+}
+
+}
+
+/**
+@brief In-place Gauss-Jordan elimination of an array of transposed matrices
+@param a            Transposed left sides of augmented matrices
+@param t            Transposed right sides of augmented matrices
+@param regular      Where to save whether given @p a is regular. If empty,
+    the information is not saved.
+@param threadCount  Count of threads to distribute the work to
+@return True if all matrices in @p a are regular, false otherwise. Contents
+    of @p t corresponding to singular matrices are undefined.
+
+Solves each pair of matrices in @p a and @p t as
+gaussJordanInPlaceTransposed(RectangularMatrix<size, size, T>&, RectangularMatrix<size, rows, T>&),
+with the same results. The matrices are solved four at a time using the
+structure-of-arrays variant above and if @p threadCount is larger than `1`,
+the arrays are split into contiguous ranges solved in separate threads. All
+arrays are expected to have the same size (@p regular can be also empty) and
+@p threadCount is expected to be positive. As the matrix types can't be
+deduced from brace-initialized arrays, they must be specified explicitly:
+@code
+std::vector<Matrix4x4> a;
+std::vector<Matrix4x4> t;
+Math::Algorithms::gaussJordanInPlaceTransposed<4, 4, Float>({a.data(), a.size()}, {t.data(), t.size()}, nullptr, 4);
+@endcode
+*/
+template<std::size_t size, std::size_t rows, class T> bool gaussJordanInPlaceTransposed(Batch::StridedArrayReference<RectangularMatrix<size, size, T>> a, Batch::StridedArrayReference<RectangularMatrix<size, rows, T>> t, Batch::StridedArrayReference<bool> regular = nullptr, UnsignedInt threadCount = 1) {
+    CORRADE_ASSERT(a.size() == t.size() && (regular.empty() || regular.size() == a.size()),
+        "Math::Algorithms::gaussJordanInPlaceTransposed(): expected arrays of the same size", false);
+    CORRADE_ASSERT(threadCount != 0,
+        "Math::Algorithms::gaussJordanInPlaceTransposed(): thread count must be positive", false);
+    return Implementation::gaussJordanArray<true, size, rows, T>(a, t, regular, threadCount);
+}
+
 /**
 @brief In-place Gauss-Jordan elimination
 
@@ -108,6 +283,20 @@ template<std::size_t size, std::size_t cols, class T> bool gaussJordanInPlace(Re
     return ret;
 }
 
+/**
+@brief In-place Gauss-Jordan elimination of an array of matrices
+
+Non-transposed variant of gaussJordanInPlaceTransposed(Batch::StridedArrayReference<RectangularMatrix<size, size, T>>, Batch::StridedArrayReference<RectangularMatrix<size, rows, T>>, Batch::StridedArrayReference<bool>, UnsignedInt),
+the matrices are transposed while copying them into and from the lanes.
+*/
+template<std::size_t size, std::size_t cols, class T> bool gaussJordanInPlace(Batch::StridedArrayReference<RectangularMatrix<size, size, T>> a, Batch::StridedArrayReference<RectangularMatrix<cols, size, T>> t, Batch::StridedArrayReference<bool> regular = nullptr, UnsignedInt threadCount = 1) {
+    CORRADE_ASSERT(a.size() == t.size() && (regular.empty() || regular.size() == a.size()),
+        "Math::Algorithms::gaussJordanInPlace(): expected arrays of the same size", false);
+    CORRADE_ASSERT(threadCount != 0,
+        "Math::Algorithms::gaussJordanInPlace(): thread count must be positive", false);
+    return Implementation::gaussJordanArray<false, size, cols, T>(a, t, regular, threadCount);
+}
+
 }}}
 
 #endif
@@ -30,6 +30,7 @@
 
 #include <tuple>
 
+#include "Math/Batch.h"
 #include "Math/Functions.h"
 #include "Math/Matrix.h"
 
@@ -332,6 +333,43 @@ template<std::size_t cols, std::size_t rows, class T> std::tuple<RectangularMatr
     return std::make_tuple(m, q, v);
 }
 
+/**
+@brief Singular Value Decomposition of an array of matrices
+@param m            Matrices to decompose
+@param u            Where to save first @p cols column vectors of
+    @f$ U @f$ for each matrix
+@param w            Where to save diagonal of @f$ \Sigma @f$ for each matrix
+@param v            Where to save non-transposed @f$ V @f$ for each matrix
+@param threadCount  Count of threads to distribute the work to
+
+Decomposes each matrix in @p m using svd(RectangularMatrix<cols, rows, T>)
+with the same results, output for matrices where the solution doesn't converge
+is zero. If @p threadCount is larger than `1`, the arrays are split into
+contiguous ranges decomposed in separate threads. Unlike
+@ref gaussJordanInPlaceTransposed() "gaussJordanInPlaceTransposed()", the
+matrices aren't decomposed in parallel lanes, as the iteration count and
+branching of the diagonalization differs for each matrix. All arrays are
+expected to have the same size and @p threadCount is expected to be positive.
+As the matrix types can't be deduced from brace-initialized arrays, they must
+be specified explicitly:
+@code
+std::vector<Matrix3x3d> m, u, v;
+std::vector<Vector3d> w;
+Math::Algorithms::svd<3, 3, Double>({m.data(), m.size()}, {u.data(), u.size()},
+    {w.data(), w.size()}, {v.data(), v.size()}, 4);
+@endcode
+*/
+template<std::size_t cols, std::size_t rows, class T> void svd(Batch::StridedArrayReference<const RectangularMatrix<cols, rows, T>> m, Batch::StridedArrayReference<RectangularMatrix<cols, rows, T>> u, Batch::StridedArrayReference<Vector<cols, T>> w, Batch::StridedArrayReference<Matrix<cols, T>> v, UnsignedInt threadCount = 1) {
+    CORRADE_ASSERT(m.size() == u.size() && m.size() == w.size() && m.size() == v.size(),
+        "Math::Algorithms::svd(): expected arrays of the same size", );
+    CORRADE_ASSERT(threadCount != 0,
+        "Math::Algorithms::svd(): thread count must be positive", );
+    Batch::Implementation::parallelRanges(m.size(), 1, threadCount, [&](std::size_t, std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i)
+            std::tie(u[i], w[i], v[i]) = svd(m[i]);
+    });
+}
+
 }}}
 
 #endif
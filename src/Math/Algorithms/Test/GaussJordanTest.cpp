@@ -22,6 +22,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <vector>
 #include <TestSuite/Tester.h>
 
 #include "Math/Algorithms/GaussJordan.h"
@@ -34,14 +35,36 @@ class GaussJordanTest: public Corrade::TestSuite::Tester {
 
         void singular();
         void invert();
+        void lanes();
+        void array();
+        void arrayTransposed();
 };
 
 typedef RectangularMatrix<4, 4, Float> Matrix4x4;
 typedef Vector<4, Float> Vector4;
 
+namespace {
+    /* Regular matrices, except for the sixth one */
+    Matrix4x4 testMatrix(std::size_t i) {
+        if(i == 5) return Matrix4x4(Vector4(1.0f, 2.0f,  3.0f,  4.0f),
+                                    Vector4(2.0f, 3.0f, -7.0f, 11.0f),
+                                    Vector4(2.0f, 4.0f,  6.0f,  8.0f),
+                                    Vector4(1.0f, 2.0f,  7.0f, 40.0f));
+
+        const Float f = Float(i);
+        return Matrix4x4(Vector4(3.0f + f,  5.0f, 8.0f - f, 4.0f),
+                         Vector4(4.0f,  4.0f*f, 7.0f, 3.0f),
+                         Vector4(7.0f, -1.0f, 8.0f, f),
+                         Vector4(9.0f - f,  4.0f, 5.0f, 9.0f));
+    }
+}
+
 GaussJordanTest::GaussJordanTest() {
     addTests({&GaussJordanTest::singular,
-              &GaussJordanTest::invert});
+              &GaussJordanTest::invert,
+              &GaussJordanTest::lanes,
+              &GaussJordanTest::array,
+              &GaussJordanTest::arrayTransposed});
 }
 
 void GaussJordanTest::singular() {
@@ -73,6 +96,78 @@ void GaussJordanTest::invert() {
     CORRADE_COMPARE(a*inverse, Matrix4x4::fromDiagonal(Vector4(1.0f)));
 }
 
+void GaussJordanTest::lanes() {
+    RectangularMatrix<4, 4, Vector4> a;
+    RectangularMatrix<4, 2, Vector4> t;
+    for(std::size_t i = 0; i != 4; ++i) for(std::size_t col = 0; col != 4; ++col) {
+        for(std::size_t row = 0; row != 4; ++row)
+            a[col][row][i] = testMatrix(i + 3)[col][row];
+        t[col][0][i] = Float(col);
+        t[col][1][i] = Float(i);
+    }
+
+    const BoolVector<4> regular = gaussJordanInPlaceTransposed(a, t);
+    CORRADE_COMPARE(regular, BoolVector<4>(0x0b));
+
+    /* Regular lanes have the same result as the scalar variant */
+    for(std::size_t i: {0, 1, 3}) {
+        Matrix4x4 expectedA = testMatrix(i + 3);
+        RectangularMatrix<4, 2, Float> expectedT;
+        for(std::size_t col = 0; col != 4; ++col)
+            expectedT[col] = Vector<2, Float>(Float(col), Float(i));
+        CORRADE_VERIFY(gaussJordanInPlaceTransposed(expectedA, expectedT));
+
+        for(std::size_t col = 0; col != 4; ++col) for(std::size_t row = 0; row != 2; ++row)
+            CORRADE_COMPARE(t[col][row][i], expectedT[col][row]);
+    }
+}
+
+void GaussJordanTest::array() {
+    std::vector<Matrix4x4> a, inverse;
+    for(std::size_t i = 0; i != 11; ++i) {
+        a.push_back(testMatrix(i));
+        inverse.push_back(Matrix4x4::fromDiagonal(Vector4(1.0f)));
+    }
+    bool regular[11];
+
+    const bool allRegular = gaussJordanInPlace<4, 4, Float>({a.data(), a.size()}, {inverse.data(), inverse.size()}, {regular, 11}, 3);
+    CORRADE_VERIFY(!allRegular);
+
+    for(std::size_t i = 0; i != 11; ++i) {
+        Matrix4x4 expectedA = testMatrix(i);
+        Matrix4x4 expectedInverse = Matrix4x4::fromDiagonal(Vector4(1.0f));
+        CORRADE_COMPARE(regular[i], gaussJordanInPlace(expectedA, expectedInverse));
+        if(i != 5) CORRADE_COMPARE(inverse[i], expectedInverse);
+    }
+
+    /* All regular */
+    a.erase(a.begin() + 5);
+    inverse.erase(inverse.begin() + 5);
+    const bool allRegular2 = gaussJordanInPlace<4, 4, Float>({a.data(), a.size()}, {inverse.data(), inverse.size()});
+    CORRADE_VERIFY(allRegular2);
+}
+
+void GaussJordanTest::arrayTransposed() {
+    struct Item {
+        Matrix4x4 a;
+        RectangularMatrix<4, 1, Float> t;
+    } items[6];
+    for(std::size_t i = 0; i != 6; ++i) {
+        items[i].a = testMatrix(i);
+        items[i].t = RectangularMatrix<4, 1, Float>(Vector<1, Float>(1.0f), Vector<1, Float>(2.0f), Vector<1, Float>(3.0f), Vector<1, Float>(Float(i)));
+    }
+
+    const bool allRegular = gaussJordanInPlaceTransposed<4, 1, Float>({&items[0].a, 6, sizeof(Item)}, {&items[0].t, 6, sizeof(Item)}, nullptr, 2);
+    CORRADE_VERIFY(!allRegular);
+
+    for(std::size_t i: {0, 1, 2, 3, 4}) {
+        Matrix4x4 expectedA = testMatrix(i);
+        RectangularMatrix<4, 1, Float> expectedT(Vector<1, Float>(1.0f), Vector<1, Float>(2.0f), Vector<1, Float>(3.0f), Vector<1, Float>(Float(i)));
+        CORRADE_VERIFY(gaussJordanInPlaceTransposed(expectedA, expectedT));
+        CORRADE_COMPARE(items[i].t, expectedT);
+    }
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::GaussJordanTest)
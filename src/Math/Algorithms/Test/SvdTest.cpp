@@ -34,6 +34,7 @@ class SvdTest: public Corrade::TestSuite::Tester {
 
         void testDouble();
         void testFloat();
+        void array();
 };
 
 #ifndef MAGNUM_TARGET_GLES
@@ -72,7 +73,8 @@ static const Vector5f expectedf(std::sqrt(1248.0f), 0.0f, 20.0f, std::sqrt(384.0
 
 SvdTest::SvdTest() {
     addTests({&SvdTest::testDouble,
-              &SvdTest::testFloat});
+              &SvdTest::testFloat,
+              &SvdTest::array});
 }
 
 void SvdTest::testDouble() {
@@ -117,6 +119,28 @@ void SvdTest::testFloat() {
     CORRADE_VERIFY(Math::abs(w-expectedf).max() < 1.0e-5f);
 }
 
+void SvdTest::array() {
+    Matrix5x8f m[7];
+    for(std::size_t i = 0; i != 7; ++i)
+        m[i] = af*Float(i + 1);
+    Matrix5x8f u[7];
+    Vector5f w[7];
+    Matrix5f v[7];
+
+    svd<5, 8, Float>({m, 7}, {u, 7}, {w, 7}, {v, 7}, 3);
+
+    /* Same results as the single-matrix variant */
+    for(std::size_t i = 0; i != 7; ++i) {
+        Matrix5x8f expectedU;
+        Vector5f expectedW;
+        Matrix5f expectedV;
+        std::tie(expectedU, expectedW, expectedV) = Algorithms::svd(m[i]);
+        CORRADE_COMPARE(u[i], expectedU);
+        CORRADE_COMPARE(w[i], expectedW);
+        CORRADE_COMPARE(v[i], expectedV);
+    }
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::SvdTest)
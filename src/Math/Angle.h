@@ -234,6 +234,45 @@ constexpr Rad<Float> operator "" _radf(long double value) { return Rad<Float>(va
 template<class T> constexpr Deg<T>::Deg(Unit<Rad, T> value): Unit<Math::Deg, T>(T(180)*T(value)/Math::Constants<T>::pi()) {}
 template<class T> constexpr Rad<T>::Rad(Unit<Deg, T> value): Unit<Math::Rad, T>(T(value)*Math::Constants<T>::pi()/T(180)) {}
 
+namespace Implementation {
+    /* Sine and cosine usable in constant expressions, used in constexpr
+       variants of rotation matrices so they can be computed at compile
+       time. The angle is reduced to [-π, π] and then Taylor series is
+       evaluated using Horner scheme, i.e.
+       1 - x²/(n(n + 1))*(1 - x²/((n + 2)(n + 3))*(...)). The series is
+       truncated after thirteen terms, which is precise enough even for
+       doubles. */
+    template<UnsignedInt n, class T, bool end = (n > 26)> struct TrigonometricSeries {
+        constexpr static T evaluate(T x2) {
+            return T(1) - x2*(T(1)/T(n*(n + 1)))*TrigonometricSeries<n + 2, T>::evaluate(x2);
+        }
+    };
+    template<UnsignedInt n, class T> struct TrigonometricSeries<n, T, true> {
+        constexpr static T evaluate(T) { return T(1); }
+    };
+
+    template<class T> constexpr T reduceAngle(T angle) {
+        /* Infinity and NaN result in NaN, the conversion to integer would be
+           undefined for them */
+        return angle - angle != T(0) ? angle - angle :
+            angle - T(2)*Constants<T>::pi()*T(Long(angle/(T(2)*Constants<T>::pi()) + (angle < T(0) ? T(-0.5) : T(0.5))));
+    }
+
+    template<class T> constexpr T sinReduced(T x) {
+        return x*TrigonometricSeries<2, T>::evaluate(x*x);
+    }
+    template<class T> constexpr T sin(Rad<T> angle) {
+        return sinReduced(reduceAngle(T(angle)));
+    }
+
+    template<class T> constexpr T cosReduced(T x) {
+        return TrigonometricSeries<1, T>::evaluate(x*x);
+    }
+    template<class T> constexpr T cos(Rad<T> angle) {
+        return cosReduced(reduceAngle(T(angle)));
+    }
+}
+
 /** @debugoperator{Magnum::Math::Rad} */
 template<class T> Corrade::Utility::Debug operator<<(Corrade::Utility::Debug debug, const Unit<Rad, T>& value) {
     debug << "Rad(";
@@ -0,0 +1,157 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "Math/Batch.h"
+
+#include "magnumConfigure.h"
+
+#ifdef MAGNUM_BUILD_THREADS
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace Magnum { namespace Math { namespace Batch { namespace Implementation {
+
+#ifdef MAGNUM_BUILD_THREADS
+namespace {
+
+struct Job {
+    void(*function)(void*, std::size_t, std::size_t, std::size_t);
+    void* state;
+    std::size_t count, rangeSize, rangeCount;
+
+    /* Both guarded by WorkerPool::_mutex */
+    std::size_t nextRange, finishedRanges;
+};
+
+/* Persistent pool shared by all parallel ranges in the engine. The pool is
+   created on first use, grows up to largest requested thread count and the
+   workers are joined on exit. Submitting thread processes the ranges too, so
+   it can wait only for ranges which are already being processed and nested
+   submissions from the workers don't deadlock. */
+class WorkerPool {
+    public:
+        static WorkerPool& instance() {
+            static WorkerPool pool;
+            return pool;
+        }
+
+        ~WorkerPool();
+
+        void run(Job& job, std::size_t workerCount);
+
+    private:
+        WorkerPool(): _exit(false) {}
+
+        void work();
+
+        /* Claims next range of given job, the lock must be held. Removes the
+           job from the queue if this is its last range. */
+        std::size_t claim(Job& job);
+
+        /* Processes given range of the job, the lock is released meanwhile */
+        void process(std::unique_lock<std::mutex>& lock, Job& job, std::size_t index);
+
+        std::mutex _mutex;
+        std::condition_variable _wake, _finished;
+        std::vector<std::thread> _workers;
+        std::deque<Job*> _queue;
+        bool _exit;
+};
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _exit = true;
+    }
+    _wake.notify_all();
+    for(std::thread& worker: _workers) worker.join();
+}
+
+void WorkerPool::run(Job& job, const std::size_t workerCount) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while(_workers.size() < workerCount)
+        _workers.emplace_back(&WorkerPool::work, this);
+
+    _queue.push_back(&job);
+    _wake.notify_all();
+
+    while(job.nextRange != job.rangeCount)
+        process(lock, job, claim(job));
+
+    _finished.wait(lock, [&job]() { return job.finishedRanges == job.rangeCount; });
+}
+
+void WorkerPool::work() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    for(;;) {
+        _wake.wait(lock, [this]() { return _exit || !_queue.empty(); });
+        if(_exit) return;
+
+        Job& job = *_queue.front();
+        process(lock, job, claim(job));
+    }
+}
+
+std::size_t WorkerPool::claim(Job& job) {
+    const std::size_t index = job.nextRange++;
+    if(job.nextRange == job.rangeCount)
+        _queue.erase(std::find(_queue.begin(), _queue.end(), &job));
+    return index;
+}
+
+void WorkerPool::process(std::unique_lock<std::mutex>& lock, Job& job, const std::size_t index) {
+    lock.unlock();
+    const std::size_t begin = index*job.rangeSize;
+    job.function(job.state, index, begin, std::min(begin + job.rangeSize, job.count));
+    lock.lock();
+
+    if(++job.finishedRanges == job.rangeCount) _finished.notify_all();
+}
+
+}
+#endif
+
+void parallelRanges(const std::size_t count, const std::size_t granularity, const std::size_t threadCount, void(*const function)(void*, std::size_t, std::size_t, std::size_t), void* const state) {
+    #ifdef MAGNUM_BUILD_THREADS
+    const std::size_t chunks = (count + granularity - 1)/granularity;
+    const std::size_t threads = std::min(threadCount, chunks);
+    if(threads > 1) {
+        const std::size_t rangeSize = (chunks + threads - 1)/threads*granularity;
+        Job job{function, state, count, rangeSize, (count + rangeSize - 1)/rangeSize, 0, 0};
+        WorkerPool::instance().run(job, threads - 1);
+        return;
+    }
+    #else
+    static_cast<void>(granularity);
+    static_cast<void>(threadCount);
+    #endif
+
+    function(state, 0, 0, count);
+}
+
+}}}}
@@ -0,0 +1,390 @@
+#ifndef Magnum_Math_Batch_h
+#define Magnum_Math_Batch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::Math::Batch::StridedArrayReference, functions Magnum::Math::Batch::transformPointsInPlace(), Magnum::Math::Batch::transformVectorsInPlace(), Magnum::Math::Batch::translateInPlace(), Magnum::Math::Batch::normalizeInPlace(), Magnum::Math::Batch::dot(), Magnum::Math::Batch::cross(), Magnum::Math::Batch::minmax()
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <Containers/Array.h>
+#include <Utility/Assert.h>
+
+#include "Math/Functions.h"
+#include "Math/Matrix3.h"
+#include "Math/Matrix4.h"
+#include "Math/Quaternion.h"
+
+namespace Magnum { namespace Math { namespace Batch {
+
+/**
+@brief Strided array reference
+
+Non-owning reference to @p size items of type @p T placed @p stride bytes
+apart, e.g. positions in interleaved vertex array. Contiguous arrays are
+referenced with stride equal to item size. All functions in @ref Batch
+namespace take the arrays using this class. It can be created using
+brace-initialization directly in the function call:
+@code
+std::vector<Vector3> positions;
+Math::Batch::transformPointsInPlace(transformation, {positions.data(), positions.size()});
+
+struct Vertex {
+    Vector2 position, textureCoordinates;
+};
+std::vector<Vertex> vertices;
+Math::Batch::translateInPlace(offset, {&vertices[0].position, vertices.size(), sizeof(Vertex)});
+@endcode
+*/
+template<class T> class StridedArrayReference {
+    template<class> friend class StridedArrayReference;
+
+    public:
+        /** @brief Underlying data type */
+        typedef T Type;
+
+        /** @brief Default constructor, creates empty reference */
+        constexpr /*implicit*/ StridedArrayReference(std::nullptr_t = nullptr): _data(nullptr), _size(0), _stride(sizeof(T)) {}
+
+        /**
+         * @brief Constructor
+         * @param data      Pointer to first item
+         * @param size      Item count
+         * @param stride    Distance between two items in bytes
+         */
+        constexpr /*implicit*/ StridedArrayReference(T* data, std::size_t size, std::size_t stride = sizeof(T)): _data(data), _size(size), _stride(stride) {}
+
+        /** @brief Construct reference to contiguous array */
+        constexpr /*implicit*/ StridedArrayReference(Corrade::Containers::ArrayReference<T> data): _data(data.data()), _size(data.size()), _stride(sizeof(T)) {}
+
+        /** @brief Construct const reference from non-const one */
+        template<class U, class = typename std::enable_if<std::is_same<const U, T>::value>::type> constexpr /*implicit*/ StridedArrayReference(StridedArrayReference<U> other): _data(other._data), _size(other._size), _stride(other._stride) {}
+
+        /** @brief Pointer to first item */
+        constexpr T* data() const { return _data; }
+
+        /** @brief Item count */
+        constexpr std::size_t size() const { return _size; }
+
+        /** @brief Distance between two items in bytes */
+        constexpr std::size_t stride() const { return _stride; }
+
+        /** @brief Whether the array is empty */
+        constexpr bool empty() const { return !_size; }
+
+        /** @brief Whether the items are placed contiguously */
+        constexpr bool isContiguous() const { return _stride == sizeof(T); }
+
+        /** @brief Item at given position */
+        T& operator[](std::size_t i) const {
+            return *reinterpret_cast<T*>(reinterpret_cast<typename std::conditional<std::is_const<T>::value, const char, char>::type*>(_data) + i*_stride);
+        }
+
+    private:
+        T* _data;
+        std::size_t _size;
+        std::size_t _stride;
+};
+
+namespace Implementation {
+    /* Splits [0, count) into at most threadCount contiguous ranges with
+       sizes divisible by granularity and calls function(state, index, begin,
+       end) for each. The ranges are distributed to shared worker pool,
+       without MAGNUM_BUILD_THREADS or if only one range is needed the
+       function is called on the calling thread. */
+    MAGNUM_EXPORT void parallelRanges(std::size_t count, std::size_t granularity, std::size_t threadCount, void(*function)(void*, std::size_t, std::size_t, std::size_t), void* state);
+
+    /* Convenience overload calling function(index, begin, end) */
+    template<class F> void parallelRanges(const std::size_t count, const std::size_t granularity, const std::size_t threadCount, F function) {
+        parallelRanges(count, granularity, threadCount, [](void* state, std::size_t index, std::size_t begin, std::size_t end) {
+            (*static_cast<F*>(state))(index, begin, end);
+        }, &function);
+    }
+
+    template<class T> void transformPoints(const Matrix3<T>& matrix, StridedArrayReference<const Vector2<T>> points, StridedArrayReference<Vector2<T>> out) {
+        for(std::size_t i = 0; i != points.size(); ++i)
+            out[i] = matrix.transformPoint(points[i]);
+    }
+
+    template<class T> void transformPoints(const Matrix4<T>& matrix, StridedArrayReference<const Vector3<T>> points, StridedArrayReference<Vector3<T>> out) {
+        for(std::size_t i = 0; i != points.size(); ++i)
+            out[i] = matrix.transformPoint(points[i]);
+    }
+
+    template<class T> void transformVectors(const Matrix3<T>& matrix, StridedArrayReference<const Vector2<T>> vectors, StridedArrayReference<Vector2<T>> out) {
+        for(std::size_t i = 0; i != vectors.size(); ++i)
+            out[i] = matrix.transformVector(vectors[i]);
+    }
+
+    template<class T> void transformVectors(const Matrix4<T>& matrix, StridedArrayReference<const Vector3<T>> vectors, StridedArrayReference<Vector3<T>> out) {
+        for(std::size_t i = 0; i != vectors.size(); ++i)
+            out[i] = matrix.transformVector(vectors[i]);
+    }
+
+    /* Expanded qvq^*, needs two cross products instead of two quaternion
+       multiplications */
+    template<class T> void transformVectors(const Quaternion<T>& normalizedQuaternion, StridedArrayReference<const Vector3<T>> vectors, StridedArrayReference<Vector3<T>> out) {
+        const Vector3<T> q = normalizedQuaternion.vector();
+        const T w = normalizedQuaternion.scalar();
+        for(std::size_t i = 0; i != vectors.size(); ++i) {
+            const Vector3<T> t = T(2)*Vector3<T>::cross(q, vectors[i]);
+            out[i] = vectors[i] + w*t + Vector3<T>::cross(q, t);
+        }
+    }
+
+    template<class T> void normalize(StridedArrayReference<const T> vectors, StridedArrayReference<T> out) {
+        for(std::size_t i = 0; i != vectors.size(); ++i)
+            out[i] = vectors[i].normalized();
+    }
+
+    #if defined(MAGNUM_TARGET_SSE2) && !defined(DOXYGEN_GENERATING_OUTPUT)
+    /* Matrix columns are kept in registers for the whole array */
+    template<Int w> inline void transformPointsSse(const Matrix4<Float>& matrix, StridedArrayReference<const Vector3<Float>> points, StridedArrayReference<Vector3<Float>> out) {
+        const __m128 a = _mm_loadu_ps(matrix[0].data());
+        const __m128 b = _mm_loadu_ps(matrix[1].data());
+        const __m128 c = _mm_loadu_ps(matrix[2].data());
+        const __m128 d = w ? _mm_loadu_ps(matrix[3].data()) : _mm_setzero_ps();
+        for(std::size_t i = 0; i != points.size(); ++i) {
+            const Vector3<Float>& point = points[i];
+            const __m128 result = _mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(a, _mm_set1_ps(point.x())),
+                _mm_mul_ps(b, _mm_set1_ps(point.y()))), _mm_add_ps(
+                _mm_mul_ps(c, _mm_set1_ps(point.z())), d));
+            Float data[4];
+            _mm_storeu_ps(data, result);
+            out[i] = {data[0], data[1], data[2]};
+        }
+    }
+
+    template<> inline void transformPoints(const Matrix4<Float>& matrix, StridedArrayReference<const Vector3<Float>> points, StridedArrayReference<Vector3<Float>> out) {
+        transformPointsSse<1>(matrix, points, out);
+    }
+
+    template<> inline void transformVectors(const Matrix4<Float>& matrix, StridedArrayReference<const Vector3<Float>> vectors, StridedArrayReference<Vector3<Float>> out) {
+        transformPointsSse<0>(matrix, vectors, out);
+    }
+
+    /* Four vectors at once, transposed to have one component in a register */
+    template<> inline void normalize(StridedArrayReference<const Vector3<Float>> vectors, StridedArrayReference<Vector3<Float>> out) {
+        std::size_t i = 0;
+        for(; i + 4 <= vectors.size(); i += 4) {
+            const Vector3<Float>& a = vectors[i];
+            const Vector3<Float>& b = vectors[i + 1];
+            const Vector3<Float>& c = vectors[i + 2];
+            const Vector3<Float>& d = vectors[i + 3];
+            __m128 x = _mm_setr_ps(a.x(), b.x(), c.x(), d.x());
+            __m128 y = _mm_setr_ps(a.y(), b.y(), c.y(), d.y());
+            __m128 z = _mm_setr_ps(a.z(), b.z(), c.z(), d.z());
+            const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+            x = _mm_div_ps(x, length);
+            y = _mm_div_ps(y, length);
+            z = _mm_div_ps(z, length);
+
+            Float xs[4], ys[4], zs[4];
+            _mm_storeu_ps(xs, x);
+            _mm_storeu_ps(ys, y);
+            _mm_storeu_ps(zs, z);
+            for(std::size_t j = 0; j != 4; ++j)
+                out[i + j] = {xs[j], ys[j], zs[j]};
+        }
+
+        for(; i != vectors.size(); ++i)
+            out[i] = vectors[i].normalized();
+    }
+    #endif
+}
+
+/**
+@brief Transform points in-place
+
+Equivalent to calling @ref Matrix3::transformPoint() on all items of the array,
+but the matrix is prepared only once for the whole array.
+@see transformPoints(), transformVectorsInPlace(),
+    @ref MeshTools::transformPointsInPlace()
+*/
+template<class T> inline void transformPointsInPlace(const Matrix3<T>& matrix, StridedArrayReference<Vector2<T>> points) {
+    Implementation::transformPoints<T>(matrix, points, points);
+}
+
+/** @overload */
+template<class T> inline void transformPointsInPlace(const Matrix4<T>& matrix, StridedArrayReference<Vector3<T>> points) {
+    Implementation::transformPoints<T>(matrix, points, points);
+}
+
+/**
+@brief Transform points
+
+Transformed points are saved into @p out, which is expected to have the same
+size as @p points. See transformPointsInPlace() for more information.
+*/
+template<class T> inline void transformPoints(const Matrix3<T>& matrix, StridedArrayReference<const Vector2<T>> points, StridedArrayReference<Vector2<T>> out) {
+    CORRADE_ASSERT(points.size() == out.size(), "Math::Batch::transformPoints(): expected output of size" << points.size() << "but got" << out.size(), );
+    Implementation::transformPoints<T>(matrix, points, out);
+}
+
+/** @overload */
+template<class T> inline void transformPoints(const Matrix4<T>& matrix, StridedArrayReference<const Vector3<T>> points, StridedArrayReference<Vector3<T>> out) {
+    CORRADE_ASSERT(points.size() == out.size(), "Math::Batch::transformPoints(): expected output of size" << points.size() << "but got" << out.size(), );
+    Implementation::transformPoints<T>(matrix, points, out);
+}
+
+/**
+@brief Transform vectors in-place
+
+Equivalent to calling @ref Matrix3::transformVector() or
+@ref Quaternion::transformVectorNormalized() on all items of the array. The
+quaternion is expected to be normalized, rotation with it is done using two
+cross products instead of two quaternion multiplications.
+@see transformVectors(), transformPointsInPlace(),
+    @ref MeshTools::transformVectorsInPlace()
+*/
+template<class T> inline void transformVectorsInPlace(const Matrix3<T>& matrix, StridedArrayReference<Vector2<T>> vectors) {
+    Implementation::transformVectors<T>(matrix, vectors, vectors);
+}
+
+/** @overload */
+template<class T> inline void transformVectorsInPlace(const Matrix4<T>& matrix, StridedArrayReference<Vector3<T>> vectors) {
+    Implementation::transformVectors<T>(matrix, vectors, vectors);
+}
+
+/** @overload */
+template<class T> inline void transformVectorsInPlace(const Quaternion<T>& normalizedQuaternion, StridedArrayReference<Vector3<T>> vectors) {
+    CORRADE_ASSERT(normalizedQuaternion.isNormalized(),
+        "Math::Batch::transformVectorsInPlace(): quaternion must be normalized", );
+    Implementation::transformVectors<T>(normalizedQuaternion, vectors, vectors);
+}
+
+/**
+@brief Transform vectors
+
+Transformed vectors are saved into @p out, which is expected to have the same
+size as @p vectors. See transformVectorsInPlace() for more information.
+*/
+template<class T> inline void transformVectors(const Matrix3<T>& matrix, StridedArrayReference<const Vector2<T>> vectors, StridedArrayReference<Vector2<T>> out) {
+    CORRADE_ASSERT(vectors.size() == out.size(), "Math::Batch::transformVectors(): expected output of size" << vectors.size() << "but got" << out.size(), );
+    Implementation::transformVectors<T>(matrix, vectors, out);
+}
+
+/** @overload */
+template<class T> inline void transformVectors(const Matrix4<T>& matrix, StridedArrayReference<const Vector3<T>> vectors, StridedArrayReference<Vector3<T>> out) {
+    CORRADE_ASSERT(vectors.size() == out.size(), "Math::Batch::transformVectors(): expected output of size" << vectors.size() << "but got" << out.size(), );
+    Implementation::transformVectors<T>(matrix, vectors, out);
+}
+
+/** @overload */
+template<class T> inline void transformVectors(const Quaternion<T>& normalizedQuaternion, StridedArrayReference<const Vector3<T>> vectors, StridedArrayReference<Vector3<T>> out) {
+    CORRADE_ASSERT(vectors.size() == out.size(), "Math::Batch::transformVectors(): expected output of size" << vectors.size() << "but got" << out.size(), );
+    CORRADE_ASSERT(normalizedQuaternion.isNormalized(),
+        "Math::Batch::transformVectors(): quaternion must be normalized", );
+    Implementation::transformVectors<T>(normalizedQuaternion, vectors, out);
+}
+
+/**
+@brief Translate points in-place
+
+Adds @p offset to all items of the array.
+*/
+template<class T> inline void translateInPlace(const T& offset, StridedArrayReference<T> points) {
+    for(std::size_t i = 0; i != points.size(); ++i)
+        points[i] += offset;
+}
+
+/**
+@brief Normalize vectors in-place
+
+Equivalent to calling @ref Vector::normalized() on all items of the array.
+As the vector type can't be deduced from brace-initialized array, it must be
+specified explicitly:
+@code
+std::vector<Vector3> normals;
+Math::Batch::normalizeInPlace<Vector3>({normals.data(), normals.size()});
+@endcode
+@see normalize()
+*/
+template<class T> inline void normalizeInPlace(StridedArrayReference<T> vectors) {
+    Implementation::normalize<T>(vectors, vectors);
+}
+
+/**
+@brief Normalize vectors
+
+Normalized vectors are saved into @p out, which is expected to have the same
+size as @p vectors. See normalizeInPlace() for more information.
+*/
+template<class T> inline void normalize(StridedArrayReference<const T> vectors, StridedArrayReference<T> out) {
+    CORRADE_ASSERT(vectors.size() == out.size(), "Math::Batch::normalize(): expected output of size" << vectors.size() << "but got" << out.size(), );
+    Implementation::normalize<T>(vectors, out);
+}
+
+/**
+@brief Dot products of vector pairs
+
+Saves dot product of each pair of items in @p a and @p b into @p out. All
+arrays are expected to have the same size.
+@see Vector::dot()
+*/
+template<class T> void dot(StridedArrayReference<const T> a, StridedArrayReference<const T> b, StridedArrayReference<typename T::Type> out) {
+    CORRADE_ASSERT(a.size() == b.size() && a.size() == out.size(), "Math::Batch::dot(): expected arrays of the same size", );
+    for(std::size_t i = 0; i != a.size(); ++i)
+        out[i] = T::dot(a[i], b[i]);
+}
+
+/**
+@brief Cross products of three-component vector pairs
+
+Saves cross product of each pair of items in @p a and @p b into @p out. All
+arrays are expected to have the same size.
+@see Vector3::cross()
+*/
+template<class T> void cross(StridedArrayReference<const Vector3<T>> a, StridedArrayReference<const Vector3<T>> b, StridedArrayReference<Vector3<T>> out) {
+    CORRADE_ASSERT(a.size() == b.size() && a.size() == out.size(), "Math::Batch::cross(): expected arrays of the same size", );
+    for(std::size_t i = 0; i != a.size(); ++i)
+        out[i] = Vector3<T>::cross(a[i], b[i]);
+}
+
+/**
+@brief Component-wise minimum and maximum of all vectors
+
+Returns pair of vectors with minimal and maximal values of each component,
+i.e. axis-aligned bounds of given points. Expects that the array is not empty.
+@see Math::min(), Math::max()
+*/
+template<class T> std::pair<T, T> minmax(StridedArrayReference<const T> vectors) {
+    CORRADE_ASSERT(!vectors.empty(), "Math::Batch::minmax(): the array is empty", {});
+    T min = vectors[0], max = vectors[0];
+    for(std::size_t i = 1; i < vectors.size(); ++i) {
+        min = Math::min(min, vectors[i]);
+        max = Math::max(max, vectors[i]);
+    }
+    return {min, max};
+}
+
+}}}
+
+#endif
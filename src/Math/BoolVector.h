@@ -117,7 +117,8 @@ template<std::size_t size> class BoolVector {
 
         /** @brief Set bit at given position */
         BoolVector<size>& set(std::size_t i, bool value) {
-            _data[i/8] |= ((value & 0x01) << i%8);
+            if(value) _data[i/8] |= (1 << i%8);
+            else _data[i/8] &= ~(1 << i%8);
             return *this;
         }
 
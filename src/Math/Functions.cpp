@@ -26,6 +26,208 @@
 
 namespace Magnum { namespace Math {
 
+#ifdef MAGNUM_TARGET_SSE2
+namespace {
+
+/* Loading of integers widened to four 32-bit integers per register and
+   storing of 32-bit integers narrowed back with saturation */
+template<class> struct Packing;
+template<> struct Packing<UnsignedByte> {
+    enum: std::size_t { Count = 16 };
+
+    static void load(const UnsignedByte* data, __m128i* out) {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        const __m128i lo = _mm_unpacklo_epi8(v, zero);
+        const __m128i hi = _mm_unpackhi_epi8(v, zero);
+        out[0] = _mm_unpacklo_epi16(lo, zero);
+        out[1] = _mm_unpackhi_epi16(lo, zero);
+        out[2] = _mm_unpacklo_epi16(hi, zero);
+        out[3] = _mm_unpackhi_epi16(hi, zero);
+    }
+
+    static void store(const __m128i* values, UnsignedByte* data) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data), _mm_packus_epi16(
+            _mm_packs_epi32(values[0], values[1]),
+            _mm_packs_epi32(values[2], values[3])));
+    }
+};
+template<> struct Packing<Byte> {
+    enum: std::size_t { Count = 16 };
+
+    /* Sign extension by duplicating the value into upper half and shifting
+       it back */
+    static void load(const Byte* data, __m128i* out) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        const __m128i lo = _mm_unpacklo_epi8(v, v);
+        const __m128i hi = _mm_unpackhi_epi8(v, v);
+        out[0] = _mm_srai_epi32(_mm_unpacklo_epi16(lo, lo), 24);
+        out[1] = _mm_srai_epi32(_mm_unpackhi_epi16(lo, lo), 24);
+        out[2] = _mm_srai_epi32(_mm_unpacklo_epi16(hi, hi), 24);
+        out[3] = _mm_srai_epi32(_mm_unpackhi_epi16(hi, hi), 24);
+    }
+
+    static void store(const __m128i* values, Byte* data) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data), _mm_packs_epi16(
+            _mm_packs_epi32(values[0], values[1]),
+            _mm_packs_epi32(values[2], values[3])));
+    }
+};
+template<> struct Packing<UnsignedShort> {
+    enum: std::size_t { Count = 8 };
+
+    static void load(const UnsignedShort* data, __m128i* out) {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        out[0] = _mm_unpacklo_epi16(v, zero);
+        out[1] = _mm_unpackhi_epi16(v, zero);
+    }
+
+    /* SSE2 has only signed 32-bit packing, so the values are shifted to
+       signed range and back */
+    static void store(const __m128i* values, UnsignedShort* data) {
+        const __m128i offset = _mm_set1_epi32(32768);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data), _mm_xor_si128(
+            _mm_packs_epi32(_mm_sub_epi32(values[0], offset), _mm_sub_epi32(values[1], offset)),
+            _mm_set1_epi16(Short(0x8000))));
+    }
+};
+template<> struct Packing<Short> {
+    enum: std::size_t { Count = 8 };
+
+    static void load(const Short* data, __m128i* out) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        out[0] = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+        out[1] = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+    }
+
+    static void store(const __m128i* values, Short* data) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data), _mm_packs_epi32(values[0], values[1]));
+    }
+};
+
+/* Division instead of multiplication by reciprocal to be bit-exact with the
+   scalar version */
+template<class Integral> void normalizeSse(Corrade::Containers::ArrayReference<const Integral> values, Corrade::Containers::ArrayReference<Float> out) {
+    CORRADE_ASSERT(values.size() == out.size(), "Math::normalize(): expected output of size" << values.size() << "but got" << out.size(), );
+
+    const __m128 max = _mm_set1_ps(Float(std::numeric_limits<Integral>::max()));
+    const __m128 min = _mm_set1_ps(std::is_signed<Integral>::value ? -1.0f : 0.0f);
+    std::size_t i = 0;
+    for(; i + Packing<Integral>::Count <= values.size(); i += Packing<Integral>::Count) {
+        __m128i v[Packing<Integral>::Count/4];
+        Packing<Integral>::load(values.data() + i, v);
+        for(std::size_t j = 0; j != Packing<Integral>::Count/4; ++j)
+            _mm_storeu_ps(out.data() + i + j*4, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(v[j]), max), min));
+    }
+
+    for(; i != values.size(); ++i)
+        out[i] = normalize<Float, Integral>(values[i]);
+}
+
+/* Values are clamped to normalized range first and then truncated, as in the
+   scalar version */
+template<class Integral> void denormalizeSse(Corrade::Containers::ArrayReference<const Float> values, Corrade::Containers::ArrayReference<Integral> out) {
+    CORRADE_ASSERT(values.size() == out.size(), "Math::denormalize(): expected output of size" << values.size() << "but got" << out.size(), );
+
+    const __m128 max = _mm_set1_ps(Float(std::numeric_limits<Integral>::max()));
+    const __m128 min = _mm_set1_ps(std::is_signed<Integral>::value ? -1.0f : 0.0f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    std::size_t i = 0;
+    for(; i + Packing<Integral>::Count <= values.size(); i += Packing<Integral>::Count) {
+        __m128i v[Packing<Integral>::Count/4];
+        for(std::size_t j = 0; j != Packing<Integral>::Count/4; ++j) {
+            const __m128 clamped = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(values.data() + i + j*4), min), one);
+            v[j] = _mm_cvttps_epi32(_mm_mul_ps(clamped, max));
+        }
+        Packing<Integral>::store(v, out.data() + i);
+    }
+
+    for(; i != values.size(); ++i)
+        out[i] = denormalize<Integral, Float>(Math::clamp(values[i], std::is_signed<Integral>::value ? -1.0f : 0.0f, 1.0f));
+}
+
+}
+#endif
+
+namespace {
+
+/* Cephes single-precision sine and cosine. The angle is reduced to
+   [-pi/4, pi/4] around nearest even multiple of pi/4 ("octant") using
+   pi/4 split into three parts for extra precision, octant then determines
+   which polynomial is used and the sign. */
+constexpr Float FourOverPi = 1.27323954473516f;
+constexpr Float PiOverFourA = 0.78515625f;
+constexpr Float PiOverFourB = 2.4187564849853515625e-4f;
+constexpr Float PiOverFourC = 3.77489497744594108e-8f;
+constexpr Float SinCoefficients[]{-1.9515295891e-4f, 8.3321608736e-3f, -1.6666654611e-1f};
+constexpr Float CosCoefficients[]{2.443315711809948e-5f, -1.388731625493765e-3f, 4.166664568298827e-2f};
+
+void sincos(const Float angle, Float& sine, Float& cosine) {
+    const Float x = std::abs(angle);
+    const Int octant = (Int(x*FourOverPi) + 1) & ~1;
+    const Float y = Float(octant);
+    const Float r = ((x - y*PiOverFourA) - y*PiOverFourB) - y*PiOverFourC;
+    const Float z = r*r;
+
+    const Float polySin = ((SinCoefficients[0]*z + SinCoefficients[1])*z + SinCoefficients[2])*z*r + r;
+    const Float polyCos = ((CosCoefficients[0]*z + CosCoefficients[1])*z + CosCoefficients[2])*z*z - 0.5f*z + 1.0f;
+
+    const bool swap = octant & 2;
+    sine = swap ? polyCos : polySin;
+    cosine = swap ? polySin : polyCos;
+    if(bool(octant & 4) != (angle < 0.0f)) sine = -sine;
+    if((octant + 2) & 4) cosine = -cosine;
+}
+
+#ifdef MAGNUM_TARGET_SSE2
+/* The same as above, sign changes are done by flipping the sign bit */
+void sincos(const __m128 angle, __m128& sine, __m128& cosine) {
+    const __m128 signBit = _mm_set1_ps(-0.0f);
+    const __m128 x = _mm_andnot_ps(signBit, angle);
+    const __m128i octant = _mm_and_si128(_mm_add_epi32(_mm_cvttps_epi32(_mm_mul_ps(x, _mm_set1_ps(FourOverPi))), _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+    const __m128 y = _mm_cvtepi32_ps(octant);
+    const __m128 r = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(x,
+        _mm_mul_ps(y, _mm_set1_ps(PiOverFourA))),
+        _mm_mul_ps(y, _mm_set1_ps(PiOverFourB))),
+        _mm_mul_ps(y, _mm_set1_ps(PiOverFourC)));
+    const __m128 z = _mm_mul_ps(r, r);
+
+    const __m128 polySin = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(
+        _mm_mul_ps(_mm_set1_ps(SinCoefficients[0]), z), _mm_set1_ps(SinCoefficients[1])), z), _mm_set1_ps(SinCoefficients[2])), z), r), r);
+    const __m128 polyCos = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(
+        _mm_mul_ps(_mm_set1_ps(CosCoefficients[0]), z), _mm_set1_ps(CosCoefficients[1])), z), _mm_set1_ps(CosCoefficients[2])), z), z),
+        _mm_mul_ps(_mm_set1_ps(0.5f), z)), _mm_set1_ps(1.0f));
+
+    const __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(octant, _mm_set1_epi32(2)), _mm_set1_epi32(2)));
+    const __m128 sineSign = _mm_xor_ps(_mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(octant, _mm_set1_epi32(4)), 29)), _mm_and_ps(angle, signBit));
+    const __m128 cosineSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(octant, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));
+    sine = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, polyCos), _mm_andnot_ps(swap, polySin)), sineSign);
+    cosine = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, polySin), _mm_andnot_ps(swap, polyCos)), cosineSign);
+}
+#endif
+
+}
+
+void sincos(Corrade::Containers::ArrayReference<const Rad<Float>> angles, Corrade::Containers::ArrayReference<Float> sines, Corrade::Containers::ArrayReference<Float> cosines) {
+    CORRADE_ASSERT(angles.size() == sines.size() && angles.size() == cosines.size(),
+        "Math::sincos(): expected outputs of size" << angles.size() << "but got" << sines.size() << "and" << cosines.size(), );
+    static_assert(sizeof(Rad<Float>) == sizeof(Float), "Improper size of Rad");
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_TARGET_SSE2
+    for(; i + 4 <= angles.size(); i += 4) {
+        __m128 sine, cosine;
+        sincos(_mm_loadu_ps(reinterpret_cast<const Float*>(angles.data() + i)), sine, cosine);
+        _mm_storeu_ps(sines.data() + i, sine);
+        _mm_storeu_ps(cosines.data() + i, cosine);
+    }
+    #endif
+
+    for(; i != angles.size(); ++i)
+        sincos(Float(angles[i]), sines[i], cosines[i]);
+}
+
 UnsignedInt log2(UnsignedInt number) {
     UnsignedInt log = 0;
     while(number >>= 1)
@@ -40,4 +242,38 @@ UnsignedInt log(UnsignedInt base, UnsignedInt number) {
     return log;
 }
 
+#ifdef MAGNUM_TARGET_SSE2
+template<> void normalize<Float, UnsignedByte>(Corrade::Containers::ArrayReference<const UnsignedByte> values, Corrade::Containers::ArrayReference<Float> out) {
+    normalizeSse(values, out);
+}
+
+template<> void normalize<Float, Byte>(Corrade::Containers::ArrayReference<const Byte> values, Corrade::Containers::ArrayReference<Float> out) {
+    normalizeSse(values, out);
+}
+
+template<> void normalize<Float, UnsignedShort>(Corrade::Containers::ArrayReference<const UnsignedShort> values, Corrade::Containers::ArrayReference<Float> out) {
+    normalizeSse(values, out);
+}
+
+template<> void normalize<Float, Short>(Corrade::Containers::ArrayReference<const Short> values, Corrade::Containers::ArrayReference<Float> out) {
+    normalizeSse(values, out);
+}
+
+template<> void denormalize<UnsignedByte, Float>(Corrade::Containers::ArrayReference<const Float> values, Corrade::Containers::ArrayReference<UnsignedByte> out) {
+    denormalizeSse(values, out);
+}
+
+template<> void denormalize<Byte, Float>(Corrade::Containers::ArrayReference<const Float> values, Corrade::Containers::ArrayReference<Byte> out) {
+    denormalizeSse(values, out);
+}
+
+template<> void denormalize<UnsignedShort, Float>(Corrade::Containers::ArrayReference<const Float> values, Corrade::Containers::ArrayReference<UnsignedShort> out) {
+    denormalizeSse(values, out);
+}
+
+template<> void denormalize<Short, Float>(Corrade::Containers::ArrayReference<const Float> values, Corrade::Containers::ArrayReference<Short> out) {
+    denormalizeSse(values, out);
+}
+#endif
+
 }}
@@ -27,6 +27,7 @@
 #include <cmath>
 #include <type_traits>
 #include <limits>
+#include <Containers/Array.h>
 
 #include "Math/Vector.h"
 
@@ -291,6 +292,30 @@ template<std::size_t size, class T> Vector<size, T> sqrtInverted(const Vector<si
 }
 #endif
 
+/**
+@brief Approximate inverse square root
+
+Faster alternative to @ref sqrtInverted(). If `TARGET_SSE2` is enabled,
+@ref Magnum::Float "Float" values are estimated using `rsqrtss` instruction
+and refined with one Newton-Raphson step, the relative error is at most
+@f$ 5 \cdot 10^{-7} @f$ for all positive normal numbers. Other types (and
+everything if `TARGET_SSE2` is not enabled) are computed precisely.
+@see @ref Vector::lengthInvertedFast(), @ref Vector::normalizedFast()
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> inline T sqrtInvertedFast(const T& a);
+#else
+template<class T> inline typename std::enable_if<std::is_arithmetic<T>::value, T>::type sqrtInvertedFast(T a) {
+    return Implementation::sqrtInvertedFast(a);
+}
+template<std::size_t size, class T> Vector<size, T> sqrtInvertedFast(const Vector<size, T>& a) {
+    Vector<size, T> out;
+    for(std::size_t i = 0; i != size; ++i)
+        out[i] = Implementation::sqrtInvertedFast(a[i]);
+    return out;
+}
+#endif
+
 /**
 @brief Clamp value
 
@@ -460,6 +485,82 @@ template<class Integral, class FloatingPoint> inline typename std::enable_if<std
 }
 #endif
 
+/**
+@brief Normalize array of integral values
+
+Converts all values in @p values using @ref normalize(), saving the result
+into @p out, which is expected to have the same size. Vector data can be
+converted by passing pointer to first component and total component count.
+Both template parameters must be specified explicitly:
+@code
+std::vector<Math::Vector3<UnsignedByte>> colors;
+std::vector<Color3> out(colors.size());
+Math::normalize<Float, UnsignedByte>({colors[0].data(), colors.size()*3}, {out[0].data(), out.size()*3});
+@endcode
+
+If `TARGET_SSE2` is enabled, conversion of 8- and 16-bit types to
+@ref Magnum::Float "Float" is done with SSE2 intrinsics, with bit-exact result
+to the scalar version.
+@see @ref denormalize(Corrade::Containers::ArrayReference<const FloatingPoint>, Corrade::Containers::ArrayReference<Integral>)
+*/
+template<class FloatingPoint, class Integral> void normalize(Corrade::Containers::ArrayReference<const Integral> values, Corrade::Containers::ArrayReference<FloatingPoint> out) {
+    CORRADE_ASSERT(values.size() == out.size(), "Math::normalize(): expected output of size" << values.size() << "but got" << out.size(), );
+    for(std::size_t i = 0; i != values.size(); ++i)
+        out[i] = normalize<FloatingPoint, Integral>(values[i]);
+}
+
+/**
+@brief Denormalize array of floating-point values
+
+Converts all values in @p values using @ref denormalize(), saving the result
+into @p out, which is expected to have the same size. Vector data can be
+converted by passing pointer to first component and total component count.
+Both template parameters must be specified explicitly:
+@code
+std::vector<Vector3> normals;
+std::vector<Math::Vector3<Short>> out(normals.size());
+Math::denormalize<Short, Float>({normals[0].data(), normals.size()*3}, {out[0].data(), out.size()*3});
+@endcode
+
+If `TARGET_SSE2` is enabled, conversion of @ref Magnum::Float "Float" to 8-
+and 16-bit types is done with SSE2 intrinsics. Values in the normalized range
+are converted with bit-exact result to the scalar version, values outside of
+it are saturated.
+@see @ref normalize(Corrade::Containers::ArrayReference<const Integral>, Corrade::Containers::ArrayReference<FloatingPoint>)
+*/
+template<class Integral, class FloatingPoint> void denormalize(Corrade::Containers::ArrayReference<const FloatingPoint> values, Corrade::Containers::ArrayReference<Integral> out) {
+    CORRADE_ASSERT(values.size() == out.size(), "Math::denormalize(): expected output of size" << values.size() << "but got" << out.size(), );
+    for(std::size_t i = 0; i != values.size(); ++i)
+        out[i] = denormalize<Integral, FloatingPoint>(values[i]);
+}
+
+/**
+@brief Sine and cosine of array of angles
+@param angles       Angles
+@param sines        Where to put sines of the angles
+@param cosines      Where to put cosines of the angles
+
+Faster alternative to calling @ref sin() and @ref cos() on each value, both
+output arrays are expected to have the same size as @p angles. The values are
+computed using polynomial approximation after reducing the angle to
+@f$ [-\frac{\pi}{4}, \frac{\pi}{4}] @f$, the absolute error is at most
+@f$ 2 \cdot 10^{-7} @f$ for angles in range @f$ [-8192, 8192] @f$. Precision
+of larger angles degrades. If `TARGET_SSE2` is enabled, four angles are
+computed at once using SSE2 intrinsics, with equal result.
+*/
+void MAGNUM_EXPORT sincos(Corrade::Containers::ArrayReference<const Rad<Float>> angles, Corrade::Containers::ArrayReference<Float> sines, Corrade::Containers::ArrayReference<Float> cosines);
+
+#if defined(MAGNUM_TARGET_SSE2) && !defined(DOXYGEN_GENERATING_OUTPUT)
+template<> void MAGNUM_EXPORT normalize<Float, UnsignedByte>(Corrade::Containers::ArrayReference<const UnsignedByte>, Corrade::Containers::ArrayReference<Float>);
+template<> void MAGNUM_EXPORT normalize<Float, Byte>(Corrade::Containers::ArrayReference<const Byte>, Corrade::Containers::ArrayReference<Float>);
+template<> void MAGNUM_EXPORT normalize<Float, UnsignedShort>(Corrade::Containers::ArrayReference<const UnsignedShort>, Corrade::Containers::ArrayReference<Float>);
+template<> void MAGNUM_EXPORT normalize<Float, Short>(Corrade::Containers::ArrayReference<const Short>, Corrade::Containers::ArrayReference<Float>);
+template<> void MAGNUM_EXPORT denormalize<UnsignedByte, Float>(Corrade::Containers::ArrayReference<const Float>, Corrade::Containers::ArrayReference<UnsignedByte>);
+template<> void MAGNUM_EXPORT denormalize<Byte, Float>(Corrade::Containers::ArrayReference<const Float>, Corrade::Containers::ArrayReference<Byte>);
+template<> void MAGNUM_EXPORT denormalize<UnsignedShort, Float>(Corrade::Containers::ArrayReference<const Float>, Corrade::Containers::ArrayReference<UnsignedShort>);
+template<> void MAGNUM_EXPORT denormalize<Short, Float>(Corrade::Containers::ArrayReference<const Float>, Corrade::Containers::ArrayReference<Short>);
+#endif
+
 /*@}*/
 
 }}
@@ -0,0 +1,154 @@
+#ifndef Magnum_Math_Geometry_Frustum_h
+#define Magnum_Math_Geometry_Frustum_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::Math::Geometry::Frustum
+ */
+
+#include <cstddef>
+#include <Utility/Debug.h>
+
+#include "Math/Matrix4.h"
+
+namespace Magnum { namespace Math { namespace Geometry {
+
+/**
+@brief Camera frustum
+
+Six planes stored as @ref Vector4 with plane normal in first three components
+and distance from origin in the last component. The normals point inside, i.e.
+point **p** is inside the frustum if @f$ \boldsymbol n \cdot \boldsymbol p + d \ge 0 @f$
+for all planes. Used for culling with @ref Intersection::sphereFrustum() and
+@ref Intersection::axisAlignedBoxFrustum().
+@see Magnum::Frustum, Magnum::Frustumd
+*/
+template<class T> class Frustum {
+    public:
+        /**
+         * @brief Create frustum from projection matrix
+         *
+         * Extracts the planes from (combined projection and camera)
+         * @p matrix and normalizes them, so distances of points from the
+         * planes are in world units. The extracted frustum is in the space
+         * the matrix transforms from, e.g. in camera space for projection
+         * matrix or in world space for projection matrix multiplied by
+         * camera matrix.
+         */
+        static Frustum<T> fromMatrix(const Matrix4<T>& matrix) {
+            const Vector4<T> x = matrix.row(0);
+            const Vector4<T> y = matrix.row(1);
+            const Vector4<T> z = matrix.row(2);
+            const Vector4<T> w = matrix.row(3);
+            return {normalized(w + x), normalized(w - x),
+                    normalized(w + y), normalized(w - y),
+                    normalized(w + z), normalized(w - z)};
+        }
+
+        /**
+         * @brief Default constructor
+         *
+         * Creates frustum of identity projection matrix, i.e. cube from
+         * @f$ [-1, -1, -1] @f$ to @f$ [1, 1, 1] @f$.
+         */
+        constexpr /*implicit*/ Frustum(): _data{{T(1), T(0), T(0), T(1)},
+                                               {T(-1), T(0), T(0), T(1)},
+                                               {T(0), T(1), T(0), T(1)},
+                                               {T(0), T(-1), T(0), T(1)},
+                                               {T(0), T(0), T(1), T(1)},
+                                               {T(0), T(0), T(-1), T(1)}} {}
+
+        /** @brief Construct frustum from six planes */
+        constexpr /*implicit*/ Frustum(const Vector4<T>& left, const Vector4<T>& right, const Vector4<T>& bottom, const Vector4<T>& top, const Vector4<T>& near, const Vector4<T>& far): _data{left, right, bottom, top, near, far} {}
+
+        /** @brief Equality comparison */
+        bool operator==(const Frustum<T>& other) const {
+            for(std::size_t i = 0; i != 6; ++i)
+                if(_data[i] != other._data[i]) return false;
+            return true;
+        }
+
+        /** @brief Non-equality comparison */
+        bool operator!=(const Frustum<T>& other) const {
+            return !operator==(other);
+        }
+
+        /**
+         * @brief Plane at given position
+         *
+         * Planes are in order left, right, bottom, top, near, far.
+         */
+        constexpr Vector4<T> operator[](std::size_t i) const { return _data[i]; }
+
+        /**
+         * @brief Raw data
+         * @return Array of six planes
+         */
+        const Vector4<T>* data() const { return _data; }
+
+        /** @brief Left plane */
+        constexpr Vector4<T> left() const { return _data[0]; }
+
+        /** @brief Right plane */
+        constexpr Vector4<T> right() const { return _data[1]; }
+
+        /** @brief Bottom plane */
+        constexpr Vector4<T> bottom() const { return _data[2]; }
+
+        /** @brief Top plane */
+        constexpr Vector4<T> top() const { return _data[3]; }
+
+        /** @brief Near plane */
+        constexpr Vector4<T> near() const { return _data[4]; }
+
+        /** @brief Far plane */
+        constexpr Vector4<T> far() const { return _data[5]; }
+
+    private:
+        /* Normalizes plane so its normal has unit length */
+        static Vector4<T> normalized(const Vector4<T>& plane) {
+            return plane/plane.xyz().length();
+        }
+
+        Vector4<T> _data[6];
+};
+
+/** @debugoperator{Magnum::Math::Geometry::Frustum} */
+template<class T> Corrade::Utility::Debug operator<<(Corrade::Utility::Debug debug, const Frustum<T>& value) {
+    debug << "Frustum(";
+    debug.setFlag(Corrade::Utility::Debug::SpaceAfterEachValue, false);
+    for(std::size_t i = 0; i != 6; ++i) {
+        if(i != 0) debug << ", ";
+        debug << value[i];
+        debug.setFlag(Corrade::Utility::Debug::SpaceAfterEachValue, false);
+    }
+    debug << ")";
+    debug.setFlag(Corrade::Utility::Debug::SpaceAfterEachValue, true);
+    return debug;
+}
+
+}}}
+
+#endif
@@ -28,11 +28,35 @@
  * @brief Class Magnum::Math::Geometry::Intersection
  */
 
+#include <limits>
+
+#include "Math/Functions.h"
 #include "Math/Vector3.h"
+#include "Math/Geometry/Frustum.h"
 
 namespace Magnum { namespace Math { namespace Geometry {
 
-/** @brief Functions for computing intersections */
+/**
+@brief Functions for computing intersections
+
+@section Intersection-batch Batch variants
+
+Ray, sphere and box tests have also variant testing multiple primitives at
+once, which is useful e.g. for culling and picking of many objects. The
+primitives are passed in structure-of-arrays layout, i.e. each component of
+@ref Vector3 contains given component of all the primitives:
+@code
+// Centers and radii of four spheres
+Vector3<Vector<4, Float>> centers{{x0, x1, x2, x3}, {y0, y1, y2, y3}, {z0, z1, z2, z3}};
+Vector<4, Float> radii{r0, r1, r2, r3};
+BoolVector<4> visible = Intersection::sphereFrustum(centers, radii, frustum);
+@endcode
+
+Any lane count can be used. With @ref MAGNUM_TARGET_SSE2 the arithmetic on
+four float lanes uses the SSE2 vector operators, comparisons and selection of
+the results are done for each lane separately. Other lane counts are left for
+the compiler to vectorize.
+*/
 class Intersection {
     public:
         Intersection() = delete;
@@ -123,8 +147,262 @@ class Intersection {
             const T f = Vector3<T>::dot(planePosition, planeNormal);
             return (f-Vector3<T>::dot(planeNormal, p))/Vector3<T>::dot(planeNormal, r);
         }
+
+        /**
+         * @brief %Intersection of a ray and triangle
+         * @param origin        Ray origin
+         * @param direction     Ray direction
+         * @param a             First triangle vertex
+         * @param b             Second triangle vertex
+         * @param c             Third triangle vertex
+         * @return %Intersection point position `t` on the ray or infinity if
+         *      the ray doesn't hit the triangle. %Intersection point can be
+         *      then computed with `origin + t*direction`.
+         *
+         * Uses Möller-Trumbore algorithm, which computes barycentric
+         * coordinates of the intersection without computing the triangle
+         * plane. Both sides of the triangle are hit, rays parallel to the
+         * triangle plane don't hit.
+         */
+        template<class T> static T rayTriangle(const Vector3<T>& origin, const Vector3<T>& direction, const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& c);
+
+        /**
+         * @brief %Intersection of a ray and triangles
+         *
+         * Batch variant of rayTriangle(const Vector3<T>&, const Vector3<T>&, const Vector3<T>&, const Vector3<T>&, const Vector3<T>&),
+         * see @ref Intersection-batch "class documentation" for more
+         * information.
+         */
+        template<std::size_t lanes, class T> static Vector<lanes, T> rayTriangle(const Vector3<T>& origin, const Vector3<T>& direction, const Vector3<Vector<lanes, T>>& a, const Vector3<Vector<lanes, T>>& b, const Vector3<Vector<lanes, T>>& c);
+
+        /**
+         * @brief %Intersection of a ray and axis-aligned box
+         * @param origin            Ray origin
+         * @param inverseDirection  Inverted ray direction, i.e.
+         *      `1/direction`
+         * @param min               Minimal box corner
+         * @param max               Maximal box corner
+         * @return %Intersection point position `t` on the ray or infinity if
+         *      the ray doesn't hit the box. If the origin is inside the box,
+         *      returns `0`.
+         *
+         * Uses slab method. The inverted direction is passed to avoid
+         * divisions when testing many boxes with the same ray. Zero direction
+         * components result in infinite inverted components, the ray is then
+         * parallel to given slab and hits the box only if the origin lies
+         * between the slab planes (including the planes themselves).
+         */
+        template<class T> static T rayAxisAlignedBox(const Vector3<T>& origin, const Vector3<T>& inverseDirection, const Vector3<T>& min, const Vector3<T>& max);
+
+        /**
+         * @brief %Intersection of a ray and axis-aligned boxes
+         *
+         * Batch variant of rayAxisAlignedBox(const Vector3<T>&, const Vector3<T>&, const Vector3<T>&, const Vector3<T>&),
+         * see @ref Intersection-batch "class documentation" for more
+         * information.
+         */
+        template<std::size_t lanes, class T> static Vector<lanes, T> rayAxisAlignedBox(const Vector3<T>& origin, const Vector3<T>& inverseDirection, const Vector3<Vector<lanes, T>>& min, const Vector3<Vector<lanes, T>>& max);
+
+        /**
+         * @brief Whether sphere is inside frustum
+         * @param center        Sphere center
+         * @param radius        Sphere radius
+         * @param frustum       Frustum
+         *
+         * Returns `false` if the sphere lies completely on the outer side of
+         * any frustum plane. Spheres near frustum corners might be reported
+         * as inside even if they are outside, which is acceptable for
+         * culling.
+         */
+        template<class T> static bool sphereFrustum(const Vector3<T>& center, T radius, const Frustum<T>& frustum);
+
+        /**
+         * @brief Whether spheres are inside frustum
+         *
+         * Batch variant of sphereFrustum(const Vector3<T>&, T, const Frustum<T>&),
+         * see @ref Intersection-batch "class documentation" for more
+         * information.
+         */
+        template<std::size_t lanes, class T> static BoolVector<lanes> sphereFrustum(const Vector3<Vector<lanes, T>>& center, const Vector<lanes, T>& radius, const Frustum<T>& frustum);
+
+        /**
+         * @brief Whether axis-aligned box is inside frustum
+         * @param min           Minimal box corner
+         * @param max           Maximal box corner
+         * @param frustum       Frustum
+         *
+         * Returns `false` if the box lies completely on the outer side of
+         * any frustum plane, i.e. if its corner farthest along the plane
+         * normal is outside. Boxes near frustum corners might be reported as
+         * inside even if they are outside, which is acceptable for culling.
+         */
+        template<class T> static bool axisAlignedBoxFrustum(const Vector3<T>& min, const Vector3<T>& max, const Frustum<T>& frustum);
+
+        /**
+         * @brief Whether axis-aligned boxes are inside frustum
+         *
+         * Batch variant of axisAlignedBoxFrustum(const Vector3<T>&, const Vector3<T>&, const Frustum<T>&),
+         * see @ref Intersection-batch "class documentation" for more
+         * information.
+         */
+        template<std::size_t lanes, class T> static BoolVector<lanes> axisAlignedBoxFrustum(const Vector3<Vector<lanes, T>>& min, const Vector3<Vector<lanes, T>>& max, const Frustum<T>& frustum);
 };
 
+template<class T> T Intersection::rayTriangle(const Vector3<T>& origin, const Vector3<T>& direction, const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& c) {
+    const Vector3<T> ab = b - a;
+    const Vector3<T> ac = c - a;
+    const Vector3<T> p = Vector3<T>::cross(direction, ac);
+
+    /* Ray parallel to the triangle */
+    const T determinant = Vector3<T>::dot(ab, p);
+    if(std::abs(determinant) < TypeTraits<T>::epsilon())
+        return std::numeric_limits<T>::infinity();
+
+    /* Barycentric coordinates outside of the triangle */
+    const T inverseDeterminant = T(1)/determinant;
+    const Vector3<T> s = origin - a;
+    const T u = Vector3<T>::dot(s, p)*inverseDeterminant;
+    if(u < T(0) || u > T(1))
+        return std::numeric_limits<T>::infinity();
+    const Vector3<T> q = Vector3<T>::cross(s, ab);
+    const T v = Vector3<T>::dot(direction, q)*inverseDeterminant;
+    if(v < T(0) || u + v > T(1))
+        return std::numeric_limits<T>::infinity();
+
+    /* Triangle behind the ray origin */
+    const T t = Vector3<T>::dot(ac, q)*inverseDeterminant;
+    return t >= T(0) ? t : std::numeric_limits<T>::infinity();
+}
+
+template<std::size_t lanes, class T> Vector<lanes, T> Intersection::rayTriangle(const Vector3<T>& origin, const Vector3<T>& direction, const Vector3<Vector<lanes, T>>& a, const Vector3<Vector<lanes, T>>& b, const Vector3<Vector<lanes, T>>& c) {
+    typedef Vector<lanes, T> Lanes;
+
+    /* The same as above, with all branches evaluated and masked at the end */
+    const Vector3<Lanes> ab = b - a;
+    const Vector3<Lanes> ac = c - a;
+    const Vector3<Lanes> p{ac.z()*direction.y() - ac.y()*direction.z(),
+                           ac.x()*direction.z() - ac.z()*direction.x(),
+                           ac.y()*direction.x() - ac.x()*direction.y()};
+    const Lanes determinant = Vector3<Lanes>::dot(ab, p);
+    const Lanes inverseDeterminant = Lanes(T(1))/determinant;
+    const Vector3<Lanes> s = Vector3<Lanes>(Lanes(origin.x()), Lanes(origin.y()), Lanes(origin.z())) - a;
+    const Lanes u = Vector3<Lanes>::dot(s, p)*inverseDeterminant;
+    const Vector3<Lanes> q = Vector3<Lanes>::cross(s, ab);
+    const Lanes v = (q.x()*direction.x() + q.y()*direction.y() + q.z()*direction.z())*inverseDeterminant;
+    const Lanes t = Vector3<Lanes>::dot(ac, q)*inverseDeterminant;
+
+    Lanes out;
+    for(std::size_t i = 0; i != lanes; ++i)
+        out[i] = std::abs(determinant[i]) >= TypeTraits<T>::epsilon() &&
+            u[i] >= T(0) && v[i] >= T(0) && u[i] + v[i] <= T(1) && t[i] >= T(0) ?
+            t[i] : std::numeric_limits<T>::infinity();
+    return out;
+}
+
+template<class T> T Intersection::rayAxisAlignedBox(const Vector3<T>& origin, const Vector3<T>& inverseDirection, const Vector3<T>& min, const Vector3<T>& max) {
+    T near(0);
+    T far(std::numeric_limits<T>::infinity());
+    for(std::size_t i = 0; i != 3; ++i) {
+        /* Ray parallel to the slab is either whole inside or outside, origin
+           lying on the slab plane would give 0*inf = NaN otherwise */
+        if(std::isinf(inverseDirection[i])) {
+            if(origin[i] < min[i] || origin[i] > max[i])
+                return std::numeric_limits<T>::infinity();
+            continue;
+        }
+
+        const T a = (min[i] - origin[i])*inverseDirection[i];
+        const T b = (max[i] - origin[i])*inverseDirection[i];
+        near = std::max(near, std::min(a, b));
+        far = std::min(far, std::max(a, b));
+    }
+
+    return near <= far ? near : std::numeric_limits<T>::infinity();
+}
+
+template<std::size_t lanes, class T> Vector<lanes, T> Intersection::rayAxisAlignedBox(const Vector3<T>& origin, const Vector3<T>& inverseDirection, const Vector3<Vector<lanes, T>>& min, const Vector3<Vector<lanes, T>>& max) {
+    typedef Vector<lanes, T> Lanes;
+
+    Lanes near(T(0));
+    Lanes far(std::numeric_limits<T>::infinity());
+    for(std::size_t i = 0; i != 3; ++i) {
+        /* Parallel to the slab, see above */
+        if(std::isinf(inverseDirection[i])) {
+            for(std::size_t j = 0; j != lanes; ++j)
+                if(origin[i] < min[i][j] || origin[i] > max[i][j])
+                    far[j] = -std::numeric_limits<T>::infinity();
+            continue;
+        }
+
+        const Lanes a = (min[i] - Lanes(origin[i]))*inverseDirection[i];
+        const Lanes b = (max[i] - Lanes(origin[i]))*inverseDirection[i];
+        near = Math::max(near, Math::min(a, b));
+        far = Math::min(far, Math::max(a, b));
+    }
+
+    Lanes out;
+    for(std::size_t i = 0; i != lanes; ++i)
+        out[i] = near[i] <= far[i] ? near[i] : std::numeric_limits<T>::infinity();
+    return out;
+}
+
+template<class T> bool Intersection::sphereFrustum(const Vector3<T>& center, const T radius, const Frustum<T>& frustum) {
+    for(std::size_t i = 0; i != 6; ++i) {
+        const Vector4<T> plane = frustum[i];
+        if(Vector3<T>::dot(plane.xyz(), center) + plane.w() < -radius)
+            return false;
+    }
+
+    return true;
+}
+
+template<std::size_t lanes, class T> BoolVector<lanes> Intersection::sphereFrustum(const Vector3<Vector<lanes, T>>& center, const Vector<lanes, T>& radius, const Frustum<T>& frustum) {
+    typedef Vector<lanes, T> Lanes;
+
+    const Lanes negativeRadius = -radius;
+    BoolVector<lanes> out(true);
+    for(std::size_t i = 0; i != 6; ++i) {
+        const Vector4<T> plane = frustum[i];
+        out &= center.x()*plane.x() + center.y()*plane.y() + center.z()*plane.z() + Lanes(plane.w()) >= negativeRadius;
+    }
+
+    return out;
+}
+
+template<class T> bool Intersection::axisAlignedBoxFrustum(const Vector3<T>& min, const Vector3<T>& max, const Frustum<T>& frustum) {
+    for(std::size_t i = 0; i != 6; ++i) {
+        const Vector4<T> plane = frustum[i];
+
+        /* Corner farthest along the normal */
+        Vector3<T> corner;
+        for(std::size_t j = 0; j != 3; ++j)
+            corner[j] = plane[j] >= T(0) ? max[j] : min[j];
+
+        if(Vector3<T>::dot(plane.xyz(), corner) + plane.w() < T(0))
+            return false;
+    }
+
+    return true;
+}
+
+template<std::size_t lanes, class T> BoolVector<lanes> Intersection::axisAlignedBoxFrustum(const Vector3<Vector<lanes, T>>& min, const Vector3<Vector<lanes, T>>& max, const Frustum<T>& frustum) {
+    typedef Vector<lanes, T> Lanes;
+
+    BoolVector<lanes> out(true);
+    for(std::size_t i = 0; i != 6; ++i) {
+        const Vector4<T> plane = frustum[i];
+
+        /* The corner selection is the same for all boxes */
+        Lanes distance(plane.w());
+        for(std::size_t j = 0; j != 3; ++j)
+            distance += (plane[j] >= T(0) ? max[j] : min[j])*plane[j];
+
+        out &= distance >= Lanes(T(0));
+    }
+
+    return out;
+}
+
 }}}
 
 #endif
@@ -0,0 +1,159 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <sstream>
+#include <TestSuite/Tester.h>
+
+#include "Math/Geometry/Frustum.h"
+
+namespace Magnum { namespace Math { namespace Geometry { namespace Test {
+
+class FrustumTest: public Corrade::TestSuite::Tester {
+    public:
+        FrustumTest();
+
+        void construct();
+        void constructDefault();
+        void constructCopy();
+        void fromMatrixOrthographic();
+        void fromMatrixPerspective();
+
+        void access();
+        void compare();
+
+        void debug();
+};
+
+typedef Geometry::Frustum<Float> Frustum;
+typedef Math::Vector4<Float> Vector4;
+typedef Math::Vector2<Float> Vector2;
+typedef Math::Matrix4<Float> Matrix4;
+
+FrustumTest::FrustumTest() {
+    addTests({&FrustumTest::construct,
+              &FrustumTest::constructDefault,
+              &FrustumTest::constructCopy,
+              &FrustumTest::fromMatrixOrthographic,
+              &FrustumTest::fromMatrixPerspective,
+
+              &FrustumTest::access,
+              &FrustumTest::compare,
+
+              &FrustumTest::debug});
+}
+
+void FrustumTest::construct() {
+    constexpr Frustum a({1.0f, 0.0f, 0.0f, 2.0f},
+                        {-1.0f, 0.0f, 0.0f, 3.0f},
+                        {0.0f, 1.0f, 0.0f, 4.0f},
+                        {0.0f, -1.0f, 0.0f, 5.0f},
+                        {0.0f, 0.0f, 1.0f, 6.0f},
+                        {0.0f, 0.0f, -1.0f, 7.0f});
+    CORRADE_COMPARE(a[0], Vector4(1.0f, 0.0f, 0.0f, 2.0f));
+    CORRADE_COMPARE(a[5], Vector4(0.0f, 0.0f, -1.0f, 7.0f));
+}
+
+void FrustumTest::constructDefault() {
+    constexpr Frustum a;
+    CORRADE_COMPARE(a, Frustum::fromMatrix(Matrix4()));
+}
+
+void FrustumTest::constructCopy() {
+    constexpr Frustum a({1.0f, 0.0f, 0.0f, 2.0f},
+                        {-1.0f, 0.0f, 0.0f, 3.0f},
+                        {0.0f, 1.0f, 0.0f, 4.0f},
+                        {0.0f, -1.0f, 0.0f, 5.0f},
+                        {0.0f, 0.0f, 1.0f, 6.0f},
+                        {0.0f, 0.0f, -1.0f, 7.0f});
+    constexpr Frustum b(a);
+    CORRADE_COMPARE(b, a);
+}
+
+void FrustumTest::fromMatrixOrthographic() {
+    const Frustum a = Frustum::fromMatrix(Matrix4::orthographicProjection({4.0f, 6.0f}, 1.0f, 9.0f));
+    CORRADE_COMPARE(a, Frustum({1.0f, 0.0f, 0.0f, 2.0f},
+                               {-1.0f, 0.0f, 0.0f, 2.0f},
+                               {0.0f, 1.0f, 0.0f, 3.0f},
+                               {0.0f, -1.0f, 0.0f, 3.0f},
+                               {0.0f, 0.0f, -1.0f, -1.0f},
+                               {0.0f, 0.0f, 1.0f, 9.0f}));
+}
+
+void FrustumTest::fromMatrixPerspective() {
+    /* 90° field of view, the side planes are at 45° */
+    const Frustum a = Frustum::fromMatrix(Matrix4::perspectiveProjection({2.0f, 2.0f}, 1.0f, 10.0f));
+    const Float s = Constants<Float>::sqrt2()/2.0f;
+    CORRADE_COMPARE(a.left(), Vector4(s, 0.0f, -s, 0.0f));
+    CORRADE_COMPARE(a.right(), Vector4(-s, 0.0f, -s, 0.0f));
+    CORRADE_COMPARE(a.bottom(), Vector4(0.0f, s, -s, 0.0f));
+    CORRADE_COMPARE(a.top(), Vector4(0.0f, -s, -s, 0.0f));
+    CORRADE_COMPARE(a.near(), Vector4(0.0f, 0.0f, -1.0f, -1.0f));
+    CORRADE_COMPARE(a.far(), Vector4(0.0f, 0.0f, 1.0f, 10.0f));
+}
+
+void FrustumTest::access() {
+    Frustum a({1.0f, 0.0f, 0.0f, 2.0f},
+              {-1.0f, 0.0f, 0.0f, 3.0f},
+              {0.0f, 1.0f, 0.0f, 4.0f},
+              {0.0f, -1.0f, 0.0f, 5.0f},
+              {0.0f, 0.0f, 1.0f, 6.0f},
+              {0.0f, 0.0f, -1.0f, 7.0f});
+    CORRADE_COMPARE(a.left(), Vector4(1.0f, 0.0f, 0.0f, 2.0f));
+    CORRADE_COMPARE(a.right(), Vector4(-1.0f, 0.0f, 0.0f, 3.0f));
+    CORRADE_COMPARE(a.bottom(), Vector4(0.0f, 1.0f, 0.0f, 4.0f));
+    CORRADE_COMPARE(a.top(), Vector4(0.0f, -1.0f, 0.0f, 5.0f));
+    CORRADE_COMPARE(a.near(), Vector4(0.0f, 0.0f, 1.0f, 6.0f));
+    CORRADE_COMPARE(a.far(), Vector4(0.0f, 0.0f, -1.0f, 7.0f));
+    CORRADE_COMPARE(a.data()[3], a.top());
+    CORRADE_COMPARE(a[2], a.bottom());
+}
+
+void FrustumTest::compare() {
+    Frustum a;
+    Frustum b({1.0f, 0.0f, 0.0f, 1.0f},
+              {-1.0f, 0.0f, 0.0f, 1.0f},
+              {0.0f, 1.0f, 0.0f, 1.0f},
+              {0.0f, -1.0f, 0.0f, 1.0f},
+              {0.0f, 0.0f, 1.0f, 1.0f},
+              {0.0f, 0.0f, -1.0f, 1.0f+TypeTraits<Float>::epsilon()/2.0f});
+    Frustum c({1.0f, 0.0f, 0.0f, 1.0f},
+              {-1.0f, 0.0f, 0.0f, 1.0f},
+              {0.0f, 1.0f, 0.0f, 1.0f},
+              {0.0f, -1.0f, 0.0f, 1.0f},
+              {0.0f, 0.0f, 1.0f, 1.0f},
+              {0.0f, 0.0f, -1.0f, 1.1f});
+    CORRADE_VERIFY(a == b);
+    CORRADE_VERIFY(a != c);
+}
+
+void FrustumTest::debug() {
+    std::ostringstream o;
+    Debug(&o) << Frustum();
+    CORRADE_COMPARE(o.str(), "Frustum(Vector(1, 0, 0, 1), Vector(-1, 0, 0, 1), Vector(0, 1, 0, 1), Vector(0, -1, 0, 1), Vector(0, 0, 1, 1), Vector(0, 0, -1, 1))\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Geometry::Test::FrustumTest)
@@ -35,14 +35,34 @@ class IntersectionTest: public Corrade::TestSuite::Tester {
 
         void planeLine();
         void lineLine();
+        void rayTriangle();
+        void rayTriangleBatch();
+        void rayAxisAlignedBox();
+        void rayAxisAlignedBoxBatch();
+        void sphereFrustum();
+        void sphereFrustumBatch();
+        void axisAlignedBoxFrustum();
+        void axisAlignedBoxFrustumBatch();
 };
 
 typedef Math::Vector2<Float> Vector2;
 typedef Math::Vector3<Float> Vector3;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Geometry::Frustum<Float> Frustum;
+typedef Math::Vector<4, Float> Vector4x;
+typedef Math::Vector3<Vector4x> Vector3x4;
 
 IntersectionTest::IntersectionTest() {
     addTests({&IntersectionTest::planeLine,
-              &IntersectionTest::lineLine});
+              &IntersectionTest::lineLine,
+              &IntersectionTest::rayTriangle,
+              &IntersectionTest::rayTriangleBatch,
+              &IntersectionTest::rayAxisAlignedBox,
+              &IntersectionTest::rayAxisAlignedBoxBatch,
+              &IntersectionTest::sphereFrustum,
+              &IntersectionTest::sphereFrustumBatch,
+              &IntersectionTest::axisAlignedBoxFrustum,
+              &IntersectionTest::axisAlignedBoxFrustumBatch});
 }
 
 void IntersectionTest::planeLine() {
@@ -98,6 +118,141 @@ void IntersectionTest::lineLine() {
         {0.0f, 0.0f}, {1.0f, 2.0f}), std::numeric_limits<Float>::infinity());
 }
 
+void IntersectionTest::rayTriangle() {
+    const Vector3 a(-1.0f, -1.0f, -2.0f);
+    const Vector3 b(1.0f, -1.0f, -2.0f);
+    const Vector3 c(0.0f, 1.0f, -2.0f);
+
+    /* Hit from both sides */
+    CORRADE_COMPARE(Intersection::rayTriangle({0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}, a, b, c), 2.0f);
+    CORRADE_COMPARE(Intersection::rayTriangle({0.0f, 0.0f, -4.0f}, {0.0f, 0.0f, 2.0f}, a, b, c), 1.0f);
+
+    /* Miss, triangle behind the ray */
+    CORRADE_COMPARE(Intersection::rayTriangle({0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, a, b, c), std::numeric_limits<Float>::infinity());
+
+    /* Miss, outside of the triangle */
+    CORRADE_COMPARE(Intersection::rayTriangle({0.9f, 0.9f, 0.0f}, {0.0f, 0.0f, -1.0f}, a, b, c), std::numeric_limits<Float>::infinity());
+    CORRADE_COMPARE(Intersection::rayTriangle({0.0f, -1.1f, 0.0f}, {0.0f, 0.0f, -1.0f}, a, b, c), std::numeric_limits<Float>::infinity());
+
+    /* Ray parallel to the triangle */
+    CORRADE_COMPARE(Intersection::rayTriangle({0.0f, 0.0f, -2.0f}, {1.0f, 0.0f, 0.0f}, a, b, c), std::numeric_limits<Float>::infinity());
+}
+
+void IntersectionTest::rayTriangleBatch() {
+    const Vector3x4 a(Vector4x(-1.0f), Vector4x(-1.0f), Vector4x(-2.0f, -2.0f, 2.0f, 0.0f));
+    const Vector3x4 b(Vector4x(1.0f), Vector4x(-1.0f), Vector4x(-2.0f, -2.0f, 2.0f, 0.0f));
+    const Vector3x4 c(Vector4x(0.0f, 5.0f, 0.0f, 0.0f), Vector4x(1.0f), Vector4x(-2.0f, -2.0f, 2.0f, 0.0f));
+
+    /* Hit, miss outside, miss behind, hit at origin */
+    const Vector4x t = Intersection::rayTriangle({0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}, a, b, c);
+    CORRADE_COMPARE(t[0], 2.0f);
+    CORRADE_COMPARE(t[1], std::numeric_limits<Float>::infinity());
+    CORRADE_COMPARE(t[2], std::numeric_limits<Float>::infinity());
+    CORRADE_COMPARE(t[3], 0.0f);
+
+    /* Consistent with the scalar version */
+    for(std::size_t i = 0; i != 4; ++i)
+        CORRADE_COMPARE(t[i], Intersection::rayTriangle({0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f},
+            Vector3(a.x()[i], a.y()[i], a.z()[i]),
+            Vector3(b.x()[i], b.y()[i], b.z()[i]),
+            Vector3(c.x()[i], c.y()[i], c.z()[i])));
+}
+
+void IntersectionTest::rayAxisAlignedBox() {
+    const Vector3 min(-1.0f, -1.0f, -3.0f);
+    const Vector3 max(1.0f, 1.0f, -2.0f);
+
+    /* Hit */
+    CORRADE_COMPARE(Intersection::rayAxisAlignedBox({0.0f, 0.0f, 0.0f}, Vector3(1.0f)/Vector3(0.0f, 0.0f, -1.0f), min, max), 2.0f);
+    CORRADE_COMPARE(Intersection::rayAxisAlignedBox({-3.0f, 0.0f, -2.5f}, Vector3(1.0f)/Vector3(0.5f, 0.0f, 0.0f), min, max), 4.0f);
+
+    /* Origin inside */
+    CORRADE_COMPARE(Intersection::rayAxisAlignedBox({0.0f, 0.0f, -2.5f}, Vector3(1.0f)/Vector3(0.0f, 1.0f, 0.0f), min, max), 0.0f);
+
+    /* Miss, box behind the ray */
+    CORRADE_COMPARE(Intersection::rayAxisAlignedBox({0.0f, 0.0f, 0.0f}, Vector3(1.0f)/Vector3(0.0f, 0.0f, 1.0f), min, max), std::numeric_limits<Float>::infinity());
+
+    /* Miss, passing around */
+    CORRADE_COMPARE(Intersection::rayAxisAlignedBox({2.0f, 0.0f, 0.0f}, Vector3(1.0f)/Vector3(0.0f, 0.0f, -1.0f), min, max), std::numeric_limits<Float>::infinity());
+    CORRADE_COMPARE(Intersection::rayAxisAlignedBox({0.0f, 0.0f, 0.0f}, Vector3(1.0f)/Vector3(1.0f, 0.0f, -1.0f), min, max), std::numeric_limits<Float>::infinity());
+
+    /* Origin on the slab plane, parallel to it (would be 0*inf) */
+    CORRADE_COMPARE(Intersection::rayAxisAlignedBox({1.0f, 0.0f, 0.0f}, Vector3(1.0f)/Vector3(0.0f, 0.0f, -1.0f), min, max), 2.0f);
+    CORRADE_COMPARE(Intersection::rayAxisAlignedBox({-1.0f, -1.0f, 0.0f}, Vector3(1.0f)/Vector3(-0.0f, 0.0f, -1.0f), min, max), 2.0f);
+    CORRADE_COMPARE(Intersection::rayAxisAlignedBox({1.0f, 0.0f, -4.0f}, Vector3(1.0f)/Vector3(-0.0f, 0.0f, -1.0f), min, max), std::numeric_limits<Float>::infinity());
+}
+
+void IntersectionTest::rayAxisAlignedBoxBatch() {
+    const Vector3x4 min(Vector4x(-1.0f, 1.5f, -1.0f, -1.0f), Vector4x(-1.0f), Vector4x(-3.0f, -3.0f, 2.0f, -1.0f));
+    const Vector3x4 max(Vector4x(1.0f, 2.5f, 1.0f, 1.0f), Vector4x(1.0f), Vector4x(-2.0f, -2.0f, 3.0f, 1.0f));
+
+    /* Hit, miss around, miss behind, origin inside */
+    const Vector3 inverseDirection = Vector3(1.0f)/Vector3(0.0f, 0.0f, -1.0f);
+    const Vector4x t = Intersection::rayAxisAlignedBox({0.0f, 0.0f, 0.0f}, inverseDirection, min, max);
+    CORRADE_COMPARE(t[0], 2.0f);
+    CORRADE_COMPARE(t[1], std::numeric_limits<Float>::infinity());
+    CORRADE_COMPARE(t[2], std::numeric_limits<Float>::infinity());
+    CORRADE_COMPARE(t[3], 0.0f);
+
+    /* Origin on the slab plane of the first box, parallel to it */
+    const Vector4x u = Intersection::rayAxisAlignedBox({1.0f, 1.0f, 0.0f}, inverseDirection, min, max);
+    CORRADE_COMPARE(u[0], 2.0f);
+    CORRADE_COMPARE(u[3], 0.0f);
+
+    /* Consistent with the scalar version */
+    for(std::size_t i = 0; i != 4; ++i)
+        CORRADE_COMPARE(t[i], Intersection::rayAxisAlignedBox({0.0f, 0.0f, 0.0f}, inverseDirection,
+            Vector3(min.x()[i], min.y()[i], min.z()[i]),
+            Vector3(max.x()[i], max.y()[i], max.z()[i])));
+}
+
+void IntersectionTest::sphereFrustum() {
+    const Frustum frustum = Frustum::fromMatrix(Matrix4::perspectiveProjection({2.0f, 2.0f}, 1.0f, 100.0f));
+
+    /* Inside, intersecting near plane, intersecting side plane */
+    CORRADE_VERIFY(Intersection::sphereFrustum({0.0f, 0.0f, -10.0f}, 1.0f, frustum));
+    CORRADE_VERIFY(Intersection::sphereFrustum({0.0f, 0.0f, 0.0f}, 1.5f, frustum));
+    CORRADE_VERIFY(Intersection::sphereFrustum({11.0f, 0.0f, -10.0f}, 1.0f, frustum));
+
+    /* Behind the camera, beyond far plane, on the side */
+    CORRADE_VERIFY(!Intersection::sphereFrustum({0.0f, 0.0f, 1.0f}, 1.5f, frustum));
+    CORRADE_VERIFY(!Intersection::sphereFrustum({0.0f, 0.0f, -102.0f}, 1.0f, frustum));
+    CORRADE_VERIFY(!Intersection::sphereFrustum({12.0f, 0.0f, -10.0f}, 1.0f, frustum));
+}
+
+void IntersectionTest::sphereFrustumBatch() {
+    const Frustum frustum = Frustum::fromMatrix(Matrix4::perspectiveProjection({2.0f, 2.0f}, 1.0f, 100.0f));
+
+    const Vector3x4 centers(Vector4x(0.0f, 0.0f, 11.0f, 12.0f), Vector4x(0.0f), Vector4x(-10.0f, 1.0f, -10.0f, -10.0f));
+    const Vector4x radii(1.0f, 1.5f, 1.0f, 1.0f);
+    CORRADE_COMPARE(Intersection::sphereFrustum(centers, radii, frustum), BoolVector<4>(0x05));
+
+    /* Consistent with the scalar version */
+    const BoolVector<4> inside = Intersection::sphereFrustum(centers, radii, frustum);
+    for(std::size_t i = 0; i != 4; ++i)
+        CORRADE_COMPARE(inside[i], Intersection::sphereFrustum(Vector3(centers.x()[i], centers.y()[i], centers.z()[i]), radii[i], frustum));
+}
+
+void IntersectionTest::axisAlignedBoxFrustum() {
+    const Frustum frustum = Frustum::fromMatrix(Matrix4::perspectiveProjection({2.0f, 2.0f}, 1.0f, 100.0f));
+
+    /* Inside, intersecting side plane */
+    CORRADE_VERIFY(Intersection::axisAlignedBoxFrustum({-1.0f, -1.0f, -11.0f}, {1.0f, 1.0f, -9.0f}, frustum));
+    CORRADE_VERIFY(Intersection::axisAlignedBoxFrustum({9.0f, -1.0f, -11.0f}, {11.0f, 1.0f, -9.0f}, frustum));
+
+    /* Behind the camera, on the side */
+    CORRADE_VERIFY(!Intersection::axisAlignedBoxFrustum({-1.0f, -1.0f, 0.5f}, {1.0f, 1.0f, 2.0f}, frustum));
+    CORRADE_VERIFY(!Intersection::axisAlignedBoxFrustum({12.0f, -1.0f, -11.0f}, {14.0f, 1.0f, -9.0f}, frustum));
+}
+
+void IntersectionTest::axisAlignedBoxFrustumBatch() {
+    const Frustum frustum = Frustum::fromMatrix(Matrix4::perspectiveProjection({2.0f, 2.0f}, 1.0f, 100.0f));
+
+    const Vector3x4 min(Vector4x(-1.0f, 9.0f, -1.0f, 12.0f), Vector4x(-1.0f), Vector4x(-11.0f, -11.0f, 0.5f, -11.0f));
+    const Vector3x4 max(Vector4x(1.0f, 11.0f, 1.0f, 14.0f), Vector4x(1.0f), Vector4x(-9.0f, -9.0f, 2.0f, -9.0f));
+    CORRADE_COMPARE(Intersection::axisAlignedBoxFrustum(min, max, frustum), BoolVector<4>(0x03));
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Geometry::Test::IntersectionTest)
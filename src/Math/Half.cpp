@@ -0,0 +1,175 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Half.h"
+
+#include <cstring>
+#include <Utility/Assert.h>
+
+#ifdef MAGNUM_TARGET_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Magnum { namespace Math {
+
+/* Conversions based on branch-free float/half conversions by Fabian Giesen,
+   https://gist.github.com/rygorous/2156668 */
+
+namespace {
+
+inline UnsignedInt floatBits(Float value) {
+    UnsignedInt bits;
+    std::memcpy(&bits, &value, 4);
+    return bits;
+}
+
+inline Float bitsFloat(UnsignedInt bits) {
+    Float value;
+    std::memcpy(&value, &bits, 4);
+    return value;
+}
+
+/* Exponent of largest half-float value rounded up, exponent of smallest
+   normal half-float, magic number for subnormal rounding and bias converting
+   exponent and rounding half of the truncated mantissa up */
+constexpr UnsignedInt HalfMaxBits = (127 + 16) << 23;
+constexpr UnsignedInt HalfMinNormalBits = (127 - 14) << 23;
+constexpr UnsignedInt SubnormalMagicBits = ((127 - 15) + (23 - 10) + 1) << 23;
+constexpr UnsignedInt NormalBias = 0xfff - ((127 - 15) << 23);
+
+/* 2^112, converts half exponent to float exponent */
+constexpr UnsignedInt ExponentMagicBits = (254 - 15) << 23;
+
+}
+
+UnsignedShort packHalf(const Float value) {
+    UnsignedInt bits = floatBits(value);
+    const UnsignedInt sign = bits & 0x80000000u;
+    bits ^= sign;
+
+    UnsignedInt out;
+
+    /* Infinity or NaN (all exponent bits set) */
+    if(bits >= HalfMaxBits)
+        out = bits > 0x7f800000u ? 0x7e00 : 0x7c00;
+
+    /* Subnormal or zero, the float addition does the rounding */
+    else if(bits < HalfMinNormalBits)
+        out = floatBits(bitsFloat(bits) + bitsFloat(SubnormalMagicBits)) - SubnormalMagicBits;
+
+    /* Normal, round to nearest even */
+    else out = (bits + NormalBias + ((bits >> 13) & 1)) >> 13;
+
+    return UnsignedShort(out | (sign >> 16));
+}
+
+Float unpackHalf(const UnsignedShort value) {
+    Float out = bitsFloat((value & 0x7fff) << 13)*bitsFloat(ExponentMagicBits);
+
+    /* Preserve infinity and NaN */
+    if((value & 0x7fff) > 0x7bff)
+        out = bitsFloat(floatBits(out) | 0x7f800000u);
+
+    return bitsFloat(floatBits(out) | ((value & 0x8000) << 16));
+}
+
+#ifdef MAGNUM_TARGET_SSE2
+namespace {
+
+/* The same as packHalf(Float), only for four values at once */
+inline __m128i packHalfSse(const __m128 value) {
+    const __m128 sign = _mm_and_ps(value, _mm_castsi128_ps(_mm_set1_epi32(Int(0x80000000u))));
+    const __m128 absolute = _mm_xor_ps(value, sign);
+    const __m128i bits = _mm_castps_si128(absolute);
+
+    /* Infinity or NaN */
+    const __m128i isRegular = _mm_cmpgt_epi32(_mm_set1_epi32(HalfMaxBits), bits);
+    const __m128i isNan = _mm_castps_si128(_mm_cmpunord_ps(absolute, absolute));
+    const __m128i infinityNan = _mm_or_si128(_mm_and_si128(isNan, _mm_set1_epi32(0x200)), _mm_set1_epi32(0x7c00));
+
+    /* Subnormal or zero */
+    const __m128i isSubnormal = _mm_cmpgt_epi32(_mm_set1_epi32(HalfMinNormalBits), bits);
+    const __m128i subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(absolute, _mm_castsi128_ps(_mm_set1_epi32(SubnormalMagicBits)))), _mm_set1_epi32(SubnormalMagicBits));
+
+    /* Normal, odd mantissa bit is shifted to sign and expanded to -1 */
+    const __m128i odd = _mm_srai_epi32(_mm_slli_epi32(bits, 31 - 13), 31);
+    const __m128i normal = _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(bits, _mm_set1_epi32(NormalBias)), odd), 13);
+
+    const __m128i finite = _mm_or_si128(_mm_and_si128(isSubnormal, subnormal), _mm_andnot_si128(isSubnormal, normal));
+    const __m128i out = _mm_or_si128(_mm_and_si128(isRegular, finite), _mm_andnot_si128(isRegular, infinityNan));
+    const __m128i result = _mm_or_si128(out, _mm_srli_epi32(_mm_castps_si128(sign), 16));
+
+    /* Sign-extend from 16 bits so signed saturation keeps the value */
+    return _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);
+}
+
+/* The same as unpackHalf(UnsignedShort), only for four values at once */
+inline __m128 unpackHalfSse(const __m128i value) {
+    const __m128i exponentMantissa = _mm_and_si128(value, _mm_set1_epi32(0x7fff));
+    const __m128i sign = _mm_slli_epi32(_mm_xor_si128(value, exponentMantissa), 16);
+    const __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(exponentMantissa, 13)), _mm_castsi128_ps(_mm_set1_epi32(ExponentMagicBits)));
+    const __m128i isInfinityNan = _mm_cmpgt_epi32(exponentMantissa, _mm_set1_epi32(0x7bff));
+    const __m128i infinityNan = _mm_and_si128(isInfinityNan, _mm_set1_epi32(0x7f800000u));
+    return _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(sign, infinityNan)));
+}
+
+}
+#endif
+
+void packHalf(Corrade::Containers::ArrayReference<const Float> values, Corrade::Containers::ArrayReference<Half> out) {
+    CORRADE_ASSERT(values.size() == out.size(), "Math::packHalf(): expected output of size" << values.size() << "but got" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_TARGET_SSE2
+    for(; i + 8 <= values.size(); i += 8) {
+        const __m128i a = packHalfSse(_mm_loadu_ps(values.data() + i));
+        const __m128i b = packHalfSse(_mm_loadu_ps(values.data() + i + 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out.data() + i), _mm_packs_epi32(a, b));
+    }
+    #endif
+
+    for(; i != values.size(); ++i)
+        out[i] = Half(packHalf(values[i]));
+}
+
+void unpackHalf(Corrade::Containers::ArrayReference<const Half> values, Corrade::Containers::ArrayReference<Float> out) {
+    CORRADE_ASSERT(values.size() == out.size(), "Math::unpackHalf(): expected output of size" << values.size() << "but got" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_TARGET_SSE2
+    for(; i + 4 <= values.size(); i += 4) {
+        const __m128i packed = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(values.data() + i));
+        _mm_storeu_ps(out.data() + i, unpackHalfSse(_mm_unpacklo_epi16(packed, _mm_setzero_si128())));
+    }
+    #endif
+
+    for(; i != values.size(); ++i)
+        out[i] = unpackHalf(values[i].data());
+}
+
+Corrade::Utility::Debug operator<<(Corrade::Utility::Debug debug, const Half value) {
+    return debug << unpackHalf(value.data());
+}
+
+}}
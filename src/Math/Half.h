@@ -0,0 +1,156 @@
+#ifndef Magnum_Math_Half_h
+#define Magnum_Math_Half_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::Math::Half, functions Magnum::Math::packHalf(), Magnum::Math::unpackHalf()
+ */
+
+#include <Containers/Array.h>
+#include <Utility/Debug.h>
+
+#include "Math/Math.h"
+#include "Types.h"
+
+#include "magnumVisibility.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@brief Pack 32-bit float to 16-bit half-float
+
+Rounds to nearest, ties to even. Values too large for half-float are
+converted to infinity, NaN is converted to quiet NaN. Sign is preserved.
+@see @ref unpackHalf(), @ref Half
+*/
+UnsignedShort MAGNUM_EXPORT packHalf(Float value);
+
+/**
+@brief Unpack 16-bit half-float to 32-bit float
+
+The conversion is exact, including subnormals, infinity and NaN.
+@see @ref packHalf(), @ref Half
+*/
+Float MAGNUM_EXPORT unpackHalf(UnsignedShort value);
+
+/**
+@brief Half-float
+
+16-bit floating-point type with 1 sign bit, 5 exponent bits and 10 mantissa
+bits, which can be used to halve memory and bandwidth for vertex data and HDR
+images, e.g. with `HalfFloat` vertex attribute data type or
+@ref Magnum::ColorType "ColorType::HalfFloat" images. The class
+only stores the value, arithmetic has to be done on float values after
+conversion:
+@code
+Half a(3.5f);
+Float b = Float(a)*2.0f;
+@endcode
+
+It can be also used as underlying type of @ref Vector, e.g. to store packed
+positions as `Math::Vector3<Half>`. Arrays of floats are converted most
+efficiently using @ref packHalf(Corrade::Containers::ArrayReference<const Float>, Corrade::Containers::ArrayReference<Half>)
+and @ref unpackHalf(Corrade::Containers::ArrayReference<const Half>, Corrade::Containers::ArrayReference<Float>).
+@see @ref Magnum::Half
+*/
+class Half {
+    public:
+        /** @brief Default constructor, creates positive zero */
+        constexpr /*implicit*/ Half(): _data(0) {}
+
+        /** @brief Construct from raw half-float representation */
+        constexpr explicit Half(UnsignedShort data): _data(data) {}
+
+        /**
+         * @brief Construct from float value
+         *
+         * @see packHalf()
+         */
+        explicit Half(Float value): _data(packHalf(value)) {}
+
+        /**
+         * @brief Equality comparison
+         *
+         * Compares the bit representation, i.e. positive and negative zero
+         * are different and NaN is equal to itself.
+         */
+        constexpr bool operator==(Half other) const {
+            return _data == other._data;
+        }
+
+        /** @brief Non-equality comparison */
+        constexpr bool operator!=(Half other) const {
+            return !operator==(other);
+        }
+
+        /** @brief Negated value */
+        constexpr Half operator-() const {
+            return Half(UnsignedShort(_data ^ (1 << 15)));
+        }
+
+        /** @brief Raw half-float representation */
+        constexpr explicit operator UnsignedShort() const { return _data; }
+
+        /**
+         * @brief Conversion to float
+         *
+         * @see unpackHalf()
+         */
+        explicit operator Float() const { return unpackHalf(_data); }
+
+        /** @brief Raw half-float representation */
+        constexpr UnsignedShort data() const { return _data; }
+
+    private:
+        UnsignedShort _data;
+};
+
+static_assert(sizeof(Half) == 2, "Improper size of Half");
+
+/**
+@brief Pack array of floats to half-floats
+
+Converts all values in @p values using @ref packHalf(Float), saving the result
+into @p out, which is expected to have the same size. If `TARGET_SSE2` is
+enabled, eight values are converted at once with bit-exact result to the
+scalar version.
+*/
+void MAGNUM_EXPORT packHalf(Corrade::Containers::ArrayReference<const Float> values, Corrade::Containers::ArrayReference<Half> out);
+
+/**
+@brief Unpack array of half-floats to floats
+
+Converts all values in @p values using @ref unpackHalf(UnsignedShort), saving
+the result into @p out, which is expected to have the same size. If
+`TARGET_SSE2` is enabled, four values are converted at once.
+*/
+void MAGNUM_EXPORT unpackHalf(Corrade::Containers::ArrayReference<const Half> values, Corrade::Containers::ArrayReference<Float> out);
+
+/** @debugoperator{Magnum::Math::Half} */
+Corrade::Utility::Debug MAGNUM_EXPORT operator<<(Corrade::Utility::Debug debug, Half value);
+
+}}
+
+#endif
@@ -43,6 +43,8 @@ template<class> class Dual;
 template<class> class DualComplex;
 template<class> class DualQuaternion;
 
+class Half;
+
 template<std::size_t, class> class Matrix;
 #ifndef CORRADE_GCC46_COMPATIBILITY
 template<class T> using Matrix2x2 = Matrix<2, T>;
@@ -75,6 +77,7 @@ template<class> class Vector3;
 template<class> class Vector4;
 
 namespace Geometry {
+    template<class> class Frustum;
     template<class> class Rectangle;
 }
 
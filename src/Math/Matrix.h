@@ -34,6 +34,7 @@ namespace Magnum { namespace Math {
 
 namespace Implementation {
     template<std::size_t size, class T> class MatrixDeterminant;
+    template<std::size_t size, class T> class MatrixInverter;
 }
 
 /**
@@ -69,12 +70,8 @@ template<std::size_t size, class T> class Matrix: public RectangularMatrix<size,
          * You can also explicitly call this constructor with
          * `Matrix m(Matrix::Identity);`. Optional parameter @p value allows
          * you to specify value on diagonal.
-         * @todo use constexpr fromDiagonal() for this when it's done
          */
-        /*implicit*/ Matrix(IdentityType = Identity, T value = T(1)) {
-            for(std::size_t i = 0; i != size; ++i)
-                (*this)[i][i] = value;
-        }
+        constexpr /*implicit*/ Matrix(IdentityType = Identity, T value = T(1)): RectangularMatrix<size, size, T>(RectangularMatrix<size, size, T>::fromDiagonal(Vector<size, T>(value))) {}
 
         /**
          * @brief %Matrix from column vectors
@@ -132,10 +129,9 @@ template<std::size_t size, class T> class Matrix: public RectangularMatrix<size,
          * Computed recursively using Laplace's formula: @f[
          *      \det(A) = \sum_{j=1}^n (-1)^{i+j} a_{i,j} \det(A^{i,j})
          * @f] @f$ A^{i, j} @f$ is matrix without i-th row and j-th column, see
-         * ij(). The formula is expanded down to 2x2 matrix, where the
-         * determinant is computed directly: @f[
-         *      \det(A) = a_{0, 0} a_{1, 1} - a_{1, 0} a_{0, 1}
-         * @f]
+         * ij(). The formula is expanded down to 4x4 matrix, where the
+         * determinant is computed directly. For 4x4 matrices the expansion
+         * is done over 2x2 sub-determinants, which are computed only once.
          */
         T determinant() const { return Implementation::MatrixDeterminant<size, T>()(*this); }
 
@@ -145,10 +141,14 @@ template<std::size_t size, class T> class Matrix: public RectangularMatrix<size,
          * Computed using Cramer's rule: @f[
          *      A^{-1} = \frac{1}{\det(A)} Adj(A)
          * @f]
-         * See invertedOrthogonal(), Matrix3::invertedRigid() and Matrix4::invertedRigid()
-         * which are faster alternatives for particular matrix types.
+         * The adjugate of 2x2, 3x3 and 4x4 matrices is computed directly,
+         * with 2x2 sub-determinants shared between the cofactors, 4x4 float
+         * matrices use SSE2 if the library is built with `TARGET_SSE2`. See
+         * invertedOrthogonal(), Matrix3::invertedRigid() and
+         * Matrix4::invertedRigid() which are faster alternatives for
+         * particular matrix types.
          */
-        Matrix<size, T> inverted() const;
+        Matrix<size, T> inverted() const { return Implementation::MatrixInverter<size, T>()(*this); }
 
         /**
          * @brief Inverted orthogonal matrix
@@ -265,6 +265,36 @@ template<std::size_t size, class T> T MatrixDeterminant<size, T>::operator()(con
     return out;
 }
 
+template<class T> class MatrixDeterminant<4, T> {
+    public:
+        T operator()(const Matrix<4, T>& m) const {
+            /* 2x2 sub-determinants of first two and last two columns */
+            const T s0 = m[0][0]*m[1][1] - m[1][0]*m[0][1];
+            const T s1 = m[0][0]*m[1][2] - m[1][0]*m[0][2];
+            const T s2 = m[0][0]*m[1][3] - m[1][0]*m[0][3];
+            const T s3 = m[0][1]*m[1][2] - m[1][1]*m[0][2];
+            const T s4 = m[0][1]*m[1][3] - m[1][1]*m[0][3];
+            const T s5 = m[0][2]*m[1][3] - m[1][2]*m[0][3];
+            const T c0 = m[2][0]*m[3][1] - m[3][0]*m[2][1];
+            const T c1 = m[2][0]*m[3][2] - m[3][0]*m[2][2];
+            const T c2 = m[2][0]*m[3][3] - m[3][0]*m[2][3];
+            const T c3 = m[2][1]*m[3][2] - m[3][1]*m[2][2];
+            const T c4 = m[2][1]*m[3][3] - m[3][1]*m[2][3];
+            const T c5 = m[2][2]*m[3][3] - m[3][2]*m[2][3];
+
+            return s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0;
+        }
+};
+
+template<class T> class MatrixDeterminant<3, T> {
+    public:
+        constexpr T operator()(const Matrix<3, T>& m) const {
+            return m[0][0]*(m[1][1]*m[2][2] - m[2][1]*m[1][2]) -
+                   m[1][0]*(m[0][1]*m[2][2] - m[2][1]*m[0][2]) +
+                   m[2][0]*(m[0][1]*m[1][2] - m[1][1]*m[0][2]);
+        }
+};
+
 template<class T> class MatrixDeterminant<2, T> {
     public:
         constexpr T operator()(const Matrix<2, T>& m) const {
@@ -279,6 +309,186 @@ template<class T> class MatrixDeterminant<1, T> {
         }
 };
 
+template<std::size_t size, class T> class MatrixInverter {
+    public:
+        Matrix<size, T> operator()(const Matrix<size, T>& m) const;
+};
+
+template<std::size_t size, class T> Matrix<size, T> MatrixInverter<size, T>::operator()(const Matrix<size, T>& m) const {
+    Matrix<size, T> out(Matrix<size, T>::Zero);
+
+    const T determinant = m.determinant();
+
+    for(std::size_t col = 0; col != size; ++col)
+        for(std::size_t row = 0; row != size; ++row)
+            out[col][row] = (((row+col) & 1) ? -1 : 1)*m.ij(row, col).determinant()/determinant;
+
+    return out;
+}
+
+/* The closed-form specializations below compute inverse of the transposed
+   matrix with row and column indices swapped, which gives the same result */
+
+template<class T> class MatrixInverter<4, T> {
+    public:
+        Matrix<4, T> operator()(const Matrix<4, T>& m) const {
+            const T s0 = m[0][0]*m[1][1] - m[1][0]*m[0][1];
+            const T s1 = m[0][0]*m[1][2] - m[1][0]*m[0][2];
+            const T s2 = m[0][0]*m[1][3] - m[1][0]*m[0][3];
+            const T s3 = m[0][1]*m[1][2] - m[1][1]*m[0][2];
+            const T s4 = m[0][1]*m[1][3] - m[1][1]*m[0][3];
+            const T s5 = m[0][2]*m[1][3] - m[1][2]*m[0][3];
+            const T c0 = m[2][0]*m[3][1] - m[3][0]*m[2][1];
+            const T c1 = m[2][0]*m[3][2] - m[3][0]*m[2][2];
+            const T c2 = m[2][0]*m[3][3] - m[3][0]*m[2][3];
+            const T c3 = m[2][1]*m[3][2] - m[3][1]*m[2][2];
+            const T c4 = m[2][1]*m[3][3] - m[3][1]*m[2][3];
+            const T c5 = m[2][2]*m[3][3] - m[3][2]*m[2][3];
+
+            const T inverseDeterminant = T(1)/(s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0);
+
+            return Matrix<4, T>(
+                Vector<4, T>( m[1][1]*c5 - m[1][2]*c4 + m[1][3]*c3,
+                             -m[0][1]*c5 + m[0][2]*c4 - m[0][3]*c3,
+                              m[3][1]*s5 - m[3][2]*s4 + m[3][3]*s3,
+                             -m[2][1]*s5 + m[2][2]*s4 - m[2][3]*s3)*inverseDeterminant,
+                Vector<4, T>(-m[1][0]*c5 + m[1][2]*c2 - m[1][3]*c1,
+                              m[0][0]*c5 - m[0][2]*c2 + m[0][3]*c1,
+                             -m[3][0]*s5 + m[3][2]*s2 - m[3][3]*s1,
+                              m[2][0]*s5 - m[2][2]*s2 + m[2][3]*s1)*inverseDeterminant,
+                Vector<4, T>( m[1][0]*c4 - m[1][1]*c2 + m[1][3]*c0,
+                             -m[0][0]*c4 + m[0][1]*c2 - m[0][3]*c0,
+                              m[3][0]*s4 - m[3][1]*s2 + m[3][3]*s0,
+                             -m[2][0]*s4 + m[2][1]*s2 - m[2][3]*s0)*inverseDeterminant,
+                Vector<4, T>(-m[1][0]*c3 + m[1][1]*c1 - m[1][2]*c0,
+                              m[0][0]*c3 - m[0][1]*c1 + m[0][2]*c0,
+                             -m[3][0]*s3 + m[3][1]*s1 - m[3][2]*s0,
+                              m[2][0]*s3 - m[2][1]*s1 + m[2][2]*s0)*inverseDeterminant);
+        }
+};
+
+template<class T> class MatrixInverter<3, T> {
+    public:
+        Matrix<3, T> operator()(const Matrix<3, T>& m) const {
+            const T c0 = m[1][1]*m[2][2] - m[1][2]*m[2][1];
+            const T c1 = m[1][2]*m[2][0] - m[1][0]*m[2][2];
+            const T c2 = m[1][0]*m[2][1] - m[1][1]*m[2][0];
+
+            const T inverseDeterminant = T(1)/(m[0][0]*c0 + m[0][1]*c1 + m[0][2]*c2);
+
+            return Matrix<3, T>(
+                Vector<3, T>(c0, m[0][2]*m[2][1] - m[0][1]*m[2][2], m[0][1]*m[1][2] - m[0][2]*m[1][1])*inverseDeterminant,
+                Vector<3, T>(c1, m[0][0]*m[2][2] - m[0][2]*m[2][0], m[0][2]*m[1][0] - m[0][0]*m[1][2])*inverseDeterminant,
+                Vector<3, T>(c2, m[0][1]*m[2][0] - m[0][0]*m[2][1], m[0][0]*m[1][1] - m[0][1]*m[1][0])*inverseDeterminant);
+        }
+};
+
+template<class T> class MatrixInverter<2, T> {
+    public:
+        Matrix<2, T> operator()(const Matrix<2, T>& m) const {
+            const T inverseDeterminant = T(1)/(m[0][0]*m[1][1] - m[1][0]*m[0][1]);
+            return Matrix<2, T>(
+                Vector<2, T>( m[1][1], -m[0][1])*inverseDeterminant,
+                Vector<2, T>(-m[1][0],  m[0][0])*inverseDeterminant);
+        }
+};
+
+#ifdef MAGNUM_TARGET_SSE2
+/* Block-wise inverse of 4x4 float matrix. The matrix is split into four 2x2
+   blocks A, B, C, D (each stored row by row in one register), the adjugate
+   is then computed from 2x2 products of the blocks. As above, the columns
+   are treated as rows. */
+namespace Sse {
+    /* A*B */
+    inline __m128 mul2x2(__m128 a, __m128 b) {
+        return _mm_add_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, shuffle(0, 3, 0, 3))),
+                          _mm_mul_ps(_mm_shuffle_ps(a, a, shuffle(1, 0, 3, 2)), _mm_shuffle_ps(b, b, shuffle(2, 1, 2, 1))));
+    }
+
+    /* Adj(A)*B */
+    inline __m128 adjugateMul2x2(__m128 a, __m128 b) {
+        return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, shuffle(3, 3, 0, 0)), b),
+                          _mm_mul_ps(_mm_shuffle_ps(a, a, shuffle(1, 1, 2, 2)), _mm_shuffle_ps(b, b, shuffle(2, 3, 0, 1))));
+    }
+
+    /* A*Adj(B) */
+    inline __m128 mulAdjugate2x2(__m128 a, __m128 b) {
+        return _mm_sub_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, shuffle(3, 0, 3, 0))),
+                          _mm_mul_ps(_mm_shuffle_ps(a, a, shuffle(1, 0, 3, 2)), _mm_shuffle_ps(b, b, shuffle(2, 1, 2, 1))));
+    }
+
+    struct Blocks {
+        __m128 a, b, c, d, determinants, aB, dC;
+
+        explicit Blocks(const Float* data) {
+            const __m128 col0 = _mm_loadu_ps(data);
+            const __m128 col1 = _mm_loadu_ps(data + 4);
+            const __m128 col2 = _mm_loadu_ps(data + 8);
+            const __m128 col3 = _mm_loadu_ps(data + 12);
+
+            a = _mm_movelh_ps(col0, col1);
+            b = _mm_movehl_ps(col1, col0);
+            c = _mm_movelh_ps(col2, col3);
+            d = _mm_movehl_ps(col3, col2);
+
+            /* Determinants of the blocks as (|A| |B| |C| |D|) */
+            determinants = _mm_sub_ps(
+                _mm_mul_ps(_mm_shuffle_ps(col0, col2, shuffle(0, 2, 0, 2)), _mm_shuffle_ps(col1, col3, shuffle(1, 3, 1, 3))),
+                _mm_mul_ps(_mm_shuffle_ps(col0, col2, shuffle(1, 3, 1, 3)), _mm_shuffle_ps(col1, col3, shuffle(0, 2, 0, 2))));
+
+            aB = adjugateMul2x2(a, b);
+            dC = adjugateMul2x2(d, c);
+        }
+
+        /* |M| = |A||D| + |B||C| - tr(Adj(A)*B*Adj(D)*C) */
+        __m128 determinant() const {
+            return _mm_sub_ps(_mm_add_ps(
+                _mm_mul_ps(broadcast<0>(determinants), broadcast<3>(determinants)),
+                _mm_mul_ps(broadcast<1>(determinants), broadcast<2>(determinants))),
+                sum(_mm_mul_ps(aB, _mm_shuffle_ps(dC, dC, shuffle(0, 2, 1, 3)))));
+        }
+    };
+}
+
+template<> class MatrixDeterminant<4, Float> {
+    public:
+        Float operator()(const Matrix<4, Float>& m) const {
+            return _mm_cvtss_f32(Sse::Blocks(m.data()).determinant());
+        }
+};
+
+template<> class MatrixInverter<4, Float> {
+    public:
+        Matrix<4, Float> operator()(const Matrix<4, Float>& m) const {
+            const Sse::Blocks blocks(m.data());
+            const __m128 determinantA = Sse::broadcast<0>(blocks.determinants);
+            const __m128 determinantB = Sse::broadcast<1>(blocks.determinants);
+            const __m128 determinantC = Sse::broadcast<2>(blocks.determinants);
+            const __m128 determinantD = Sse::broadcast<3>(blocks.determinants);
+
+            /* Adjugates of the inverse blocks */
+            __m128 x = _mm_sub_ps(_mm_mul_ps(determinantD, blocks.a), Sse::mul2x2(blocks.b, blocks.dC));
+            __m128 w = _mm_sub_ps(_mm_mul_ps(determinantA, blocks.d), Sse::mul2x2(blocks.c, blocks.aB));
+            __m128 y = _mm_sub_ps(_mm_mul_ps(determinantB, blocks.c), Sse::mulAdjugate2x2(blocks.d, blocks.aB));
+            __m128 z = _mm_sub_ps(_mm_mul_ps(determinantC, blocks.b), Sse::mulAdjugate2x2(blocks.a, blocks.dC));
+
+            const __m128 inverseDeterminant = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), blocks.determinant());
+            x = _mm_mul_ps(x, inverseDeterminant);
+            y = _mm_mul_ps(y, inverseDeterminant);
+            z = _mm_mul_ps(z, inverseDeterminant);
+            w = _mm_mul_ps(w, inverseDeterminant);
+
+            /* Apply the adjugate and put the blocks back together */
+            Matrix<4, Float> out(Matrix<4, Float>::Zero);
+            _mm_storeu_ps(out.data(), _mm_shuffle_ps(x, y, Sse::shuffle(3, 1, 3, 1)));
+            _mm_storeu_ps(out.data() + 4, _mm_shuffle_ps(x, y, Sse::shuffle(2, 0, 2, 0)));
+            _mm_storeu_ps(out.data() + 8, _mm_shuffle_ps(z, w, Sse::shuffle(3, 1, 3, 1)));
+            _mm_storeu_ps(out.data() + 12, _mm_shuffle_ps(z, w, Sse::shuffle(2, 0, 2, 0)));
+            return out;
+        }
+};
+#endif
+
 }
 #endif
 
@@ -307,17 +517,28 @@ template<std::size_t size, class T> Matrix<size-1, T> Matrix<size, T>::ij(const
     return out;
 }
 
-template<std::size_t size, class T> Matrix<size, T> Matrix<size, T>::inverted() const {
-    Matrix<size, T> out(Zero);
+#if defined(MAGNUM_TARGET_SSE2) && !defined(DOXYGEN_GENERATING_OUTPUT)
+template<> inline Matrix<4, Float> Matrix<4, Float>::operator*(const Matrix<4, Float>& other) const {
+    const __m128 col0 = _mm_loadu_ps(data());
+    const __m128 col1 = _mm_loadu_ps(data() + 4);
+    const __m128 col2 = _mm_loadu_ps(data() + 8);
+    const __m128 col3 = _mm_loadu_ps(data() + 12);
 
-    const T _determinant = determinant();
-
-    for(std::size_t col = 0; col != size; ++col)
-        for(std::size_t row = 0; row != size; ++row)
-            out[col][row] = (((row+col) & 1) ? -1 : 1)*ij(row, col).determinant()/_determinant;
+    Matrix<4, Float> out(Zero);
+    for(std::size_t i = 0; i != 4; ++i)
+        _mm_storeu_ps(out.data() + i*4, Implementation::Sse::combine(col0, col1, col2, col3, _mm_loadu_ps(other.data() + i*4)));
+    return out;
+}
 
+template<> inline Vector<4, Float> Matrix<4, Float>::operator*(const Vector<4, Float>& other) const {
+    Vector<4, Float> out;
+    _mm_storeu_ps(out.data(), Implementation::Sse::combine(
+        _mm_loadu_ps(data()), _mm_loadu_ps(data() + 4),
+        _mm_loadu_ps(data() + 8), _mm_loadu_ps(data() + 12),
+        _mm_loadu_ps(other.data())));
     return out;
 }
+#endif
 
 }}
 
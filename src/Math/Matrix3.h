@@ -76,10 +76,24 @@ template<class T> class Matrix3: public Matrix<3, T> {
          * @brief 2D rotation matrix
          * @param angle     Rotation angle (counterclockwise)
          *
-         * @see rotation() const, Complex::rotation(), DualComplex::rotation(),
-         *      Matrix4::rotation(Rad, const Vector3&)
+         * @see rotationConstant(), rotation() const, Complex::rotation(),
+         *      DualComplex::rotation(), Matrix4::rotation(Rad, const Vector3&)
          */
-        static Matrix3<T> rotation(Rad<T> angle);
+        static Matrix3<T> rotation(Rad<T> angle) {
+            return rotationInternal(std::sin(T(angle)), std::cos(T(angle)));
+        }
+
+        /**
+         * @brief 2D rotation matrix usable in constant expressions
+         *
+         * Same as rotation(Rad), but the sine and cosine are computed using
+         * Taylor series, so the matrix can be computed at compile time. Less
+         * precise and slower than rotation(Rad) at runtime, expects finite
+         * angle.
+         */
+        constexpr static Matrix3<T> rotationConstant(Rad<T> angle) {
+            return rotationInternal(Implementation::sin(angle), Implementation::cos(angle));
+        }
 
         /**
          * @brief 2D reflection matrix
@@ -100,8 +114,8 @@ template<class T> class Matrix3: public Matrix<3, T> {
          *
          * @see Matrix4::orthographicProjection(), Matrix4::perspectiveProjection()
          */
-        static Matrix3<T> projection(const Vector2<T>& size) {
-            return scaling(2.0f/size);
+        constexpr static Matrix3<T> projection(const Vector2<T>& size) {
+            return scaling(T(2)/size);
         }
 
         /**
@@ -128,13 +142,8 @@ template<class T> class Matrix3: public Matrix<3, T> {
          * Creates identity matrix. You can also explicitly call this
          * constructor with `Matrix3 m(Matrix3::Identity);`. Optional parameter
          * @p value allows you to specify value on diagonal.
-         * @todo Use constexpr implementation in Matrix, when done
          */
-        constexpr /*implicit*/ Matrix3(typename Matrix<3, T>::IdentityType = (Matrix<3, T>::Identity), T value = T(1)): Matrix<3, T>(
-            Vector<3, T>(value,  T(0),  T(0)),
-            Vector<3, T>( T(0), value,  T(0)),
-            Vector<3, T>( T(0),  T(0), value)
-        ) {}
+        constexpr /*implicit*/ Matrix3(typename Matrix<3, T>::IdentityType = (Matrix<3, T>::Identity), T value = T(1)): Matrix<3, T>(Matrix<3, T>::Identity, value) {}
 
         /** @brief %Matrix from column vectors */
         constexpr /*implicit*/ Matrix3(const Vector3<T>& first, const Vector3<T>& second, const Vector3<T>& third): Matrix<3, T>(first, second, third) {}
@@ -300,6 +309,10 @@ template<class T> class Matrix3: public Matrix<3, T> {
 
         MAGNUM_RECTANGULARMATRIX_SUBCLASS_IMPLEMENTATION(3, 3, Matrix3<T>)
         MAGNUM_MATRIX_SUBCLASS_IMPLEMENTATION(3, Matrix3, Vector3)
+
+    private:
+        /* Used in rotation() and rotationConstant() */
+        constexpr static Matrix3<T> rotationInternal(T sine, T cosine);
 };
 
 MAGNUM_MATRIXn_OPERATOR_IMPLEMENTATION(3, Matrix3)
@@ -309,10 +322,7 @@ template<class T> inline Corrade::Utility::Debug operator<<(Corrade::Utility::De
     return debug << static_cast<const Matrix<3, T>&>(value);
 }
 
-template<class T> Matrix3<T> Matrix3<T>::rotation(const Rad<T> angle) {
-    const T sine = std::sin(T(angle));
-    const T cosine = std::cos(T(angle));
-
+template<class T> constexpr Matrix3<T> Matrix3<T>::rotationInternal(const T sine, const T cosine) {
     return {{ cosine,   sine, T(0)},
             {  -sine, cosine, T(0)},
             {   T(0),   T(0), T(1)}};
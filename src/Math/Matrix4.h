@@ -97,30 +97,75 @@ template<class T> class Matrix4: public Matrix<4, T> {
          * @param angle Rotation angle (counterclockwise)
          *
          * Faster than calling `Matrix4::rotation(angle, Vector3::xAxis())`.
-         * @see rotation(Rad, const Vector3&), rotationY(), rotationZ(),
-         *      rotation() const, Quaternion::rotation(), Matrix3::rotation(Rad)
+         * @see rotationXConstant(), rotation(Rad, const Vector3&),
+         *      rotationY(), rotationZ(), rotation() const,
+         *      Quaternion::rotation(), Matrix3::rotation(Rad)
          */
-        static Matrix4<T> rotationX(Rad<T> angle);
+        static Matrix4<T> rotationX(Rad<T> angle) {
+            return rotationXInternal(std::sin(T(angle)), std::cos(T(angle)));
+        }
+
+        /**
+         * @brief 3D rotation around X axis usable in constant expressions
+         *
+         * Same as rotationX(), but the sine and cosine are computed using
+         * Taylor series, so the matrix can be computed at compile time. Less
+         * precise and slower than rotationX() at runtime, expects finite
+         * angle.
+         */
+        constexpr static Matrix4<T> rotationXConstant(Rad<T> angle) {
+            return rotationXInternal(Implementation::sin(angle), Implementation::cos(angle));
+        }
 
         /**
          * @brief 3D rotation around Y axis
          * @param angle Rotation angle (counterclockwise)
          *
          * Faster than calling `Matrix4::rotation(angle, Vector3::yAxis())`.
-         * @see rotation(Rad, const Vector3&), rotationX(), rotationZ(),
-         *      rotation() const, Quaternion::rotation(), Matrix3::rotation(Rad)
+         * @see rotationYConstant(), rotation(Rad, const Vector3&),
+         *      rotationX(), rotationZ(), rotation() const,
+         *      Quaternion::rotation(), Matrix3::rotation(Rad)
+         */
+        static Matrix4<T> rotationY(Rad<T> angle) {
+            return rotationYInternal(std::sin(T(angle)), std::cos(T(angle)));
+        }
+
+        /**
+         * @brief 3D rotation around Y axis usable in constant expressions
+         *
+         * Same as rotationY(), but the sine and cosine are computed using
+         * Taylor series, so the matrix can be computed at compile time. Less
+         * precise and slower than rotationY() at runtime, expects finite
+         * angle.
          */
-        static Matrix4<T> rotationY(Rad<T> angle);
+        constexpr static Matrix4<T> rotationYConstant(Rad<T> angle) {
+            return rotationYInternal(Implementation::sin(angle), Implementation::cos(angle));
+        }
 
         /**
          * @brief 3D rotation matrix around Z axis
          * @param angle Rotation angle (counterclockwise)
          *
          * Faster than calling `Matrix4::rotation(angle, Vector3::zAxis())`.
-         * @see rotation(Rad, const Vector3&), rotationX(), rotationY(),
-         *      rotation() const, Quaternion::rotation(), Matrix3::rotation(Rad)
+         * @see rotationZConstant(), rotation(Rad, const Vector3&),
+         *      rotationX(), rotationY(), rotation() const,
+         *      Quaternion::rotation(), Matrix3::rotation(Rad)
          */
-        static Matrix4<T> rotationZ(Rad<T> angle);
+        static Matrix4<T> rotationZ(Rad<T> angle) {
+            return rotationZInternal(std::sin(T(angle)), std::cos(T(angle)));
+        }
+
+        /**
+         * @brief 3D rotation around Z axis usable in constant expressions
+         *
+         * Same as rotationZ(), but the sine and cosine are computed using
+         * Taylor series, so the matrix can be computed at compile time. Less
+         * precise and slower than rotationZ() at runtime, expects finite
+         * angle.
+         */
+        constexpr static Matrix4<T> rotationZConstant(Rad<T> angle) {
+            return rotationZInternal(Implementation::sin(angle), Implementation::cos(angle));
+        }
 
         /**
          * @brief 3D reflection matrix
@@ -139,7 +184,7 @@ template<class T> class Matrix4: public Matrix<4, T> {
          *
          * @see perspectiveProjection(), Matrix3::projection()
          */
-        static Matrix4<T> orthographicProjection(const Vector2<T>& size, T near, T far);
+        constexpr static Matrix4<T> orthographicProjection(const Vector2<T>& size, T near, T far);
 
         /**
          * @brief 3D perspective projection matrix
@@ -149,7 +194,7 @@ template<class T> class Matrix4: public Matrix<4, T> {
          *
          * @see orthographicProjection(), Matrix3::projection()
          */
-        static Matrix4<T> perspectiveProjection(const Vector2<T>& size, T near, T far);
+        constexpr static Matrix4<T> perspectiveProjection(const Vector2<T>& size, T near, T far);
 
         /**
          * @brief 3D perspective projection matrix
@@ -190,14 +235,8 @@ template<class T> class Matrix4: public Matrix<4, T> {
          * Creates identity matrix. You can also explicitly call this
          * constructor with `Matrix4 m(Matrix4::Identity);`. Optional parameter
          * @p value allows you to specify value on diagonal.
-         * @todo Use constexpr implementation in Matrix, when done
          */
-        constexpr /*implicit*/ Matrix4(typename Matrix<4, T>::IdentityType = (Matrix<4, T>::Identity), T value = T(1)): Matrix<4, T>(
-            Vector<4, T>(value,  T(0),  T(0),  T(0)),
-            Vector<4, T>( T(0), value,  T(0),  T(0)),
-            Vector<4, T>( T(0),  T(0), value,  T(0)),
-            Vector<4, T>( T(0),  T(0),  T(0), value)
-        ) {}
+        constexpr /*implicit*/ Matrix4(typename Matrix<4, T>::IdentityType = (Matrix<4, T>::Identity), T value = T(1)): Matrix<4, T>(Matrix<4, T>::Identity, value) {}
 
         /** @brief %Matrix from column vectors */
         constexpr /*implicit*/ Matrix4(const Vector4<T>& first, const Vector4<T>& second, const Vector4<T>& third, const Vector4<T>& fourth): Matrix<4, T>(first, second, third, fourth) {}
@@ -368,6 +407,13 @@ template<class T> class Matrix4: public Matrix<4, T> {
 
         MAGNUM_RECTANGULARMATRIX_SUBCLASS_IMPLEMENTATION(4, 4, Matrix4<T>)
         MAGNUM_MATRIX_SUBCLASS_IMPLEMENTATION(4, Matrix4, Vector4)
+
+    private:
+        /* Used in rotationX(), rotationY(), rotationZ() and their constexpr
+           variants */
+        constexpr static Matrix4<T> rotationXInternal(T sine, T cosine);
+        constexpr static Matrix4<T> rotationYInternal(T sine, T cosine);
+        constexpr static Matrix4<T> rotationZInternal(T sine, T cosine);
 };
 
 MAGNUM_MATRIXn_OPERATOR_IMPLEMENTATION(4, Matrix4)
@@ -409,30 +455,21 @@ template<class T> Matrix4<T> Matrix4<T>::rotation(const Rad<T> angle, const Vect
     };
 }
 
-template<class T> Matrix4<T> Matrix4<T>::rotationX(const Rad<T> angle) {
-    const T sine = std::sin(T(angle));
-    const T cosine = std::cos(T(angle));
-
+template<class T> constexpr Matrix4<T> Matrix4<T>::rotationXInternal(const T sine, const T cosine) {
     return {{T(1),   T(0),   T(0), T(0)},
             {T(0), cosine,   sine, T(0)},
             {T(0),  -sine, cosine, T(0)},
             {T(0),   T(0),   T(0), T(1)}};
 }
 
-template<class T> Matrix4<T> Matrix4<T>::rotationY(const Rad<T> angle) {
-    const T sine = std::sin(T(angle));
-    const T cosine = std::cos(T(angle));
-
+template<class T> constexpr Matrix4<T> Matrix4<T>::rotationYInternal(const T sine, const T cosine) {
     return {{cosine, T(0),  -sine, T(0)},
             {  T(0), T(1),   T(0), T(0)},
             {  sine, T(0), cosine, T(0)},
             {  T(0), T(0),   T(0), T(1)}};
 }
 
-template<class T> Matrix4<T> Matrix4<T>::rotationZ(const Rad<T> angle) {
-    const T sine = std::sin(T(angle));
-    const T cosine = std::cos(T(angle));
-
+template<class T> constexpr Matrix4<T> Matrix4<T>::rotationZInternal(const T sine, const T cosine) {
     return {{cosine,   sine, T(0), T(0)},
             { -sine, cosine, T(0), T(0)},
             {  T(0),   T(0), T(1), T(0)},
@@ -445,24 +482,18 @@ template<class T> Matrix4<T> Matrix4<T>::reflection(const Vector3<T>& normal) {
     return from(Matrix<3, T>() - T(2)*normal*RectangularMatrix<1, 3, T>(normal).transposed(), {});
 }
 
-template<class T> Matrix4<T> Matrix4<T>::orthographicProjection(const Vector2<T>& size, const T near, const T far) {
-    const Vector2<T> xyScale = T(2.0)/size;
-    const T zScale = T(2.0)/(near-far);
-
-    return {{xyScale.x(),        T(0),             T(0), T(0)},
-            {       T(0), xyScale.y(),             T(0), T(0)},
-            {       T(0),        T(0),           zScale, T(0)},
-            {       T(0),        T(0), near*zScale-T(1), T(1)}};
+template<class T> constexpr Matrix4<T> Matrix4<T>::orthographicProjection(const Vector2<T>& size, const T near, const T far) {
+    return {{T(2)/size.x(),          T(0),                          T(0), T(0)},
+            {         T(0), T(2)/size.y(),                          T(0), T(0)},
+            {         T(0),          T(0),              T(2)/(near-far), T(0)},
+            {         T(0),          T(0), near*(T(2)/(near-far)) - T(1), T(1)}};
 }
 
-template<class T> Matrix4<T> Matrix4<T>::perspectiveProjection(const Vector2<T>& size, const T near, const T far) {
-    Vector2<T> xyScale = 2*near/size;
-    T zScale = T(1.0)/(near-far);
-
-    return {{xyScale.x(),        T(0),                 T(0),  T(0)},
-            {       T(0), xyScale.y(),                 T(0),  T(0)},
-            {       T(0),        T(0),    (far+near)*zScale, T(-1)},
-            {       T(0),        T(0), T(2)*far*near*zScale,  T(0)}};
+template<class T> constexpr Matrix4<T> Matrix4<T>::perspectiveProjection(const Vector2<T>& size, const T near, const T far) {
+    return {{T(2)*near/size.x(),               T(0),                          T(0),  T(0)},
+            {              T(0), T(2)*near/size.y(),                          T(0),  T(0)},
+            {              T(0),               T(0),    (far+near)*(T(1)/(near-far)), T(-1)},
+            {              T(0),               T(0), T(2)*far*near*(T(1)/(near-far)),  T(0)}};
 }
 
 template<class T> inline Matrix<3, T> Matrix4<T>::rotation() const {
@@ -490,6 +521,26 @@ template<class T> Matrix4<T> Matrix4<T>::invertedRigid() const {
     return from(inverseRotation, inverseRotation*-translation());
 }
 
+#if defined(MAGNUM_TARGET_SSE2) && !defined(DOXYGEN_GENERATING_OUTPUT)
+template<> inline Vector3<Float> Matrix4<Float>::transformVector(const Vector3<Float>& vector) const {
+    Vector4<Float> out;
+    _mm_storeu_ps(out.data(), Implementation::Sse::combine(
+        _mm_loadu_ps(data()), _mm_loadu_ps(data() + 4),
+        _mm_loadu_ps(data() + 8), _mm_setzero_ps(),
+        _mm_setr_ps(vector.x(), vector.y(), vector.z(), 0.0f)));
+    return out.xyz();
+}
+
+template<> inline Vector3<Float> Matrix4<Float>::transformPoint(const Vector3<Float>& vector) const {
+    Vector4<Float> out;
+    _mm_storeu_ps(out.data(), Implementation::Sse::combine(
+        _mm_loadu_ps(data()), _mm_loadu_ps(data() + 4),
+        _mm_loadu_ps(data() + 8), _mm_loadu_ps(data() + 12),
+        _mm_setr_ps(vector.x(), vector.y(), vector.z(), 1.0f)));
+    return out.xyz();
+}
+#endif
+
 }}
 
 namespace Corrade { namespace Utility {
@@ -38,6 +38,27 @@
 
 namespace Magnum { namespace Math {
 
+namespace Implementation {
+    /* Used in Quaternion::slerpFast(). Polynomial approximation of
+       sin(tθ)/sin(θ) in terms of cos(θ) - 1, after D. Eberly, A Fast and
+       Accurate Algorithm for Computing SLERP. The series is truncated after
+       twelve terms and the last term is scaled to minimize the error for
+       θ in [0, π/2]. */
+    template<class T> T slerpCoefficient(const T t, const T cosAngleMinusOne) {
+        const T mu(1.896);
+        const T u[]{T(1)/T(3), T(1)/T(10), T(1)/T(21), T(1)/T(36), T(1)/T(55), T(1)/T(78),
+                    T(1)/T(105), T(1)/T(136), T(1)/T(171), T(1)/T(210), T(1)/T(253), mu/T(300)};
+        const T v[]{T(1)/T(3), T(2)/T(5), T(3)/T(7), T(4)/T(9), T(5)/T(11), T(6)/T(13),
+                    T(7)/T(15), T(8)/T(17), T(9)/T(19), T(10)/T(21), T(11)/T(23), mu*T(12)/T(25)};
+
+        const T t2 = t*t;
+        T out(1);
+        for(Int i = 11; i >= 0; --i)
+            out = T(1) + (u[i]*t2 - v[i])*cosAngleMinusOne*out;
+        return t*out;
+    }
+}
+
 /**
 @brief %Quaternion
 @tparam T   Underlying data type
@@ -96,10 +117,26 @@ template<class T> class Quaternion {
          *      ~~~~~~~~~~
          *      \theta = acos \left( \frac{q_A \cdot q_B}{|q_A| \cdot |q_B|} \right) = acos(q_A \cdot q_B)
          * @f]
-         * @see isNormalized(), lerp()
+         * @see isNormalized(), lerp(), slerpFast()
          */
         static Quaternion<T> slerp(const Quaternion<T>& normalizedA, const Quaternion<T>& normalizedB, T t);
 
+        /**
+         * @brief Approximate spherical linear interpolation of two quaternions
+         *
+         * Faster alternative to slerp(), which evaluates polynomial
+         * approximation of the interpolation coefficients instead of
+         * computing the angle and its sines. Expects that both quaternions
+         * are normalized. If the angle between them is not larger than
+         * @f$ \frac{\pi}{2} @f$ (i.e. dot product is nonnegative), the
+         * coefficients differ from slerp() ones by at most
+         * @f$ 2 \cdot 10^{-6} @f$ for @ref Magnum::Float "Float", otherwise
+         * the precise slerp() is used. Unlike slerp(), the result is defined
+         * also for equal quaternions.
+         * @see isNormalized(), lerp()
+         */
+        static Quaternion<T> slerpFast(const Quaternion<T>& normalizedA, const Quaternion<T>& normalizedB, T t);
+
         /**
          * @brief Rotation quaternion
          * @param angle             Rotation angle (counterclockwise)
@@ -510,6 +547,15 @@ template<class T> inline Quaternion<T> Quaternion<T>::slerp(const Quaternion<T>&
     return (std::sin((T(1) - t)*a)*normalizedA + std::sin(t*a)*normalizedB)/std::sin(a);
 }
 
+template<class T> inline Quaternion<T> Quaternion<T>::slerpFast(const Quaternion<T>& normalizedA, const Quaternion<T>& normalizedB, const T t) {
+    CORRADE_ASSERT(normalizedA.isNormalized() && normalizedB.isNormalized(),
+        "Math::Quaternion::slerpFast(): quaternions must be normalized", Quaternion<T>({}, std::numeric_limits<T>::quiet_NaN()));
+    const T cosAngle = dot(normalizedA, normalizedB);
+    if(cosAngle < T(0)) return slerp(normalizedA, normalizedB, t);
+    return Implementation::slerpCoefficient(T(1) - t, cosAngle - T(1))*normalizedA +
+           Implementation::slerpCoefficient(t, cosAngle - T(1))*normalizedB;
+}
+
 template<class T> inline Quaternion<T> Quaternion<T>::rotation(const Rad<T> angle, const Vector3<T>& normalizedAxis) {
     CORRADE_ASSERT(normalizedAxis.isNormalized(),
         "Math::Quaternion::rotation(): axis must be normalized", {});
@@ -551,6 +597,27 @@ template<class T> inline Quaternion<T> Quaternion<T>::operator*(const Quaternion
             _scalar*other._scalar - Vector3<T>::dot(_vector, other._vector)};
 }
 
+#if defined(MAGNUM_TARGET_SSE2) && !defined(DOXYGEN_GENERATING_OUTPUT)
+template<> inline Quaternion<Float> Quaternion<Float>::operator*(const Quaternion<Float>& other) const {
+    static_assert(sizeof(Quaternion<Float>) == 4*sizeof(Float), "Improper size of Quaternion");
+    using namespace Implementation::Sse;
+
+    /* Components are in order (x, y, z, w), each component of this
+       quaternion multiplies permuted components of the other */
+    const __m128 a = _mm_loadu_ps(_vector.data());
+    const __m128 b = _mm_loadu_ps(other._vector.data());
+    const __m128 out = _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(broadcast<3>(a), b),
+                   _mm_mul_ps(broadcast<0>(a), _mm_xor_ps(_mm_shuffle_ps(b, b, shuffle(3, 2, 1, 0)), _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f)))),
+        _mm_add_ps(_mm_mul_ps(broadcast<1>(a), _mm_xor_ps(_mm_shuffle_ps(b, b, shuffle(2, 3, 0, 1)), _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f))),
+                   _mm_mul_ps(broadcast<2>(a), _mm_xor_ps(_mm_shuffle_ps(b, b, shuffle(1, 0, 3, 2)), _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f)))));
+
+    Quaternion<Float> result;
+    _mm_storeu_ps(result._vector.data(), out);
+    return result;
+}
+#endif
+
 template<class T> inline Quaternion<T> Quaternion<T>::invertedNormalized() const {
     CORRADE_ASSERT(isNormalized(), "Math::Quaternion::invertedNormalized(): quaternion must be normalized",
         Quaternion<T>({}, std::numeric_limits<T>::quiet_NaN()));
@@ -88,9 +88,10 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
          * @brief Construct diagonal matrix
          *
          * @see diagonal()
-         * @todo make this constexpr
          */
-        static RectangularMatrix<cols, rows, T> fromDiagonal(const Vector<DiagonalSize, T>& diagonal);
+        constexpr static RectangularMatrix<cols, rows, T> fromDiagonal(const Vector<DiagonalSize, T>& diagonal) {
+            return RectangularMatrix<cols, rows, T>(typename Implementation::GenerateSequence<cols>::Type(), diagonal);
+        }
 
         /**
          * @brief Construct matrix from vector
@@ -342,9 +343,10 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
          * @brief Values on diagonal
          *
          * @see fromDiagonal()
-         * @todo constexpr
          */
-        Vector<DiagonalSize, T> diagonal() const;
+        constexpr Vector<DiagonalSize, T> diagonal() const {
+            return diagonalInternal(typename Implementation::GenerateSequence<DiagonalSize>::Type());
+        }
 
         /**
          * @brief Convert matrix to vector
@@ -363,6 +365,19 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
         /* Implementation for RectangularMatrix<cols, rows, T>::RectangularMatrix(const RectangularMatrix<cols, rows, U>&) */
         template<class U, std::size_t ...sequence> constexpr explicit RectangularMatrix(Implementation::Sequence<sequence...>, const RectangularMatrix<cols, rows, U>& matrix): _data{Vector<rows, T>(matrix[sequence])...} {}
 
+        /* Implementation for fromDiagonal() */
+        template<std::size_t ...sequence> constexpr explicit RectangularMatrix(Implementation::Sequence<sequence...>, const Vector<DiagonalSize, T>& diagonal): _data{diagonalColumn(typename Implementation::GenerateSequence<rows>::Type(), sequence, sequence < DiagonalSize ? diagonal[sequence] : T(0))...} {}
+
+        /* Column with given value at given position and zeros elsewhere */
+        template<std::size_t ...sequence> constexpr static Vector<rows, T> diagonalColumn(Implementation::Sequence<sequence...>, std::size_t col, T value) {
+            return {(sequence == col ? value : T(0))...};
+        }
+
+        /* Implementation for diagonal() */
+        template<std::size_t ...sequence> constexpr Vector<DiagonalSize, T> diagonalInternal(Implementation::Sequence<sequence...>) const {
+            return {_data[sequence][sequence]...};
+        }
+
         Vector<rows, T> _data[cols];
 };
 
@@ -593,15 +608,6 @@ extern template Corrade::Utility::Debug MAGNUM_EXPORT operator<<(Corrade::Utilit
     }
 #endif
 
-template<std::size_t cols, std::size_t rows, class T> inline RectangularMatrix<cols, rows, T> RectangularMatrix<cols, rows, T>::fromDiagonal(const Vector<DiagonalSize, T>& diagonal) {
-    RectangularMatrix<cols, rows, T> out;
-
-    for(std::size_t i = 0; i != DiagonalSize; ++i)
-        out[i][i] = diagonal[i];
-
-    return out;
-}
-
 template<std::size_t cols, std::size_t rows, class T> inline Vector<cols, T> RectangularMatrix<cols, rows, T>::row(std::size_t row) const {
     Vector<cols, T> out;
 
@@ -641,15 +647,6 @@ template<std::size_t cols, std::size_t rows, class T> inline RectangularMatrix<r
     return out;
 }
 
-template<std::size_t cols, std::size_t rows, class T> auto RectangularMatrix<cols, rows, T>::diagonal() const -> Vector<DiagonalSize, T> {
-    Vector<DiagonalSize, T> out;
-
-    for(std::size_t i = 0; i != DiagonalSize; ++i)
-        out[i] = _data[i][i];
-
-    return out;
-}
-
 }}
 
 namespace Corrade { namespace Utility {
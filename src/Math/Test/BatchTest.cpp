@@ -0,0 +1,338 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <TestSuite/Tester.h>
+
+#include "Math/Batch.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+class BatchTest: public Corrade::TestSuite::Tester {
+    public:
+        explicit BatchTest();
+
+        void stridedArrayReference();
+
+        void transformPoints2D();
+        void transformPoints3D();
+        void transformPointsStrided();
+        void transformVectors2D();
+        void transformVectors3D();
+        void transformVectorsQuaternion();
+        void transformVectorsQuaternionNotNormalized();
+        void translate();
+        void normalize();
+        void normalizeStrided();
+        void dot();
+        void cross();
+        void minmax();
+        void minmaxEmpty();
+        void sizeMismatch();
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Matrix3<Float> Matrix3;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Quaternion<Float> Quaternion;
+typedef Math::Vector2<Float> Vector2;
+typedef Math::Vector3<Float> Vector3;
+
+struct Vertex {
+    Vector3 position;
+    Vector2 textureCoordinates;
+};
+
+BatchTest::BatchTest() {
+    addTests({&BatchTest::stridedArrayReference,
+
+              &BatchTest::transformPoints2D,
+              &BatchTest::transformPoints3D,
+              &BatchTest::transformPointsStrided,
+              &BatchTest::transformVectors2D,
+              &BatchTest::transformVectors3D,
+              &BatchTest::transformVectorsQuaternion,
+              &BatchTest::transformVectorsQuaternionNotNormalized,
+              &BatchTest::translate,
+              &BatchTest::normalize,
+              &BatchTest::normalizeStrided,
+              &BatchTest::dot,
+              &BatchTest::cross,
+              &BatchTest::minmax,
+              &BatchTest::minmaxEmpty,
+              &BatchTest::sizeMismatch});
+}
+
+void BatchTest::stridedArrayReference() {
+    Vertex vertices[3]{
+        {{1.0f, 2.0f, 3.0f}, {}},
+        {{4.0f, 5.0f, 6.0f}, {}},
+        {{7.0f, 8.0f, 9.0f}, {}}
+    };
+
+    Batch::StridedArrayReference<Vector3> a(&vertices[0].position, 3, sizeof(Vertex));
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a.stride(), sizeof(Vertex));
+    CORRADE_VERIFY(!a.empty());
+    CORRADE_VERIFY(!a.isContiguous());
+    CORRADE_COMPARE(a[2], Vector3(7.0f, 8.0f, 9.0f));
+
+    /* Const conversion */
+    Batch::StridedArrayReference<const Vector3> b = a;
+    CORRADE_VERIFY(b.data() == a.data());
+    CORRADE_COMPARE(b[1], Vector3(4.0f, 5.0f, 6.0f));
+
+    /* Contiguous array */
+    Vector3 data[2];
+    Batch::StridedArrayReference<Vector3> c = Corrade::Containers::ArrayReference<Vector3>(data);
+    CORRADE_COMPARE(c.size(), 2);
+    CORRADE_VERIFY(c.isContiguous());
+
+    /* Empty */
+    Batch::StridedArrayReference<Vector3> d;
+    CORRADE_VERIFY(d.empty());
+    CORRADE_VERIFY(d.data() == nullptr);
+}
+
+void BatchTest::transformPoints2D() {
+    const Matrix3 matrix = Matrix3::translation({1.0f, -2.0f})*Matrix3::rotation(Deg(90.0f));
+    Vector2 points[]{{1.0f, 0.0f}, {0.0f, 2.0f}, {-3.0f, 1.0f}};
+    Vector2 out[3];
+
+    Batch::transformPoints(matrix, {points, 3}, {out, 3});
+    Batch::transformPointsInPlace(matrix, {points, 3});
+    for(std::size_t i = 0; i != 3; ++i)
+        CORRADE_COMPARE(out[i], points[i]);
+
+    CORRADE_COMPARE(points[0], Vector2(1.0f, -1.0f));
+    CORRADE_COMPARE(points[1], Vector2(-1.0f, -2.0f));
+    CORRADE_COMPARE(points[2], Vector2(0.0f, -5.0f));
+}
+
+void BatchTest::transformPoints3D() {
+    const Matrix4 matrix = Matrix4::translation({1.0f, -2.0f, 3.0f})*
+        Matrix4::rotationZ(Deg(90.0f))*Matrix4::scaling(Vector3(2.0f));
+
+    /* More points than SIMD width, not divisible by it */
+    Vector3 points[5]{{1.0f, 0.0f, 0.0f},
+                      {0.0f, 2.0f, 1.0f},
+                      {-3.0f, 1.0f, 0.5f},
+                      {0.0f, 0.0f, 0.0f},
+                      {4.0f, -1.0f, 2.0f}};
+    Vector3 expected[5];
+    for(std::size_t i = 0; i != 5; ++i)
+        expected[i] = matrix.transformPoint(points[i]);
+
+    Batch::transformPointsInPlace(matrix, {points, 5});
+    for(std::size_t i = 0; i != 5; ++i)
+        CORRADE_COMPARE(points[i], expected[i]);
+    CORRADE_COMPARE(points[1], Vector3(-3.0f, -2.0f, 5.0f));
+}
+
+void BatchTest::transformPointsStrided() {
+    const Matrix4 matrix = Matrix4::translation({1.0f, 2.0f, 3.0f});
+    Vertex vertices[2]{
+        {{1.0f, 0.0f, 0.0f}, {0.5f, 0.5f}},
+        {{0.0f, 1.0f, 0.0f}, {0.25f, 0.75f}}
+    };
+    Vector3 out[2];
+
+    Batch::transformPoints(matrix, {&vertices[0].position, 2, sizeof(Vertex)}, {out, 2});
+    CORRADE_COMPARE(out[0], Vector3(2.0f, 2.0f, 3.0f));
+    CORRADE_COMPARE(out[1], Vector3(1.0f, 3.0f, 3.0f));
+
+    /* Data between the items are not touched */
+    Batch::transformPointsInPlace(matrix, {&vertices[0].position, 2, sizeof(Vertex)});
+    CORRADE_COMPARE(vertices[0].position, Vector3(2.0f, 2.0f, 3.0f));
+    CORRADE_COMPARE(vertices[1].position, Vector3(1.0f, 3.0f, 3.0f));
+    CORRADE_COMPARE(vertices[0].textureCoordinates, Vector2(0.5f, 0.5f));
+    CORRADE_COMPARE(vertices[1].textureCoordinates, Vector2(0.25f, 0.75f));
+}
+
+void BatchTest::transformVectors2D() {
+    const Matrix3 matrix = Matrix3::translation({1.0f, -2.0f})*Matrix3::rotation(Deg(90.0f));
+    Vector2 vectors[]{{1.0f, 0.0f}, {0.0f, 2.0f}};
+    Vector2 out[2];
+
+    Batch::transformVectors(matrix, {vectors, 2}, {out, 2});
+    CORRADE_COMPARE(out[0], Vector2(0.0f, 1.0f));
+    CORRADE_COMPARE(out[1], Vector2(-2.0f, 0.0f));
+
+    Batch::transformVectorsInPlace(matrix, {vectors, 2});
+    CORRADE_COMPARE(vectors[0], out[0]);
+    CORRADE_COMPARE(vectors[1], out[1]);
+}
+
+void BatchTest::transformVectors3D() {
+    const Matrix4 matrix = Matrix4::translation({1.0f, -2.0f, 3.0f})*Matrix4::rotationX(Deg(90.0f));
+    Vector3 vectors[]{{1.0f, 0.0f, 0.0f}, {0.0f, 2.0f, 0.0f}, {0.0f, 0.0f, -3.0f}};
+    Vector3 out[3];
+
+    Batch::transformVectors(matrix, {vectors, 3}, {out, 3});
+    CORRADE_COMPARE(out[0], Vector3(1.0f, 0.0f, 0.0f));
+    CORRADE_COMPARE(out[1], Vector3(0.0f, 0.0f, 2.0f));
+    CORRADE_COMPARE(out[2], Vector3(0.0f, 3.0f, 0.0f));
+
+    Batch::transformVectorsInPlace(matrix, {vectors, 3});
+    for(std::size_t i = 0; i != 3; ++i)
+        CORRADE_COMPARE(vectors[i], out[i]);
+}
+
+void BatchTest::transformVectorsQuaternion() {
+    const Quaternion q = Quaternion::rotation(Deg(23.0f), Vector3(1.0f, -3.0f, 2.0f).normalized());
+    Vector3 vectors[]{{1.0f, 0.0f, 0.0f}, {0.0f, 2.0f, -1.0f}, {5.0f, 3.0f, 2.0f}};
+    Vector3 out[3];
+
+    Batch::transformVectors(q, {vectors, 3}, {out, 3});
+    for(std::size_t i = 0; i != 3; ++i)
+        CORRADE_COMPARE(out[i], q.transformVectorNormalized(vectors[i]));
+
+    Batch::transformVectorsInPlace(q, {vectors, 3});
+    for(std::size_t i = 0; i != 3; ++i)
+        CORRADE_COMPARE(vectors[i], out[i]);
+}
+
+void BatchTest::transformVectorsQuaternionNotNormalized() {
+    std::ostringstream o;
+    Error::setOutput(&o);
+
+    Vector3 vectors[1];
+    Batch::transformVectorsInPlace(Quaternion({1.0f, 2.0f, 3.0f}, 4.0f), {vectors, 1});
+    CORRADE_COMPARE(o.str(), "Math::Batch::transformVectorsInPlace(): quaternion must be normalized\n");
+}
+
+void BatchTest::translate() {
+    Vertex vertices[2]{
+        {{1.0f, 0.0f, 0.0f}, {0.5f, 0.5f}},
+        {{0.0f, 1.0f, 0.0f}, {0.25f, 0.75f}}
+    };
+
+    Batch::translateInPlace(Vector2(1.0f, -1.0f), {&vertices[0].textureCoordinates, 2, sizeof(Vertex)});
+    CORRADE_COMPARE(vertices[0].textureCoordinates, Vector2(1.5f, -0.5f));
+    CORRADE_COMPARE(vertices[1].textureCoordinates, Vector2(1.25f, -0.25f));
+    CORRADE_COMPARE(vertices[1].position, Vector3(0.0f, 1.0f, 0.0f));
+}
+
+void BatchTest::normalize() {
+    /* More vectors than SIMD width, not divisible by it */
+    Vector3 vectors[]{{3.0f, 0.0f, 4.0f},
+                      {0.0f, -2.0f, 0.0f},
+                      {1.0f, 1.0f, 1.0f},
+                      {0.0f, 0.0f, 0.5f},
+                      {-1.0f, 2.0f, 2.0f},
+                      {6.0f, 0.0f, 0.0f}};
+    Vector3 out[6];
+
+    Batch::normalize<Vector3>({vectors, 6}, {out, 6});
+    for(std::size_t i = 0; i != 6; ++i)
+        CORRADE_COMPARE(out[i], vectors[i].normalized());
+    CORRADE_COMPARE(out[0], Vector3(0.6f, 0.0f, 0.8f));
+    CORRADE_COMPARE(out[4], Vector3(-1.0f, 2.0f, 2.0f)/3.0f);
+
+    Batch::normalizeInPlace<Vector3>({vectors, 6});
+    for(std::size_t i = 0; i != 6; ++i)
+        CORRADE_COMPARE(vectors[i], out[i]);
+
+    /* Other vector sizes */
+    Vector2 vectors2[]{{3.0f, 4.0f}, {0.0f, 2.0f}};
+    Batch::normalizeInPlace<Vector2>({vectors2, 2});
+    CORRADE_COMPARE(vectors2[0], Vector2(0.6f, 0.8f));
+    CORRADE_COMPARE(vectors2[1], Vector2(0.0f, 1.0f));
+}
+
+void BatchTest::normalizeStrided() {
+    Vertex vertices[5]{
+        {{3.0f, 0.0f, 4.0f}, {1.0f, 2.0f}},
+        {{0.0f, 2.0f, 0.0f}, {3.0f, 4.0f}},
+        {{0.0f, 0.0f, -7.0f}, {5.0f, 6.0f}},
+        {{2.0f, 0.0f, 0.0f}, {7.0f, 8.0f}},
+        {{0.0f, 3.0f, 4.0f}, {9.0f, 10.0f}}
+    };
+
+    Batch::normalizeInPlace<Vector3>({&vertices[0].position, 5, sizeof(Vertex)});
+    CORRADE_COMPARE(vertices[0].position, Vector3(0.6f, 0.0f, 0.8f));
+    CORRADE_COMPARE(vertices[1].position, Vector3(0.0f, 1.0f, 0.0f));
+    CORRADE_COMPARE(vertices[2].position, Vector3(0.0f, 0.0f, -1.0f));
+    CORRADE_COMPARE(vertices[3].position, Vector3(1.0f, 0.0f, 0.0f));
+    CORRADE_COMPARE(vertices[4].position, Vector3(0.0f, 0.6f, 0.8f));
+    for(std::size_t i = 0; i != 5; ++i)
+        CORRADE_COMPARE(vertices[i].textureCoordinates, Vector2(2*i + 1.0f, 2*i + 2.0f));
+}
+
+void BatchTest::dot() {
+    const Vector3 a[]{{1.0f, 2.0f, 3.0f}, {-1.0f, 0.0f, 2.0f}};
+    const Vector3 b[]{{4.0f, 5.0f, 6.0f}, {3.0f, 7.0f, 0.5f}};
+    Float out[2];
+
+    Batch::dot<Vector3>({a, 2}, {b, 2}, {out, 2});
+    CORRADE_COMPARE(out[0], 32.0f);
+    CORRADE_COMPARE(out[1], -2.0f);
+}
+
+void BatchTest::cross() {
+    const Vector3 a[]{{1.0f, 0.0f, 0.0f}, {1.0f, 2.0f, 3.0f}};
+    const Vector3 b[]{{0.0f, 1.0f, 0.0f}, {4.0f, 5.0f, 6.0f}};
+    Vector3 out[2];
+
+    Batch::cross<Float>({a, 2}, {b, 2}, {out, 2});
+    CORRADE_COMPARE(out[0], Vector3::zAxis());
+    CORRADE_COMPARE(out[1], Vector3::cross(a[1], b[1]));
+}
+
+void BatchTest::minmax() {
+    const Vector3 points[]{{1.0f, -2.0f, 3.0f},
+                           {-4.0f, 5.0f, 0.0f},
+                           {2.0f, 0.0f, -1.0f}};
+
+    const std::pair<Vector3, Vector3> bounds = Batch::minmax<Vector3>({points, 3});
+    CORRADE_COMPARE(bounds.first, Vector3(-4.0f, -2.0f, -1.0f));
+    CORRADE_COMPARE(bounds.second, Vector3(2.0f, 5.0f, 3.0f));
+
+    /* Single point */
+    const std::pair<Vector3, Vector3> single = Batch::minmax<Vector3>({points, 1});
+    CORRADE_COMPARE(single.first, points[0]);
+    CORRADE_COMPARE(single.second, points[0]);
+}
+
+void BatchTest::minmaxEmpty() {
+    std::ostringstream o;
+    Error::setOutput(&o);
+
+    Batch::minmax<Vector3>({});
+    CORRADE_COMPARE(o.str(), "Math::Batch::minmax(): the array is empty\n");
+}
+
+void BatchTest::sizeMismatch() {
+    std::ostringstream o;
+    Error::setOutput(&o);
+
+    Vector3 points[3];
+    Vector3 out[2];
+    Batch::transformPoints(Matrix4(), {points, 3}, {out, 2});
+    CORRADE_COMPARE(o.str(), "Math::Batch::transformPoints(): expected output of size 3 but got 2\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::BatchTest)
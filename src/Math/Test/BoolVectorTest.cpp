@@ -140,6 +140,9 @@ void BoolVectorTest::data() {
     d.set(15, true);
     CORRADE_VERIFY(d[15]);
     CORRADE_COMPARE(d, BoolVector19(0x08, 0x83, 0x04));
+    d.set(9, false);
+    CORRADE_VERIFY(!d[9]);
+    CORRADE_COMPARE(d, BoolVector19(0x08, 0x81, 0x04));
 }
 
 void BoolVectorTest::compare() {
@@ -22,6 +22,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <vector>
 #include <TestSuite/Tester.h>
 
 #include "Math/Functions.h"
@@ -46,6 +47,7 @@ class FunctionsTest: public Corrade::TestSuite::Tester {
 
         void sqrt();
         void sqrtInverted();
+        void sqrtInvertedFast();
         void clamp();
         void lerp();
         void lerpInverted();
@@ -58,12 +60,15 @@ class FunctionsTest: public Corrade::TestSuite::Tester {
         void renormalizeSinged();
 
         void normalizeTypeDeduction();
+        void normalizeArray();
+        void denormalizeArray();
 
         void pow();
         void log();
         void log2();
         void trigonometric();
         void trigonometricWithBase();
+        void sincosArray();
 };
 
 typedef Math::Constants<Float> Constants;
@@ -88,6 +93,7 @@ FunctionsTest::FunctionsTest() {
 
               &FunctionsTest::sqrt,
               &FunctionsTest::sqrtInverted,
+              &FunctionsTest::sqrtInvertedFast,
               &FunctionsTest::clamp,
               &FunctionsTest::lerp,
               &FunctionsTest::lerpInverted,
@@ -100,12 +106,15 @@ FunctionsTest::FunctionsTest() {
               &FunctionsTest::renormalizeSinged,
 
               &FunctionsTest::normalizeTypeDeduction,
+              &FunctionsTest::normalizeArray,
+              &FunctionsTest::denormalizeArray,
 
               &FunctionsTest::pow,
               &FunctionsTest::log,
               &FunctionsTest::log2,
               &FunctionsTest::trigonometric,
-              &FunctionsTest::trigonometricWithBase});
+              &FunctionsTest::trigonometricWithBase,
+              &FunctionsTest::sincosArray});
 }
 
 void FunctionsTest::min() {
@@ -170,6 +179,20 @@ void FunctionsTest::sqrtInverted() {
     CORRADE_COMPARE(Math::sqrtInverted(Vector3(1.0f, 4.0f, 16.0f)), Vector3(1.0f, 0.5f, 0.25f));
 }
 
+void FunctionsTest::sqrtInvertedFast() {
+    CORRADE_COMPARE(Math::sqrtInvertedFast(16.0f), 0.25f);
+    CORRADE_COMPARE(Math::sqrtInvertedFast(16.0), 0.25);
+    CORRADE_COMPARE(Math::sqrtInvertedFast(Vector3(1.0f, 4.0f, 16.0f)), Vector3(1.0f, 0.5f, 0.25f));
+
+    /* Relative error over whole exponent range */
+    Double maxError = 0.0;
+    for(Float value = std::numeric_limits<Float>::min(); value < std::numeric_limits<Float>::max()/1.01f; value *= 1.01f) {
+        const Double expected = 1.0/std::sqrt(Double(value));
+        maxError = std::max(maxError, std::abs(Math::sqrtInvertedFast(value) - expected)/expected);
+    }
+    CORRADE_VERIFY(maxError < 5.0e-7);
+}
+
 void FunctionsTest::clamp() {
     CORRADE_COMPARE(Math::clamp(0.5f, -1.0f, 5.0f), 0.5f);
     CORRADE_COMPARE(Math::clamp(-1.6f, -1.0f, 5.0f), -1.0f);
@@ -349,6 +372,67 @@ void FunctionsTest::normalizeTypeDeduction() {
     CORRADE_COMPARE((Math::normalize<Float, Byte>('\x7F')), 1.0f);
 }
 
+namespace {
+    /* All representable values, count not divisible by SIMD width */
+    template<class Integral> std::size_t normalizeArrayMismatches() {
+        const std::size_t count = std::size_t(std::numeric_limits<Integral>::max()) - std::numeric_limits<Integral>::min() + 4;
+        std::vector<Integral> values(count);
+        for(std::size_t i = 0; i != count; ++i)
+            values[i] = Integral(std::numeric_limits<Integral>::min() + i);
+
+        std::vector<Float> out(count);
+        Math::normalize<Float, Integral>({values.data(), count}, {out.data(), count});
+
+        std::size_t mismatches = 0;
+        for(std::size_t i = 0; i != count; ++i)
+            if(out[i] != Math::normalize<Float, Integral>(values[i])) ++mismatches;
+        return mismatches;
+    }
+
+    /* Dense sampling of the normalized range including both ends */
+    template<class Integral> std::size_t denormalizeArrayMismatches() {
+        const std::size_t count = 200003;
+        const Float min = std::is_signed<Integral>::value ? -1.0f : 0.0f;
+        std::vector<Float> values(count);
+        for(std::size_t i = 0; i != count; ++i)
+            values[i] = Math::lerp(min, 1.0f, Float(i)/(count - 1));
+
+        std::vector<Integral> out(count);
+        Math::denormalize<Integral, Float>({values.data(), count}, {out.data(), count});
+
+        std::size_t mismatches = 0;
+        for(std::size_t i = 0; i != count; ++i)
+            if(out[i] != Math::denormalize<Integral>(values[i])) ++mismatches;
+        return mismatches;
+    }
+}
+
+void FunctionsTest::normalizeArray() {
+    CORRADE_COMPARE(normalizeArrayMismatches<UnsignedByte>(), 0);
+    CORRADE_COMPARE(normalizeArrayMismatches<Byte>(), 0);
+    CORRADE_COMPARE(normalizeArrayMismatches<UnsignedShort>(), 0);
+    CORRADE_COMPARE(normalizeArrayMismatches<Short>(), 0);
+
+    const Vector3ub colors[]{{0, 127, 255}, {255, 0, 51}};
+    Vector3 out[2];
+    Math::normalize<Float, UnsignedByte>({colors[0].data(), 6}, {out[0].data(), 6});
+    CORRADE_COMPARE(out[0], Vector3(0.0f, 0.498039f, 1.0f));
+    CORRADE_COMPARE(out[1], Vector3(1.0f, 0.0f, 0.2f));
+}
+
+void FunctionsTest::denormalizeArray() {
+    CORRADE_COMPARE(denormalizeArrayMismatches<UnsignedByte>(), 0);
+    CORRADE_COMPARE(denormalizeArrayMismatches<Byte>(), 0);
+    CORRADE_COMPARE(denormalizeArrayMismatches<UnsignedShort>(), 0);
+    CORRADE_COMPARE(denormalizeArrayMismatches<Short>(), 0);
+
+    const Vector3 normals[]{{0.0f, 1.0f, 0.0f}, {-1.0f, 0.0f, 0.5f}};
+    Math::Vector3<Short> out[2];
+    Math::denormalize<Short, Float>({normals[0].data(), 6}, {out[0].data(), 6});
+    CORRADE_COMPARE(out[0], Math::Vector3<Short>(0, 32767, 0));
+    CORRADE_COMPARE(out[1], Math::Vector3<Short>(-32767, 0, 16383));
+}
+
 void FunctionsTest::pow() {
     CORRADE_COMPARE(Math::pow<10>(2ul), 1024ul);
     CORRADE_COMPARE(Math::pow<0>(3ul), 1ul);
@@ -397,6 +481,41 @@ void FunctionsTest::trigonometricWithBase() {
     CORRADE_COMPARE(Math::tan(2*Rad(Constants::pi()/8)), 1.0f);
 }
 
+void FunctionsTest::sincosArray() {
+    /* Not multiple of four to test also the remainder */
+    std::vector<Rad> angles;
+    for(Float angle = -8192.0f; angle <= 8192.0f; angle += 0.0137f)
+        angles.push_back(Rad(angle));
+    angles.push_back(Rad(0.0f));
+    angles.push_back(Rad(Constants::pi()/2.0f));
+    angles.push_back(Rad(-Constants::pi()));
+
+    std::vector<Float> sines(angles.size());
+    std::vector<Float> cosines(angles.size());
+    Math::sincos({angles.data(), angles.size()}, {sines.data(), sines.size()}, {cosines.data(), cosines.size()});
+
+    Double maxError = 0.0;
+    for(std::size_t i = 0; i != angles.size(); ++i) {
+        maxError = std::max(maxError, std::abs(sines[i] - std::sin(Double(Float(angles[i])))));
+        maxError = std::max(maxError, std::abs(cosines[i] - std::cos(Double(Float(angles[i])))));
+    }
+    CORRADE_VERIFY(maxError < 2.0e-7);
+
+    /* Exact values */
+    CORRADE_COMPARE(sines[angles.size() - 3], 0.0f);
+    CORRADE_COMPARE(cosines[angles.size() - 3], 1.0f);
+    CORRADE_COMPARE(sines[angles.size() - 2], 1.0f);
+    CORRADE_COMPARE(cosines[angles.size() - 1], -1.0f);
+
+    /* Bulk and remainder processing give the same result */
+    for(std::size_t i: {std::size_t(0), std::size_t(1), std::size_t(5), angles.size() - 4}) {
+        Float sine, cosine;
+        Math::sincos({angles.data() + i, 1}, {&sine, 1}, {&cosine, 1});
+        CORRADE_COMPARE(sine, sines[i]);
+        CORRADE_COMPARE(cosine, cosines[i]);
+    }
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Test::FunctionsTest)
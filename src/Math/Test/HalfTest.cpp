@@ -0,0 +1,235 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <vector>
+#include <TestSuite/Tester.h>
+
+#include "Math/Half.h"
+#include "Math/Vector3.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+class HalfTest: public Corrade::TestSuite::Tester {
+    public:
+        explicit HalfTest();
+
+        void construct();
+        void pack();
+        void packRounding();
+        void packSpecial();
+        void unpack();
+        void unpackSpecial();
+        void roundtrip();
+        void packArray();
+        void unpackArray();
+        void vector();
+        void debug();
+};
+
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector3<Half> Vector3h;
+
+HalfTest::HalfTest() {
+    addTests({&HalfTest::construct,
+              &HalfTest::pack,
+              &HalfTest::packRounding,
+              &HalfTest::packSpecial,
+              &HalfTest::unpack,
+              &HalfTest::unpackSpecial,
+              &HalfTest::roundtrip,
+              &HalfTest::packArray,
+              &HalfTest::unpackArray,
+              &HalfTest::vector,
+              &HalfTest::debug});
+}
+
+namespace {
+    UnsignedInt floatBits(Float value) {
+        UnsignedInt bits;
+        std::memcpy(&bits, &value, 4);
+        return bits;
+    }
+
+    Float bitsFloat(UnsignedInt bits) {
+        Float value;
+        std::memcpy(&value, &bits, 4);
+        return value;
+    }
+}
+
+void HalfTest::construct() {
+    constexpr Half a;
+    CORRADE_COMPARE(a.data(), 0);
+
+    constexpr Half b(UnsignedShort(0x3c00));
+    constexpr UnsignedShort c(b);
+    CORRADE_COMPARE(c, 0x3c00);
+    CORRADE_COMPARE(Float(b), 1.0f);
+
+    const Half d(-2.5f);
+    CORRADE_COMPARE(d.data(), 0xc100);
+    CORRADE_COMPARE(Float(d), -2.5f);
+    CORRADE_COMPARE(Float(-d), 2.5f);
+
+    CORRADE_VERIFY(Half(1.0f) == b);
+    CORRADE_VERIFY(Half(1.0f) != d);
+    CORRADE_VERIFY(Half(0.0f) != Half(-0.0f));
+}
+
+void HalfTest::pack() {
+    CORRADE_COMPARE(packHalf(0.0f), 0x0000);
+    CORRADE_COMPARE(packHalf(-0.0f), 0x8000);
+    CORRADE_COMPARE(packHalf(1.0f), 0x3c00);
+    CORRADE_COMPARE(packHalf(-2.0f), 0xc000);
+    CORRADE_COMPARE(packHalf(0.5f), 0x3800);
+    CORRADE_COMPARE(packHalf(65504.0f), 0x7bff);
+    CORRADE_COMPARE(packHalf(0.333251953125f), 0x3555);
+
+    /* Smallest normal and subnormal */
+    CORRADE_COMPARE(packHalf(6.103515625e-05f), 0x0400);
+    CORRADE_COMPARE(packHalf(5.9604644775390625e-08f), 0x0001);
+    CORRADE_COMPARE(packHalf(-5.9604644775390625e-08f), 0x8001);
+}
+
+void HalfTest::packRounding() {
+    /* Halfway between 1 and next representable value rounds to even */
+    CORRADE_COMPARE(packHalf(1.0f + 1.0f/2048), 0x3c00);
+    CORRADE_COMPARE(packHalf(1.0f + 3.0f/2048), 0x3c02);
+
+    /* Slightly above halfway rounds up */
+    CORRADE_COMPARE(packHalf(bitsFloat(floatBits(1.0f + 1.0f/2048) + 1)), 0x3c01);
+
+    /* The same for subnormals */
+    CORRADE_COMPARE(packHalf(5.9604644775390625e-08f*0.5f), 0x0000);
+    CORRADE_COMPARE(packHalf(5.9604644775390625e-08f*1.5f), 0x0002);
+    CORRADE_COMPARE(packHalf(5.9604644775390625e-08f*0.75f), 0x0001);
+
+    /* Largest value which doesn't round to infinity */
+    CORRADE_COMPARE(packHalf(65519.0f), 0x7bff);
+    CORRADE_COMPARE(packHalf(65520.0f), 0x7c00);
+}
+
+void HalfTest::packSpecial() {
+    CORRADE_COMPARE(packHalf(std::numeric_limits<Float>::infinity()), 0x7c00);
+    CORRADE_COMPARE(packHalf(-std::numeric_limits<Float>::infinity()), 0xfc00);
+    CORRADE_COMPARE(packHalf(1.0e10f), 0x7c00);
+    CORRADE_COMPARE(packHalf(std::numeric_limits<Float>::quiet_NaN()), 0x7e00);
+
+    /* Too small values are flushed to zero */
+    CORRADE_COMPARE(packHalf(1.0e-10f), 0x0000);
+    CORRADE_COMPARE(packHalf(-1.0e-10f), 0x8000);
+}
+
+void HalfTest::unpack() {
+    CORRADE_COMPARE(floatBits(unpackHalf(0x0000)), floatBits(0.0f));
+    CORRADE_COMPARE(floatBits(unpackHalf(0x8000)), floatBits(-0.0f));
+    CORRADE_COMPARE(unpackHalf(0x3c00), 1.0f);
+    CORRADE_COMPARE(unpackHalf(0xc000), -2.0f);
+    CORRADE_COMPARE(unpackHalf(0x7bff), 65504.0f);
+    CORRADE_COMPARE(unpackHalf(0x0400), 6.103515625e-05f);
+    CORRADE_COMPARE(floatBits(unpackHalf(0x0001)), floatBits(5.9604644775390625e-08f));
+    CORRADE_COMPARE(floatBits(unpackHalf(0x83ff)), floatBits(-6.097555160522461e-05f));
+}
+
+void HalfTest::unpackSpecial() {
+    CORRADE_COMPARE(unpackHalf(0x7c00), std::numeric_limits<Float>::infinity());
+    CORRADE_COMPARE(unpackHalf(0xfc00), -std::numeric_limits<Float>::infinity());
+    CORRADE_VERIFY(unpackHalf(0x7e00) != unpackHalf(0x7e00));
+    CORRADE_VERIFY(unpackHalf(0x7c01) != unpackHalf(0x7c01));
+}
+
+void HalfTest::roundtrip() {
+    /* All values except NaNs survive the roundtrip */
+    std::size_t mismatches = 0;
+    for(UnsignedInt i = 0; i != 65536; ++i) {
+        if((i & 0x7fff) > 0x7c00) continue;
+        if(packHalf(unpackHalf(i)) != i) ++mismatches;
+    }
+    CORRADE_COMPARE(mismatches, 0);
+}
+
+void HalfTest::packArray() {
+    /* Values around all half exponents, special values and count not
+       divisible by SIMD width */
+    std::vector<Float> values;
+    for(Int exponent = -30; exponent != 20; ++exponent)
+        for(UnsignedInt mantissa = 0; mantissa < (1 << 23); mantissa += 4093)
+            values.push_back(bitsFloat(((exponent + 127) << 23) | mantissa));
+    const std::size_t positiveCount = values.size();
+    for(std::size_t i = 0; i != positiveCount; ++i)
+        values.push_back(-values[i]);
+    values.push_back(0.0f);
+    values.push_back(-0.0f);
+    values.push_back(std::numeric_limits<Float>::infinity());
+    values.push_back(std::numeric_limits<Float>::quiet_NaN());
+    values.push_back(1.0f + 1.0f/2048);
+    CORRADE_VERIFY(values.size() % 8);
+
+    std::vector<Half> out(values.size());
+    packHalf({values.data(), values.size()}, {out.data(), out.size()});
+
+    std::size_t mismatches = 0;
+    for(std::size_t i = 0; i != values.size(); ++i)
+        if(out[i].data() != packHalf(values[i])) ++mismatches;
+    CORRADE_COMPARE(mismatches, 0);
+}
+
+void HalfTest::unpackArray() {
+    /* All values, count not divisible by SIMD width */
+    std::vector<Half> values;
+    for(UnsignedInt i = 0; i != 65536; ++i)
+        values.push_back(Half(UnsignedShort(i)));
+    values.push_back(Half(1.0f));
+    values.push_back(Half(-3.0f));
+
+    std::vector<Float> out(values.size());
+    unpackHalf({values.data(), values.size()}, {out.data(), out.size()});
+
+    std::size_t mismatches = 0;
+    for(std::size_t i = 0; i != values.size(); ++i)
+        if(floatBits(out[i]) != floatBits(unpackHalf(values[i].data()))) ++mismatches;
+    CORRADE_COMPARE(mismatches, 0);
+}
+
+void HalfTest::vector() {
+    const Vector3h a(Vector3(1.0f, -2.0f, 0.5f));
+    CORRADE_COMPARE(a, Vector3h(Half(1.0f), Half(-2.0f), Half(0.5f)));
+    CORRADE_COMPARE(a.y().data(), 0xc000);
+    CORRADE_COMPARE(Vector3(a), Vector3(1.0f, -2.0f, 0.5f));
+    CORRADE_COMPARE(Vector3h(), Vector3h(Half(0.0f)));
+    CORRADE_COMPARE(sizeof(Vector3h), 6);
+}
+
+void HalfTest::debug() {
+    std::ostringstream o;
+    Debug(&o) << Half(3.5f) << Vector3h(Vector3(1.0f, -2.0f, 0.25f));
+    CORRADE_COMPARE(o.str(), "3.5 Vector(1, -2, 0.25)\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::HalfTest)
@@ -239,6 +239,10 @@ void Matrix3Test::rotation() {
                    {      0.0f,      0.0f, 1.0f});
 
     CORRADE_COMPARE(Matrix3::rotation(Deg(15.0f)), matrix);
+
+    /* Sine and cosine computed at compile time */
+    constexpr Matrix3 a = Matrix3::rotationConstant(Deg(15.0f));
+    CORRADE_COMPARE(a, matrix);
 }
 
 void Matrix3Test::reflection() {
@@ -265,7 +269,8 @@ void Matrix3Test::projection() {
                      {     0.0f, 2.0f/3.0f, 0.0f},
                      {     0.0f,      0.0f, 1.0f});
 
-    CORRADE_COMPARE(Matrix3::projection({4.0f, 3.0f}), expected);
+    constexpr Matrix3 projection = Matrix3::projection({4.0f, 3.0f});
+    CORRADE_COMPARE(projection, expected);
 }
 
 void Matrix3Test::fromParts() {
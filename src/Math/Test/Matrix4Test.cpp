@@ -22,6 +22,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <limits>
 #include <sstream>
 #include <TestSuite/Tester.h>
 #include <Utility/Configuration.h>
@@ -283,6 +284,14 @@ void Matrix4Test::rotationX() {
                    {0.0f,         0.0f,        0.0f, 1.0f});
     CORRADE_COMPARE(Matrix4::rotation(Rad(Math::Constants<Float>::pi()/7), Vector3::xAxis()), matrix);
     CORRADE_COMPARE(Matrix4::rotationX(Rad(Math::Constants<Float>::pi()/7)), matrix);
+
+    /* Sine and cosine computed at compile time */
+    constexpr Matrix4 a = Matrix4::rotationXConstant(Rad(Math::Constants<Float>::pi()/7));
+    CORRADE_COMPARE(a, matrix);
+
+    /* Infinite angle results in NaN */
+    const Float nan = Matrix4::rotationXConstant(Rad(std::numeric_limits<Float>::infinity()))[1][1];
+    CORRADE_VERIFY(nan != nan);
 }
 
 void Matrix4Test::rotationY() {
@@ -292,6 +301,9 @@ void Matrix4Test::rotationY() {
                    {       0.0f, 0.0f,         0.0f, 1.0f});
     CORRADE_COMPARE(Matrix4::rotation(Rad(Math::Constants<Float>::pi()/7), Vector3::yAxis()), matrix);
     CORRADE_COMPARE(Matrix4::rotationY(Rad(Math::Constants<Float>::pi()/7)), matrix);
+
+    constexpr Matrix4 a = Matrix4::rotationYConstant(Rad(Math::Constants<Float>::pi()/7));
+    CORRADE_COMPARE(a, matrix);
 }
 
 void Matrix4Test::rotationZ() {
@@ -301,6 +313,9 @@ void Matrix4Test::rotationZ() {
                    {        0.0f,        0.0f, 0.0f, 1.0f});
     CORRADE_COMPARE(Matrix4::rotation(Rad(Math::Constants<Float>::pi()/7), Vector3::zAxis()), matrix);
     CORRADE_COMPARE(Matrix4::rotationZ(Rad(Math::Constants<Float>::pi()/7)), matrix);
+
+    constexpr Matrix4 a = Matrix4::rotationZConstant(Rad(Math::Constants<Float>::pi()/7));
+    CORRADE_COMPARE(a, matrix);
 }
 
 void Matrix4Test::reflection() {
@@ -328,7 +343,8 @@ void Matrix4Test::orthographicProjection() {
                      {0.0f, 0.5f,   0.0f, 0.0f},
                      {0.0f, 0.0f, -0.25f, 0.0f},
                      {0.0f, 0.0f, -1.25f, 1.0f});
-    CORRADE_COMPARE(Matrix4::orthographicProjection({5.0f, 4.0f}, 1, 9), expected);
+    constexpr Matrix4 projection = Matrix4::orthographicProjection({5.0f, 4.0f}, 1, 9);
+    CORRADE_COMPARE(projection, expected);
 }
 
 void Matrix4Test::perspectiveProjection() {
@@ -336,7 +352,8 @@ void Matrix4Test::perspectiveProjection() {
                      {0.0f, 7.111111f,         0.0f,  0.0f},
                      {0.0f,      0.0f,  -1.9411764f, -1.0f},
                      {0.0f,      0.0f, -94.1176452f,  0.0f});
-    CORRADE_COMPARE(Matrix4::perspectiveProjection({16.0f, 9.0f}, 32.0f, 100), expected);
+    constexpr Matrix4 projection = Matrix4::perspectiveProjection({16.0f, 9.0f}, 32.0f, 100);
+    CORRADE_COMPARE(projection, expected);
 }
 
 void Matrix4Test::perspectiveProjectionFov() {
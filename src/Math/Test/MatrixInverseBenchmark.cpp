@@ -0,0 +1,92 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <vector>
+
+#include "Math/Matrix3.h"
+#include "Math/Matrix4.h"
+#include "Test/Benchmark.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+namespace {
+    /* Generic cofactor expansion, which was used for all sizes before the
+       closed-form specializations */
+    template<class T> T determinant(const Matrix<2, T>& m) {
+        return m[0][0]*m[1][1] - m[1][0]*m[0][1];
+    }
+
+    template<std::size_t size, class T> T determinant(const Matrix<size, T>& m) {
+        T out(0);
+        for(std::size_t col = 0; col != size; ++col)
+            out += ((col & 1) ? -1 : 1)*m[col][0]*determinant(m.ij(col, 0));
+        return out;
+    }
+
+    template<std::size_t size, class T> Matrix<size, T> inverted(const Matrix<size, T>& m) {
+        Matrix<size, T> out(Matrix<size, T>::Zero);
+        const T d = determinant(m);
+        for(std::size_t col = 0; col != size; ++col)
+            for(std::size_t row = 0; row != size; ++row)
+                out[col][row] = (((row+col) & 1) ? -1 : 1)*determinant(m.ij(row, col))/d;
+        return out;
+    }
+
+    template<std::size_t size, class T> void compare(Magnum::Test::Benchmark& benchmark, const char* name, const std::vector<Matrix<size, T>>& matrices) {
+        std::vector<Matrix<size, T>> out(matrices.size());
+        benchmark.compare(name, [&]() {
+            for(std::size_t i = 0; i != matrices.size(); ++i) out[i] = inverted(matrices[i]);
+            return Float(out[matrices.size()/2][0][0]);
+        }, [&]() {
+            for(std::size_t i = 0; i != matrices.size(); ++i) out[i] = matrices[i].inverted();
+            return Float(out[matrices.size()/2][0][0]);
+        });
+    }
+
+    constexpr std::size_t Count = 1000;
+}
+
+}}}
+
+int main() {
+    using namespace Magnum;
+    using namespace Magnum::Math::Test;
+
+    std::vector<Math::Matrix<3, Float>> matrices3;
+    std::vector<Math::Matrix<4, Float>> matrices4;
+    std::vector<Math::Matrix<4, Double>> matrices4d;
+    for(std::size_t i = 0; i != Count; ++i) {
+        const Float f = Float(i%97)/97.0f;
+        matrices3.push_back(Math::Matrix3<Float>::rotation(Math::Rad<Float>(f))*Math::Matrix3<Float>::scaling({1.0f + f, 2.0f}));
+        matrices4.push_back(Math::Matrix4<Float>::rotation(Math::Rad<Float>(f), Math::Vector3<Float>(1.0f, f, 0.5f).normalized())*Math::Matrix4<Float>::scaling({1.0f + f, 2.0f, 0.5f}));
+        matrices4d.push_back(Math::Matrix<4, Double>(matrices4.back()));
+    }
+
+    /* The Float 4x4 version is the SSE2 one if TARGET_SSE2 is enabled */
+    Magnum::Test::Benchmark benchmark;
+    compare(benchmark, "Matrix3 inversion", matrices3);
+    compare(benchmark, "Matrix4 inversion", matrices4);
+    compare(benchmark, "Matrix4d inversion", matrices4d);
+}
@@ -72,7 +72,10 @@ class MatrixTest: public Corrade::TestSuite::Tester {
         void trace();
         void ij();
         void determinant();
+        void determinantSmall();
         void inverted();
+        void invertedSmall();
+        void invertedGeneric();
         void invertedOrthogonal();
 
         void subclassTypes();
@@ -104,7 +107,10 @@ MatrixTest::MatrixTest() {
               &MatrixTest::trace,
               &MatrixTest::ij,
               &MatrixTest::determinant,
+              &MatrixTest::determinantSmall,
               &MatrixTest::inverted,
+              &MatrixTest::invertedSmall,
+              &MatrixTest::invertedGeneric,
               &MatrixTest::invertedOrthogonal,
 
               &MatrixTest::subclassTypes,
@@ -126,9 +132,9 @@ void MatrixTest::construct() {
 }
 
 void MatrixTest::constructIdentity() {
-    Matrix4x4 identity;
-    Matrix4x4 identity2(Matrix4x4::Identity);
-    Matrix4x4 identity3(Matrix4x4::Identity, 4.0f);
+    constexpr Matrix4x4 identity;
+    constexpr Matrix4x4 identity2(Matrix4x4::Identity);
+    constexpr Matrix4x4 identity3(Matrix4x4::Identity, 4.0f);
 
     Matrix4x4 identityExpected(Vector4(1.0f, 0.0f, 0.0f, 0.0f),
                                Vector4(0.0f, 1.0f, 0.0f, 0.0f),
@@ -255,6 +261,30 @@ void MatrixTest::determinant() {
     CORRADE_COMPARE(m.determinant(), -2);
 }
 
+void MatrixTest::determinantSmall() {
+    /* Closed-form specializations */
+    Matrix4x4i a(Vector4i(1, 2, 2, 1),
+                 Vector4i(2, 3, 2, 1),
+                 Vector4i(1, 1, 1, 1),
+                 Vector4i(2, 0, 0, 1));
+    CORRADE_COMPARE(a.determinant(), 1);
+
+    Matrix4x4 b(Vector4(3.0f,  5.0f, 8.0f, 4.0f),
+                Vector4(4.0f,  4.0f, 7.0f, 3.0f),
+                Vector4(7.0f, -1.0f, 8.0f, 0.0f),
+                Vector4(9.0f,  4.0f, 5.0f, 9.0f));
+    CORRADE_COMPARE(b.determinant(), -412.0f);
+
+    Matrix<3, Int> c(Vector<3, Int>(1, 2, 3),
+                     Vector<3, Int>(0, 1, 4),
+                     Vector<3, Int>(5, 6, 0));
+    CORRADE_COMPARE(c.determinant(), 1);
+
+    Matrix<2, Int> d(Vector<2, Int>(3, 8),
+                     Vector<2, Int>(4, 6));
+    CORRADE_COMPARE(d.determinant(), -14);
+}
+
 void MatrixTest::inverted() {
     Matrix4x4 m(Vector4(3.0f,  5.0f, 8.0f, 4.0f),
                 Vector4(4.0f,  4.0f, 7.0f, 3.0f),
@@ -272,6 +302,38 @@ void MatrixTest::inverted() {
     CORRADE_COMPARE(_inverse*m, Matrix4x4());
 }
 
+void MatrixTest::invertedSmall() {
+    Matrix3x3 a(Vector3(1.0f, 2.0f, 3.0f),
+                Vector3(0.0f, 1.0f, 4.0f),
+                Vector3(5.0f, 6.0f, 0.0f));
+    Matrix3x3 inverse(Vector3(-24.0f, 18.0f,  5.0f),
+                      Vector3( 20.0f, -15.0f, -4.0f),
+                      Vector3( -5.0f,  4.0f,  1.0f));
+    CORRADE_COMPARE(a.inverted(), inverse);
+    CORRADE_COMPARE(a.inverted()*a, Matrix3x3());
+
+    Matrix<2, Float> b(Vector<2, Float>(3.0f, 8.0f),
+                       Vector<2, Float>(4.0f, 6.0f));
+    Matrix<2, Float> inverse2(Vector<2, Float>(-3.0f/7.0f,  4.0f/7.0f),
+                              Vector<2, Float>( 2.0f/7.0f, -1.5f/7.0f));
+    CORRADE_COMPARE(b.inverted(), inverse2);
+    CORRADE_COMPARE(b.inverted()*b, (Matrix<2, Float>()));
+}
+
+void MatrixTest::invertedGeneric() {
+    /* Cofactor expansion for larger matrices */
+    Matrix<5, Double> m(
+        Vector<5, Double>(1.0, 2.0, 2.0, 1.0,  0.0),
+        Vector<5, Double>(2.0, 3.0, 2.0, 1.0, -2.0),
+        Vector<5, Double>(1.0, 1.0, 1.0, 1.0,  0.0),
+        Vector<5, Double>(2.0, 0.0, 0.0, 1.0,  2.0),
+        Vector<5, Double>(3.0, 1.0, 0.0, 1.0, -2.0)
+    );
+
+    CORRADE_COMPARE(m.inverted()*m, (Matrix<5, Double>()));
+    CORRADE_COMPARE(m*m.inverted(), (Matrix<5, Double>()));
+}
+
 void MatrixTest::invertedOrthogonal() {
     std::ostringstream o;
     Error::setOutput(&o);
@@ -61,6 +61,7 @@ class QuaternionTest: public Corrade::TestSuite::Tester {
         void matrix();
         void lerp();
         void slerp();
+        void slerpFast();
         void transformVector();
         void transformVectorNormalized();
 
@@ -103,6 +104,7 @@ QuaternionTest::QuaternionTest() {
               &QuaternionTest::matrix,
               &QuaternionTest::lerp,
               &QuaternionTest::slerp,
+              &QuaternionTest::slerpFast,
               &QuaternionTest::transformVector,
               &QuaternionTest::transformVectorNormalized,
 
@@ -349,6 +351,38 @@ void QuaternionTest::slerp() {
     CORRADE_COMPARE(slerp, Quaternion({0.119165f, 0.0491109f, 0.0491109f}, 0.990442f));
 }
 
+void QuaternionTest::slerpFast() {
+    Quaternion a = Quaternion::rotation(Deg(15.0f), Vector3(1.0f/Constants<Float>::sqrt3()));
+    Quaternion b = Quaternion::rotation(Deg(23.0f), Vector3::xAxis());
+
+    std::ostringstream o;
+    Corrade::Utility::Error::setOutput(&o);
+
+    Quaternion notSlerpA = Quaternion::slerpFast(a*3.0f, b, 0.35f);
+    CORRADE_COMPARE(notSlerpA.vector(), Vector3());
+    CORRADE_COMPARE(notSlerpA.scalar(), std::numeric_limits<Float>::quiet_NaN());
+    CORRADE_COMPARE(o.str(), "Math::Quaternion::slerpFast(): quaternions must be normalized\n");
+
+    Quaternion slerp = Quaternion::slerpFast(a, b, 0.35f);
+    CORRADE_COMPARE(slerp, Quaternion({0.119165f, 0.0491109f, 0.0491109f}, 0.990442f));
+
+    /* Equal quaternions */
+    CORRADE_COMPARE(Quaternion::slerpFast(a, a, 0.35f), a);
+
+    /* Error bound for angles up to 90° between the quaternions */
+    Float maxError = 0.0f;
+    for(Float angle = 1.0f; angle <= 180.0f; angle += 1.0f) {
+        const Quaternion c = Quaternion::rotation(Deg(angle), Vector3::yAxis());
+        for(Float t = 0.0f; t <= 1.0f; t += 0.05f)
+            maxError = std::max(maxError, (Quaternion::slerpFast(Quaternion(), c, t) - Quaternion::slerp(Quaternion(), c, t)).length());
+    }
+    CORRADE_VERIFY(maxError < 3.0e-6f);
+
+    /* Larger angles fall back to precise version */
+    const Quaternion c = Quaternion::rotation(Deg(270.0f), Vector3::yAxis());
+    CORRADE_COMPARE(Quaternion::slerpFast(Quaternion(), c, 0.35f), Quaternion::slerp(Quaternion(), c, 0.35f));
+}
+
 void QuaternionTest::transformVector() {
     Quaternion a = Quaternion::rotation(Deg(23.0f), Vector3::xAxis());
     Matrix4 m = Matrix4::rotationX(Deg(23.0f));
@@ -182,18 +182,20 @@ void RectangularMatrixTest::constructFromData() {
 }
 
 void RectangularMatrixTest::constructFromDiagonal() {
-    Vector3 diagonal(-1.0f, 5.0f, 11.0f);
+    constexpr Vector3 diagonal(-1.0f, 5.0f, 11.0f);
 
     Matrix3x4 expectedA(Vector4(-1.0f, 0.0f,  0.0f, 0.0f),
                         Vector4( 0.0f, 5.0f,  0.0f, 0.0f),
                         Vector4( 0.0f, 0.0f, 11.0f, 0.0f));
-    CORRADE_COMPARE(Matrix3x4::fromDiagonal(diagonal), expectedA);
+    constexpr Matrix3x4 a = Matrix3x4::fromDiagonal(diagonal);
+    CORRADE_COMPARE(a, expectedA);
 
     Matrix4x3 expectedB(Vector3(-1.0f, 0.0f,  0.0f),
                         Vector3( 0.0f, 5.0f,  0.0f),
                         Vector3( 0.0f, 0.0f, 11.0f),
                         Vector3( 0.0f, 0.0f,  0.0f));
-    CORRADE_COMPARE(Matrix4x3::fromDiagonal(diagonal), expectedB);
+    constexpr Matrix4x3 b = Matrix4x3::fromDiagonal(diagonal);
+    CORRADE_COMPARE(b, expectedB);
 }
 
 void RectangularMatrixTest::constructCopy() {
@@ -388,16 +390,18 @@ void RectangularMatrixTest::transposed() {
 void RectangularMatrixTest::diagonal() {
     Vector3 diagonal(-1.0f, 5.0f, 11.0f);
 
-    Matrix4x3 a(Vector3(-1.0f,  1.0f,  3.0f),
-                Vector3( 4.0f,  5.0f,  7.0f),
-                Vector3( 8.0f,  9.0f, 11.0f),
-                Vector3(12.0f, 13.0f, 15.0f));
-    CORRADE_COMPARE(a.diagonal(), diagonal);
-
-    Matrix3x4 b(Vector4(-1.0f, 4.0f,  8.0f, 12.0f),
-                Vector4( 1.0f, 5.0f,  9.0f, 13.0f),
-                Vector4( 3.0f, 7.0f, 11.0f, 15.0f));
-    CORRADE_COMPARE(b.diagonal(), diagonal);
+    constexpr Matrix4x3 a(Vector3(-1.0f,  1.0f,  3.0f),
+                          Vector3( 4.0f,  5.0f,  7.0f),
+                          Vector3( 8.0f,  9.0f, 11.0f),
+                          Vector3(12.0f, 13.0f, 15.0f));
+    constexpr Vector3 aDiagonal = a.diagonal();
+    CORRADE_COMPARE(aDiagonal, diagonal);
+
+    constexpr Matrix3x4 b(Vector4(-1.0f, 4.0f,  8.0f, 12.0f),
+                          Vector4( 1.0f, 5.0f,  9.0f, 13.0f),
+                          Vector4( 3.0f, 7.0f, 11.0f, 15.0f));
+    constexpr Vector3 bDiagonal = b.diagonal();
+    CORRADE_COMPARE(bDiagonal, diagonal);
 }
 
 void RectangularMatrixTest::vector() {
@@ -0,0 +1,145 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <vector>
+
+#include "Math/Matrix4.h"
+#include "Math/Quaternion.h"
+#include "Test/Benchmark.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Quaternion<Float> Quaternion;
+
+namespace {
+    /* The same as the generic implementation of the operators, which is
+       replaced by the SSE2 specializations */
+    Vector4 add(const Vector4& a, const Vector4& b) {
+        Vector4 out(a);
+        for(std::size_t i = 0; i != 4; ++i) out[i] += b[i];
+        return out;
+    }
+
+    Float dot(const Vector4& a, const Vector4& b) {
+        Vector4 product(a);
+        for(std::size_t i = 0; i != 4; ++i) product[i] *= b[i];
+        Float out(product[0]);
+        for(std::size_t i = 1; i != 4; ++i) out += product[i];
+        return out;
+    }
+
+    /* Generic matrix multiplication is still available in the base class */
+    Matrix4 multiply(const Matrix4& a, const Matrix4& b) {
+        return a.RectangularMatrix<4, 4, Float>::operator*(b);
+    }
+
+    Vector4 multiply(const Matrix4& a, const Vector4& b) {
+        return a.RectangularMatrix<4, 4, Float>::operator*(b);
+    }
+
+    Vector3 transformPoint(const Matrix4& a, const Vector3& b) {
+        return multiply(a, Vector4(b, 1.0f)).xyz();
+    }
+
+    Quaternion multiply(const Quaternion& a, const Quaternion& b) {
+        return {a.scalar()*b.vector() + b.scalar()*a.vector() + Vector3::cross(a.vector(), b.vector()),
+                a.scalar()*b.scalar() - Vector3::dot(a.vector(), b.vector())};
+    }
+
+    constexpr std::size_t Count = 1000;
+}
+
+}}}
+
+int main() {
+    using namespace Magnum;
+    using namespace Magnum::Math::Test;
+
+    std::vector<Vector4> vectors, vectorsOut(Count);
+    std::vector<Matrix4> matrices, matricesOut(Count);
+    std::vector<Quaternion> quaternions, quaternionsOut(Count);
+    std::vector<Vector3> points(Count);
+    for(std::size_t i = 0; i != Count + 1; ++i) {
+        const Float f = Float(i%97)/97.0f;
+        vectors.push_back({f, 1.0f - f, f*0.5f, 2.0f});
+        matrices.push_back(Matrix4::rotation(Math::Rad<Float>(f), Vector3(1.0f, f, 0.5f).normalized())*Matrix4::translation({f, 2.0f, -f}));
+        quaternions.push_back(Quaternion::rotation(Math::Rad<Float>(f), Vector3(f, 1.0f, 0.5f).normalized()));
+    }
+
+    Magnum::Test::Benchmark benchmark;
+
+    benchmark.compare("Vector4 addition", [&]() {
+        for(std::size_t i = 0; i != Count; ++i) vectorsOut[i] = add(vectors[i], vectors[i + 1]);
+        return vectorsOut[Count/2].x();
+    }, [&]() {
+        for(std::size_t i = 0; i != Count; ++i) vectorsOut[i] = vectors[i] + vectors[i + 1];
+        return vectorsOut[Count/2].x();
+    });
+
+    benchmark.compare("Vector4 dot product", [&]() {
+        Float out{};
+        for(std::size_t i = 0; i != Count; ++i) out += dot(vectors[i], vectors[i + 1]);
+        return out;
+    }, [&]() {
+        Float out{};
+        for(std::size_t i = 0; i != Count; ++i) out += Vector4::dot(vectors[i], vectors[i + 1]);
+        return out;
+    });
+
+    benchmark.compare("Matrix4 multiplication", [&]() {
+        for(std::size_t i = 0; i != Count; ++i) matricesOut[i] = multiply(matrices[i], matrices[i + 1]);
+        return matricesOut[Count/2][3][0];
+    }, [&]() {
+        for(std::size_t i = 0; i != Count; ++i) matricesOut[i] = matrices[i]*matrices[i + 1];
+        return matricesOut[Count/2][3][0];
+    });
+
+    benchmark.compare("Matrix4 vector multiplication", [&]() {
+        for(std::size_t i = 0; i != Count; ++i) vectorsOut[i] = multiply(matrices[i], vectors[i]);
+        return vectorsOut[Count/2].x();
+    }, [&]() {
+        for(std::size_t i = 0; i != Count; ++i) vectorsOut[i] = matrices[i]*vectors[i];
+        return vectorsOut[Count/2].x();
+    });
+
+    benchmark.compare("Matrix4 point transformation", [&]() {
+        for(std::size_t i = 0; i != Count; ++i) points[i] = transformPoint(matrices[i], vectors[i].xyz());
+        return points[Count/2].x();
+    }, [&]() {
+        for(std::size_t i = 0; i != Count; ++i) points[i] = matrices[i].transformPoint(vectors[i].xyz());
+        return points[Count/2].x();
+    });
+
+    benchmark.compare("Quaternion multiplication", [&]() {
+        for(std::size_t i = 0; i != Count; ++i) quaternionsOut[i] = multiply(quaternions[i], quaternions[i + 1]);
+        return quaternionsOut[Count/2].scalar();
+    }, [&]() {
+        for(std::size_t i = 0; i != Count; ++i) quaternionsOut[i] = quaternions[i]*quaternions[i + 1];
+        return quaternionsOut[Count/2].scalar();
+    });
+}
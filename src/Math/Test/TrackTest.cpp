@@ -0,0 +1,295 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <TestSuite/Tester.h>
+
+#include "Math/Track.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+class TrackTest: public Corrade::TestSuite::Tester {
+    public:
+        explicit TrackTest();
+
+        void construct();
+        void constructInvalid();
+
+        void keyframe();
+        void keyframeHint();
+        void factor();
+
+        void atScalar();
+        void atVector();
+        void atConstant();
+        void atSingle();
+        void atQuaternion();
+        void atQuaternionShortestPath();
+        void atDualQuaternion();
+
+        void sample();
+        void sampleQuaternion();
+        void sampleDualQuaternion();
+
+        void debugInterpolation();
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Quaternion<Float> Quaternion;
+typedef Math::DualQuaternion<Float> DualQuaternion;
+typedef Math::Vector3<Float> Vector3;
+
+TrackTest::TrackTest() {
+    addTests({&TrackTest::construct,
+              &TrackTest::constructInvalid,
+
+              &TrackTest::keyframe,
+              &TrackTest::keyframeHint,
+              &TrackTest::factor,
+
+              &TrackTest::atScalar,
+              &TrackTest::atVector,
+              &TrackTest::atConstant,
+              &TrackTest::atSingle,
+              &TrackTest::atQuaternion,
+              &TrackTest::atQuaternionShortestPath,
+              &TrackTest::atDualQuaternion,
+
+              &TrackTest::sample,
+              &TrackTest::sampleQuaternion,
+              &TrackTest::sampleDualQuaternion,
+
+              &TrackTest::debugInterpolation});
+}
+
+void TrackTest::construct() {
+    Track<Float, Float> a({0.0f, 1.0f, 3.0f}, {1.0f, 2.0f, -1.0f}, TrackInterpolation::Constant);
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a.times(), (std::vector<Float>{0.0f, 1.0f, 3.0f}));
+    CORRADE_COMPARE(a.values(), (std::vector<Float>{1.0f, 2.0f, -1.0f}));
+    CORRADE_COMPARE(a.interpolation(), TrackInterpolation::Constant);
+    CORRADE_COMPARE(a.startTime(), 0.0f);
+    CORRADE_COMPARE(a.endTime(), 3.0f);
+
+    Track<Float, Float> b;
+    CORRADE_COMPARE(b.size(), 0);
+    CORRADE_COMPARE(b.interpolation(), TrackInterpolation::Linear);
+}
+
+void TrackTest::constructInvalid() {
+    std::ostringstream o;
+    Error::setOutput(&o);
+
+    Track<Float, Float>({0.0f, 1.0f}, {1.0f});
+    CORRADE_COMPARE(o.str(), "Math::Track: count of times and values doesn't match\n");
+
+    o.str({});
+    Track<Float, Float>({1.0f, 0.0f}, {1.0f, 2.0f});
+    CORRADE_COMPARE(o.str(), "Math::Track: times are not sorted\n");
+}
+
+void TrackTest::keyframe() {
+    Track<Float, Float> a({0.0f, 1.0f, 3.0f, 4.0f}, {1.0f, 2.0f, -1.0f, 0.0f});
+
+    std::size_t hint = 0;
+    CORRADE_COMPARE(a.keyframe(-1.0f, hint), 0);
+    CORRADE_COMPARE(a.keyframe(0.5f, hint), 0);
+    CORRADE_COMPARE(a.keyframe(3.5f, hint), 2);
+    CORRADE_COMPARE(hint, 2);
+    CORRADE_COMPARE(a.keyframe(1.0f, hint), 1);
+    CORRADE_COMPARE(a.keyframe(4.0f, hint), 2);
+    CORRADE_COMPARE(a.keyframe(100.0f, hint), 2);
+}
+
+void TrackTest::keyframeHint() {
+    Track<Float, Float> a({0.0f, 1.0f, 3.0f, 4.0f}, {1.0f, 2.0f, -1.0f, 0.0f});
+
+    /* Hint pointing to the same or previous interval */
+    std::size_t hint = 1;
+    CORRADE_COMPARE(a.keyframe(2.0f, hint), 1);
+    CORRADE_COMPARE(a.keyframe(3.5f, hint), 2);
+    CORRADE_COMPARE(hint, 2);
+
+    /* Invalid hint should be corrected */
+    hint = 76;
+    CORRADE_COMPARE(a.keyframe(0.5f, hint), 0);
+    CORRADE_COMPARE(hint, 0);
+}
+
+void TrackTest::factor() {
+    Track<Float, Float> a({0.0f, 1.0f, 3.0f, 3.0f}, {1.0f, 2.0f, -1.0f, 0.0f});
+    CORRADE_COMPARE(a.factor(-1.0f, 0), 0.0f);
+    CORRADE_COMPARE(a.factor(2.5f, 1), 0.75f);
+    CORRADE_COMPARE(a.factor(5.0f, 1), 1.0f);
+
+    /* Zero-length interval */
+    CORRADE_COMPARE(a.factor(2.0f, 2), 0.0f);
+    CORRADE_COMPARE(a.factor(3.0f, 2), 1.0f);
+
+    Track<Float, Float> b({0.0f, 1.0f}, {1.0f, 2.0f}, TrackInterpolation::Constant);
+    CORRADE_COMPARE(b.factor(0.75f, 0), 0.0f);
+    CORRADE_COMPARE(b.factor(1.0f, 0), 1.0f);
+}
+
+void TrackTest::atScalar() {
+    Track<Float, Float> a({0.0f, 1.0f, 3.0f}, {1.0f, 2.0f, -2.0f});
+    CORRADE_COMPARE(a.at(-1.0f), 1.0f);
+    CORRADE_COMPARE(a.at(0.5f), 1.5f);
+    CORRADE_COMPARE(a.at(1.0f), 2.0f);
+    CORRADE_COMPARE(a.at(2.5f), -1.0f);
+    CORRADE_COMPARE(a.at(5.0f), -2.0f);
+}
+
+void TrackTest::atVector() {
+    Track<Float, Vector3> a({1.0f, 3.0f}, {Vector3(1.0f, 2.0f, 3.0f), Vector3(3.0f, 0.0f, 3.0f)});
+    CORRADE_COMPARE(a.at(1.5f), Vector3(1.5f, 1.5f, 3.0f));
+}
+
+void TrackTest::atConstant() {
+    Track<Float, Float> a({0.0f, 1.0f, 3.0f}, {1.0f, 2.0f, -2.0f}, TrackInterpolation::Constant);
+    CORRADE_COMPARE(a.at(-1.0f), 1.0f);
+    CORRADE_COMPARE(a.at(0.5f), 1.0f);
+    CORRADE_COMPARE(a.at(2.9f), 2.0f);
+    CORRADE_COMPARE(a.at(3.0f), -2.0f);
+}
+
+void TrackTest::atSingle() {
+    Track<Float, Float> a({1.0f}, {3.0f});
+    CORRADE_COMPARE(a.at(-1.0f), 3.0f);
+    CORRADE_COMPARE(a.at(1.0f), 3.0f);
+    CORRADE_COMPARE(a.at(2.0f), 3.0f);
+
+    /* Last two keyframes at the same time */
+    Track<Float, Float> b({0.0f, 1.0f, 1.0f}, {1.0f, 2.0f, 5.0f});
+    CORRADE_COMPARE(b.at(0.5f), 1.5f);
+    CORRADE_COMPARE(b.at(1.0f), 5.0f);
+}
+
+void TrackTest::atQuaternion() {
+    const Quaternion a = Quaternion::rotation(Deg(15.0f), Vector3::xAxis());
+    const Quaternion b = Quaternion::rotation(Deg(75.0f), Vector3::xAxis());
+
+    Track<Float, Quaternion> linear({0.0f, 1.0f}, {a, b});
+    CORRADE_COMPARE(linear.at(0.5f), Quaternion::lerp(a, b, 0.5f));
+    CORRADE_COMPARE(linear.at(0.25f), Quaternion::lerp(a, b, 0.25f));
+
+    Track<Float, Quaternion> spherical({0.0f, 1.0f}, {a, b}, TrackInterpolation::Spherical);
+    CORRADE_COMPARE(spherical.at(0.25f), Quaternion::slerp(a, b, 0.25f));
+    CORRADE_COMPARE(spherical.at(0.25f), Quaternion::rotation(Deg(30.0f), Vector3::xAxis()));
+
+    /* Equal rotations shouldn't produce NaN */
+    Track<Float, Quaternion> same({0.0f, 1.0f}, {a, a}, TrackInterpolation::Spherical);
+    CORRADE_COMPARE(same.at(0.5f), a);
+}
+
+void TrackTest::atQuaternionShortestPath() {
+    const Quaternion a = Quaternion::rotation(Deg(15.0f), Vector3::xAxis());
+    const Quaternion b = -Quaternion::rotation(Deg(75.0f), Vector3::xAxis());
+
+    Track<Float, Quaternion> linear({0.0f, 1.0f}, {a, b});
+    CORRADE_COMPARE(linear.at(0.5f), Quaternion::rotation(Deg(45.0f), Vector3::xAxis()));
+
+    Track<Float, Quaternion> spherical({0.0f, 1.0f}, {a, b}, TrackInterpolation::Spherical);
+    CORRADE_COMPARE(spherical.at(0.25f), Quaternion::rotation(Deg(30.0f), Vector3::xAxis()));
+}
+
+void TrackTest::atDualQuaternion() {
+    const DualQuaternion a = DualQuaternion::translation(Vector3(2.0f, 0.0f, 0.0f));
+    const DualQuaternion b = DualQuaternion::translation(Vector3(4.0f, 2.0f, 0.0f));
+
+    Track<Float, DualQuaternion> track({0.0f, 1.0f}, {a, b});
+    const DualQuaternion c = track.at(0.5f);
+    CORRADE_VERIFY(c.isNormalized());
+    CORRADE_COMPARE(c.translation(), Vector3(3.0f, 1.0f, 0.0f));
+
+    const DualQuaternion rotated = DualQuaternion::rotation(Deg(90.0f), Vector3::zAxis());
+    Track<Float, DualQuaternion> rotation({0.0f, 1.0f}, {DualQuaternion(), rotated});
+    const DualQuaternion d = rotation.at(0.5f);
+    CORRADE_VERIFY(d.isNormalized());
+    CORRADE_COMPARE(d.rotation(), Quaternion::rotation(Deg(45.0f), Vector3::zAxis()));
+}
+
+void TrackTest::sample() {
+    std::vector<Track<Float, Float>> tracks{
+        Track<Float, Float>({0.0f, 2.0f}, {0.0f, 2.0f}),
+        Track<Float, Float>({0.0f, 1.0f, 2.0f}, {4.0f, 0.0f, 1.0f}),
+        Track<Float, Float>({0.0f, 1.0f}, {3.0f, 5.0f}, TrackInterpolation::Constant)};
+
+    std::size_t hints[3]{};
+    Float out[3];
+    Math::sample(tracks.data(), tracks.size(), 1.5f, hints, out);
+    CORRADE_COMPARE(out[0], 1.5f);
+    CORRADE_COMPARE(out[1], 0.5f);
+    CORRADE_COMPARE(out[2], 5.0f);
+    CORRADE_COMPARE(hints[1], 1);
+}
+
+void TrackTest::sampleQuaternion() {
+    /* More tracks than fits into one batch, with all interpolation types
+       and single-keyframe tracks, the result should be the same as from
+       at() */
+    std::vector<Track<Float, Quaternion>> tracks;
+    for(std::size_t i = 0; i != 150; ++i) {
+        const Quaternion a = Quaternion::rotation(Deg(Float(i)), Vector3::xAxis());
+        const Quaternion b = Quaternion::rotation(Deg(90.0f + i*2.0f), Vector3(1.0f, 1.0f, 0.0f).normalized());
+        if(i%10 == 9) tracks.emplace_back(std::vector<Float>{0.5f}, std::vector<Quaternion>{a});
+        else tracks.emplace_back(std::vector<Float>{0.0f, 1.0f, 2.0f}, std::vector<Quaternion>{a, i%2 ? -b : b, a}, TrackInterpolation(i%3));
+    }
+
+    std::vector<std::size_t> hints(tracks.size()), expectedHints(tracks.size());
+    std::vector<Quaternion> out(tracks.size());
+    for(Float time: {-1.0f, 0.3f, 1.25f, 3.0f}) {
+        Math::sample(tracks.data(), tracks.size(), time, hints.data(), out.data());
+        for(std::size_t i = 0; i != tracks.size(); ++i) {
+            CORRADE_COMPARE(out[i], tracks[i].at(time, expectedHints[i]));
+            CORRADE_COMPARE(hints[i], expectedHints[i]);
+        }
+    }
+}
+
+void TrackTest::sampleDualQuaternion() {
+    const DualQuaternion a = DualQuaternion::translation(Vector3(2.0f, 0.0f, 0.0f));
+    const DualQuaternion b = DualQuaternion::rotation(Deg(90.0f), Vector3::zAxis());
+    std::vector<Track<Float, DualQuaternion>> tracks{
+        Track<Float, DualQuaternion>({0.0f, 1.0f}, {a, b}),
+        Track<Float, DualQuaternion>({0.0f, 1.0f}, {b, -a}),
+        Track<Float, DualQuaternion>({0.0f}, {b})};
+
+    std::size_t hints[3]{};
+    DualQuaternion out[3];
+    Math::sample(tracks.data(), tracks.size(), 0.25f, hints, out);
+    CORRADE_COMPARE(out[0], tracks[0].at(0.25f));
+    CORRADE_COMPARE(out[1], tracks[1].at(0.25f));
+    CORRADE_COMPARE(out[2], b);
+}
+
+void TrackTest::debugInterpolation() {
+    std::ostringstream o;
+    Debug(&o) << TrackInterpolation::Spherical;
+    CORRADE_COMPARE(o.str(), "Math::TrackInterpolation::Spherical\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::TrackTest)
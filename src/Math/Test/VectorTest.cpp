@@ -85,6 +85,7 @@ class VectorTest: public Corrade::TestSuite::Tester {
         void length();
         void lengthInverted();
         void normalized();
+        void normalizedFast();
         void resized();
 
         void sum();
@@ -140,6 +141,7 @@ VectorTest::VectorTest() {
               &VectorTest::length,
               &VectorTest::lengthInverted,
               &VectorTest::normalized,
+              &VectorTest::normalizedFast,
               &VectorTest::resized,
 
               &VectorTest::sum,
@@ -282,29 +284,52 @@ void VectorTest::compareComponentWise() {
 
 void VectorTest::negative() {
     CORRADE_COMPARE(-Vector4(1.0f, -3.0f, 5.0f, -10.0f), Vector4(-1.0f, 3.0f, -5.0f, 10.0f));
+
+    /* Usable in constant expressions (except for four-component floats with
+       SSE2) */
+    constexpr Vector3 a = -Vector3(1.0f, -3.0f, 5.0f);
+    CORRADE_COMPARE(a, Vector3(-1.0f, 3.0f, -5.0f));
 }
 
 void VectorTest::addSubtract() {
-    Vector4 a(1.0f, -3.0f, 5.0f, -10.0f);
-    Vector4 b(7.5f, 33.0f, -15.0f, 0.0f);
-    Vector4 c(8.5f, 30.0f, -10.0f, -10.0f);
+    constexpr Vector4 a(1.0f, -3.0f, 5.0f, -10.0f);
+    constexpr Vector4 b(7.5f, 33.0f, -15.0f, 0.0f);
+    constexpr Vector4 c(8.5f, 30.0f, -10.0f, -10.0f);
 
     CORRADE_COMPARE(a + b, c);
     CORRADE_COMPARE(c - b, a);
+
+    /* Usable in constant expressions (except for four-component floats with
+       SSE2) */
+    constexpr Vector3 d = Vector3(1.0f, -3.0f, 5.0f) + Vector3(7.5f, 33.0f, -15.0f);
+    constexpr Vector3 e = Vector3(8.5f, 30.0f, -10.0f) - Vector3(7.5f, 33.0f, -15.0f);
+    CORRADE_COMPARE(d, Vector3(8.5f, 30.0f, -10.0f));
+    CORRADE_COMPARE(e, Vector3(1.0f, -3.0f, 5.0f));
 }
 
 void VectorTest::multiplyDivide() {
-    Vector4 vector(1.0f, 2.0f, 3.0f, 4.0f);
-    Vector4 multiplied(-1.5f, -3.0f, -4.5f, -6.0f);
+    constexpr Vector4 vector(1.0f, 2.0f, 3.0f, 4.0f);
+    constexpr Vector4 multiplied(-1.5f, -3.0f, -4.5f, -6.0f);
 
     CORRADE_COMPARE(vector*-1.5f, multiplied);
     CORRADE_COMPARE(-1.5f*vector, multiplied);
     CORRADE_COMPARE(multiplied/-1.5f, vector);
 
     /* Divide vector with number and invert */
-    Vector4 divisor(1.0f, 2.0f, -4.0f, 8.0f);
-    Vector4 result(1.0f, 0.5f, -0.25f, 0.125f);
+    constexpr Vector4 divisor(1.0f, 2.0f, -4.0f, 8.0f);
+    constexpr Vector4 result(1.0f, 0.5f, -0.25f, 0.125f);
     CORRADE_COMPARE(1.0f/divisor, result);
+
+    /* Usable in constant expressions (except for four-component floats with
+       SSE2) */
+    constexpr Vector3 a = Vector3(1.0f, 2.0f, 3.0f)*-1.5f;
+    constexpr Vector3 b = -1.5f*Vector3(1.0f, 2.0f, 3.0f);
+    constexpr Vector3 c = Vector3(-1.5f, -3.0f, -4.5f)/-1.5f;
+    constexpr Vector3 d = 1.0f/Vector3(1.0f, 2.0f, -4.0f);
+    CORRADE_COMPARE(a, Vector3(-1.5f, -3.0f, -4.5f));
+    CORRADE_COMPARE(b, Vector3(-1.5f, -3.0f, -4.5f));
+    CORRADE_COMPARE(c, Vector3(1.0f, 2.0f, 3.0f));
+    CORRADE_COMPARE(d, Vector3(1.0f, 0.5f, -0.25f));
 }
 
 void VectorTest::multiplyDivideIntegral() {
@@ -319,12 +344,19 @@ void VectorTest::multiplyDivideIntegral() {
 }
 
 void VectorTest::multiplyDivideComponentWise() {
-    Vector4 vec(1.0f, 2.0f, 3.0f, 4.0f);
-    Vector4 multiplier(7.0f, -4.0f, -1.5f, 1.0f);
-    Vector4 multiplied(7.0f, -8.0f, -4.5f, 4.0f);
+    constexpr Vector4 vec(1.0f, 2.0f, 3.0f, 4.0f);
+    constexpr Vector4 multiplier(7.0f, -4.0f, -1.5f, 1.0f);
+    constexpr Vector4 multiplied(7.0f, -8.0f, -4.5f, 4.0f);
 
     CORRADE_COMPARE(vec*multiplier, multiplied);
     CORRADE_COMPARE(multiplied/multiplier, vec);
+
+    /* Usable in constant expressions (except for four-component floats with
+       SSE2) */
+    constexpr Vector3 a = Vector3(1.0f, 2.0f, 3.0f)*Vector3(7.0f, -4.0f, -1.5f);
+    constexpr Vector3 b = Vector3(7.0f, -8.0f, -4.5f)/Vector3(7.0f, -4.0f, -1.5f);
+    CORRADE_COMPARE(a, Vector3(7.0f, -8.0f, -4.5f));
+    CORRADE_COMPARE(b, Vector3(1.0f, 2.0f, 3.0f));
 }
 
 void VectorTest::multiplyDivideComponentWiseIntegral() {
@@ -385,6 +417,14 @@ void VectorTest::normalized() {
     CORRADE_COMPARE(vec.length(), 1.0f);
 }
 
+void VectorTest::normalizedFast() {
+    const auto vec = Vector4(1.0f, 1.0f, 1.0f, 1.0f).normalizedFast();
+    CORRADE_COMPARE(vec, Vector4(0.5f, 0.5f, 0.5f, 0.5f));
+    CORRADE_VERIFY(vec.isNormalized());
+    CORRADE_VERIFY(Vector4(0.0f, 3.0f, -1.5f, 7.5f).normalizedFast().isNormalized());
+    CORRADE_COMPARE(Vector4(0.0f, 3.0f, -1.5f, 7.5f).lengthInvertedFast(), Vector4(0.0f, 3.0f, -1.5f, 7.5f).lengthInverted());
+}
+
 void VectorTest::resized() {
     const auto vec = Vector4(2.0f, 2.0f, 0.0f, 1.0f).resized(9.0f);
     CORRADE_COMPARE(vec, Vector4(6.0f, 6.0f, 0.0f, 3.0f));
@@ -0,0 +1,354 @@
+#ifndef Magnum_Math_Track_h
+#define Magnum_Math_Track_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::Math::Track, enum Magnum::Math::TrackInterpolation, function Magnum::Math::sample()
+ */
+
+#include <cstdint>
+#include <algorithm>
+#include <vector>
+#include <Utility/Assert.h>
+#include <Utility/Debug.h>
+
+#include "Math/Functions.h"
+#include "Math/DualQuaternion.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@brief Track interpolation
+
+@see Track
+*/
+enum class TrackInterpolation: std::uint8_t {
+    /** Value of previous keyframe is used without interpolation */
+    Constant,
+
+    /**
+     * Linear interpolation. Quaternions and dual quaternions are interpolated
+     * along the shortest path and normalized afterwards.
+     */
+    Linear,
+
+    /**
+     * Spherical linear interpolation for quaternions, linear interpolation
+     * for all other types.
+     */
+    Spherical
+};
+
+/** @debugoperator{Magnum::Math::TrackInterpolation} */
+inline Corrade::Utility::Debug operator<<(Corrade::Utility::Debug debug, TrackInterpolation value) {
+    switch(value) {
+        #define _c(value) case TrackInterpolation::value: return debug << "Math::TrackInterpolation::" #value;
+        _c(Constant)
+        _c(Linear)
+        _c(Spherical)
+        #undef _c
+    }
+
+    return debug << "Math::TrackInterpolation::(invalid)";
+}
+
+namespace Implementation {
+
+/* Interpolation is split into two steps. Weights of the two keyframe values
+   are computed per track, the weighted values are then blended in one pass
+   over many tracks at once, see sample(). */
+template<class V> struct TrackInterpolator {
+    template<class T> static void weights(const V&, const V&, T t, TrackInterpolation, T& weightA, T& weightB) {
+        weightA = T(1) - t;
+        weightB = t;
+    }
+
+    template<class T> static void blend(const V* a, const V* b, const T* weightsA, const T* weightsB, V* out, std::size_t count) {
+        for(std::size_t i = 0; i != count; ++i)
+            out[i] = weightsA[i]*a[i] + weightsB[i]*b[i];
+    }
+};
+
+template<class T> struct TrackInterpolator<Quaternion<T>> {
+    static void weights(const Quaternion<T>& a, const Quaternion<T>& b, T t, TrackInterpolation interpolation, T& weightA, T& weightB) {
+        weightA = T(1) - t;
+        weightB = t;
+
+        /* Fall back to linear interpolation for (nearly) equal rotations */
+        if(interpolation != TrackInterpolation::Spherical) return;
+        const T cosAngle = std::abs(Quaternion<T>::dot(a, b));
+        if(cosAngle < T(1) - TypeTraits<T>::epsilon()) {
+            const T angle = std::acos(cosAngle);
+            const T invertedSin = T(1)/std::sin(angle);
+            weightA = std::sin(weightA*angle)*invertedSin;
+            weightB = std::sin(weightB*angle)*invertedSin;
+        }
+    }
+
+    static void blend(const Quaternion<T>* a, const Quaternion<T>* b, const T* weightsA, const T* weightsB, Quaternion<T>* out, std::size_t count) {
+        /* Take the shortest path */
+        for(std::size_t i = 0; i != count; ++i) {
+            const T weightB = Quaternion<T>::dot(a[i], b[i]) < T(0) ? -weightsB[i] : weightsB[i];
+            out[i] = (weightsA[i]*a[i] + weightB*b[i]).normalized();
+        }
+    }
+};
+
+template<class T> struct TrackInterpolator<DualQuaternion<T>> {
+    static void weights(const DualQuaternion<T>&, const DualQuaternion<T>&, T t, TrackInterpolation, T& weightA, T& weightB) {
+        weightA = T(1) - t;
+        weightB = t;
+    }
+
+    static void blend(const DualQuaternion<T>* a, const DualQuaternion<T>* b, const T* weightsA, const T* weightsB, DualQuaternion<T>* out, std::size_t count) {
+        /* Dual quaternion linear blending along the shortest path */
+        for(std::size_t i = 0; i != count; ++i) {
+            const T weightB = Quaternion<T>::dot(a[i].real(), b[i].real()) < T(0) ? -weightsB[i] : weightsB[i];
+            out[i] = DualQuaternion<T>(weightsA[i]*a[i].real() + weightB*b[i].real(),
+                                       weightsA[i]*a[i].dual() + weightB*b[i].dual()).normalized();
+        }
+    }
+};
+
+}
+
+/**
+@brief Keyframe animation track
+@tparam T   Time type
+@tparam V   Value type
+
+Sorted list of keyframe times with corresponding values. Values between
+keyframes are interpolated, values outside the track range are clamped to
+first or last keyframe value. Supported value types are scalars, vectors,
+@ref Quaternion and @ref DualQuaternion, see @ref TrackInterpolation for
+more information about interpolation of particular types.
+
+@section Track-playback Monotonic playback
+
+Lookup of keyframe for given time is done using binary search. When playing
+the animation forward, it is more efficient to pass the same hint variable to
+all @ref at() calls, so the lookup is done in constant time by checking
+neighborhood of previously found keyframe:
+@code
+Math::Track<Float, Quaternion> rotation({0.0f, 1.0f, 2.5f}, {a, b, c});
+
+std::size_t hint = 0;
+for(Float time = 0.0f; time < 2.5f; time += 1.0f/60.0f)
+    object.setRotation(rotation.at(time, hint));
+@endcode
+
+Many tracks can be sampled at once using @ref sample().
+*/
+template<class T, class V> class Track {
+    public:
+        typedef T TimeType;     /**< @brief Time type */
+        typedef V ValueType;    /**< @brief Value type */
+
+        /**
+         * @brief Default constructor
+         *
+         * Creates empty track. Sampling empty track is not allowed.
+         */
+        explicit Track(): _interpolation(TrackInterpolation::Linear) {}
+
+        /**
+         * @brief Constructor
+         * @param times         Keyframe times, sorted in ascending order
+         * @param values        Keyframe values
+         * @param interpolation Interpolation between keyframes
+         *
+         * Count of keyframe times must be the same as count of values.
+         */
+        explicit Track(std::vector<T> times, std::vector<V> values, TrackInterpolation interpolation = TrackInterpolation::Linear): _times(std::move(times)), _values(std::move(values)), _interpolation(interpolation) {
+            CORRADE_ASSERT(_times.size() == _values.size(),
+                "Math::Track: count of times and values doesn't match", );
+            CORRADE_ASSERT(std::is_sorted(_times.begin(), _times.end()),
+                "Math::Track: times are not sorted", );
+        }
+
+        /** @brief Keyframe count */
+        std::size_t size() const { return _times.size(); }
+
+        /** @brief Keyframe times */
+        const std::vector<T>& times() const { return _times; }
+
+        /** @brief Keyframe values */
+        const std::vector<V>& values() const { return _values; }
+
+        /** @brief Interpolation between keyframes */
+        TrackInterpolation interpolation() const { return _interpolation; }
+
+        /**
+         * @brief Time of first keyframe
+         *
+         * Expects that the track is not empty.
+         */
+        T startTime() const { return _times.front(); }
+
+        /**
+         * @brief Time of last keyframe
+         *
+         * Expects that the track is not empty.
+         */
+        T endTime() const { return _times.back(); }
+
+        /**
+         * @brief Keyframe index
+         * @param time  Time
+         * @param hint  Index of keyframe found in previous call
+         *
+         * Returns index of keyframe preceding @p time, clamped so there is
+         * always one following keyframe (if the track has more than one
+         * keyframe). If @p time is in the same or next interval as in
+         * previous call, the lookup is done in constant time, otherwise
+         * binary search is used. The @p hint is updated with the found
+         * index.
+         */
+        std::size_t keyframe(T time, std::size_t& hint) const;
+
+        /**
+         * @brief Interpolation factor
+         * @param time      Time
+         * @param keyframe  Keyframe index, see @ref keyframe()
+         *
+         * Returns position of @p time between given keyframe and the next
+         * one in range @f$ [0, 1] @f$. For @ref TrackInterpolation::Constant
+         * the factor is rounded down to `0` until the next keyframe is
+         * reached. Expects that the track has at least two keyframes.
+         */
+        T factor(T time, std::size_t keyframe) const;
+
+        /**
+         * @brief Value at given time
+         *
+         * Expects that the track is not empty.
+         * @see @ref at(T, std::size_t&) const
+         */
+        V at(T time) const {
+            std::size_t hint = 0;
+            return at(time, hint);
+        }
+
+        /**
+         * @brief Value at given time using keyframe hint
+         *
+         * See @ref keyframe() for more information about the hint. Expects
+         * that the track is not empty.
+         */
+        V at(T time, std::size_t& hint) const;
+
+    private:
+        std::vector<T> _times;
+        std::vector<V> _values;
+        TrackInterpolation _interpolation;
+};
+
+/** @relates Track
+@brief Sample many tracks at once
+@param tracks   Tracks
+@param count    Track count
+@param time     Time
+@param hints    Keyframe hint for each track, see @ref Track::keyframe()
+@param out      Where to put the values
+
+Gives the same result as calling @ref Track::at() for each track. Keyframe
+lookup is done first for a batch of tracks and the gathered keyframe value
+pairs are then interpolated in one tight loop, which for quaternions and dual
+quaternions is a normalized linear interpolation without any branching on
+interpolation type.
+*/
+template<class T, class V> void sample(const Track<T, V>* tracks, std::size_t count, T time, std::size_t* hints, V* out) {
+    /* Keyframe values are gathered on stack to avoid allocations */
+    constexpr std::size_t BatchSize = 64;
+    V a[BatchSize], b[BatchSize];
+    T weightsA[BatchSize], weightsB[BatchSize];
+
+    for(std::size_t batch = 0; batch < count; batch += BatchSize) {
+        const std::size_t batchCount = std::min(count - batch, BatchSize);
+
+        for(std::size_t i = 0; i != batchCount; ++i) {
+            const Track<T, V>& track = tracks[batch + i];
+            CORRADE_ASSERT(track.size(), "Math::sample(): track" << batch + i << "is empty", );
+
+            /* Single keyframe is blended with itself and replaced with the
+               original value afterwards */
+            const std::size_t keyframe = track.keyframe(time, hints[batch + i]);
+            const std::size_t next = track.size() == 1 ? keyframe : keyframe + 1;
+            a[i] = track.values()[keyframe];
+            b[i] = track.values()[next];
+            Implementation::TrackInterpolator<V>::weights(a[i], b[i],
+                track.size() == 1 ? T(0) : track.factor(time, keyframe),
+                track.interpolation(), weightsA[i], weightsB[i]);
+        }
+
+        Implementation::TrackInterpolator<V>::blend(a, b, weightsA, weightsB, out + batch, batchCount);
+
+        for(std::size_t i = 0; i != batchCount; ++i)
+            if(tracks[batch + i].size() == 1) out[batch + i] = a[i];
+    }
+}
+
+template<class T, class V> std::size_t Track<T, V>::keyframe(const T time, std::size_t& hint) const {
+    /* Zero or one keyframe, nothing to search */
+    if(_times.size() < 2) return hint = 0;
+
+    /* Same or next interval as in previous call */
+    if(hint + 1 < _times.size() && _times[hint] <= time) {
+        if(time < _times[hint + 1]) return hint;
+        if(hint + 2 < _times.size() && time < _times[hint + 2]) return ++hint;
+    }
+
+    /* Binary search, clamp the result to the first/last interval */
+    const std::size_t found = std::upper_bound(_times.begin(), _times.end(), time) - _times.begin();
+    return hint = std::min(found == 0 ? 0 : found - 1, _times.size() - 2);
+}
+
+template<class T, class V> T Track<T, V>::factor(const T time, const std::size_t keyframe) const {
+    /* Zero-length interval at the end is possible if the last two keyframes
+       have the same time */
+    const T duration = _times[keyframe + 1] - _times[keyframe];
+    const T t = duration > T(0) ? Math::clamp((time - _times[keyframe])/duration, T(0), T(1)) :
+        (time < _times[keyframe] ? T(0) : T(1));
+    if(_interpolation == TrackInterpolation::Constant)
+        return t < T(1) ? T(0) : T(1);
+    return t;
+}
+
+template<class T, class V> inline V Track<T, V>::at(const T time, std::size_t& hint) const {
+    CORRADE_ASSERT(!_times.empty(), "Math::Track::at(): the track is empty", {});
+
+    const std::size_t i = keyframe(time, hint);
+    if(_times.size() == 1) return _values[0];
+
+    T weightA, weightB;
+    Implementation::TrackInterpolator<V>::weights(_values[i], _values[i + 1], factor(time, i), _interpolation, weightA, weightB);
+    V out;
+    Implementation::TrackInterpolator<V>::blend(&_values[i], &_values[i + 1], &weightA, &weightB, &out, 1);
+    return out;
+}
+
+}}
+
+#endif
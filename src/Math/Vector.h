@@ -40,10 +40,57 @@
 
 #include "magnumVisibility.h"
 
+#ifdef MAGNUM_TARGET_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace Magnum { namespace Math {
 
 namespace Implementation {
     template<std::size_t, class, class> struct VectorConverter;
+
+    #ifdef MAGNUM_TARGET_SSE2
+    /* Helpers for SSE2 specializations of four-component float types. The
+       data are loaded unaligned, so the memory layout stays the same. */
+    namespace Sse {
+        /* Immediate operand for _mm_shuffle_ps() */
+        constexpr int shuffle(int x, int y, int z, int w) {
+            return x | (y << 2) | (z << 4) | (w << 6);
+        }
+
+        /* Given component in all components */
+        template<int i> inline __m128 broadcast(__m128 a) {
+            return _mm_shuffle_ps(a, a, shuffle(i, i, i, i));
+        }
+
+        /* Sum of all components in all components */
+        inline __m128 sum(__m128 a) {
+            a = _mm_add_ps(a, _mm_shuffle_ps(a, a, shuffle(1, 0, 3, 2)));
+            return _mm_add_ps(a, _mm_shuffle_ps(a, a, shuffle(2, 3, 0, 1)));
+        }
+
+        /* Linear combination of four columns */
+        inline __m128 combine(__m128 a, __m128 b, __m128 c, __m128 d, __m128 factors) {
+            return _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(a, broadcast<0>(factors)), _mm_mul_ps(b, broadcast<1>(factors))),
+                _mm_add_ps(_mm_mul_ps(c, broadcast<2>(factors)), _mm_mul_ps(d, broadcast<3>(factors))));
+        }
+    }
+    #endif
+
+    /* Used in Math::sqrtInvertedFast() and Vector::lengthInvertedFast().
+       Only Float with SSE2 has the fast path, everything else is computed
+       precisely. */
+    template<class T> inline T sqrtInvertedFast(T value) {
+        return T(1)/std::sqrt(value);
+    }
+    #ifdef MAGNUM_TARGET_SSE2
+    template<> inline Float sqrtInvertedFast(Float value) {
+        /* 12-bit estimate refined with one Newton-Raphson step */
+        const Float estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(value)));
+        return estimate*(1.5f - 0.5f*value*estimate*estimate);
+    }
+    #endif
 }
 
 /**
@@ -252,7 +299,9 @@ template<std::size_t size, class T> class Vector {
          * @f]
          * @see Vector2::perpendicular()
          */
-        Vector<size, T> operator-() const;
+        constexpr Vector<size, T> operator-() const {
+            return negateInternal(typename Implementation::GenerateSequence<size>::Type());
+        }
 
         /**
          * @brief Add and assign vector
@@ -273,8 +322,8 @@ template<std::size_t size, class T> class Vector {
          *
          * @see operator+=(), sum()
          */
-        Vector<size, T> operator+(const Vector<size, T>& other) const {
-            return Vector<size, T>(*this) += other;
+        constexpr Vector<size, T> operator+(const Vector<size, T>& other) const {
+            return addInternal(typename Implementation::GenerateSequence<size>::Type(), other);
         }
 
         /**
@@ -296,8 +345,8 @@ template<std::size_t size, class T> class Vector {
          *
          * @see operator-=()
          */
-        Vector<size, T> operator-(const Vector<size, T>& other) const {
-            return Vector<size, T>(*this) -= other;
+        constexpr Vector<size, T> operator-(const Vector<size, T>& other) const {
+            return subtractInternal(typename Implementation::GenerateSequence<size>::Type(), other);
         }
 
         /**
@@ -323,8 +372,8 @@ template<std::size_t size, class T> class Vector {
          *      operator*=(T), operator*(T, const Vector<size, T>&),
          *      operator*(const Vector<size, Integral>&, FloatingPoint)
          */
-        Vector<size, T> operator*(T number) const {
-            return Vector<size, T>(*this) *= number;
+        constexpr Vector<size, T> operator*(T number) const {
+            return multiplyInternal(typename Implementation::GenerateSequence<size>::Type(), number);
         }
 
         /**
@@ -350,8 +399,8 @@ template<std::size_t size, class T> class Vector {
          *      operator/=(T), operator/(T, const Vector<size, T>&),
          *      operator/(const Vector<size, Integral>&, FloatingPoint)
          */
-        Vector<size, T> operator/(T number) const {
-            return Vector<size, T>(*this) /= number;
+        constexpr Vector<size, T> operator/(T number) const {
+            return divideInternal(typename Implementation::GenerateSequence<size>::Type(), number);
         }
 
         /**
@@ -376,8 +425,8 @@ template<std::size_t size, class T> class Vector {
          * @see operator*(T) const, operator*=(const Vector<size, T>&),
          *      operator*(const Vector<size, Integral>&, const Vector<size, FloatingPoint>&)
          */
-        Vector<size, T> operator*(const Vector<size, T>& other) const {
-            return Vector<size, T>(*this) *= other;
+        constexpr Vector<size, T> operator*(const Vector<size, T>& other) const {
+            return multiplyInternal(typename Implementation::GenerateSequence<size>::Type(), other);
         }
 
         /**
@@ -402,8 +451,8 @@ template<std::size_t size, class T> class Vector {
          * @see operator/(T) const, operator/=(const Vector<size, T>&),
          *      operator/(const Vector<size, Integral>&, const Vector<size, FloatingPoint>&)
          */
-        Vector<size, T> operator/(const Vector<size, T>& other) const {
-            return Vector<size, T>(*this) /= other;
+        constexpr Vector<size, T> operator/(const Vector<size, T>& other) const {
+            return divideInternal(typename Implementation::GenerateSequence<size>::Type(), other);
         }
 
         /**
@@ -439,13 +488,32 @@ template<std::size_t size, class T> class Vector {
          */
         T lengthInverted() const { return T(1)/length(); }
 
+        /**
+         * @brief Approximate inverse vector length
+         *
+         * Faster alternative to lengthInverted() using
+         * Math::sqrtInvertedFast(), see its documentation for error bounds.
+         * @see normalizedFast()
+         */
+        T lengthInvertedFast() const { return Implementation::sqrtInvertedFast(dot()); }
+
         /**
          * @brief Normalized vector (of unit length)
          *
-         * @see isNormalized(), lengthInverted(), resized()
+         * @see isNormalized(), lengthInverted(), resized(), normalizedFast()
          */
         Vector<size, T> normalized() const { return *this*lengthInverted(); }
 
+        /**
+         * @brief Approximately normalized vector
+         *
+         * Faster alternative to normalized() using lengthInvertedFast(). The
+         * length of resulting vector differs from `1` by at most
+         * @f$ 5 \cdot 10^{-7} @f$, which is within tolerance of
+         * isNormalized().
+         */
+        Vector<size, T> normalizedFast() const { return *this*lengthInvertedFast(); }
+
         /**
          * @brief Resized vector
          *
@@ -520,6 +588,29 @@ template<std::size_t size, class T> class Vector {
         /* Implementation for Vector<size, T>::Vector(U) */
         template<std::size_t ...sequence> constexpr explicit Vector(Implementation::Sequence<sequence...>, T value): _data{Implementation::repeat(value, sequence)...} {}
 
+        /* Implementation for constexpr arithmetic operators */
+        template<std::size_t ...sequence> constexpr Vector<size, T> negateInternal(Implementation::Sequence<sequence...>) const {
+            return {T(-_data[sequence])...};
+        }
+        template<std::size_t ...sequence> constexpr Vector<size, T> addInternal(Implementation::Sequence<sequence...>, const Vector<size, T>& other) const {
+            return {T(_data[sequence] + other._data[sequence])...};
+        }
+        template<std::size_t ...sequence> constexpr Vector<size, T> subtractInternal(Implementation::Sequence<sequence...>, const Vector<size, T>& other) const {
+            return {T(_data[sequence] - other._data[sequence])...};
+        }
+        template<std::size_t ...sequence> constexpr Vector<size, T> multiplyInternal(Implementation::Sequence<sequence...>, T number) const {
+            return {T(_data[sequence]*number)...};
+        }
+        template<std::size_t ...sequence> constexpr Vector<size, T> multiplyInternal(Implementation::Sequence<sequence...>, const Vector<size, T>& other) const {
+            return {T(_data[sequence]*other._data[sequence])...};
+        }
+        template<std::size_t ...sequence> constexpr Vector<size, T> divideInternal(Implementation::Sequence<sequence...>, T number) const {
+            return {T(_data[sequence]/number)...};
+        }
+        template<std::size_t ...sequence> constexpr Vector<size, T> divideInternal(Implementation::Sequence<sequence...>, const Vector<size, T>& other) const {
+            return {T(_data[sequence]/other._data[sequence])...};
+        }
+
         T _data[size];
 };
 
@@ -528,7 +619,7 @@ template<std::size_t size, class T> class Vector {
 
 Same as Vector::operator*(T) const.
 */
-template<std::size_t size, class T> inline Vector<size, T> operator*(
+template<std::size_t size, class T> constexpr Vector<size, T> operator*(
     #ifdef DOXYGEN_GENERATING_OUTPUT
     T
     #else
@@ -539,6 +630,13 @@ template<std::size_t size, class T> inline Vector<size, T> operator*(
     return vector*number;
 }
 
+namespace Implementation {
+    /* Implementation for operator/(T, const Vector<size, T>&) */
+    template<std::size_t size, class T, std::size_t ...sequence> constexpr Vector<size, T> divideInverted(Sequence<sequence...>, T number, const Vector<size, T>& vector) {
+        return {T(number/vector[sequence])...};
+    }
+}
+
 /** @relates Vector
 @brief Divide vector with number and invert
 
@@ -547,7 +645,7 @@ template<std::size_t size, class T> inline Vector<size, T> operator*(
 @f]
 @see Vector::operator/(T) const
 */
-template<std::size_t size, class T> inline Vector<size, T> operator/(
+template<std::size_t size, class T> constexpr Vector<size, T> operator/(
     #ifdef DOXYGEN_GENERATING_OUTPUT
     T
     #else
@@ -555,12 +653,7 @@ template<std::size_t size, class T> inline Vector<size, T> operator/(
     #endif
     number, const Vector<size, T>& vector)
 {
-    Vector<size, T> out;
-
-    for(std::size_t i = 0; i != size; ++i)
-        out[i] = number/vector[i];
-
-    return out;
+    return Implementation::divideInverted(typename Implementation::GenerateSequence<size>::Type(), number, vector);
 }
 
 /** @relates Vector
@@ -1054,55 +1147,58 @@ extern template Corrade::Utility::Debug MAGNUM_EXPORT operator<<(Corrade::Utilit
         return *this;                                                       \
     }                                                                       \
                                                                             \
-    Type<T> operator-() const {                                             \
+    constexpr Type<T> operator-() const {                                   \
         return Math::Vector<size, T>::operator-();                          \
     }                                                                       \
     Type<T>& operator+=(const Math::Vector<size, T>& other) {               \
         Math::Vector<size, T>::operator+=(other);                           \
         return *this;                                                       \
     }                                                                       \
-    Type<T> operator+(const Math::Vector<size, T>& other) const {           \
+    constexpr Type<T> operator+(const Math::Vector<size, T>& other) const { \
         return Math::Vector<size, T>::operator+(other);                     \
     }                                                                       \
     Type<T>& operator-=(const Math::Vector<size, T>& other) {               \
         Math::Vector<size, T>::operator-=(other);                           \
         return *this;                                                       \
     }                                                                       \
-    Type<T> operator-(const Math::Vector<size, T>& other) const {           \
+    constexpr Type<T> operator-(const Math::Vector<size, T>& other) const { \
         return Math::Vector<size, T>::operator-(other);                     \
     }                                                                       \
     Type<T>& operator*=(T number) {                                         \
         Math::Vector<size, T>::operator*=(number);                          \
         return *this;                                                       \
     }                                                                       \
-    Type<T> operator*(T number) const {                                     \
+    constexpr Type<T> operator*(T number) const {                           \
         return Math::Vector<size, T>::operator*(number);                    \
     }                                                                       \
     Type<T>& operator/=(T number) {                                         \
         Math::Vector<size, T>::operator/=(number);                          \
         return *this;                                                       \
     }                                                                       \
-    Type<T> operator/(T number) const {                                     \
+    constexpr Type<T> operator/(T number) const {                           \
         return Math::Vector<size, T>::operator/(number);                    \
     }                                                                       \
     Type<T>& operator*=(const Math::Vector<size, T>& other) {               \
         Math::Vector<size, T>::operator*=(other);                           \
         return *this;                                                       \
     }                                                                       \
-    Type<T> operator*(const Math::Vector<size, T>& other) const {           \
+    constexpr Type<T> operator*(const Math::Vector<size, T>& other) const { \
         return Math::Vector<size, T>::operator*(other);                     \
     }                                                                       \
     Type<T>& operator/=(const Math::Vector<size, T>& other) {               \
         Math::Vector<size, T>::operator/=(other);                           \
         return *this;                                                       \
     }                                                                       \
-    Type<T> operator/(const Math::Vector<size, T>& other) const {           \
+    constexpr Type<T> operator/(const Math::Vector<size, T>& other) const { \
         return Math::Vector<size, T>::operator/(other);                     \
     }                                                                       \
                                                                             \
     Type<T> normalized() const {                                            \
         return Math::Vector<size, T>::normalized();                         \
     }                                                                       \
+    Type<T> normalizedFast() const {                                        \
+        return Math::Vector<size, T>::normalizedFast();                     \
+    }                                                                       \
     Type<T> resized(T length) const {                                       \
         return Math::Vector<size, T>::resized(length);                      \
     }                                                                       \
@@ -1114,10 +1210,10 @@ extern template Corrade::Utility::Debug MAGNUM_EXPORT operator<<(Corrade::Utilit
     }
 
 #define MAGNUM_VECTORn_OPERATOR_IMPLEMENTATION(size, Type)                  \
-    template<class T> inline Type<T> operator*(typename std::common_type<T>::type number, const Type<T>& vector) { \
+    template<class T> constexpr Type<T> operator*(typename std::common_type<T>::type number, const Type<T>& vector) { \
         return number*static_cast<const Math::Vector<size, T>&>(vector);    \
     }                                                                       \
-    template<class T> inline Type<T> operator/(typename std::common_type<T>::type number, const Type<T>& vector) { \
+    template<class T> constexpr Type<T> operator/(typename std::common_type<T>::type number, const Type<T>& vector) { \
         return number/static_cast<const Math::Vector<size, T>&>(vector);    \
     }                                                                       \
                                                                             \
@@ -1253,15 +1349,6 @@ template<std::size_t size, class T> inline BoolVector<size> Vector<size, T>::ope
     return out;
 }
 
-template<std::size_t size, class T> inline Vector<size, T> Vector<size, T>::operator-() const {
-    Vector<size, T> out;
-
-    for(std::size_t i = 0; i != size; ++i)
-        out._data[i] = -_data[i];
-
-    return out;
-}
-
 template<std::size_t size, class T> inline Vector<size, T> Vector<size, T>::projectedOntoNormalized(const Vector<size, T>& line) const {
     CORRADE_ASSERT(line.isNormalized(), "Math::Vector::projectedOntoNormalized(): line must be normalized",
         (Vector<size, T>(std::numeric_limits<T>::quiet_NaN())));
@@ -1304,6 +1391,74 @@ template<std::size_t size, class T> inline T Vector<size, T>::max() const {
     return out;
 }
 
+#if defined(MAGNUM_TARGET_SSE2) && !defined(DOXYGEN_GENERATING_OUTPUT)
+template<> inline Vector<4, Float>& Vector<4, Float>::operator+=(const Vector<4, Float>& other) {
+    _mm_storeu_ps(_data, _mm_add_ps(_mm_loadu_ps(_data), _mm_loadu_ps(other._data)));
+    return *this;
+}
+
+template<> inline Vector<4, Float>& Vector<4, Float>::operator-=(const Vector<4, Float>& other) {
+    _mm_storeu_ps(_data, _mm_sub_ps(_mm_loadu_ps(_data), _mm_loadu_ps(other._data)));
+    return *this;
+}
+
+template<> inline Vector<4, Float>& Vector<4, Float>::operator*=(Float number) {
+    _mm_storeu_ps(_data, _mm_mul_ps(_mm_loadu_ps(_data), _mm_set1_ps(number)));
+    return *this;
+}
+
+template<> inline Vector<4, Float>& Vector<4, Float>::operator/=(Float number) {
+    _mm_storeu_ps(_data, _mm_div_ps(_mm_loadu_ps(_data), _mm_set1_ps(number)));
+    return *this;
+}
+
+template<> inline Vector<4, Float>& Vector<4, Float>::operator*=(const Vector<4, Float>& other) {
+    _mm_storeu_ps(_data, _mm_mul_ps(_mm_loadu_ps(_data), _mm_loadu_ps(other._data)));
+    return *this;
+}
+
+template<> inline Vector<4, Float>& Vector<4, Float>::operator/=(const Vector<4, Float>& other) {
+    _mm_storeu_ps(_data, _mm_div_ps(_mm_loadu_ps(_data), _mm_loadu_ps(other._data)));
+    return *this;
+}
+
+/* The binary operators are constexpr in the generic implementation, these
+   specializations trade it for the SSE2 path */
+template<> inline Vector<4, Float> Vector<4, Float>::operator-() const {
+    Vector<4, Float> out;
+    _mm_storeu_ps(out._data, _mm_xor_ps(_mm_loadu_ps(_data), _mm_set1_ps(-0.0f)));
+    return out;
+}
+
+template<> inline Vector<4, Float> Vector<4, Float>::operator+(const Vector<4, Float>& other) const {
+    return Vector<4, Float>(*this) += other;
+}
+
+template<> inline Vector<4, Float> Vector<4, Float>::operator-(const Vector<4, Float>& other) const {
+    return Vector<4, Float>(*this) -= other;
+}
+
+template<> inline Vector<4, Float> Vector<4, Float>::operator*(Float number) const {
+    return Vector<4, Float>(*this) *= number;
+}
+
+template<> inline Vector<4, Float> Vector<4, Float>::operator/(Float number) const {
+    return Vector<4, Float>(*this) /= number;
+}
+
+template<> inline Vector<4, Float> Vector<4, Float>::operator*(const Vector<4, Float>& other) const {
+    return Vector<4, Float>(*this) *= other;
+}
+
+template<> inline Vector<4, Float> Vector<4, Float>::operator/(const Vector<4, Float>& other) const {
+    return Vector<4, Float>(*this) /= other;
+}
+
+template<> inline Float Vector<4, Float>::dot(const Vector<4, Float>& a, const Vector<4, Float>& b) {
+    return _mm_cvtss_f32(Implementation::Sse::sum(_mm_mul_ps(_mm_loadu_ps(a._data), _mm_loadu_ps(b._data))));
+}
+#endif
+
 }}
 
 namespace Corrade { namespace Utility {
@@ -24,7 +24,7 @@
 
 #include "GenerateFlatNormals.h"
 
-#include "Math/Vector3.h"
+#include "Math/Batch.h"
 #include "MeshTools/RemoveDuplicates.h"
 
 namespace Magnum { namespace MeshTools {
@@ -39,7 +39,7 @@ std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> generateFlatNormals(c
     normals.reserve(indices.size()/3);
     for(std::size_t i = 0; i != indices.size(); i += 3) {
         Vector3 normal = Vector3::cross(positions[indices[i+2]]-positions[indices[i+1]],
-                                        positions[indices[i]]-positions[indices[i+1]]).normalized();
+                                        positions[indices[i]]-positions[indices[i+1]]);
 
         /* Use the same normal for all three vertices of the face */
         normalIndices.push_back(normals.size());
@@ -48,6 +48,9 @@ std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> generateFlatNormals(c
         normals.push_back(normal);
     }
 
+    /* Normalize all at once */
+    Math::Batch::normalizeInPlace<Vector3>({normals.data(), normals.size()});
+
     /* Remove duplicate normals and return */
     MeshTools::removeDuplicates(normalIndices, normals);
     return std::make_tuple(std::move(normalIndices), std::move(normals));
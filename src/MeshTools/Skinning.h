@@ -0,0 +1,180 @@
+#ifndef Magnum_MeshTools_Skinning_h
+#define Magnum_MeshTools_Skinning_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function Magnum::MeshTools::jointPalette(), Magnum::MeshTools::blendJoints(), Magnum::MeshTools::skinPointsInPlace(), Magnum::MeshTools::skinVectorsInPlace()
+ */
+
+#include <vector>
+#include <Utility/Assert.h>
+
+#include "Math/DualQuaternion.h"
+#include "Math/Vector4.h"
+#include "Types.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Compute joint palette
+@param[in] parents                      Parent ID of each joint or `-1` for
+    root joints
+@param[in] transformations              Joint transformations relative to
+    parent joint
+@param[in] inverseBindTransformations   Inverse absolute transformations of
+    joints in bind pose
+@param[out] absoluteTransformations     Absolute transformations of joints
+@param[out] palette                     Joint transformations relative to bind
+    pose
+
+Computes absolute transformation and skinning transformation of all joints in
+one pass over a flat skeleton. Expects that each joint is preceded by its
+parent and that all arrays have the same size. Output arrays are resized to
+joint count, so passing the same arrays each frame doesn't allocate. The
+transformation type can be either @ref Math::DualQuaternion "DualQuaternion"
+or @ref Math::Matrix4 "Matrix4". The resulting palette can be passed
+directly to @ref Shaders::Phong::setJointTransformations() or to
+@ref skinPointsInPlace().
+@see @ref SceneGraph::KeyframeAnimable
+*/
+template<class Transformation> void jointPalette(const std::vector<Int>& parents, const std::vector<Transformation>& transformations, const std::vector<Transformation>& inverseBindTransformations, std::vector<Transformation>& absoluteTransformations, std::vector<Transformation>& palette) {
+    CORRADE_ASSERT(parents.size() == transformations.size() && parents.size() == inverseBindTransformations.size(),
+        "MeshTools::jointPalette(): array sizes don't match", );
+
+    const std::size_t count = parents.size();
+    absoluteTransformations.resize(count);
+    palette.resize(count);
+    for(std::size_t i = 0; i != count; ++i) {
+        CORRADE_ASSERT(parents[i] < Int(i),
+            "MeshTools::jointPalette(): joint" << i << "is not preceded by its parent", );
+
+        absoluteTransformations[i] = parents[i] == -1 ? transformations[i] :
+            absoluteTransformations[parents[i]]*transformations[i];
+        palette[i] = absoluteTransformations[i]*inverseBindTransformations[i];
+    }
+}
+
+/**
+@brief Compute joint palette
+
+Convenience alternative to the above, returns the palette instead of filling
+existing arrays.
+*/
+template<class Transformation> std::vector<Transformation> jointPalette(const std::vector<Int>& parents, const std::vector<Transformation>& transformations, const std::vector<Transformation>& inverseBindTransformations) {
+    std::vector<Transformation> absoluteTransformations, palette;
+    jointPalette(parents, transformations, inverseBindTransformations, absoluteTransformations, palette);
+    return palette;
+}
+
+/**
+@brief Blend joint transformations using dual quaternion linear blending
+@param palette  Joint palette
+@param ids      IDs of up to four joints affecting the vertex
+@param weights  Joint weights
+
+Reference implementation of the blending done in @ref Shaders::Phong with
+@ref Shaders::Phong::Flag::Skinned. Dual quaternions are blended along the
+shortest path relative to the first joint and normalized afterwards.
+*/
+template<class T> Math::DualQuaternion<T> blendJoints(const std::vector<Math::DualQuaternion<T>>& palette, const Math::Vector4<UnsignedInt>& ids, const Math::Vector4<T>& weights) {
+    const Math::Quaternion<T> first = palette[ids[0]].real();
+    Math::Quaternion<T> real({}, T(0)), dual({}, T(0));
+    for(std::size_t i = 0; i != 4; ++i) {
+        const Math::DualQuaternion<T>& joint = palette[ids[i]];
+        const T weight = Math::Quaternion<T>::dot(first, joint.real()) < T(0) ? -weights[i] : weights[i];
+        real += weight*joint.real();
+        dual += weight*joint.dual();
+    }
+
+    return Math::DualQuaternion<T>(real, dual).normalized();
+}
+
+/**
+@brief Blend joint transformations using linear blend skinning
+
+Matrix counterpart to @ref blendJoints(const std::vector<Math::DualQuaternion<T>>&, const Math::Vector4<UnsignedInt>&, const Math::Vector4<T>&).
+*/
+template<class T> Math::Matrix4<T> blendJoints(const std::vector<Math::Matrix4<T>>& palette, const Math::Vector4<UnsignedInt>& ids, const Math::Vector4<T>& weights) {
+    Math::Matrix4<T> out(Math::Matrix4<T>::Zero);
+    for(std::size_t i = 0; i != 4; ++i)
+        out += palette[ids[i]]*weights[i];
+    return out;
+}
+
+namespace Implementation {
+    template<class T> inline Math::Vector3<T> skinPoint(const Math::DualQuaternion<T>& transformation, const Math::Vector3<T>& point) {
+        return transformation.transformPointNormalized(point);
+    }
+    template<class T> inline Math::Vector3<T> skinPoint(const Math::Matrix4<T>& transformation, const Math::Vector3<T>& point) {
+        return transformation.transformPoint(point);
+    }
+    template<class T> inline Math::Vector3<T> skinVector(const Math::DualQuaternion<T>& transformation, const Math::Vector3<T>& vector) {
+        return transformation.rotation().transformVectorNormalized(vector);
+    }
+    template<class T> inline Math::Vector3<T> skinVector(const Math::Matrix4<T>& transformation, const Math::Vector3<T>& vector) {
+        return transformation.transformVector(vector);
+    }
+}
+
+/**
+@brief Skin points in-place using given joint palette
+@param palette  Joint palette, see @ref jointPalette()
+@param ids      Joint IDs for each point
+@param weights  Joint weights for each point
+@param points   Points to transform
+
+CPU implementation of vertex skinning, usable for e.g. physics or collision
+meshes or for verifying the GPU implementation in @ref Shaders::Phong.
+Expects that all arrays have the same size.
+@see @ref Trade::MeshData3D::jointIds(), @ref Trade::MeshData3D::jointWeights(),
+    @ref transformPointsInPlace()
+*/
+template<class Transformation, class T> void skinPointsInPlace(const std::vector<Transformation>& palette, const std::vector<Math::Vector4<UnsignedInt>>& ids, const std::vector<Math::Vector4<T>>& weights, std::vector<Math::Vector3<T>>& points) {
+    CORRADE_ASSERT(ids.size() == points.size() && weights.size() == points.size(),
+        "MeshTools::skinPointsInPlace(): array sizes don't match", );
+
+    for(std::size_t i = 0; i != points.size(); ++i)
+        points[i] = Implementation::skinPoint(blendJoints(palette, ids[i], weights[i]), points[i]);
+}
+
+/**
+@brief Skin vectors in-place using given joint palette
+
+Unlike in @ref skinPointsInPlace(), the transformation doesn't involve
+translation. Usable for transforming normals, in case of matrix palette the
+joint transformations shouldn't contain non-uniform scaling. See
+@ref skinPointsInPlace() for more information.
+*/
+template<class Transformation, class T> void skinVectorsInPlace(const std::vector<Transformation>& palette, const std::vector<Math::Vector4<UnsignedInt>>& ids, const std::vector<Math::Vector4<T>>& weights, std::vector<Math::Vector3<T>>& vectors) {
+    CORRADE_ASSERT(ids.size() == vectors.size() && weights.size() == vectors.size(),
+        "MeshTools::skinVectorsInPlace(): array sizes don't match", );
+
+    for(std::size_t i = 0; i != vectors.size(); ++i)
+        vectors[i] = Implementation::skinVector(blendJoints(palette, ids[i], weights[i]), vectors[i]);
+}
+
+}}
+
+#endif
@@ -0,0 +1,197 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <TestSuite/Tester.h>
+
+#include "Math/DualQuaternion.h"
+#include "Magnum.h"
+#include "MeshTools/Skinning.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+class SkinningTest: public TestSuite::Tester {
+    public:
+        explicit SkinningTest();
+
+        void jointPalette();
+        void jointPaletteMatrix();
+        void jointPaletteWrongOrder();
+
+        void skinPoints();
+        void skinPointsMatrix();
+        void skinVectors();
+        void blend();
+        void blendShortestPath();
+        void blendMatrix();
+};
+
+SkinningTest::SkinningTest() {
+    addTests({&SkinningTest::jointPalette,
+              &SkinningTest::jointPaletteMatrix,
+              &SkinningTest::jointPaletteWrongOrder,
+
+              &SkinningTest::skinPoints,
+              &SkinningTest::skinPointsMatrix,
+              &SkinningTest::skinVectors,
+              &SkinningTest::blend,
+              &SkinningTest::blendShortestPath,
+              &SkinningTest::blendMatrix});
+}
+
+namespace {
+    /* Root joint translated by X, child joint rotated 90° around Z two units
+       above its parent, bind pose with both joints at origin and the child
+       two units above it */
+    const std::vector<Int> parents{-1, 0};
+
+    std::vector<DualQuaternion> transformations() {
+        return {DualQuaternion::translation(Vector3::xAxis()),
+                DualQuaternion::translation(Vector3::yAxis(2.0f))*DualQuaternion::rotation(Deg(90.0f), Vector3::zAxis())};
+    }
+
+    std::vector<DualQuaternion> inverseBindTransformations() {
+        return {DualQuaternion(),
+                DualQuaternion::translation(Vector3::yAxis(-2.0f))};
+    }
+}
+
+void SkinningTest::jointPalette() {
+    std::vector<DualQuaternion> absolute, palette;
+    MeshTools::jointPalette(parents, transformations(), inverseBindTransformations(), absolute, palette);
+
+    CORRADE_COMPARE(absolute.size(), 2);
+    CORRADE_COMPARE(absolute[0], DualQuaternion::translation(Vector3::xAxis()));
+    CORRADE_COMPARE(absolute[1], DualQuaternion::translation({1.0f, 2.0f, 0.0f})*DualQuaternion::rotation(Deg(90.0f), Vector3::zAxis()));
+
+    CORRADE_COMPARE(palette.size(), 2);
+    CORRADE_COMPARE(palette[0], DualQuaternion::translation(Vector3::xAxis()));
+    CORRADE_COMPARE(palette[1].transformPointNormalized({0.0f, 3.0f, 0.0f}), Vector3(0.0f, 2.0f, 0.0f));
+
+    /* Convenience overload gives the same result */
+    CORRADE_COMPARE(MeshTools::jointPalette(parents, transformations(), inverseBindTransformations()), palette);
+}
+
+void SkinningTest::jointPaletteMatrix() {
+    std::vector<Matrix4> palette = MeshTools::jointPalette(parents,
+        std::vector<Matrix4>{Matrix4::translation(Vector3::xAxis()),
+                             Matrix4::translation(Vector3::yAxis(2.0f))*Matrix4::rotationZ(Deg(90.0f))},
+        std::vector<Matrix4>{Matrix4(),
+                             Matrix4::translation(Vector3::yAxis(-2.0f))});
+
+    CORRADE_COMPARE(palette.size(), 2);
+    CORRADE_COMPARE(palette[0], Matrix4::translation(Vector3::xAxis()));
+    CORRADE_COMPARE(palette[1].transformPoint({0.0f, 3.0f, 0.0f}), Vector3(0.0f, 2.0f, 0.0f));
+}
+
+void SkinningTest::jointPaletteWrongOrder() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    std::vector<DualQuaternion> absolute, palette;
+    MeshTools::jointPalette({-1, 2, 0}, std::vector<DualQuaternion>(3), std::vector<DualQuaternion>(3), absolute, palette);
+    CORRADE_COMPARE(out.str(), "MeshTools::jointPalette(): joint 1 is not preceded by its parent\n");
+
+    out.str({});
+    MeshTools::jointPalette({-1, 0}, std::vector<DualQuaternion>(3), std::vector<DualQuaternion>(2), absolute, palette);
+    CORRADE_COMPARE(out.str(), "MeshTools::jointPalette(): array sizes don't match\n");
+}
+
+void SkinningTest::skinPoints() {
+    const std::vector<DualQuaternion> palette = MeshTools::jointPalette(parents, transformations(), inverseBindTransformations());
+
+    std::vector<Vector3> points{{1.0f, 0.0f, 0.0f},
+                                {0.0f, 3.0f, 0.0f}};
+    MeshTools::skinPointsInPlace(palette,
+        std::vector<Vector4ui>{{0, 0, 0, 0}, {1, 0, 0, 0}},
+        std::vector<Vector4>{{1.0f, 0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f, 0.0f}}, points);
+
+    CORRADE_COMPARE(points, (std::vector<Vector3>{{2.0f, 0.0f, 0.0f},
+                                                  {0.0f, 2.0f, 0.0f}}));
+}
+
+void SkinningTest::skinPointsMatrix() {
+    const std::vector<Matrix4> palette{Matrix4::translation(Vector3::xAxis()),
+                                       Matrix4::translation({1.0f, 2.0f, 0.0f})*Matrix4::rotationZ(Deg(90.0f))*Matrix4::translation(Vector3::yAxis(-2.0f))};
+
+    std::vector<Vector3> points{{1.0f, 0.0f, 0.0f},
+                                {0.0f, 3.0f, 0.0f}};
+    MeshTools::skinPointsInPlace(palette,
+        std::vector<Vector4ui>{{0, 0, 0, 0}, {1, 0, 0, 0}},
+        std::vector<Vector4>{{1.0f, 0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f, 0.0f}}, points);
+
+    CORRADE_COMPARE(points, (std::vector<Vector3>{{2.0f, 0.0f, 0.0f},
+                                                  {0.0f, 2.0f, 0.0f}}));
+}
+
+void SkinningTest::skinVectors() {
+    const std::vector<DualQuaternion> palette = MeshTools::jointPalette(parents, transformations(), inverseBindTransformations());
+
+    /* Translation doesn't affect the vectors */
+    std::vector<Vector3> normals{Vector3::yAxis(),
+                                 Vector3::yAxis()};
+    MeshTools::skinVectorsInPlace(palette,
+        std::vector<Vector4ui>{{0, 0, 0, 0}, {1, 0, 0, 0}},
+        std::vector<Vector4>{{1.0f, 0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f, 0.0f}}, normals);
+
+    CORRADE_COMPARE(normals, (std::vector<Vector3>{Vector3::yAxis(),
+                                                   -Vector3::xAxis()}));
+}
+
+void SkinningTest::blend() {
+    const std::vector<DualQuaternion> palette{
+        DualQuaternion::translation(Vector3::xAxis(2.0f)),
+        DualQuaternion::translation(Vector3::yAxis(4.0f)),
+        DualQuaternion::rotation(Deg(90.0f), Vector3::zAxis())};
+
+    CORRADE_COMPARE(MeshTools::blendJoints(palette, {0, 1, 0, 0}, {0.5f, 0.5f, 0.0f, 0.0f}),
+        DualQuaternion::translation({1.0f, 2.0f, 0.0f}));
+    CORRADE_COMPARE(MeshTools::blendJoints(palette, {1, 2, 0, 0}, {0.0f, 1.0f, 0.0f, 0.0f}),
+        DualQuaternion::rotation(Deg(90.0f), Vector3::zAxis()));
+
+    /* Result is always normalized */
+    CORRADE_VERIFY(MeshTools::blendJoints(palette, {0, 2, 1, 0}, {0.25f, 0.5f, 0.25f, 0.0f}).isNormalized());
+}
+
+void SkinningTest::blendShortestPath() {
+    /* Second joint has the same rotation as the first, but in the other
+       hemisphere, it shouldn't cancel out the first one */
+    const DualQuaternion a = DualQuaternion::rotation(Deg(30.0f), Vector3::zAxis());
+    const std::vector<DualQuaternion> palette{a, -a};
+
+    CORRADE_COMPARE(MeshTools::blendJoints(palette, {0, 1, 0, 0}, {0.5f, 0.5f, 0.0f, 0.0f}), a);
+}
+
+void SkinningTest::blendMatrix() {
+    const std::vector<Matrix4> palette{
+        Matrix4::translation(Vector3::xAxis(2.0f)),
+        Matrix4::translation(Vector3::yAxis(4.0f))};
+
+    CORRADE_COMPARE(MeshTools::blendJoints(palette, {0, 1, 0, 0}, {0.5f, 0.5f, 0.0f, 0.0f}),
+        Matrix4::translation({1.0f, 2.0f, 0.0f}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SkinningTest)
@@ -28,6 +28,9 @@
  * @brief Function Magnum::MeshTools::transformVectorsInPlace(), Magnum::MeshTools::transformVectors(), Magnum::MeshTools::transformPointsInPlace(), Magnum::MeshTools::transformPoints()
  */
 
+#include <vector>
+
+#include "Math/Batch.h"
 #include "Math/DualQuaternion.h"
 #include "Math/DualComplex.h"
 
@@ -40,7 +43,8 @@ Usable for one-time mesh transformations that would otherwise negatively affect
 dependent objects, such as (uneven) scaling. Accepts any forward-iterable type
 with compatible vector type as @p vectors. Expects that @ref Math::Quaternion "Quaternion"
 is normalized, no further requirements are for other transformation
-representations.
+representations. Matrix and quaternion transformations of `std::vector` are
+done using @ref Math::Batch::transformVectorsInPlace().
 
 Unlike in transformPointsInPlace(), the transformation does not involve
 translation.
@@ -75,6 +79,20 @@ template<class T, class U> void transformVectorsInPlace(const Math::Matrix4<T>&
     for(auto& vector: vectors) vector = matrix.transformVector(vector);
 }
 
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template<class T> inline void transformVectorsInPlace(const Math::Quaternion<T>& normalizedQuaternion, std::vector<Math::Vector3<T>>& vectors) {
+    Math::Batch::transformVectorsInPlace(normalizedQuaternion, {vectors.data(), vectors.size()});
+}
+
+template<class T> inline void transformVectorsInPlace(const Math::Matrix3<T>& matrix, std::vector<Math::Vector2<T>>& vectors) {
+    Math::Batch::transformVectorsInPlace(matrix, {vectors.data(), vectors.size()});
+}
+
+template<class T> inline void transformVectorsInPlace(const Math::Matrix4<T>& matrix, std::vector<Math::Vector3<T>>& vectors) {
+    Math::Batch::transformVectorsInPlace(matrix, {vectors.data(), vectors.size()});
+}
+#endif
+
 /**
 @brief Transform vectors using given transformation
 
@@ -94,7 +112,9 @@ Usable for one-time mesh transformations that would otherwise negatively affect
 dependent objects, such as (uneven) scaling. Accepts any forward-iterable type
 with compatible vector type as @p vectors. Expects that
 @ref Math::DualQuaternion "DualQuaternion" is normalized, no further
-requirements are for other transformation representations.
+requirements are for other transformation representations. Matrix
+transformations of `std::vector` are done using
+@ref Math::Batch::transformPointsInPlace().
 
 Unlike in transformVectorsInPlace(), the transformation also involves
 translation.
@@ -129,6 +149,16 @@ template<class T, class U> void transformPointsInPlace(const Math::Matrix4<T>& m
     for(auto& point: points) point = matrix.transformPoint(point);
 }
 
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template<class T> inline void transformPointsInPlace(const Math::Matrix3<T>& matrix, std::vector<Math::Vector2<T>>& points) {
+    Math::Batch::transformPointsInPlace(matrix, {points.data(), points.size()});
+}
+
+template<class T> inline void transformPointsInPlace(const Math::Matrix4<T>& matrix, std::vector<Math::Vector3<T>>& points) {
+    Math::Batch::transformPointsInPlace(matrix, {points.data(), points.size()});
+}
+#endif
+
 /**
 @brief Transform points using given transformation
 
@@ -106,6 +106,11 @@ void WindowlessGlxApplication::createContext(const Configuration&) {
 }
 
 WindowlessGlxApplication::~WindowlessGlxApplication() {
+    /* Context was not created (createContext() not called after
+       WindowlessGlxApplication(const Arguments&, std::nullptr_t)), nothing
+       to destroy */
+    if(!c) return;
+
     delete c;
 
     glXMakeCurrent(display, None, nullptr);
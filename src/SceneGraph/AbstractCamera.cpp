@@ -0,0 +1,76 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "AbstractCamera.h"
+
+#include <cstring>
+
+namespace Magnum { namespace SceneGraph { namespace Implementation {
+
+UnsignedInt depthSortKey(const Float depth) {
+    UnsignedInt bits;
+    std::memcpy(&bits, &depth, sizeof(Float));
+
+    /* Flip all bits of negative values (so larger magnitude is smaller) and
+       only sign bit of positive values (so they are after negative ones) */
+    return bits & 0x80000000u ? ~bits : bits|0x80000000u;
+}
+
+void sortDrawOrder(std::vector<UnsignedLong>& keys, std::vector<UnsignedInt>& indices) {
+    if(keys.empty()) return;
+
+    std::vector<UnsignedLong> keysOut(keys.size());
+    std::vector<UnsignedInt> indicesOut(indices.size());
+
+    /* Eight passes, one for each byte, starting with the least significant */
+    for(UnsignedInt shift = 0; shift != 64; shift += 8) {
+        std::size_t offsets[256]{};
+        for(UnsignedLong key: keys) ++offsets[(key >> shift) & 0xff];
+
+        /* All keys have the same value in this byte, nothing to do. This is
+           usually the case for unused high bits of sort keys. */
+        if(offsets[(keys.front() >> shift) & 0xff] == keys.size()) continue;
+
+        /* Convert counts to offsets */
+        std::size_t offset = 0;
+        for(std::size_t& i: offsets) {
+            const std::size_t count = i;
+            i = offset;
+            offset += count;
+        }
+
+        /* Scatter */
+        for(std::size_t i = 0; i != keys.size(); ++i) {
+            const std::size_t position = offsets[(keys[i] >> shift) & 0xff]++;
+            keysOut[position] = keys[i];
+            indicesOut[position] = indices[i];
+        }
+
+        std::swap(keys, keysOut);
+        std::swap(indices, indicesOut);
+    }
+}
+
+}}}
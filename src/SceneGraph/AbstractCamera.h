@@ -25,9 +25,11 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::SceneGraph::AbstractCamera, enum @ref Magnum::SceneGraph::AspectRatioPolicy, alias @ref Magnum::SceneGraph::AbstractBasicCamera2D, @ref Magnum::SceneGraph::AbstractBasicCamera3D, typedef @ref Magnum::SceneGraph::AbstractCamera2D, @ref Magnum::SceneGraph::AbstractCamera3D
+ * @brief Class @ref Magnum::SceneGraph::AbstractCamera, enum @ref Magnum::SceneGraph::AspectRatioPolicy, @ref Magnum::SceneGraph::DrawOrder, alias @ref Magnum::SceneGraph::AbstractBasicCamera2D, @ref Magnum::SceneGraph::AbstractBasicCamera3D, typedef @ref Magnum::SceneGraph::AbstractCamera2D, @ref Magnum::SceneGraph::AbstractCamera3D
  */
 
+#include <vector>
+
 #include "Math/Matrix3.h"
 #include "Math/Matrix4.h"
 #include "AbstractFeature.h"
@@ -47,8 +49,38 @@ enum class AspectRatioPolicy: UnsignedByte {
     Clip            /**< Clip on smaller side of view */
 };
 
+/**
+@brief Drawable draw order
+
+@see @ref AbstractCamera::setDrawOrder(), @ref Drawable::setSortKey()
+*/
+enum class DrawOrder: UnsignedByte {
+    /** Draw in the order in which the drawables were added (default) */
+    Unsorted,
+
+    /**
+     * Sort by @ref Drawable::sortKey() "sort key" and drawables with the same
+     * key front-to-back. Suitable for opaque drawables, as it minimizes state
+     * changes and overdraw.
+     */
+    StateFrontToBack,
+
+    /**
+     * Sort back-to-front and drawables with the same depth by
+     * @ref Drawable::sortKey() "sort key". Suitable for transparent
+     * drawables.
+     */
+    BackToFront
+};
+
 namespace Implementation {
     template<UnsignedInt dimensions, class T> typename DimensionTraits<dimensions, T>::MatrixType aspectRatioFix(AspectRatioPolicy aspectRatioPolicy, const Math::Vector2<T>& projectionScale, const Vector2i& viewport);
+
+    /* Converts depth to key preserving the ordering when compared as integer */
+    UnsignedInt MAGNUM_SCENEGRAPH_EXPORT depthSortKey(Float depth);
+
+    /* Stable LSD radix sort of indices by given 64-bit keys */
+    void MAGNUM_SCENEGRAPH_EXPORT sortDrawOrder(std::vector<UnsignedLong>& keys, std::vector<UnsignedInt>& indices);
 }
 
 /**
@@ -126,10 +158,30 @@ template<UnsignedInt dimensions, class T> class MAGNUM_SCENEGRAPH_EXPORT Abstrac
          */
         virtual void setViewport(const Vector2i& size);
 
+        /** @brief Draw order */
+        DrawOrder drawOrder() const { return _drawOrder; }
+
+        /**
+         * @brief Set draw order
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @ref DrawOrder::Unsorted, i.e. drawables are drawn in
+         * the order in which they were added to the group. Other orders sort
+         * the drawables by @ref Drawable::sortKey() and depth relative to the
+         * camera using radix sort before drawing. For 2D scenes the depth is
+         * always zero, thus only the sort key is taken into account.
+         * @see @ref draw()
+         */
+        AbstractCamera<dimensions, T>& setDrawOrder(DrawOrder order) {
+            _drawOrder = order;
+            return *this;
+        }
+
         /**
          * @brief Draw
          *
-         * Draws given group of drawables.
+         * Draws given group of drawables in order specified by
+         * @ref setDrawOrder().
          */
         virtual void draw(DrawableGroup<dimensions, T>& group);
 
@@ -161,6 +213,7 @@ template<UnsignedInt dimensions, class T> class MAGNUM_SCENEGRAPH_EXPORT Abstrac
         typename DimensionTraits<dimensions, T>::MatrixType _cameraMatrix;
 
         Vector2i _viewport;
+        DrawOrder _drawOrder;
 };
 
 #ifndef CORRADE_GCC46_COMPATIBILITY
@@ -43,12 +43,19 @@ template<class T> class Camera<2, T> {
         constexpr static Math::Matrix3<T> aspectRatioScale(const Math::Vector2<T>& scale) {
             return Math::Matrix3<T>::scaling({scale.x(), scale.y()});
         }
+
+        constexpr static T depth(const Math::Matrix3<T>&) { return T(0); }
 };
 template<class T> class Camera<3, T> {
     public:
         constexpr static Math::Matrix4<T> aspectRatioScale(const Math::Vector2<T>& scale) {
             return Math::Matrix4<T>::scaling({scale.x(), scale.y(), 1.0f});
         }
+
+        /* Camera is looking in direction of negative Z */
+        static T depth(const Math::Matrix4<T>& transformation) {
+            return -transformation.translation().z();
+        }
 };
 
 template<UnsignedInt dimensions, class T> typename DimensionTraits<dimensions, T>::MatrixType aspectRatioFix(AspectRatioPolicy aspectRatioPolicy, const Math::Vector2<T>& projectionScale, const Vector2i& viewport) {
@@ -68,7 +75,7 @@ template<UnsignedInt dimensions, class T> typename DimensionTraits<dimensions, T
 
 }
 
-template<UnsignedInt dimensions, class T> AbstractCamera<dimensions, T>::AbstractCamera(AbstractObject<dimensions, T>& object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved) {
+template<UnsignedInt dimensions, class T> AbstractCamera<dimensions, T>::AbstractCamera(AbstractObject<dimensions, T>& object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved), _drawOrder(DrawOrder::Unsorted) {
     AbstractFeature<dimensions, T>::setCachedTransformations(CachedTransformation::InvertedAbsolute);
 }
 
@@ -99,8 +106,27 @@ template<UnsignedInt dimensions, class T> void AbstractCamera<dimensions, T>::dr
     std::vector<typename DimensionTraits<dimensions, T>::MatrixType> transformations =
         scene->transformationMatrices(objects, _cameraMatrix);
 
-    /* Perform the drawing */
-    for(std::size_t i = 0; i != transformations.size(); ++i)
+    /* Perform the drawing in insertion order */
+    if(_drawOrder == DrawOrder::Unsorted) {
+        for(std::size_t i = 0; i != transformations.size(); ++i)
+            group[i].draw(transformations[i], *this);
+        return;
+    }
+
+    /* Compute sort keys from drawable state and depth relative to camera */
+    std::vector<UnsignedLong> keys(transformations.size());
+    std::vector<UnsignedInt> indices(transformations.size());
+    for(std::size_t i = 0; i != transformations.size(); ++i) {
+        const UnsignedLong stateKey = group[i].sortKey();
+        const UnsignedInt depthKey = Implementation::depthSortKey(Float(Implementation::Camera<dimensions, T>::depth(transformations[i])));
+        keys[i] = _drawOrder == DrawOrder::StateFrontToBack ?
+            (stateKey << 32)|depthKey : (UnsignedLong(~depthKey) << 32)|stateKey;
+        indices[i] = i;
+    }
+
+    /* Sort and perform the drawing */
+    Implementation::sortDrawOrder(keys, indices);
+    for(UnsignedInt i: indices)
         group[i].draw(transformations[i], *this);
 }
 
@@ -121,11 +121,40 @@ void MyApplication::drawEvent() {
 
 @section Animable-performance Using animable groups to improve performance
 
-AnimableGroup is optimized for case when no animation is running -- it just
-puts itself to rest and waits until some animation changes its state to
-@ref AnimationState::Running again. If you put animations which are not
-pernamently running to separate group, they will not be always traversed when
-calling @ref AnimableGroup::step(), saving precious frame time.
+AnimableGroup keeps running animations in separate compact list and processes
+state changes only for animables which called @ref setState() since last
+step, so paused and stopped animations don't cost anything in
+@ref AnimableGroup::step(). It is also optimized for case when no animation is
+running -- it just puts itself to rest and waits until some animation changes
+its state to @ref AnimationState::Running again.
+
+If the group contains many animables of the same type, you can set batch step
+function using @ref AnimableGroup::setBatchStep(). It is then called with
+contiguous list of all running animables and their times instead of calling
+virtual @ref animationStep() for each animable separately. Animation steps of
+independent animables can be also distributed across multiple threads using
+@ref AnimableGroup::setThreadCount(). The steps then mustn't touch anything
+shared, in particular they mustn't change object transformations. The example
+below only computes color of each object, which is then used for drawing:
+@code
+class Fade: public Object3D, public SceneGraph::Animable3D {
+    public:
+        static void step(SceneGraph::Animable3D* const* animables, const Float* times, std::size_t count, Float) {
+            for(std::size_t i = 0; i != count; ++i) {
+                Fade& fade = static_cast<Fade&>(*animables[i]);
+                fade.color = Math::lerp(fade.from, fade.to, times[i]/fade.duration());
+            }
+        }
+
+        Color3 from, to, color;
+
+    // ...
+};
+
+SceneGraph::AnimableGroup3D fades;
+fades.setBatchStep(Fade::step)
+    .setThreadCount(4);
+@endcode
 
 @section Animable-explicit-specializations Explicit template specializations
 
@@ -170,7 +199,8 @@ template<UnsignedInt dimensions, class T> class MAGNUM_SCENEGRAPH_EXPORT Animabl
          * Note that changing state from @ref AnimationState::Stopped to
          * @ref AnimationState::Paused is ignored and animation remains in
          * @ref AnimationState::Stopped state. See also @ref animationStep()
-         * for more information.
+         * for more information. The state change is processed in next
+         * @ref AnimableGroup::step().
          * @see @ref animationStarted(), @ref animationPaused(),
          *      @ref animationResumed(), @ref animationStopped()
          */
@@ -262,6 +292,8 @@ template<UnsignedInt dimensions, class T> class MAGNUM_SCENEGRAPH_EXPORT Animabl
          * if the animation state is set to @ref AnimationState::Running. After
          * animation duration is exceeded and repeat is not enabled or repeat
          * count is exceeded, the animation state is set to @ref AnimationState::Stopped.
+         * Not called if the group has batch step function set, see
+         * @ref AnimableGroup::setBatchStep() for more information.
          *
          * If the animation is resumed from @ref AnimationState::Paused, this
          * function is called with @p time continuing from the point when it
@@ -332,6 +364,8 @@ template<UnsignedInt dimensions, class T> class MAGNUM_SCENEGRAPH_EXPORT Animabl
         bool _repeated;
         UnsignedShort _repeatCount;
         UnsignedShort repeats;
+        bool changePending;
+        std::size_t runningIndex;
 };
 
 #ifndef CORRADE_GCC46_COMPATIBILITY
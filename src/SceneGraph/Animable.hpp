@@ -31,13 +31,18 @@
 #include "AnimableGroup.h"
 #include "Animable.h"
 
+#include <algorithm>
+
+#include "Math/Batch.h"
 #include "Timeline.h"
 
 namespace Magnum { namespace SceneGraph {
 
-template<UnsignedInt dimensions, class T> Animable<dimensions, T>::Animable(AbstractObject<dimensions, T>& object, AnimableGroup<dimensions, T>* group): AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>(object, group), _duration(0.0f), startTime(std::numeric_limits<Float>::infinity()), pauseTime(-std::numeric_limits<Float>::infinity()), previousState(AnimationState::Stopped), currentState(AnimationState::Stopped), _repeated(false), _repeatCount(0), repeats(0) {}
+template<UnsignedInt dimensions, class T> Animable<dimensions, T>::Animable(AbstractObject<dimensions, T>& object, AnimableGroup<dimensions, T>* group): AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>(object, group), _duration(0.0f), startTime(std::numeric_limits<Float>::infinity()), pauseTime(-std::numeric_limits<Float>::infinity()), previousState(AnimationState::Stopped), currentState(AnimationState::Stopped), _repeated(false), _repeatCount(0), repeats(0), changePending(false), runningIndex(~std::size_t(0)) {}
 
-template<UnsignedInt dimensions, class T> Animable<dimensions, T>::~Animable() {}
+template<UnsignedInt dimensions, class T> Animable<dimensions, T>::~Animable() {
+    if(animables()) animables()->removeFromLists(*this);
+}
 
 template<UnsignedInt dimensions, class T> Animable<dimensions, T>& Animable<dimensions, T>::setState(AnimationState state) {
     if(currentState == state) return *this;
@@ -46,9 +51,9 @@ template<UnsignedInt dimensions, class T> Animable<dimensions, T>& Animable<dime
     if(previousState == AnimationState::Stopped && state == AnimationState::Paused)
         return *this;
 
-    /* Wake up the group in case no animations are running */
-    animables()->wakeUp = true;
+    /* Schedule the change for next step */
     currentState = state;
+    if(animables()) animables()->markChanged(*this);
     return *this;
 }
 
@@ -60,52 +65,154 @@ template<UnsignedInt dimensions, class T> const AnimableGroup<dimensions, T>* An
     return static_cast<const AnimableGroup<dimensions, T>*>(AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>::group());
 }
 
+template<UnsignedInt dimensions, class T> AnimableGroup<dimensions, T>::~AnimableGroup() {
+    /* The animables outlive the group, reset the group-specific state so
+       they can be added to another group */
+    for(std::size_t i = 0; i != this->size(); ++i) {
+        Animable<dimensions, T>& animable = (*this)[i];
+        animable.changePending = false;
+        animable.runningIndex = ~std::size_t(0);
+    }
+}
+
+template<UnsignedInt dimensions, class T> AnimableGroup<dimensions, T>& AnimableGroup<dimensions, T>::setThreadCount(UnsignedInt count) {
+    CORRADE_ASSERT(count != 0,
+        "SceneGraph::AnimableGroup::setThreadCount(): thread count must be positive", *this);
+    _threadCount = count;
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> AnimableGroup<dimensions, T>& AnimableGroup<dimensions, T>::add(Animable<dimensions, T>& animable) {
+    /* Remove from previous group */
+    if(animable.animables()) animable.animables()->remove(animable);
+
+    FeatureGroup<dimensions, Animable<dimensions, T>, T>::add(animable);
+
+    /* Continue where the previous group left off */
+    if(animable.previousState == AnimationState::Running) addRunning(animable);
+    if(animable.previousState != animable.currentState) markChanged(animable);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> AnimableGroup<dimensions, T>& AnimableGroup<dimensions, T>::remove(Animable<dimensions, T>& animable) {
+    CORRADE_ASSERT(animable.animables() == this,
+        "SceneGraph::AnimableGroup::remove(): animable is not part of this group", *this);
+
+    removeFromLists(animable);
+    FeatureGroup<dimensions, Animable<dimensions, T>, T>::remove(animable);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::markChanged(Animable<dimensions, T>& animable) {
+    if(animable.changePending) return;
+
+    animable.changePending = true;
+    _changed.push_back(&animable);
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::addRunning(Animable<dimensions, T>& animable) {
+    animable.runningIndex = _running.size();
+    _running.push_back(&animable);
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::removeRunning(Animable<dimensions, T>& animable) {
+    /* Move last running animable in place of the removed one */
+    Animable<dimensions, T>* last = _running.back();
+    _running[animable.runningIndex] = last;
+    last->runningIndex = animable.runningIndex;
+    _running.pop_back();
+    animable.runningIndex = ~std::size_t(0);
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::removeFromLists(Animable<dimensions, T>& animable) {
+    if(animable.runningIndex != ~std::size_t(0)) removeRunning(animable);
+
+    /* Removed from animationStopped() of another animable before its own
+       callback was called */
+    const auto stopped = std::find(_stopped.begin(), _stopped.end(), &animable);
+    if(stopped != _stopped.end()) *stopped = nullptr;
+
+    if(animable.changePending) {
+        /* The change is either scheduled or currently being processed in
+           step() (if the animable is removed from a state callback). In the
+           latter case just clear the item so it's skipped. */
+        auto found = std::find(_changed.begin(), _changed.end(), &animable);
+        if(found != _changed.end()) _changed.erase(found);
+        else {
+            found = std::find(_processedChanges.begin(), _processedChanges.end(), &animable);
+            CORRADE_INTERNAL_ASSERT(found != _processedChanges.end());
+            *found = nullptr;
+        }
+        animable.changePending = false;
+    }
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::stepRange(const std::size_t begin, const std::size_t end, const Float delta) {
+    if(_batchStep) {
+        _batchStep(_running.data() + begin, _times.data() + begin, end - begin, delta);
+        return;
+    }
+
+    for(std::size_t i = begin; i != end; ++i)
+        _running[i]->animationStep(_times[i], delta);
+}
+
 template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::step(const Float time, const Float delta) {
-    if(!_runningCount && !wakeUp) return;
-    wakeUp = false;
+    if(_running.empty() && _changed.empty()) return;
 
-    for(std::size_t i = 0; i != AnimableGroup<dimensions, T>::size(); ++i) {
-        Animable<dimensions, T>& animable = (*this)[i];
+    /* Process state changes. Changes done from the callbacks are processed
+       in next step, animables removed from the callbacks are set to null. */
+    std::swap(_processedChanges, _changed);
+    for(std::size_t i = 0; i != _processedChanges.size(); ++i) {
+        Animable<dimensions, T>* const animable = _processedChanges[i];
+        if(!animable) continue;
+        animable->changePending = false;
 
-        /* The animation was stopped recently, just decrease count of running
+        /* The animation was stopped recently, remove it from running
            animations if the animation was running before */
-        if(animable.previousState != AnimationState::Stopped && animable.currentState == AnimationState::Stopped) {
-            if(animable.previousState == AnimationState::Running)
-                --_runningCount;
-            animable.previousState = AnimationState::Stopped;
-            animable.animationStopped();
-            continue;
+        if(animable->previousState != AnimationState::Stopped && animable->currentState == AnimationState::Stopped) {
+            if(animable->previousState == AnimationState::Running)
+                removeRunning(*animable);
+            animable->previousState = AnimationState::Stopped;
+            animable->animationStopped();
 
         /* The animation was paused recently, set pause time to previous frame time */
-        } else if(animable.previousState == AnimationState::Running && animable.currentState == AnimationState::Paused) {
-            animable.previousState = AnimationState::Paused;
-            animable.pauseTime = time;
-            --_runningCount;
-            animable.animationPaused();
-            continue;
-
-        /* Skip the rest for not running animations */
-        } else if(animable.currentState != AnimationState::Running) {
-            CORRADE_INTERNAL_ASSERT(animable.previousState == animable.currentState);
-            continue;
+        } else if(animable->previousState == AnimationState::Running && animable->currentState == AnimationState::Paused) {
+            animable->previousState = AnimationState::Paused;
+            animable->pauseTime = time;
+            removeRunning(*animable);
+            animable->animationPaused();
 
         /* The animation was started recently, set start time to previous frame
            time, reset repeat count */
-        } else if(animable.previousState == AnimationState::Stopped) {
-            animable.previousState = AnimationState::Running;
-            animable.startTime = time;
-            animable.repeats = 0;
-            ++_runningCount;
-            animable.animationStarted();
+        } else if(animable->previousState == AnimationState::Stopped && animable->currentState == AnimationState::Running) {
+            animable->previousState = AnimationState::Running;
+            animable->startTime = time;
+            animable->repeats = 0;
+            addRunning(*animable);
+            animable->animationStarted();
 
         /* The animation was resumed recently, add pause duration to start time */
-        } else if(animable.previousState == AnimationState::Paused) {
-            animable.previousState = AnimationState::Running;
-            animable.startTime += time - animable.pauseTime;
-            ++_runningCount;
-            animable.animationResumed();
+        } else if(animable->previousState == AnimationState::Paused && animable->currentState == AnimationState::Running) {
+            animable->previousState = AnimationState::Running;
+            animable->startTime += time - animable->pauseTime;
+            addRunning(*animable);
+            animable->animationResumed();
         }
 
+        /* Otherwise the state was changed back before the step, nothing to do */
+    }
+    _processedChanges.clear();
+
+    CORRADE_ASSERT(delta >= 0.0f,
+        "SceneGraph::AnimableGroup::step(): negative delta passed", );
+
+    /* Check durations of running animations. Stopped animation is replaced
+       with the last one, so the index is incremented only if the animation
+       continues running. The callbacks are called after the sweep, as they
+       might remove other running animables. */
+    for(std::size_t i = 0; i < _running.size(); ) {
+        Animable<dimensions, T>& animable = *_running[i];
         CORRADE_INTERNAL_ASSERT(animable.previousState == AnimationState::Running);
 
         /* Animation time exceeded duration */
@@ -114,8 +221,8 @@ template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::ste
             if(!animable._repeated || animable.repeats+1 == animable._repeatCount) {
                 animable.previousState = AnimationState::Stopped;
                 animable.currentState = AnimationState::Stopped;
-                --_runningCount;
-                animable.animationStopped();
+                removeRunning(animable);
+                _stopped.push_back(&animable);
                 continue;
             }
 
@@ -124,15 +231,28 @@ template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::ste
             animable.startTime += animable._duration;
         }
 
-        /* Animation is still running, perform animation step */
-        CORRADE_ASSERT(time-animable.startTime >= 0.0f,
+        ++i;
+    }
+
+    /* Animables removed from the callbacks are set to null */
+    for(std::size_t i = 0; i != _stopped.size(); ++i)
+        if(_stopped[i]) _stopped[i]->animationStopped();
+    _stopped.clear();
+
+    /* Compute animation times of running animations */
+    _times.resize(_running.size());
+    for(std::size_t i = 0; i != _running.size(); ++i) {
+        CORRADE_ASSERT(time-_running[i]->startTime >= 0.0f,
             "SceneGraph::AnimableGroup::step(): animation was started in future - probably wrong time passed", );
-        CORRADE_ASSERT(delta >= 0.0f,
-            "SceneGraph::AnimableGroup::step(): negative delta passed", );
-        animable.animationStep(time - animable.startTime, delta);
+        _times[i] = time - _running[i]->startTime;
     }
 
-    CORRADE_INTERNAL_ASSERT((_runningCount <= AnimableGroup<dimensions, T>::size()));
+    /* Perform animation steps, distribute them across worker threads if
+       requested */
+    if(_running.empty()) return;
+    Math::Batch::Implementation::parallelRanges(_running.size(), 1, _threadCount, [this, delta](std::size_t, std::size_t begin, std::size_t end) {
+        stepRange(begin, end, delta);
+    });
 }
 
 }}
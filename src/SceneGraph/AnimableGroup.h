@@ -45,31 +45,115 @@ template<UnsignedInt dimensions, class T> class MAGNUM_SCENEGRAPH_EXPORT Animabl
     friend class Animable<dimensions, T>;
 
     public:
+        /**
+         * @brief Batch step function
+         *
+         * Called with list of running animables, their times from start of
+         * the animation and time delta for current frame. See
+         * @ref setBatchStep() for more information.
+         */
+        typedef void(*BatchStepFunction)(Animable<dimensions, T>* const*, const Float*, std::size_t, Float);
+
         /**
          * @brief Constructor
          */
-        explicit AnimableGroup(): _runningCount(0), wakeUp(false) {}
+        explicit AnimableGroup(): _batchStep(nullptr), _threadCount(1) {}
+
+        /**
+         * @brief Destructor
+         *
+         * Animables in the group are not destroyed, they can be added to
+         * another group afterwards.
+         */
+        ~AnimableGroup();
 
         /**
          * @brief Count of running animations
          *
          * @see step()
          */
-        std::size_t runningCount() const { return _runningCount; }
+        std::size_t runningCount() const { return _running.size(); }
+
+        /** @brief Batch step function */
+        BatchStepFunction batchStep() const { return _batchStep; }
+
+        /**
+         * @brief Set batch step function
+         * @return Reference to self (for method chaining)
+         *
+         * If set, @ref step() calls this function with contiguous list of
+         * all running animables instead of calling @ref Animable::animationStep()
+         * on each of them, avoiding virtual call overhead for groups
+         * containing animables of the same type. The function is
+         * responsible for casting the animables to proper type. Set to
+         * `nullptr` to use @ref Animable::animationStep() again. Default is
+         * `nullptr`.
+         */
+        AnimableGroup<dimensions, T>& setBatchStep(BatchStepFunction function) {
+            _batchStep = function;
+            return *this;
+        }
+
+        /** @brief Count of threads used for animation steps */
+        UnsignedInt threadCount() const { return _threadCount; }
+
+        /**
+         * @brief Set count of threads used for animation steps
+         * @return Reference to self (for method chaining)
+         *
+         * If set to value larger than `1`, running animables are split into
+         * contiguous ranges and @ref Animable::animationStep() (or the batch
+         * step function) for each range is called from a shared pool of
+         * worker threads. State changes and all other callbacks are still
+         * processed from the calling thread. The animation steps must be
+         * independent on each other, mustn't change animation state and
+         * mustn't change object transformations, as that marks the objects
+         * and bounding volume hierarchies dirty. Has effect only if Magnum
+         * is built with @ref MAGNUM_BUILD_THREADS. Default is `1`.
+         */
+        AnimableGroup<dimensions, T>& setThreadCount(UnsignedInt count);
+
+        /**
+         * @brief Add animable to the group
+         * @return Reference to self (for method chaining)
+         *
+         * If the animable is part of another group, it is removed from it.
+         * Running animable continues running in this group.
+         */
+        AnimableGroup<dimensions, T>& add(Animable<dimensions, T>& animable);
+
+        /**
+         * @brief Remove animable from the group
+         * @return Reference to self (for method chaining)
+         *
+         * The animable must be part of the group.
+         */
+        AnimableGroup<dimensions, T>& remove(Animable<dimensions, T>& animable);
 
         /**
          * @brief Perform animation step
          * @param time      Absolute time (e.g. Timeline::previousFrameTime())
          * @param delta     Time delta for current frame (e.g. Timeline::previousFrameDuration())
          *
-         * If there are no running animations the function does nothing.
-         * @see runningCount()
+         * Processes state changes of animables which called
+         * @ref Animable::setState() since last step and then performs
+         * animation step for all running animables. If there are no running
+         * animations and no state changes, the function does nothing.
+         * @see @ref runningCount(), @ref setBatchStep(), @ref setThreadCount()
          */
         void step(const Float time, const Float delta);
 
     private:
-        std::size_t _runningCount;
-        bool wakeUp;
+        void markChanged(Animable<dimensions, T>& animable);
+        void addRunning(Animable<dimensions, T>& animable);
+        void removeRunning(Animable<dimensions, T>& animable);
+        void removeFromLists(Animable<dimensions, T>& animable);
+        void stepRange(std::size_t begin, std::size_t end, Float delta);
+
+        std::vector<Animable<dimensions, T>*> _running, _changed, _processedChanges, _stopped;
+        std::vector<Float> _times;
+        BatchStepFunction _batchStep;
+        UnsignedInt _threadCount;
 };
 
 #ifndef CORRADE_GCC46_COMPATIBILITY
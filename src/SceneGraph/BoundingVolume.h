@@ -0,0 +1,208 @@
+#ifndef Magnum_SceneGraph_BoundingVolume_h
+#define Magnum_SceneGraph_BoundingVolume_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::SceneGraph::BoundingVolume, alias Magnum::SceneGraph::BasicBoundingVolume2D, Magnum::SceneGraph::BasicBoundingVolume3D, typedef Magnum::SceneGraph::BoundingVolume2D, Magnum::SceneGraph::BoundingVolume3D
+ */
+
+#include "AbstractGroupedFeature.h"
+
+#include "magnumSceneGraphVisibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Bounding volume
+
+Adds axis-aligned bounding box to the object and indexes it in
+@ref BoundingVolumeHierarchy for fast spatial queries.
+
+@section BoundingVolume-usage Usage
+
+Specify bounds of the object in object local coordinates. Absolute bounds are
+recomputed from them every time the object is transformed and the hierarchy is
+updated incrementally.
+@code
+Scene3D scene;
+SceneGraph::BoundingVolumeHierarchy3D index;
+
+Object3D* object = new Object3D(&scene);
+(new SceneGraph::BoundingVolume3D(*object, &index))
+    ->setBounds({-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f});
+@endcode
+
+See @ref BoundingVolumeHierarchy for available queries.
+
+@section BoundingVolume-explicit-specializations Explicit template specializations
+
+The following specialization are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Double type) you have to
+use @ref BoundingVolumeHierarchy.hpp implementation file to avoid linker
+errors. See @ref compilation-speedup-hpp for more information.
+
+-   @ref BoundingVolume2D
+-   @ref BoundingVolume3D
+
+@see @ref scenegraph, @ref BasicBoundingVolume2D, @ref BasicBoundingVolume3D,
+    @ref BoundingVolume2D, @ref BoundingVolume3D, @ref BoundingVolumeHierarchy
+*/
+template<UnsignedInt dimensions, class T> class MAGNUM_SCENEGRAPH_EXPORT BoundingVolume: public AbstractGroupedFeature<dimensions, BoundingVolume<dimensions, T>, T> {
+    friend class BoundingVolumeHierarchy<dimensions, T>;
+
+    public:
+        /**
+         * @brief Constructor
+         * @param object    %Object this bounding volume belongs to
+         * @param hierarchy Hierarchy this bounding volume belongs to
+         *
+         * Creates empty bounding volume at object origin. Adds the feature to
+         * the object and also to the hierarchy, if specified.
+         * @see @ref setBounds(), @ref BoundingVolumeHierarchy::add()
+         */
+        explicit BoundingVolume(AbstractObject<dimensions, T>& object, BoundingVolumeHierarchy<dimensions, T>* hierarchy = nullptr);
+
+        /**
+         * @brief Destructor
+         *
+         * Removes the bounding volume from the hierarchy, if it belongs to
+         * any.
+         */
+        ~BoundingVolume();
+
+        /**
+         * @brief Hierarchy containing this bounding volume
+         *
+         * If the bounding volume doesn't belong to any hierarchy, returns
+         * `nullptr`.
+         */
+        BoundingVolumeHierarchy<dimensions, T>* hierarchy();
+        const BoundingVolumeHierarchy<dimensions, T>* hierarchy() const; /**< @overload */
+
+        /** @brief Minimal corner of the bounds in object local coordinates */
+        typename DimensionTraits<dimensions, T>::VectorType min() const { return _min; }
+
+        /** @brief Maximal corner of the bounds in object local coordinates */
+        typename DimensionTraits<dimensions, T>::VectorType max() const { return _max; }
+
+        /**
+         * @brief Set bounds in object local coordinates
+         * @return Reference to self (for method chaining)
+         *
+         * Marks the volume for update in the hierarchy.
+         */
+        BoundingVolume<dimensions, T>& setBounds(const typename DimensionTraits<dimensions, T>::VectorType& min, const typename DimensionTraits<dimensions, T>::VectorType& max);
+
+        /**
+         * @brief Minimal corner of the bounds in absolute coordinates
+         *
+         * Value computed during last @ref BoundingVolumeHierarchy::update().
+         */
+        typename DimensionTraits<dimensions, T>::VectorType absoluteMin() const { return _absoluteMin; }
+
+        /**
+         * @brief Maximal corner of the bounds in absolute coordinates
+         *
+         * Value computed during last @ref BoundingVolumeHierarchy::update().
+         */
+        typename DimensionTraits<dimensions, T>::VectorType absoluteMax() const { return _absoluteMax; }
+
+    protected:
+        /** Marks the volume for update in the hierarchy */
+        void markDirty() override;
+
+        /**
+         * @brief Recalculate absolute bounds
+         *
+         * Transforms the bounds in object local coordinates and passes them
+         * to @ref setAbsoluteBounds(). Subclasses can reimplement this to
+         * compute the absolute bounds directly.
+         */
+        void clean(const typename DimensionTraits<dimensions, T>::MatrixType& absoluteTransformationMatrix) override;
+
+        /**
+         * @brief Set bounds in absolute coordinates
+         *
+         * Updates the volume in the hierarchy. Meant to be called from
+         * @ref clean().
+         */
+        void setAbsoluteBounds(const typename DimensionTraits<dimensions, T>::VectorType& min, const typename DimensionTraits<dimensions, T>::VectorType& max);
+
+    private:
+        typename DimensionTraits<dimensions, T>::VectorType _min, _max,
+            _absoluteMin, _absoluteMax;
+        Int _node;
+        bool _dirty, _queued;
+};
+
+#ifndef CORRADE_GCC46_COMPATIBILITY
+/**
+@brief Bounding volume for two-dimensional scenes
+
+Convenience alternative to <tt>%BoundingVolume<2, T></tt>. See
+BoundingVolume for more information.
+@note Not available on GCC < 4.7. Use <tt>%BoundingVolume<2, T></tt> instead.
+@see @ref BoundingVolume2D, @ref BasicBoundingVolume3D
+*/
+template<class T> using BasicBoundingVolume2D = BoundingVolume<2, T>;
+#endif
+
+/**
+@brief Bounding volume for two-dimensional float scenes
+
+@see @ref BoundingVolume3D
+*/
+#ifndef CORRADE_GCC46_COMPATIBILITY
+typedef BasicBoundingVolume2D<Float> BoundingVolume2D;
+#else
+typedef BoundingVolume<2, Float> BoundingVolume2D;
+#endif
+
+#ifndef CORRADE_GCC46_COMPATIBILITY
+/**
+@brief Bounding volume for three-dimensional scenes
+
+Convenience alternative to <tt>%BoundingVolume<3, T></tt>. See
+BoundingVolume for more information.
+@note Not available on GCC < 4.7. Use <tt>%BoundingVolume<3, T></tt> instead.
+@see @ref BoundingVolume3D, @ref BasicBoundingVolume2D
+*/
+template<class T> using BasicBoundingVolume3D = BoundingVolume<3, T>;
+#endif
+
+/**
+@brief Bounding volume for three-dimensional float scenes
+
+@see @ref BoundingVolume2D
+*/
+#ifndef CORRADE_GCC46_COMPATIBILITY
+typedef BasicBoundingVolume3D<Float> BoundingVolume3D;
+#else
+typedef BoundingVolume<3, Float> BoundingVolume3D;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,313 @@
+#ifndef Magnum_SceneGraph_BoundingVolumeHierarchy_h
+#define Magnum_SceneGraph_BoundingVolumeHierarchy_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::SceneGraph::BoundingVolumeHierarchy, alias Magnum::SceneGraph::BasicBoundingVolumeHierarchy2D, Magnum::SceneGraph::BasicBoundingVolumeHierarchy3D, typedef Magnum::SceneGraph::BoundingVolumeHierarchy2D, Magnum::SceneGraph::BoundingVolumeHierarchy3D
+ */
+
+#include <limits>
+#include <utility>
+
+#include "DimensionTraits.h"
+#include "FeatureGroup.h"
+
+#include "magnumSceneGraphVisibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Bounding volume hierarchy
+
+Spatial index of @ref BoundingVolume features implemented as dynamic tree of
+axis-aligned bounding boxes. Leafs are stored with bounds enlarged by
+@ref setMargin() "margin", so slightly moving objects don't need any tree
+restructuring. The tree is kept balanced using tree rotations on insertion and
+removal.
+
+@section BoundingVolumeHierarchy-update Incremental updates
+
+When an object with bounding volume is transformed (or the bounds are
+changed), the volume is marked for update. The update is done lazily in
+@ref update() (which is called implicitly by all queries) by cleaning all
+marked objects at once, recalculating their absolute bounds and reinserting
+only the leafs whose bounds escaped the enlarged bounds stored in the tree.
+
+@section BoundingVolumeHierarchy-queries Queries
+
+-   @ref queryBox() and @ref querySphere() return all volumes intersecting
+    given box or sphere,
+-   @ref queryFrustum() and @ref visible() return all volumes inside given
+    view frustum, usable for culling before drawing,
+-   @ref raycast() returns all volumes hit by given ray sorted by distance,
+    usable for picking, @ref sphereCast() does the same for moving sphere,
+-   @ref overlappingPairs() returns all pairs of overlapping volumes.
+
+@ref Shapes::ShapeGroup uses the hierarchy for its ray and sphere casts.
+
+Example culling:
+@code
+SceneGraph::BoundingVolumeHierarchy3D index;
+SceneGraph::Camera3D camera(cameraObject);
+
+for(SceneGraph::BoundingVolume3D* volume: index.visible(camera)) {
+    // draw only visible objects ...
+}
+@endcode
+
+@section BoundingVolumeHierarchy-explicit-specializations Explicit template specializations
+
+The following specialization are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Double type) you have to
+use @ref BoundingVolumeHierarchy.hpp implementation file to avoid linker
+errors. See @ref compilation-speedup-hpp for more information.
+
+-   @ref BoundingVolumeHierarchy2D
+-   @ref BoundingVolumeHierarchy3D
+
+@see @ref scenegraph, @ref BasicBoundingVolumeHierarchy2D,
+    @ref BasicBoundingVolumeHierarchy3D, @ref BoundingVolumeHierarchy2D,
+    @ref BoundingVolumeHierarchy3D
+*/
+template<UnsignedInt dimensions, class T> class MAGNUM_SCENEGRAPH_EXPORT BoundingVolumeHierarchy: public FeatureGroup<dimensions, BoundingVolume<dimensions, T>, T> {
+    friend class BoundingVolume<dimensions, T>;
+
+    public:
+        /**
+         * @brief Constructor
+         *
+         * Creates empty hierarchy with zero margin.
+         */
+        explicit BoundingVolumeHierarchy();
+
+        /**
+         * @brief Destructor
+         *
+         * Removes all volumes belonging to this hierarchy, but not deletes
+         * them.
+         */
+        ~BoundingVolumeHierarchy();
+
+        /** @brief Margin */
+        T margin() const { return _margin; }
+
+        /**
+         * @brief Set margin
+         * @return Reference to self (for method chaining)
+         *
+         * Amount by which are the bounds enlarged in each direction when
+         * (re)inserting them into the tree. Larger margin means less
+         * restructuring for moving objects, but less precise culling of
+         * inner nodes. Affects only volumes inserted after this call.
+         */
+        BoundingVolumeHierarchy<dimensions, T>& setMargin(T margin) {
+            _margin = margin;
+            return *this;
+        }
+
+        /**
+         * @brief Add bounding volume to the hierarchy
+         * @return Reference to self (for method chaining)
+         *
+         * If the volume is part of another hierarchy, it is removed from it.
+         * The volume is inserted into the tree on next @ref update().
+         */
+        BoundingVolumeHierarchy<dimensions, T>& add(BoundingVolume<dimensions, T>& volume);
+
+        /**
+         * @brief Remove bounding volume from the hierarchy
+         * @return Reference to self (for method chaining)
+         *
+         * The volume must be part of the hierarchy.
+         */
+        BoundingVolumeHierarchy<dimensions, T>& remove(BoundingVolume<dimensions, T>& volume);
+
+        /**
+         * @brief Tree height
+         *
+         * Zero for empty tree or tree with only one leaf. For balanced tree
+         * with @f$ n @f$ leafs the height is approximately @f$ \log_2 n @f$.
+         */
+        Int height() const;
+
+        /**
+         * @brief Update the hierarchy
+         *
+         * Cleans all objects with bounding volumes marked for update and
+         * updates the tree. Called implicitly from all queries.
+         */
+        void update();
+
+        /**
+         * @brief Volumes intersecting given box
+         *
+         * Box is specified with minimal and maximal corner in absolute
+         * coordinates.
+         */
+        std::vector<BoundingVolume<dimensions, T>*> queryBox(const typename DimensionTraits<dimensions, T>::VectorType& min, const typename DimensionTraits<dimensions, T>::VectorType& max);
+
+        /**
+         * @brief Volumes intersecting given sphere
+         *
+         * Sphere is specified with center position in absolute coordinates
+         * and radius.
+         */
+        std::vector<BoundingVolume<dimensions, T>*> querySphere(const typename DimensionTraits<dimensions, T>::VectorType& center, T radius);
+
+        /**
+         * @brief Volumes inside given frustum
+         * @param projectionMatrix  Projection matrix multiplied with camera
+         *      matrix
+         *
+         * Returns all volumes which are at least partially inside the clip
+         * volume of given matrix. The test is conservative, some volumes
+         * near frustum corners might be reported even if they are outside.
+         * @see @ref visible()
+         */
+        std::vector<BoundingVolume<dimensions, T>*> queryFrustum(const typename DimensionTraits<dimensions, T>::MatrixType& projectionMatrix);
+
+        /**
+         * @brief Volumes visible with given camera
+         *
+         * Equivalent to calling @ref queryFrustum() with camera projection
+         * matrix multiplied by camera matrix.
+         */
+        std::vector<BoundingVolume<dimensions, T>*> visible(AbstractCamera<dimensions, T>& camera);
+
+        /**
+         * @brief Volumes hit by given ray
+         * @param origin        Ray origin in absolute coordinates
+         * @param direction     Ray direction
+         * @param maxDistance   Max distance along the ray, in multiples of
+         *      direction length
+         *
+         * Returns volumes hit by the ray with distance of the first
+         * intersection (in multiples of @p direction length), sorted by the
+         * distance. If the ray origin is inside the volume, distance is `0`.
+         */
+        std::vector<std::pair<T, BoundingVolume<dimensions, T>*>> raycast(const typename DimensionTraits<dimensions, T>::VectorType& origin, const typename DimensionTraits<dimensions, T>::VectorType& direction, T maxDistance = std::numeric_limits<T>::infinity());
+
+        /**
+         * @brief Volumes hit by sphere moving along given ray
+         * @param origin        Ray origin in absolute coordinates
+         * @param direction     Ray direction
+         * @param radius        Sphere radius
+         * @param maxDistance   Max distance along the ray, in multiples of
+         *      direction length
+         *
+         * Same as @ref raycast(), but tests the ray against the bounds
+         * enlarged by @p radius. The distances are thus only lower bounds of
+         * distances to the actual sphere contact.
+         */
+        std::vector<std::pair<T, BoundingVolume<dimensions, T>*>> sphereCast(const typename DimensionTraits<dimensions, T>::VectorType& origin, const typename DimensionTraits<dimensions, T>::VectorType& direction, T radius, T maxDistance = std::numeric_limits<T>::infinity());
+
+        /**
+         * @brief All pairs of overlapping volumes
+         *
+         * Each pair is reported only once.
+         */
+        std::vector<std::pair<BoundingVolume<dimensions, T>*, BoundingVolume<dimensions, T>*>> overlappingPairs();
+
+    private:
+        struct Node {
+            typename DimensionTraits<dimensions, T>::VectorType min, max;
+            BoundingVolume<dimensions, T>* volume;
+            Int parent; /* or next free node */
+            Int children[2];
+            Int height; /* -1 for free nodes, 0 for leafs */
+        };
+
+        static T cost(const typename DimensionTraits<dimensions, T>::VectorType& min, const typename DimensionTraits<dimensions, T>::VectorType& max);
+        void merge(Node& out, Int a, Int b);
+        void fixUpwards(Int index);
+
+        Int allocateNode();
+        void freeNode(Int index);
+        void insertLeaf(Int leaf);
+        void removeLeaf(Int leaf);
+        Int balance(Int index);
+
+        void updateVolume(BoundingVolume<dimensions, T>& volume);
+        void removeVolume(BoundingVolume<dimensions, T>& volume);
+
+        template<class NodePredicate, class LeafFunction> void traverse(NodePredicate nodePredicate, LeafFunction leafFunction) const;
+
+        std::vector<Node> _nodes;
+        std::vector<BoundingVolume<dimensions, T>*> _dirty;
+        Int _root, _freeList;
+        T _margin;
+};
+
+#ifndef CORRADE_GCC46_COMPATIBILITY
+/**
+@brief Bounding volume hierarchy for two-dimensional scenes
+
+Convenience alternative to <tt>%BoundingVolumeHierarchy<2, T></tt>. See
+BoundingVolumeHierarchy for more information.
+@note Not available on GCC < 4.7. Use <tt>%BoundingVolumeHierarchy<2, T></tt>
+    instead.
+@see @ref BoundingVolumeHierarchy2D, @ref BasicBoundingVolumeHierarchy3D
+*/
+template<class T> using BasicBoundingVolumeHierarchy2D = BoundingVolumeHierarchy<2, T>;
+#endif
+
+/**
+@brief Bounding volume hierarchy for two-dimensional float scenes
+
+@see @ref BoundingVolumeHierarchy3D
+*/
+#ifndef CORRADE_GCC46_COMPATIBILITY
+typedef BasicBoundingVolumeHierarchy2D<Float> BoundingVolumeHierarchy2D;
+#else
+typedef BoundingVolumeHierarchy<2, Float> BoundingVolumeHierarchy2D;
+#endif
+
+#ifndef CORRADE_GCC46_COMPATIBILITY
+/**
+@brief Bounding volume hierarchy for three-dimensional scenes
+
+Convenience alternative to <tt>%BoundingVolumeHierarchy<3, T></tt>. See
+BoundingVolumeHierarchy for more information.
+@note Not available on GCC < 4.7. Use <tt>%BoundingVolumeHierarchy<3, T></tt>
+    instead.
+@see @ref BoundingVolumeHierarchy3D, @ref BasicBoundingVolumeHierarchy2D
+*/
+template<class T> using BasicBoundingVolumeHierarchy3D = BoundingVolumeHierarchy<3, T>;
+#endif
+
+/**
+@brief Bounding volume hierarchy for three-dimensional float scenes
+
+@see @ref BoundingVolumeHierarchy2D
+*/
+#ifndef CORRADE_GCC46_COMPATIBILITY
+typedef BasicBoundingVolumeHierarchy3D<Float> BoundingVolumeHierarchy3D;
+#else
+typedef BoundingVolumeHierarchy<3, Float> BoundingVolumeHierarchy3D;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,526 @@
+#ifndef Magnum_SceneGraph_BoundingVolumeHierarchy_hpp
+#define Magnum_SceneGraph_BoundingVolumeHierarchy_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref BoundingVolume.h and @ref BoundingVolumeHierarchy.h
+ */
+
+#include "BoundingVolumeHierarchy.h"
+#include "BoundingVolume.h"
+
+#include <algorithm>
+
+#include "Math/Functions.h"
+#include "SceneGraph/AbstractCamera.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<UnsignedInt dimensions, class T> BoundingVolume<dimensions, T>::BoundingVolume(AbstractObject<dimensions, T>& object, BoundingVolumeHierarchy<dimensions, T>* hierarchy): AbstractGroupedFeature<dimensions, BoundingVolume<dimensions, T>, T>(object), _node(-1), _dirty(false), _queued(false) {
+    AbstractFeature<dimensions, T>::setCachedTransformations(CachedTransformation::Absolute);
+    if(hierarchy) hierarchy->add(*this);
+}
+
+template<UnsignedInt dimensions, class T> BoundingVolume<dimensions, T>::~BoundingVolume() {
+    if(hierarchy()) hierarchy()->remove(*this);
+}
+
+template<UnsignedInt dimensions, class T> BoundingVolumeHierarchy<dimensions, T>* BoundingVolume<dimensions, T>::hierarchy() {
+    return static_cast<BoundingVolumeHierarchy<dimensions, T>*>(AbstractGroupedFeature<dimensions, BoundingVolume<dimensions, T>, T>::group());
+}
+
+template<UnsignedInt dimensions, class T> const BoundingVolumeHierarchy<dimensions, T>* BoundingVolume<dimensions, T>::hierarchy() const {
+    return static_cast<const BoundingVolumeHierarchy<dimensions, T>*>(AbstractGroupedFeature<dimensions, BoundingVolume<dimensions, T>, T>::group());
+}
+
+template<UnsignedInt dimensions, class T> BoundingVolume<dimensions, T>& BoundingVolume<dimensions, T>::setBounds(const typename DimensionTraits<dimensions, T>::VectorType& min, const typename DimensionTraits<dimensions, T>::VectorType& max) {
+    _min = min;
+    _max = max;
+    markDirty();
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolume<dimensions, T>::markDirty() {
+    if(!hierarchy()) return;
+
+    /* The volume might have been cleaned outside of update() (e.g. together
+       with other features of the object) and still be queued */
+    _dirty = true;
+    if(_queued) return;
+
+    _queued = true;
+    hierarchy()->_dirty.push_back(this);
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolume<dimensions, T>::clean(const typename DimensionTraits<dimensions, T>::MatrixType& absoluteTransformationMatrix) {
+    /* Transform center and project the extents onto absolute axes */
+    const typename DimensionTraits<dimensions, T>::VectorType center = absoluteTransformationMatrix.transformPoint((_min + _max)/T(2));
+    const typename DimensionTraits<dimensions, T>::VectorType extents = (_max - _min)/T(2);
+    typename DimensionTraits<dimensions, T>::VectorType absoluteExtents;
+    for(std::size_t i = 0; i != dimensions; ++i)
+        for(std::size_t j = 0; j != dimensions; ++j)
+            absoluteExtents[i] += std::abs(absoluteTransformationMatrix[j][i])*extents[j];
+
+    setAbsoluteBounds(center - absoluteExtents, center + absoluteExtents);
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolume<dimensions, T>::setAbsoluteBounds(const typename DimensionTraits<dimensions, T>::VectorType& min, const typename DimensionTraits<dimensions, T>::VectorType& max) {
+    _absoluteMin = min;
+    _absoluteMax = max;
+    _dirty = false;
+
+    if(hierarchy()) hierarchy()->updateVolume(*this);
+}
+
+template<UnsignedInt dimensions, class T> BoundingVolumeHierarchy<dimensions, T>::BoundingVolumeHierarchy(): _root(-1), _freeList(-1), _margin(T(0)) {}
+
+template<UnsignedInt dimensions, class T> BoundingVolumeHierarchy<dimensions, T>::~BoundingVolumeHierarchy() {
+    for(std::size_t i = 0; i != this->size(); ++i) {
+        (*this)[i]._node = -1;
+        (*this)[i]._dirty = (*this)[i]._queued = false;
+    }
+}
+
+template<UnsignedInt dimensions, class T> BoundingVolumeHierarchy<dimensions, T>& BoundingVolumeHierarchy<dimensions, T>::add(BoundingVolume<dimensions, T>& volume) {
+    /* Remove from previous hierarchy */
+    if(volume.hierarchy()) volume.hierarchy()->remove(volume);
+
+    FeatureGroup<dimensions, BoundingVolume<dimensions, T>, T>::add(volume);
+    volume.markDirty();
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> BoundingVolumeHierarchy<dimensions, T>& BoundingVolumeHierarchy<dimensions, T>::remove(BoundingVolume<dimensions, T>& volume) {
+    CORRADE_ASSERT(volume.hierarchy() == this,
+        "SceneGraph::BoundingVolumeHierarchy::remove(): volume is not part of this hierarchy", *this);
+
+    removeVolume(volume);
+    FeatureGroup<dimensions, BoundingVolume<dimensions, T>, T>::remove(volume);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> Int BoundingVolumeHierarchy<dimensions, T>::height() const {
+    return _root == -1 ? 0 : _nodes[_root].height;
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolumeHierarchy<dimensions, T>::update() {
+    if(_dirty.empty()) return;
+
+    /* Clean all objects at once, this calls clean() on the volumes */
+    std::vector<AbstractObject<dimensions, T>*> objects;
+    objects.reserve(_dirty.size());
+    for(BoundingVolume<dimensions, T>* volume: _dirty)
+        objects.push_back(&volume->object());
+    AbstractObject<dimensions, T>::setClean(objects);
+
+    /* Volumes on objects which were already clean (i.e. newly added volumes
+       or volumes with changed bounds) need to be cleaned explicitly */
+    for(BoundingVolume<dimensions, T>* volume: _dirty) {
+        volume->_queued = false;
+        if(volume->_dirty) volume->clean(volume->object().absoluteTransformationMatrix());
+    }
+
+    _dirty.clear();
+}
+
+template<UnsignedInt dimensions, class T> template<class NodePredicate, class LeafFunction> void BoundingVolumeHierarchy<dimensions, T>::traverse(NodePredicate nodePredicate, LeafFunction leafFunction) const {
+    if(_root == -1) return;
+
+    std::vector<Int> stack{_root};
+    while(!stack.empty()) {
+        const Node& node = _nodes[stack.back()];
+        stack.pop_back();
+
+        if(!nodePredicate(node.min, node.max)) continue;
+
+        if(node.height == 0) {
+            leafFunction(*node.volume);
+        } else {
+            stack.push_back(node.children[0]);
+            stack.push_back(node.children[1]);
+        }
+    }
+}
+
+namespace Implementation {
+    template<class VectorType> inline bool boxesIntersect(const VectorType& aMin, const VectorType& aMax, const VectorType& bMin, const VectorType& bMax) {
+        for(std::size_t i = 0; i != VectorType::Size; ++i)
+            if(aMax[i] < bMin[i] || aMin[i] > bMax[i]) return false;
+        return true;
+    }
+}
+
+template<UnsignedInt dimensions, class T> std::vector<BoundingVolume<dimensions, T>*> BoundingVolumeHierarchy<dimensions, T>::queryBox(const typename DimensionTraits<dimensions, T>::VectorType& min, const typename DimensionTraits<dimensions, T>::VectorType& max) {
+    update();
+
+    std::vector<BoundingVolume<dimensions, T>*> out;
+    auto predicate = [&min, &max](const typename DimensionTraits<dimensions, T>::VectorType& nodeMin, const typename DimensionTraits<dimensions, T>::VectorType& nodeMax) {
+        return Implementation::boxesIntersect(nodeMin, nodeMax, min, max);
+    };
+    traverse(predicate, [&out, &predicate](BoundingVolume<dimensions, T>& volume) {
+        if(predicate(volume._absoluteMin, volume._absoluteMax)) out.push_back(&volume);
+    });
+    return out;
+}
+
+template<UnsignedInt dimensions, class T> std::vector<BoundingVolume<dimensions, T>*> BoundingVolumeHierarchy<dimensions, T>::querySphere(const typename DimensionTraits<dimensions, T>::VectorType& center, const T radius) {
+    update();
+
+    std::vector<BoundingVolume<dimensions, T>*> out;
+    const T radiusSquared = radius*radius;
+    auto predicate = [&center, radiusSquared](const typename DimensionTraits<dimensions, T>::VectorType& min, const typename DimensionTraits<dimensions, T>::VectorType& max) {
+        /* Distance from the center to nearest point in the box */
+        T distanceSquared(0);
+        for(std::size_t i = 0; i != dimensions; ++i) {
+            const T d = Math::clamp(center[i], min[i], max[i]) - center[i];
+            distanceSquared += d*d;
+        }
+        return distanceSquared <= radiusSquared;
+    };
+    traverse(predicate, [&out, &predicate](BoundingVolume<dimensions, T>& volume) {
+        if(predicate(volume._absoluteMin, volume._absoluteMax)) out.push_back(&volume);
+    });
+    return out;
+}
+
+template<UnsignedInt dimensions, class T> std::vector<BoundingVolume<dimensions, T>*> BoundingVolumeHierarchy<dimensions, T>::queryFrustum(const typename DimensionTraits<dimensions, T>::MatrixType& projectionMatrix) {
+    update();
+
+    /* Extract clip planes from the matrix rows. Point is inside if
+       -w <= x_i <= w for all coordinates, i.e. w + x_i >= 0 and w - x_i >= 0 */
+    std::vector<Math::Vector<dimensions + 1, T>> planes;
+    planes.reserve(dimensions*2);
+    const Math::Vector<dimensions + 1, T> w = projectionMatrix.row(dimensions);
+    for(std::size_t i = 0; i != dimensions; ++i) {
+        planes.push_back(w + projectionMatrix.row(i));
+        planes.push_back(w - projectionMatrix.row(i));
+    }
+
+    std::vector<BoundingVolume<dimensions, T>*> out;
+    auto predicate = [&planes](const typename DimensionTraits<dimensions, T>::VectorType& min, const typename DimensionTraits<dimensions, T>::VectorType& max) {
+        /* The box is outside if its corner farthest in plane normal direction
+           is behind the plane */
+        for(const Math::Vector<dimensions + 1, T>& plane: planes) {
+            T distance = plane[dimensions];
+            for(std::size_t i = 0; i != dimensions; ++i)
+                distance += plane[i]*(plane[i] >= T(0) ? max[i] : min[i]);
+            if(distance < T(0)) return false;
+        }
+        return true;
+    };
+    traverse(predicate, [&out, &predicate](BoundingVolume<dimensions, T>& volume) {
+        if(predicate(volume._absoluteMin, volume._absoluteMax)) out.push_back(&volume);
+    });
+    return out;
+}
+
+template<UnsignedInt dimensions, class T> std::vector<BoundingVolume<dimensions, T>*> BoundingVolumeHierarchy<dimensions, T>::visible(AbstractCamera<dimensions, T>& camera) {
+    return queryFrustum(camera.projectionMatrix()*camera.cameraMatrix());
+}
+
+template<UnsignedInt dimensions, class T> std::vector<std::pair<T, BoundingVolume<dimensions, T>*>> BoundingVolumeHierarchy<dimensions, T>::raycast(const typename DimensionTraits<dimensions, T>::VectorType& origin, const typename DimensionTraits<dimensions, T>::VectorType& direction, const T maxDistance) {
+    return sphereCast(origin, direction, T(0), maxDistance);
+}
+
+template<UnsignedInt dimensions, class T> std::vector<std::pair<T, BoundingVolume<dimensions, T>*>> BoundingVolumeHierarchy<dimensions, T>::sphereCast(const typename DimensionTraits<dimensions, T>::VectorType& origin, const typename DimensionTraits<dimensions, T>::VectorType& direction, const T radius, const T maxDistance) {
+    update();
+
+    /* Slab test against the bounds enlarged by the radius, returns distance
+       of the first intersection or NaN */
+    auto intersection = [&origin, &direction, radius, maxDistance](const typename DimensionTraits<dimensions, T>::VectorType& min, const typename DimensionTraits<dimensions, T>::VectorType& max) {
+        T near(0), far(maxDistance);
+        for(std::size_t i = 0; i != dimensions; ++i) {
+            /* Ray parallel to the slab, miss if the origin is outside */
+            if(direction[i] == T(0)) {
+                if(origin[i] < min[i] - radius || origin[i] > max[i] + radius)
+                    return std::numeric_limits<T>::quiet_NaN();
+                continue;
+            }
+
+            const T inverted = T(1)/direction[i];
+            T t1 = (min[i] - radius - origin[i])*inverted;
+            T t2 = (max[i] + radius - origin[i])*inverted;
+            if(t1 > t2) std::swap(t1, t2);
+            near = std::max(near, t1);
+            far = std::min(far, t2);
+            if(near > far) return std::numeric_limits<T>::quiet_NaN();
+        }
+        return near;
+    };
+
+    std::vector<std::pair<T, BoundingVolume<dimensions, T>*>> out;
+    traverse([&intersection](const typename DimensionTraits<dimensions, T>::VectorType& min, const typename DimensionTraits<dimensions, T>::VectorType& max) {
+        return !std::isnan(intersection(min, max));
+    }, [&out, &intersection](BoundingVolume<dimensions, T>& volume) {
+        const T distance = intersection(volume._absoluteMin, volume._absoluteMax);
+        if(!std::isnan(distance)) out.emplace_back(distance, &volume);
+    });
+
+    std::sort(out.begin(), out.end(), [](const std::pair<T, BoundingVolume<dimensions, T>*>& a, const std::pair<T, BoundingVolume<dimensions, T>*>& b) {
+        return a.first < b.first;
+    });
+    return out;
+}
+
+template<UnsignedInt dimensions, class T> std::vector<std::pair<BoundingVolume<dimensions, T>*, BoundingVolume<dimensions, T>*>> BoundingVolumeHierarchy<dimensions, T>::overlappingPairs() {
+    update();
+
+    std::vector<std::pair<BoundingVolume<dimensions, T>*, BoundingVolume<dimensions, T>*>> out;
+    for(std::size_t i = 0; i != this->size(); ++i) {
+        BoundingVolume<dimensions, T>& a = (*this)[i];
+        auto predicate = [&a](const typename DimensionTraits<dimensions, T>::VectorType& min, const typename DimensionTraits<dimensions, T>::VectorType& max) {
+            return Implementation::boxesIntersect(a._absoluteMin, a._absoluteMax, min, max);
+        };
+
+        /* Report each pair only once, from the volume with lower node ID */
+        traverse(predicate, [&out, &a, &predicate](BoundingVolume<dimensions, T>& b) {
+            if(a._node < b._node && predicate(b._absoluteMin, b._absoluteMax))
+                out.emplace_back(&a, &b);
+        });
+    }
+
+    return out;
+}
+
+template<UnsignedInt dimensions, class T> T BoundingVolumeHierarchy<dimensions, T>::cost(const typename DimensionTraits<dimensions, T>::VectorType& min, const typename DimensionTraits<dimensions, T>::VectorType& max) {
+    /* Half of the perimeter in 2D, half of the surface area in 3D */
+    const typename DimensionTraits<dimensions, T>::VectorType size = max - min;
+    T out(0);
+    for(std::size_t i = 0; i != dimensions; ++i) {
+        T product(1);
+        for(std::size_t j = 0; j != dimensions; ++j)
+            if(i != j) product *= size[j];
+        out += product;
+    }
+    return out;
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolumeHierarchy<dimensions, T>::merge(Node& out, const Int a, const Int b) {
+    out.min = Math::min(_nodes[a].min, _nodes[b].min);
+    out.max = Math::max(_nodes[a].max, _nodes[b].max);
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolumeHierarchy<dimensions, T>::fixUpwards(Int index) {
+    while(index != -1) {
+        index = balance(index);
+
+        Node& node = _nodes[index];
+        node.height = 1 + std::max(_nodes[node.children[0]].height, _nodes[node.children[1]].height);
+        merge(node, node.children[0], node.children[1]);
+
+        index = node.parent;
+    }
+}
+
+template<UnsignedInt dimensions, class T> Int BoundingVolumeHierarchy<dimensions, T>::allocateNode() {
+    if(_freeList == -1) {
+        _nodes.push_back(Node());
+        _nodes.back().height = -1;
+        _freeList = _nodes.size() - 1;
+        _nodes.back().parent = -1;
+    }
+
+    const Int index = _freeList;
+    Node& node = _nodes[index];
+    _freeList = node.parent;
+    node.parent = node.children[0] = node.children[1] = -1;
+    node.height = 0;
+    node.volume = nullptr;
+    return index;
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolumeHierarchy<dimensions, T>::freeNode(const Int index) {
+    _nodes[index].parent = _freeList;
+    _nodes[index].height = -1;
+    _nodes[index].volume = nullptr;
+    _freeList = index;
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolumeHierarchy<dimensions, T>::insertLeaf(const Int leaf) {
+    if(_root == -1) {
+        _root = leaf;
+        _nodes[leaf].parent = -1;
+        return;
+    }
+
+    /* Find the best sibling using surface area heuristic */
+    Int index = _root;
+    while(_nodes[index].height != 0) {
+        const Node& node = _nodes[index];
+        const Node& leafNode = _nodes[leaf];
+
+        const T combinedCost = cost(Math::min(node.min, leafNode.min), Math::max(node.max, leafNode.max));
+
+        /* Cost of creating new parent for this node and the leaf */
+        const T costHere = T(2)*combinedCost;
+
+        /* Minimum cost of pushing the leaf further down the tree */
+        const T inheritanceCost = T(2)*(combinedCost - cost(node.min, node.max));
+
+        T childCost[2];
+        for(std::size_t i = 0; i != 2; ++i) {
+            const Node& child = _nodes[node.children[i]];
+            childCost[i] = cost(Math::min(child.min, leafNode.min), Math::max(child.max, leafNode.max)) + inheritanceCost;
+            if(child.height != 0) childCost[i] -= cost(child.min, child.max);
+        }
+
+        if(costHere < childCost[0] && costHere < childCost[1]) break;
+
+        index = node.children[childCost[0] < childCost[1] ? 0 : 1];
+    }
+
+    /* Create new parent (this might reallocate the node array) */
+    const Int sibling = index;
+    const Int oldParent = _nodes[sibling].parent;
+    const Int newParent = allocateNode();
+    _nodes[newParent].parent = oldParent;
+    _nodes[newParent].height = _nodes[sibling].height + 1;
+    merge(_nodes[newParent], sibling, leaf);
+    _nodes[newParent].children[0] = sibling;
+    _nodes[newParent].children[1] = leaf;
+    _nodes[sibling].parent = newParent;
+    _nodes[leaf].parent = newParent;
+
+    /* The sibling was not the root */
+    if(oldParent != -1) {
+        Node& parent = _nodes[oldParent];
+        parent.children[parent.children[0] == sibling ? 0 : 1] = newParent;
+    } else _root = newParent;
+
+    fixUpwards(newParent);
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolumeHierarchy<dimensions, T>::removeLeaf(const Int leaf) {
+    if(leaf == _root) {
+        _root = -1;
+        return;
+    }
+
+    const Int parent = _nodes[leaf].parent;
+    const Int grandParent = _nodes[parent].parent;
+    const Int sibling = _nodes[parent].children[_nodes[parent].children[0] == leaf ? 1 : 0];
+
+    /* Replace the parent with the sibling */
+    if(grandParent != -1) {
+        Node& grandParentNode = _nodes[grandParent];
+        grandParentNode.children[grandParentNode.children[0] == parent ? 0 : 1] = sibling;
+        _nodes[sibling].parent = grandParent;
+        freeNode(parent);
+        fixUpwards(grandParent);
+    } else {
+        _root = sibling;
+        _nodes[sibling].parent = -1;
+        freeNode(parent);
+    }
+}
+
+template<UnsignedInt dimensions, class T> Int BoundingVolumeHierarchy<dimensions, T>::balance(const Int a) {
+    Node& nodeA = _nodes[a];
+    if(nodeA.height < 2) return a;
+
+    const Int b = nodeA.children[0];
+    const Int c = nodeA.children[1];
+    const Int balance = _nodes[c].height - _nodes[b].height;
+
+    /* Rotate C up (or B up, which is the same with swapped sides) */
+    if(balance > 1 || balance < -1) {
+        /* Index of the child to rotate up and the other child */
+        const std::size_t up = balance > 1 ? 1 : 0;
+        const Int upper = nodeA.children[up];
+        const Int other = nodeA.children[1 - up];
+        Node& nodeUp = _nodes[upper];
+        const Int f = nodeUp.children[0];
+        const Int g = nodeUp.children[1];
+
+        /* Swap A and the upper node */
+        nodeUp.children[0] = a;
+        nodeUp.parent = nodeA.parent;
+        nodeA.parent = upper;
+
+        /* A's old parent should point to the upper node */
+        if(nodeUp.parent != -1) {
+            Node& parent = _nodes[nodeUp.parent];
+            parent.children[parent.children[0] == a ? 0 : 1] = upper;
+        } else _root = upper;
+
+        /* Keep the taller grandchild in the upper node, move the smaller to
+           A */
+        const Int taller = _nodes[f].height > _nodes[g].height ? f : g;
+        const Int smaller = taller == f ? g : f;
+        nodeUp.children[1] = taller;
+        nodeA.children[up] = smaller;
+        _nodes[smaller].parent = a;
+
+        merge(nodeA, other, smaller);
+        merge(nodeUp, a, taller);
+        nodeA.height = 1 + std::max(_nodes[other].height, _nodes[smaller].height);
+        nodeUp.height = 1 + std::max(nodeA.height, _nodes[taller].height);
+
+        return upper;
+    }
+
+    return a;
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolumeHierarchy<dimensions, T>::updateVolume(BoundingVolume<dimensions, T>& volume) {
+    /* Still inside the enlarged bounds, nothing to do */
+    if(volume._node != -1) {
+        const Node& node = _nodes[volume._node];
+        bool inside = true;
+        for(std::size_t i = 0; i != dimensions; ++i) if(volume._absoluteMin[i] < node.min[i] || volume._absoluteMax[i] > node.max[i]) {
+            inside = false;
+            break;
+        }
+        if(inside) return;
+
+        removeLeaf(volume._node);
+    } else volume._node = allocateNode();
+
+    /* (Re)insert the leaf with enlarged bounds */
+    Node& node = _nodes[volume._node];
+    node.min = volume._absoluteMin - typename DimensionTraits<dimensions, T>::VectorType(_margin);
+    node.max = volume._absoluteMax + typename DimensionTraits<dimensions, T>::VectorType(_margin);
+    node.volume = &volume;
+    node.height = 0;
+    insertLeaf(volume._node);
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolumeHierarchy<dimensions, T>::removeVolume(BoundingVolume<dimensions, T>& volume) {
+    if(volume._queued) {
+        _dirty.erase(std::find(_dirty.begin(), _dirty.end(), &volume));
+        volume._queued = false;
+    }
+    volume._dirty = false;
+
+    if(volume._node != -1) {
+        removeLeaf(volume._node);
+        freeNode(volume._node);
+        volume._node = -1;
+    }
+}
+
+}}
+
+#endif
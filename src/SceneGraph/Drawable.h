@@ -114,6 +114,33 @@ void MyApplication::drawEvent() {
 }
 @endcode
 
+@section Drawable-sorting Sorted drawing
+
+By default the drawables are drawn in the order in which they were added to
+the group, which might result in many redundant shader, texture and mesh
+changes. You can assign a @ref setSortKey() "sort key" to each drawable
+describing its state and let the camera sort the drawables before drawing
+using @ref AbstractCamera::setDrawOrder(). The key is an arbitrary 32-bit
+value, drawables with equal key are drawn one after another. Put the most
+expensive state change into the highest bits, for example:
+@code
+drawable->setSortKey(shaderId << 20|textureId << 10|meshId);
+@endcode
+
+For opaque objects use @ref DrawOrder::StateFrontToBack, which additionally
+sorts drawables with the same key front-to-back to reduce overdraw, for
+transparent objects use @ref DrawOrder::BackToFront, which sorts by depth first
+and uses the key only for drawables with the same depth.
+@code
+camera.setDrawOrder(SceneGraph::DrawOrder::StateFrontToBack)
+    .draw(phongObjects);
+
+Renderer::setFeature(Renderer::Feature::Blending, true);
+camera.setDrawOrder(SceneGraph::DrawOrder::BackToFront)
+    .draw(transparentObjects);
+Renderer::setFeature(Renderer::Feature::Blending, false);
+@endcode
+
 @see @ref scenegraph, @ref BasicDrawable2D, @ref BasicDrawable3D,
     @ref Drawable2D, @ref Drawable3D, @ref DrawableGroup
 */
@@ -127,7 +154,7 @@ template<UnsignedInt dimensions, class T> class Drawable: public AbstractGrouped
          * Adds the feature to the object and also to the group, if specified.
          * Otherwise you can use DrawableGroup::add().
          */
-        explicit Drawable(AbstractObject<dimensions, T>& object, DrawableGroup<dimensions, T>* drawables = nullptr): AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>(object, drawables) {}
+        explicit Drawable(AbstractObject<dimensions, T>& object, DrawableGroup<dimensions, T>* drawables = nullptr): AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>(object, drawables), _sortKey(0) {}
 
         /**
          * @brief Group containing this drawable
@@ -143,6 +170,23 @@ template<UnsignedInt dimensions, class T> class Drawable: public AbstractGrouped
             return AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>::group();
         }
 
+        /** @brief Sort key */
+        UnsignedInt sortKey() const { return _sortKey; }
+
+        /**
+         * @brief Set sort key
+         * @return Reference to self (for method chaining)
+         *
+         * The key is used for ordering the drawables if draw order other than
+         * @ref DrawOrder::Unsorted is set in the camera. Default is `0`. See
+         * @ref Drawable-sorting "class documentation" for more information.
+         * @see @ref AbstractCamera::setDrawOrder()
+         */
+        Drawable<dimensions, T>& setSortKey(UnsignedInt key) {
+            _sortKey = key;
+            return *this;
+        }
+
         /**
          * @brief Draw the object using given camera
          * @param transformationMatrix      %Object transformation relative
@@ -152,6 +196,9 @@ template<UnsignedInt dimensions, class T> class Drawable: public AbstractGrouped
          * Projection matrix can be retrieved from AbstractCamera::projectionMatrix().
          */
         virtual void draw(const typename DimensionTraits<dimensions, T>::MatrixType& transformationMatrix, AbstractCamera<dimensions, T>& camera) = 0;
+
+    private:
+        UnsignedInt _sortKey;
 };
 
 #ifndef CORRADE_GCC46_COMPATIBILITY
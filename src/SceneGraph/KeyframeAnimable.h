@@ -0,0 +1,156 @@
+#ifndef Magnum_SceneGraph_KeyframeAnimable_h
+#define Magnum_SceneGraph_KeyframeAnimable_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::SceneGraph::KeyframeAnimable
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "Math/Track.h"
+#include "SceneGraph/Animable.h"
+#include "SceneGraph/DualQuaternionTransformation.h"
+#include "SceneGraph/Object.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+    /* Matrix-based transformations */
+    template<class Transformation> struct KeyframeTransformation {
+        static void set(Object<Transformation>& object, const Math::Vector3<typename Transformation::Type>& translation, const Math::Quaternion<typename Transformation::Type>& rotation) {
+            object.setTransformation(Math::Matrix4<typename Transformation::Type>::from(rotation.toMatrix(), translation));
+        }
+    };
+
+    template<class T> struct KeyframeTransformation<BasicDualQuaternionTransformation<T>> {
+        static void set(Object<BasicDualQuaternionTransformation<T>>& object, const Math::Vector3<T>& translation, const Math::Quaternion<T>& rotation) {
+            object.setTransformation(Math::DualQuaternion<T>::translation(translation)*Math::DualQuaternion<T>(rotation));
+        }
+    };
+}
+
+/**
+@brief Keyframe animable
+@tparam Transformation  Transformation of animated objects
+
+Animates transformation of many objects (e.g. bones of a skeleton) using
+translation and rotation keyframe tracks. All tracks are sampled in a batch
+using @ref Math::sample() and the resulting transformations are set directly
+to the objects, so there is only one virtual @ref animationStep() call for the
+whole animation. Animation duration is set to end time of the longest track.
+@code
+typedef SceneGraph::Object<SceneGraph::DualQuaternionTransformation> Object3D;
+
+Object3D skeleton;
+Object3D* bones[]{...};
+
+SceneGraph::KeyframeAnimable<SceneGraph::DualQuaternionTransformation> animation(skeleton, &animables);
+for(std::size_t i = 0; i != boneCount; ++i)
+    animation.addChannel(*bones[i], translations[i], rotations[i]);
+animation.setRepeated(true)
+    .setState(SceneGraph::AnimationState::Running);
+@endcode
+
+Only three-dimensional transformations are supported. The transformation
+must be either @ref DualQuaternionTransformation or any transformation
+accepting @ref Matrix4 in `setTransformation()`.
+@see @ref Math::Track
+*/
+template<class Transformation> class KeyframeAnimable: public Animable<3, typename Transformation::Type> {
+    static_assert(Transformation::Dimensions == 3, "Only three-dimensional transformations are supported");
+
+    public:
+        /** @brief Underlying floating-point type */
+        typedef typename Transformation::Type Type;
+
+        /** @brief Translation track */
+        typedef Math::Track<Float, Math::Vector3<Type>> TranslationTrack;
+
+        /** @brief Rotation track */
+        typedef Math::Track<Float, Math::Quaternion<Type>> RotationTrack;
+
+        /**
+         * @brief Constructor
+         * @param object    %Object this animable belongs to
+         * @param group     Group this animable belongs to
+         *
+         * Creates animation without any channels.
+         * @see @ref addChannel()
+         */
+        explicit KeyframeAnimable(AbstractObject<3, Type>& object, AnimableGroup<3, Type>* group = nullptr): Animable<3, Type>(object, group) {}
+
+        /** @brief Count of animated objects */
+        std::size_t channelCount() const { return _objects.size(); }
+
+        /**
+         * @brief Add animation channel
+         * @param object        Animated object
+         * @param translation   Translation track
+         * @param rotation      Rotation track
+         * @return Reference to self (for method chaining)
+         *
+         * Both tracks must be non-empty, use track with one keyframe for
+         * constant translation or rotation. The animation duration is
+         * extended to end time of the tracks, if needed.
+         */
+        KeyframeAnimable<Transformation>& addChannel(Object<Transformation>& object, TranslationTrack translation, RotationTrack rotation) {
+            CORRADE_ASSERT(translation.size() && rotation.size(),
+                "SceneGraph::KeyframeAnimable::addChannel(): the tracks must not be empty", *this);
+
+            this->setDuration(std::max({this->duration(), translation.endTime(), rotation.endTime()}));
+            _objects.push_back(&object);
+            _translations.push_back(std::move(translation));
+            _rotations.push_back(std::move(rotation));
+            _translationHints.push_back(0);
+            _rotationHints.push_back(0);
+            _translationValues.emplace_back();
+            _rotationValues.emplace_back();
+            return *this;
+        }
+
+    protected:
+        void animationStep(Float time, Float) override {
+            const std::size_t count = _objects.size();
+            Math::sample(_translations.data(), count, time, _translationHints.data(), _translationValues.data());
+            Math::sample(_rotations.data(), count, time, _rotationHints.data(), _rotationValues.data());
+
+            for(std::size_t i = 0; i != count; ++i)
+                Implementation::KeyframeTransformation<Transformation>::set(*_objects[i], _translationValues[i], _rotationValues[i]);
+        }
+
+    private:
+        std::vector<Object<Transformation>*> _objects;
+        std::vector<TranslationTrack> _translations;
+        std::vector<RotationTrack> _rotations;
+        std::vector<std::size_t> _translationHints, _rotationHints;
+        std::vector<Math::Vector3<Type>> _translationValues;
+        std::vector<Math::Quaternion<Type>> _rotationValues;
+};
+
+}}
+
+#endif
@@ -35,6 +35,7 @@
 namespace Magnum { namespace SceneGraph {
 
 enum class AspectRatioPolicy: UnsignedByte;
+enum class DrawOrder: UnsignedByte;
 
 template<UnsignedInt, class> class AbstractCamera;
 #ifndef CORRADE_GCC46_COMPATIBILITY
@@ -139,6 +140,28 @@ typedef AnimableGroup<2, Float> AnimableGroup2D;
 typedef AnimableGroup<3, Float> AnimableGroup3D;
 #endif
 
+template<UnsignedInt, class> class BoundingVolume;
+#ifndef CORRADE_GCC46_COMPATIBILITY
+template<class T> using BasicBoundingVolume2D = BoundingVolume<2, T>;
+template<class T> using BasicBoundingVolume3D = BoundingVolume<3, T>;
+typedef BasicBoundingVolume2D<Float> BoundingVolume2D;
+typedef BasicBoundingVolume3D<Float> BoundingVolume3D;
+#else
+typedef BoundingVolume<2, Float> BoundingVolume2D;
+typedef BoundingVolume<3, Float> BoundingVolume3D;
+#endif
+
+template<UnsignedInt, class> class BoundingVolumeHierarchy;
+#ifndef CORRADE_GCC46_COMPATIBILITY
+template<class T> using BasicBoundingVolumeHierarchy2D = BoundingVolumeHierarchy<2, T>;
+template<class T> using BasicBoundingVolumeHierarchy3D = BoundingVolumeHierarchy<3, T>;
+typedef BasicBoundingVolumeHierarchy2D<Float> BoundingVolumeHierarchy2D;
+typedef BasicBoundingVolumeHierarchy3D<Float> BoundingVolumeHierarchy3D;
+#else
+typedef BoundingVolumeHierarchy<2, Float> BoundingVolumeHierarchy2D;
+typedef BoundingVolumeHierarchy<3, Float> BoundingVolumeHierarchy3D;
+#endif
+
 template<class> class BasicCamera2D;
 template<class> class BasicCamera3D;
 typedef BasicCamera2D<Float> Camera2D;
@@ -177,6 +200,8 @@ typedef DrawableGroup<2, Float> DrawableGroup2D;
 typedef DrawableGroup<3, Float> DrawableGroup3D;
 #endif
 
+template<class> class KeyframeAnimable;
+
 template<class> class BasicMatrixTransformation2D;
 template<class> class BasicMatrixTransformation3D;
 typedef BasicMatrixTransformation2D<Float> MatrixTransformation2D;
@@ -41,6 +41,12 @@ class AnimableTest: public TestSuite::Tester {
         void repeat();
         void stop();
         void pause();
+        void moveToAnotherGroup();
+        void deleteFromCallback();
+        void deleteFromStoppedCallback();
+        void deleteGroup();
+        void batchStep();
+        void threads();
 
         void debug();
 };
@@ -54,6 +60,12 @@ AnimableTest::AnimableTest() {
               &AnimableTest::repeat,
               &AnimableTest::stop,
               &AnimableTest::pause,
+              &AnimableTest::moveToAnotherGroup,
+              &AnimableTest::deleteFromCallback,
+              &AnimableTest::deleteFromStoppedCallback,
+              &AnimableTest::deleteGroup,
+              &AnimableTest::batchStep,
+              &AnimableTest::threads,
 
               &AnimableTest::debug});
 }
@@ -351,6 +363,210 @@ void AnimableTest::pause() {
     CORRADE_COMPARE(animable.time, 2.0f);
 }
 
+void AnimableTest::moveToAnotherGroup() {
+    Object3D object;
+    AnimableGroup3D group;
+    OneShotAnimable animable(object, &group);
+    group.step(1.0f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 1);
+
+    /* The animation should continue running in the other group */
+    AnimableGroup3D another;
+    another.add(animable);
+    CORRADE_COMPARE(group.runningCount(), 0);
+    CORRADE_COMPARE(another.runningCount(), 1);
+    another.step(2.5f, 0.5f);
+    CORRADE_COMPARE(animable.stateChanges, "started;");
+    CORRADE_COMPARE(animable.time, 1.5f);
+
+    /* Pending state change should be moved too */
+    animable.setState(AnimationState::Stopped);
+    group.add(animable);
+    CORRADE_COMPARE(another.runningCount(), 0);
+    another.step(3.0f, 0.5f);
+    CORRADE_COMPARE(animable.stateChanges, "started;");
+    group.step(3.0f, 0.5f);
+    CORRADE_COMPARE(animable.stateChanges, "started;stopped;");
+    CORRADE_COMPARE(group.runningCount(), 0);
+
+    /* Deleting running animable should remove it from running ones */
+    auto a = new OneShotAnimable(object, &group);
+    new OneShotAnimable(object, &group);
+    group.step(4.0f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 2);
+    delete a;
+    CORRADE_COMPARE(group.runningCount(), 1);
+}
+
+void AnimableTest::deleteFromCallback() {
+    class DeletingAnimable: public SceneGraph::Animable3D {
+        public:
+            DeletingAnimable(AbstractObject3D& object, AnimableGroup3D* group = nullptr): SceneGraph::Animable3D(object, group), other(nullptr) {
+                setState(AnimationState::Running);
+            }
+
+            SceneGraph::Animable3D* other;
+
+        protected:
+            void animationStarted() override {
+                delete other;
+                other = nullptr;
+            }
+
+            void animationStep(Float, Float) override {}
+    };
+
+    Object3D object;
+    AnimableGroup3D group;
+
+    /* Both animables have pending state change, the second one is deleted
+       when the change of the first one is processed */
+    auto a = new DeletingAnimable(object, &group);
+    a->other = new DeletingAnimable(object, &group);
+    group.step(1.0f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 1);
+    CORRADE_COMPARE(group.size(), 1);
+}
+
+void AnimableTest::deleteFromStoppedCallback() {
+    class StoppingAnimable: public SceneGraph::Animable3D {
+        public:
+            StoppingAnimable(AbstractObject3D& object, AnimableGroup3D* group, Float duration): SceneGraph::Animable3D(object, group), other(nullptr), stopped(false) {
+                setDuration(duration);
+                setState(AnimationState::Running);
+            }
+
+            SceneGraph::Animable3D* other;
+            bool stopped;
+
+        protected:
+            void animationStopped() override {
+                stopped = true;
+                delete other;
+                other = nullptr;
+            }
+
+            void animationStep(Float, Float) override {}
+    };
+
+    Object3D object;
+    AnimableGroup3D group;
+
+    /* Running animables are in order b, a, c, d */
+    auto b = new StoppingAnimable(object, &group, 10.0f);
+    auto a = new StoppingAnimable(object, &group, 1.0f);
+    auto c = new StoppingAnimable(object, &group, 1.0f);
+    auto d = new StoppingAnimable(object, &group, 10.0f);
+    a->other = b;
+    group.step(0.0f, 0.0f);
+    CORRADE_COMPARE(group.runningCount(), 4);
+
+    /* Deleting already processed b from the callback mustn't cause c to be
+       skipped */
+    group.step(2.0f, 0.5f);
+    CORRADE_VERIFY(a->stopped);
+    CORRADE_VERIFY(c->stopped);
+    CORRADE_VERIFY(!d->stopped);
+    CORRADE_COMPARE(group.size(), 3);
+    CORRADE_COMPARE(group.runningCount(), 1);
+}
+
+namespace {
+    class CountingAnimable: public SceneGraph::Animable3D {
+        public:
+            CountingAnimable(AbstractObject3D& object, AnimableGroup3D* group = nullptr): SceneGraph::Animable3D(object, group), time(-1.0f), steps(0) {
+                setDuration(10.0f);
+                setState(AnimationState::Running);
+            }
+
+            Float time;
+            Int steps;
+
+            static void batchStep(Animable3D* const* animables, const Float* times, std::size_t count, Float) {
+                for(std::size_t i = 0; i != count; ++i) {
+                    CountingAnimable& animable = static_cast<CountingAnimable&>(*animables[i]);
+                    animable.time = times[i];
+                    animable.steps += 100;
+                }
+            }
+
+        protected:
+            void animationStep(Float time, Float) override {
+                this->time = time;
+                ++steps;
+            }
+    };
+}
+
+void AnimableTest::batchStep() {
+    Object3D object;
+    AnimableGroup3D group;
+    group.setBatchStep(CountingAnimable::batchStep);
+    CountingAnimable a(object, &group);
+    CountingAnimable b(object, &group);
+    group.step(1.0f, 0.5f);
+    b.setState(AnimationState::Paused);
+    group.step(2.5f, 0.5f);
+
+    /* Virtual function shouldn't be called */
+    CORRADE_COMPARE(a.steps, 200);
+    CORRADE_COMPARE(a.time, 1.5f);
+    CORRADE_COMPARE(b.steps, 100);
+    CORRADE_COMPARE(b.time, 0.0f);
+
+    /* Back to virtual function */
+    group.setBatchStep(nullptr);
+    group.step(3.0f, 0.5f);
+    CORRADE_COMPARE(a.steps, 201);
+    CORRADE_COMPARE(a.time, 2.0f);
+}
+
+void AnimableTest::threads() {
+    Object3D object;
+    AnimableGroup3D group;
+    group.setThreadCount(3);
+    CORRADE_COMPARE(group.threadCount(), 3);
+
+    std::vector<CountingAnimable*> animables;
+    for(std::size_t i = 0; i != 100; ++i)
+        animables.push_back(new CountingAnimable(object, &group));
+
+    /* Stop some of them to have non-uniform distribution */
+    for(std::size_t i = 0; i < 100; i += 7)
+        animables[i]->setState(AnimationState::Stopped);
+
+    group.step(1.0f, 0.5f);
+    group.step(3.0f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 85);
+    for(std::size_t i = 0; i != 100; ++i) {
+        CORRADE_COMPARE(animables[i]->steps, i % 7 ? 2 : 0);
+        CORRADE_COMPARE(animables[i]->time, i % 7 ? 2.0f : -1.0f);
+    }
+}
+
+void AnimableTest::deleteGroup() {
+    Object3D object;
+    auto group = new AnimableGroup3D;
+
+    /* One animable with pending state change, one already running */
+    auto a = new CountingAnimable(object, group);
+    group->step(1.0f, 0.5f);
+    auto b = new CountingAnimable(object, group);
+    delete group;
+    CORRADE_VERIFY(!a->animables());
+    CORRADE_VERIFY(!b->animables());
+
+    /* Both animables continue in another group */
+    AnimableGroup3D another;
+    another.add(*a);
+    another.add(*b);
+    another.step(2.0f, 0.5f);
+    another.step(3.0f, 0.5f);
+    CORRADE_COMPARE(another.runningCount(), 2);
+    CORRADE_COMPARE(a->steps, 3);
+    CORRADE_COMPARE(b->steps, 2);
+}
+
 void AnimableTest::debug() {
     std::ostringstream o;
     Debug(&o) << AnimationState::Running;
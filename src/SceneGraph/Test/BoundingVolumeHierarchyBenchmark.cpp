@@ -0,0 +1,136 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+
+#include "SceneGraph/BoundingVolume.h"
+#include "SceneGraph/BoundingVolumeHierarchy.h"
+#include "SceneGraph/MatrixTransformation3D.h"
+#include "SceneGraph/Scene.h"
+#include "Test/Benchmark.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+namespace {
+    constexpr std::size_t Count = 2000;
+
+    bool boxesIntersect(const Vector3& aMin, const Vector3& aMax, const Vector3& bMin, const Vector3& bMax) {
+        for(std::size_t i = 0; i != 3; ++i)
+            if(aMax[i] < bMin[i] || aMin[i] > bMax[i]) return false;
+        return true;
+    }
+
+    bool rayIntersects(const Vector3& origin, const Vector3& direction, const Vector3& min, const Vector3& max) {
+        Float near = 0.0f, far = std::numeric_limits<Float>::infinity();
+        for(std::size_t i = 0; i != 3; ++i) {
+            if(direction[i] == 0.0f) {
+                if(origin[i] < min[i] || origin[i] > max[i]) return false;
+                continue;
+            }
+
+            Float t1 = (min[i] - origin[i])/direction[i];
+            Float t2 = (max[i] - origin[i])/direction[i];
+            if(t1 > t2) std::swap(t1, t2);
+            near = std::max(near, t1);
+            far = std::min(far, t2);
+            if(near > far) return false;
+        }
+        return true;
+    }
+}
+
+}}}
+
+int main() {
+    using namespace Magnum;
+    using namespace Magnum::SceneGraph::Test;
+
+    /* Unit cubes randomly scattered in 100x100x100 area */
+    Scene3D scene;
+    std::mt19937 random(3);
+    std::uniform_real_distribution<Float> position(-50.0f, 50.0f);
+    std::vector<Object3D*> objects;
+    std::vector<SceneGraph::BoundingVolume3D*> volumes;
+    for(std::size_t i = 0; i != Count; ++i) {
+        Object3D* o = new Object3D(&scene);
+        o->translate({position(random), position(random), position(random)});
+        objects.push_back(o);
+        volumes.push_back(&(new SceneGraph::BoundingVolume3D(*o))->setBounds(Vector3(-0.5f), Vector3(0.5f)));
+    }
+
+    Magnum::Test::Benchmark benchmark(10, 5);
+
+    /* Building the whole hierarchy from scratch */
+    benchmark.print("BoundingVolumeHierarchy insert", [&]() {
+        SceneGraph::BoundingVolumeHierarchy3D hierarchy;
+        for(SceneGraph::BoundingVolume3D* volume: volumes) hierarchy.add(*volume);
+        hierarchy.update();
+        return Float(hierarchy.height());
+    });
+
+    SceneGraph::BoundingVolumeHierarchy3D hierarchy;
+    hierarchy.setMargin(0.1f);
+    for(SceneGraph::BoundingVolume3D* volume: volumes) hierarchy.add(*volume);
+    hierarchy.update();
+
+    /* Every tenth object moving back and forth, only some of them escape the
+       margin and are reinserted */
+    Float step = 0.15f;
+    benchmark.print("BoundingVolumeHierarchy update", [&]() {
+        step = -step;
+        for(std::size_t i = 0; i < Count; i += 10)
+            objects[i]->translate(Vector3(step, 0.0f, 0.0f)*Float(i%3));
+        hierarchy.update();
+        return Float(hierarchy.height());
+    });
+
+    /* Queries compared to testing all volumes */
+    const Vector3 boxMin(-10.0f), boxMax(10.0f);
+    benchmark.compare("BoundingVolumeHierarchy box query", [&]() {
+        std::size_t count = 0;
+        for(SceneGraph::BoundingVolume3D* volume: volumes)
+            if(boxesIntersect(volume->absoluteMin(), volume->absoluteMax(), boxMin, boxMax)) ++count;
+        return Float(count);
+    }, [&]() {
+        return Float(hierarchy.queryBox(boxMin, boxMax).size());
+    });
+
+    const Vector3 origin(-60.0f, 0.0f, 0.0f);
+    const Vector3 direction = Vector3(1.0f, 0.1f, 0.05f).normalized();
+    benchmark.compare("BoundingVolumeHierarchy raycast", [&]() {
+        std::size_t count = 0;
+        for(SceneGraph::BoundingVolume3D* volume: volumes)
+            if(rayIntersects(origin, direction, volume->absoluteMin(), volume->absoluteMax())) ++count;
+        return Float(count);
+    }, [&]() {
+        return Float(hierarchy.raycast(origin, direction).size());
+    });
+}
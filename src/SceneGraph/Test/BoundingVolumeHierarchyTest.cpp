@@ -0,0 +1,281 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <TestSuite/Tester.h>
+
+#include "SceneGraph/BoundingVolume.h"
+#include "SceneGraph/BoundingVolumeHierarchy.h"
+#include "SceneGraph/Camera3D.h"
+#include "SceneGraph/MatrixTransformation2D.h"
+#include "SceneGraph/MatrixTransformation3D.h"
+#include "SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+class BoundingVolumeHierarchyTest: public TestSuite::Tester {
+    public:
+        BoundingVolumeHierarchyTest();
+
+        void absoluteBounds();
+        void queryBox();
+        void querySphere();
+        void queryFrustum();
+        void raycast();
+        void sphereCast();
+        void overlappingPairs();
+        void move();
+        void remove();
+        void removeCleaned();
+        void balanced();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Object2D;
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+BoundingVolumeHierarchyTest::BoundingVolumeHierarchyTest() {
+    addTests({&BoundingVolumeHierarchyTest::absoluteBounds,
+              &BoundingVolumeHierarchyTest::queryBox,
+              &BoundingVolumeHierarchyTest::querySphere,
+              &BoundingVolumeHierarchyTest::queryFrustum,
+              &BoundingVolumeHierarchyTest::raycast,
+              &BoundingVolumeHierarchyTest::sphereCast,
+              &BoundingVolumeHierarchyTest::overlappingPairs,
+              &BoundingVolumeHierarchyTest::move,
+              &BoundingVolumeHierarchyTest::remove,
+              &BoundingVolumeHierarchyTest::removeCleaned,
+              &BoundingVolumeHierarchyTest::balanced});
+}
+
+namespace {
+    std::vector<Object3D*> grid(Scene3D& scene, BoundingVolumeHierarchy3D& hierarchy) {
+        /* 3x3 grid of unit cubes in XY plane, two units apart */
+        std::vector<Object3D*> objects;
+        for(Int y = 0; y != 3; ++y) for(Int x = 0; x != 3; ++x) {
+            Object3D* o = new Object3D(&scene);
+            o->translate(Vector3(x*2.0f, y*2.0f, 0.0f));
+            (new BoundingVolume3D(*o, &hierarchy))->setBounds(Vector3(-0.5f), Vector3(0.5f));
+            objects.push_back(o);
+        }
+        return objects;
+    }
+
+    std::vector<Object3D*> objects(const std::vector<BoundingVolume3D*>& volumes) {
+        std::vector<Object3D*> out;
+        for(BoundingVolume3D* volume: volumes)
+            out.push_back(static_cast<Object3D*>(&volume->object()));
+        std::sort(out.begin(), out.end());
+        return out;
+    }
+}
+
+void BoundingVolumeHierarchyTest::absoluteBounds() {
+    Object2D o;
+    o.rotate(Deg(90.0f))
+     .translate(Vector2(1.0f, 2.0f));
+
+    BoundingVolumeHierarchy2D hierarchy;
+    BoundingVolume2D volume(o, &hierarchy);
+    volume.setBounds(Vector2(0.0f, -1.0f), Vector2(3.0f, 1.0f));
+    hierarchy.update();
+
+    CORRADE_COMPARE(volume.absoluteMin(), Vector2(0.0f, 2.0f));
+    CORRADE_COMPARE(volume.absoluteMax(), Vector2(2.0f, 5.0f));
+}
+
+void BoundingVolumeHierarchyTest::queryBox() {
+    Scene3D scene;
+    BoundingVolumeHierarchy3D hierarchy;
+    std::vector<Object3D*> o = grid(scene, hierarchy);
+
+    std::vector<Object3D*> expected{o[4], o[5]};
+    std::sort(expected.begin(), expected.end());
+    CORRADE_COMPARE(objects(hierarchy.queryBox(Vector3(1.75f, 1.75f, -1.0f), Vector3(4.0f, 2.25f, 1.0f))), expected);
+    CORRADE_VERIFY(hierarchy.queryBox(Vector3(0.75f, 0.75f, -1.0f), Vector3(1.25f, 1.25f, 1.0f)).empty());
+}
+
+void BoundingVolumeHierarchyTest::querySphere() {
+    Scene3D scene;
+    BoundingVolumeHierarchy3D hierarchy;
+    std::vector<Object3D*> o = grid(scene, hierarchy);
+
+    /* Touches the four cubes around, but not the corners of the others */
+    std::vector<Object3D*> expected{o[0], o[1], o[3], o[4]};
+    std::sort(expected.begin(), expected.end());
+    CORRADE_COMPARE(objects(hierarchy.querySphere(Vector3(1.0f, 1.0f, 0.0f), 0.75f)), expected);
+}
+
+void BoundingVolumeHierarchyTest::queryFrustum() {
+    Scene3D scene;
+    BoundingVolumeHierarchy3D hierarchy;
+    std::vector<Object3D*> o = grid(scene, hierarchy);
+
+    /* Orthographic camera looking at the first row only */
+    Object3D cameraObject(&scene);
+    cameraObject.translate(Vector3(2.0f, 0.0f, 5.0f));
+    Camera3D camera(cameraObject);
+    camera.setOrthographic(Vector2(5.0f, 1.5f), 1.0f, 10.0f);
+
+    std::vector<Object3D*> expected{o[0], o[1], o[2]};
+    std::sort(expected.begin(), expected.end());
+    CORRADE_COMPARE(objects(hierarchy.visible(camera)), expected);
+}
+
+void BoundingVolumeHierarchyTest::raycast() {
+    Scene3D scene;
+    BoundingVolumeHierarchy3D hierarchy;
+    std::vector<Object3D*> o = grid(scene, hierarchy);
+
+    std::vector<std::pair<Float, BoundingVolume3D*>> hits = hierarchy.raycast(Vector3(-2.0f, 2.0f, 0.0f), Vector3::xAxis());
+    CORRADE_COMPARE(hits.size(), 3);
+    CORRADE_COMPARE(hits[0].first, 1.5f);
+    CORRADE_COMPARE(&hits[0].second->object(), o[3]);
+    CORRADE_COMPARE(hits[1].first, 3.5f);
+    CORRADE_COMPARE(&hits[1].second->object(), o[4]);
+    CORRADE_COMPARE(hits[2].first, 5.5f);
+    CORRADE_COMPARE(&hits[2].second->object(), o[5]);
+
+    /* Limited distance */
+    CORRADE_COMPARE(hierarchy.raycast(Vector3(-2.0f, 2.0f, 0.0f), Vector3::xAxis(), 2.0f).size(), 1);
+
+    /* Between the cubes */
+    CORRADE_VERIFY(hierarchy.raycast(Vector3(-2.0f, 1.0f, 0.0f), Vector3::xAxis()).empty());
+}
+
+void BoundingVolumeHierarchyTest::sphereCast() {
+    Scene3D scene;
+    BoundingVolumeHierarchy3D hierarchy;
+    std::vector<Object3D*> o = grid(scene, hierarchy);
+
+    /* Small sphere passes between the cubes */
+    CORRADE_VERIFY(hierarchy.sphereCast(Vector3(-2.0f, 1.0f, 0.0f), Vector3::xAxis(), 0.25f).empty());
+
+    /* Large sphere touches both rows */
+    std::vector<std::pair<Float, BoundingVolume3D*>> hits = hierarchy.sphereCast(Vector3(-2.0f, 1.0f, 0.0f), Vector3::xAxis(), 0.75f);
+    CORRADE_COMPARE(hits.size(), 6);
+    CORRADE_COMPARE(hits[0].first, 0.75f);
+    CORRADE_COMPARE(hits[1].first, 0.75f);
+    CORRADE_COMPARE(hits[5].first, 4.75f);
+
+    /* Zero radius is the same as raycast */
+    CORRADE_COMPARE(hierarchy.sphereCast(Vector3(-2.0f, 2.0f, 0.0f), Vector3::xAxis(), 0.0f).size(), 3);
+}
+
+void BoundingVolumeHierarchyTest::overlappingPairs() {
+    Scene3D scene;
+    BoundingVolumeHierarchy3D hierarchy;
+    std::vector<Object3D*> o = grid(scene, hierarchy);
+    CORRADE_VERIFY(hierarchy.overlappingPairs().empty());
+
+    o[4]->translate(Vector3(1.25f, 0.0f, 0.0f));
+    auto pairs = hierarchy.overlappingPairs();
+    CORRADE_COMPARE(pairs.size(), 1);
+    std::vector<Object3D*> pair{static_cast<Object3D*>(&pairs[0].first->object()),
+                                static_cast<Object3D*>(&pairs[0].second->object())};
+    std::vector<Object3D*> expected{o[4], o[5]};
+    std::sort(pair.begin(), pair.end());
+    std::sort(expected.begin(), expected.end());
+    CORRADE_COMPARE(pair, expected);
+}
+
+void BoundingVolumeHierarchyTest::move() {
+    Scene3D scene;
+    BoundingVolumeHierarchy3D hierarchy;
+    hierarchy.setMargin(0.25f);
+    std::vector<Object3D*> o = grid(scene, hierarchy);
+
+    /* Small move inside the margin, the query must use tight bounds */
+    o[0]->translate(Vector3(0.1f, 0.0f, 0.0f));
+    CORRADE_VERIFY(hierarchy.queryBox(Vector3(-0.5f, -0.5f, -1.0f), Vector3(-0.45f, 0.5f, 1.0f)).empty());
+
+    /* Large move */
+    o[0]->translate(Vector3(10.0f, 10.0f, 0.0f));
+    std::vector<Object3D*> expected{o[0]};
+    CORRADE_COMPARE(objects(hierarchy.queryBox(Vector3(10.0f, 10.0f, -1.0f), Vector3(11.0f, 11.0f, 1.0f))), expected);
+    CORRADE_VERIFY(hierarchy.queryBox(Vector3(-0.5f, -0.5f, -1.0f), Vector3(0.5f, 0.5f, 1.0f)).empty());
+
+    /* Changed bounds */
+    hierarchy[0].setBounds(Vector3(-5.0f), Vector3(-4.0f));
+    CORRADE_COMPARE(objects(hierarchy.queryBox(Vector3(5.5f, 5.5f, -4.5f), Vector3(6.5f, 6.5f, -4.5f))), expected);
+}
+
+void BoundingVolumeHierarchyTest::remove() {
+    Scene3D scene;
+    BoundingVolumeHierarchy3D hierarchy;
+    std::vector<Object3D*> o = grid(scene, hierarchy);
+
+    /* Removing by deleting the object */
+    delete o[4];
+    CORRADE_COMPARE(hierarchy.size(), 8);
+    CORRADE_VERIFY(hierarchy.querySphere(Vector3(2.0f, 2.0f, 0.0f), 0.5f).empty());
+
+    /* Moving to another hierarchy */
+    BoundingVolumeHierarchy3D another;
+    another.add(hierarchy[0]);
+    CORRADE_COMPARE(hierarchy.size(), 7);
+    CORRADE_COMPARE(another.size(), 1);
+    CORRADE_COMPARE(hierarchy.queryBox(Vector3(-10.0f), Vector3(10.0f)).size(), 7);
+    CORRADE_COMPARE(another.queryBox(Vector3(-10.0f), Vector3(10.0f)).size(), 1);
+}
+
+void BoundingVolumeHierarchyTest::removeCleaned() {
+    Scene3D scene;
+    BoundingVolumeHierarchy3D hierarchy;
+    std::vector<Object3D*> o = grid(scene, hierarchy);
+    hierarchy.update();
+
+    /* Cleaned outside of update(), while still queued, then dirtied again */
+    o[4]->translate(Vector3(1.0f, 0.0f, 0.0f));
+    o[4]->setClean();
+    o[4]->translate(Vector3(1.0f, 0.0f, 0.0f));
+    o[4]->setClean();
+
+    /* The volume must not stay queued after deletion */
+    delete o[4];
+    hierarchy.update();
+    CORRADE_COMPARE(hierarchy.size(), 8);
+    CORRADE_COMPARE(hierarchy.queryBox(Vector3(-10.0f), Vector3(10.0f)).size(), 8);
+}
+
+void BoundingVolumeHierarchyTest::balanced() {
+    Scene3D scene;
+    BoundingVolumeHierarchy3D hierarchy;
+
+    /* Inserting sorted data would create degenerate tree without balancing */
+    for(Int i = 0; i != 1024; ++i) {
+        Object3D* o = new Object3D(&scene);
+        o->translate(Vector3::xAxis(i*2.0f));
+        (new BoundingVolume3D(*o, &hierarchy))->setBounds(Vector3(-0.5f), Vector3(0.5f));
+    }
+
+    hierarchy.update();
+    CORRADE_VERIFY(hierarchy.height() <= 20);
+    CORRADE_COMPARE(hierarchy.queryBox(Vector3(99.0f), Vector3(101.0f)).size(), 0);
+    CORRADE_COMPARE(hierarchy.queryBox(Vector3(99.0f, -1.0f, -1.0f), Vector3(101.0f, 1.0f, 1.0f)).size(), 1);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::BoundingVolumeHierarchyTest)
@@ -46,6 +46,9 @@ class CameraTest: public TestSuite::Tester {
         void projectionSizePerspective();
         void projectionSizeViewport();
         void draw();
+        void drawOrderStateFrontToBack();
+        void drawOrderBackToFront();
+        void sortDrawOrder();
 };
 
 typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Object2D;
@@ -60,7 +63,10 @@ CameraTest::CameraTest() {
               &CameraTest::projectionSizeOrthographic,
               &CameraTest::projectionSizePerspective,
               &CameraTest::projectionSizeViewport,
-              &CameraTest::draw});
+              &CameraTest::draw,
+              &CameraTest::drawOrderStateFrontToBack,
+              &CameraTest::drawOrderBackToFront,
+              &CameraTest::sortDrawOrder});
 }
 
 void CameraTest::fixAspectRatio() {
@@ -195,6 +201,103 @@ void CameraTest::draw() {
     CORRADE_COMPARE(thirdTransformation, Matrix4());
 }
 
+namespace {
+    class OrderedDrawable: public SceneGraph::Drawable3D {
+        public:
+            OrderedDrawable(AbstractObject3D& object, DrawableGroup3D* group, Int id, std::vector<Int>& order): SceneGraph::Drawable3D(object, group), id(id), order(order) {}
+
+        protected:
+            void draw(const Matrix4&, AbstractCamera3D&) override {
+                order.push_back(id);
+            }
+
+        private:
+            Int id;
+            std::vector<Int>& order;
+    };
+}
+
+void CameraTest::drawOrderStateFrontToBack() {
+    DrawableGroup3D group;
+    Scene3D scene;
+    std::vector<Int> order;
+
+    Object3D a(&scene);
+    a.translate(Vector3::zAxis(-5.0f));
+    (new OrderedDrawable(a, &group, 0, order))->setSortKey(2);
+
+    Object3D b(&scene);
+    b.translate(Vector3::zAxis(-1.0f));
+    (new OrderedDrawable(b, &group, 1, order))->setSortKey(7);
+
+    Object3D c(&scene);
+    c.translate(Vector3::zAxis(-3.0f));
+    (new OrderedDrawable(c, &group, 2, order))->setSortKey(2);
+
+    Object3D d(&scene);
+    d.translate(Vector3::zAxis(2.0f));
+    (new OrderedDrawable(d, &group, 3, order))->setSortKey(7);
+
+    Object3D cameraObject(&scene);
+    Camera3D camera(cameraObject);
+
+    /* Insertion order by default */
+    CORRADE_VERIFY(camera.drawOrder() == DrawOrder::Unsorted);
+    camera.draw(group);
+    CORRADE_COMPARE(order, (std::vector<Int>{0, 1, 2, 3}));
+
+    /* Sorted by key, then front-to-back (the last one is behind the camera) */
+    order.clear();
+    camera.setDrawOrder(DrawOrder::StateFrontToBack).draw(group);
+    CORRADE_COMPARE(order, (std::vector<Int>{2, 0, 3, 1}));
+}
+
+void CameraTest::drawOrderBackToFront() {
+    DrawableGroup3D group;
+    Scene3D scene;
+    std::vector<Int> order;
+
+    Object3D a(&scene);
+    a.translate(Vector3::zAxis(-1.0f));
+    (new OrderedDrawable(a, &group, 0, order))->setSortKey(1);
+
+    Object3D b(&scene);
+    b.translate(Vector3::zAxis(-4.0f));
+    (new OrderedDrawable(b, &group, 1, order))->setSortKey(5);
+
+    Object3D c(&scene);
+    c.translate(Vector3::zAxis(-4.0f));
+    (new OrderedDrawable(c, &group, 2, order))->setSortKey(3);
+
+    Object3D d(&scene);
+    d.translate(Vector3::zAxis(-2.5f));
+    new OrderedDrawable(d, &group, 3, order);
+
+    Object3D cameraObject(&scene);
+    cameraObject.translate(Vector3::zAxis(0.5f));
+    Camera3D camera(cameraObject);
+
+    /* Sorted back-to-front, same depth by key */
+    camera.setDrawOrder(DrawOrder::BackToFront).draw(group);
+    CORRADE_COMPARE(order, (std::vector<Int>{2, 1, 3, 0}));
+}
+
+void CameraTest::sortDrawOrder() {
+    /* Depth key preserves ordering */
+    CORRADE_VERIFY(Implementation::depthSortKey(-100.0f) < Implementation::depthSortKey(-2.5f));
+    CORRADE_VERIFY(Implementation::depthSortKey(-2.5f) < Implementation::depthSortKey(0.0f));
+    CORRADE_VERIFY(Implementation::depthSortKey(0.0f) < Implementation::depthSortKey(0.001f));
+    CORRADE_VERIFY(Implementation::depthSortKey(0.001f) < Implementation::depthSortKey(1.0f));
+    CORRADE_VERIFY(Implementation::depthSortKey(1.0f) < Implementation::depthSortKey(1.0e10f));
+
+    /* Sorting is stable and handles all bytes */
+    std::vector<UnsignedLong> keys{0x0100000000000003ull, 5, 0x0100000000000003ull, 0x300, 5, 0};
+    std::vector<UnsignedInt> indices{0, 1, 2, 3, 4, 5};
+    Implementation::sortDrawOrder(keys, indices);
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{5, 1, 4, 3, 0, 2}));
+    CORRADE_COMPARE(keys, (std::vector<UnsignedLong>{0, 5, 5, 0x300, 0x0100000000000003ull, 0x0100000000000003ull}));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::CameraTest)
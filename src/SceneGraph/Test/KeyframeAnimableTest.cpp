@@ -0,0 +1,107 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <TestSuite/Tester.h>
+
+#include "SceneGraph/AnimableGroup.h"
+#include "SceneGraph/KeyframeAnimable.h"
+#include "SceneGraph/MatrixTransformation3D.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+class KeyframeAnimableTest: public TestSuite::Tester {
+    public:
+        KeyframeAnimableTest();
+
+        void addChannel();
+        void matrix();
+        void dualQuaternion();
+};
+
+KeyframeAnimableTest::KeyframeAnimableTest() {
+    addTests({&KeyframeAnimableTest::addChannel,
+              &KeyframeAnimableTest::matrix,
+              &KeyframeAnimableTest::dualQuaternion});
+}
+
+typedef Math::Track<Float, Vector3> TranslationTrack;
+typedef Math::Track<Float, Quaternion> RotationTrack;
+
+void KeyframeAnimableTest::addChannel() {
+    typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+
+    Object3D root;
+    Object3D a(&root), b(&root);
+    KeyframeAnimable<MatrixTransformation3D> animable(root);
+    CORRADE_COMPARE(animable.channelCount(), 0);
+    CORRADE_COMPARE(animable.duration(), 0.0f);
+
+    /* Duration is extended to the longest track */
+    animable.addChannel(a, TranslationTrack({0.0f, 2.0f}, {{}, {}}), RotationTrack({0.0f}, {{}}))
+            .addChannel(b, TranslationTrack({0.0f}, {{}}), RotationTrack({1.0f, 3.5f}, {{}, {}}));
+    CORRADE_COMPARE(animable.channelCount(), 2);
+    CORRADE_COMPARE(animable.duration(), 3.5f);
+}
+
+void KeyframeAnimableTest::matrix() {
+    typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+
+    Object3D root;
+    Object3D a(&root), b(&root);
+    AnimableGroup3D group;
+    KeyframeAnimable<MatrixTransformation3D> animable(root, &group);
+    animable.addChannel(a,
+        TranslationTrack({0.0f, 2.0f}, {Vector3(0.0f, 2.0f, 0.0f), Vector3(4.0f, 2.0f, 0.0f)}),
+        RotationTrack({0.0f}, {Quaternion::rotation(Deg(90.0f), Vector3::zAxis())}));
+    animable.addChannel(b,
+        TranslationTrack({0.0f}, {Vector3(1.0f, 0.0f, 0.0f)}),
+        RotationTrack({0.0f, 2.0f}, {Quaternion(), Quaternion::rotation(Deg(90.0f), Vector3::xAxis())}, Math::TrackInterpolation::Spherical));
+    animable.setState(AnimationState::Running);
+
+    group.step(1.0f, 0.5f);
+    group.step(2.0f, 0.5f);
+    CORRADE_COMPARE(a.transformationMatrix(), Matrix4::translation(Vector3(2.0f, 2.0f, 0.0f))*Matrix4::rotationZ(Deg(90.0f)));
+    CORRADE_COMPARE(b.transformationMatrix(), Matrix4::translation(Vector3::xAxis())*Matrix4::rotationX(Deg(45.0f)));
+}
+
+void KeyframeAnimableTest::dualQuaternion() {
+    typedef SceneGraph::Object<SceneGraph::DualQuaternionTransformation> Object3D;
+
+    Object3D root;
+    Object3D a(&root);
+    AnimableGroup3D group;
+    KeyframeAnimable<DualQuaternionTransformation> animable(root, &group);
+    animable.addChannel(a,
+        TranslationTrack({0.0f, 2.0f}, {Vector3(0.0f, 2.0f, 0.0f), Vector3(4.0f, 2.0f, 0.0f)}),
+        RotationTrack({0.0f, 2.0f}, {Quaternion(), Quaternion::rotation(Deg(90.0f), Vector3::zAxis())}));
+    animable.setState(AnimationState::Running);
+
+    group.step(1.0f, 0.5f);
+    group.step(2.0f, 0.5f);
+    CORRADE_COMPARE(a.transformation(), DualQuaternion::translation(Vector3(2.0f, 2.0f, 0.0f))*DualQuaternion::rotation(Deg(45.0f), Vector3::zAxis()));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::KeyframeAnimableTest)
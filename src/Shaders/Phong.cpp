@@ -24,6 +24,7 @@
 
 #include "Phong.h"
 
+#include <sstream>
 #include <Utility/Resource.h>
 
 #include "Extensions.h"
@@ -31,7 +32,14 @@
 
 namespace Magnum { namespace Shaders {
 
-Phong::Phong(const Flags flags): transformationMatrixUniform(0), projectionMatrixUniform(1), normalMatrixUniform(2), lightUniform(3), diffuseColorUniform(4), ambientColorUniform(5), specularColorUniform(6), lightColorUniform(7), shininessUniform(8), _flags(flags) {
+namespace {
+    const Phong::Flags TextureFlags = Phong::Flag::AmbientTexture|Phong::Flag::DiffuseTexture|Phong::Flag::SpecularTexture;
+}
+
+Phong::Phong(const Flags flags, const UnsignedInt jointCount): transformationMatrixUniform(0), projectionMatrixUniform(1), normalMatrixUniform(2), lightUniform(3), diffuseColorUniform(4), ambientColorUniform(5), specularColorUniform(6), lightColorUniform(7), shininessUniform(8), jointTransformationsUniform(9), _flags(flags), _jointCount(flags & Flag::Skinned ? jointCount : 0) {
+    CORRADE_ASSERT(!(flags & Flag::Skinned) || jointCount,
+        "Shaders::Phong: joint count must be nonzero for skinned shader", );
+
     Utility::Resource rs("MagnumShaders");
 
     #ifndef MAGNUM_TARGET_GLES
@@ -40,8 +48,14 @@ Phong::Phong(const Flags flags): transformationMatrixUniform(0), projectionMatri
     const Version version = Context::current()->supportedVersion({Version::GLES300, Version::GLES200});
     #endif
 
+    /* Joint count is needed for palette array size */
+    std::ostringstream skinned;
+    if(flags & Flag::Skinned)
+        skinned << "#define SKINNED\n#define JOINT_COUNT " << _jointCount << "\n";
+
     Shader vert(version, Shader::Type::Vertex);
-    vert.addSource(flags ? "#define TEXTURED\n" : "")
+    vert.addSource(flags & TextureFlags ? "#define TEXTURED\n" : "")
+        .addSource(skinned.str())
         .addSource(rs.get("compatibility.glsl"))
         .addSource(rs.get("Phong.vert"));
     CORRADE_INTERNAL_ASSERT_OUTPUT(vert.compile());
@@ -64,7 +78,11 @@ Phong::Phong(const Flags flags): transformationMatrixUniform(0), projectionMatri
     {
         bindAttributeLocation(Position::Location, "position");
         bindAttributeLocation(Normal::Location, "normal");
-        if(flags) bindAttributeLocation(TextureCoordinates::Location, "textureCoordinates");
+        if(flags & TextureFlags) bindAttributeLocation(TextureCoordinates::Location, "textureCoordinates");
+        if(flags & Flag::Skinned) {
+            bindAttributeLocation(JointIds::Location, "jointIds");
+            bindAttributeLocation(JointWeights::Location, "jointWeights");
+        }
     }
 
     CORRADE_INTERNAL_ASSERT_OUTPUT(link());
@@ -82,10 +100,11 @@ Phong::Phong(const Flags flags): transformationMatrixUniform(0), projectionMatri
         if(!(flags & Flag::SpecularTexture)) specularColorUniform = uniformLocation("specularColor");
         lightColorUniform = uniformLocation("lightColor");
         shininessUniform = uniformLocation("shininess");
+        if(flags & Flag::Skinned) jointTransformationsUniform = uniformLocation("jointDualQuaternions");
     }
 
     #ifndef MAGNUM_TARGET_GLES
-    if(flags && !Context::current()->isExtensionSupported<Extensions::GL::ARB::shading_language_420pack>(version))
+    if((flags & TextureFlags) && !Context::current()->isExtensionSupported<Extensions::GL::ARB::shading_language_420pack>(version))
     #endif
     {
         if(flags & Flag::AmbientTexture) setUniform(uniformLocation("ambientTexture"), AmbientTextureLayer);
@@ -102,4 +121,14 @@ Phong::Phong(const Flags flags): transformationMatrixUniform(0), projectionMatri
     #endif
 }
 
+Phong& Phong::setJointTransformations(const DualQuaternion* const transformations, const UnsignedInt count) {
+    CORRADE_ASSERT(count <= _jointCount,
+        "Shaders::Phong::setJointTransformations(): expected at most" << _jointCount << "joints, got" << count, *this);
+
+    /* Each dual quaternion is two vec4s, real part first */
+    static_assert(sizeof(DualQuaternion) == 2*sizeof(Vector4), "Improper size of DualQuaternion");
+    if(count) setUniform(jointTransformationsUniform, 2*count, reinterpret_cast<const Vector4*>(transformations));
+    return *this;
+}
+
 }}
@@ -28,6 +28,9 @@
  * @brief Class Magnum::Shaders::Phong
  */
 
+#include <vector>
+
+#include "Math/DualQuaternion.h"
 #include "Math/Matrix4.h"
 #include "AbstractShaderProgram.h"
 #include "Color.h"
@@ -55,6 +58,24 @@ Shaders::Phong shader(Shaders::Phong::Flag::DiffuseTexture);
 
 myDiffuseTexture.bind(Shaders::Phong::DiffuseTextureLayer);
 @endcode
+
+@section Phong-skinning Skinned meshes
+
+With @ref Flag::Skinned the shader additionally transforms each vertex by up to
+four joints using dual quaternion linear blending. You need to provide also
+@ref JointIds and @ref JointWeights attributes (see
+@ref Trade::MeshData3D::jointIds() and @ref Trade::MeshData3D::jointWeights()),
+specify maximal joint count in constructor and upload the joint palette with
+@ref setJointTransformations() each frame. The palette can be computed with
+@ref MeshTools::jointPalette(), the same blending is implemented on CPU in
+@ref MeshTools::skinPointsInPlace(). Example:
+@code
+Shaders::Phong shader(Shaders::Phong::Flag::Skinned, 32);
+
+std::vector<DualQuaternion> absolute, palette;
+MeshTools::jointPalette(parents, transformations, inverseBindTransformations, absolute, palette);
+shader.setJointTransformations(palette);
+@endcode
 */
 class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
     public:
@@ -69,6 +90,24 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
          */
         typedef Attribute<2, Vector2> TextureCoordinates;
 
+        /**
+         * @brief Joint IDs
+         *
+         * IDs of up to four joints affecting the vertex. Stored as floats to
+         * be usable also on OpenGL ES 2.0 and OpenGL 2.1, which don't have
+         * integer attributes. Used only if @ref Flag::Skinned is set.
+         */
+        typedef Attribute<3, Vector4> JointIds;
+
+        /**
+         * @brief Joint weights
+         *
+         * Weights corresponding to @ref JointIds, should sum to `1.0f`. Unused
+         * joints should have zero weight. Used only if @ref Flag::Skinned is
+         * set.
+         */
+        typedef Attribute<4, Vector4> JointWeights;
+
         enum: Int {
             /**
              * Layer for ambient texture. Used only if @ref Flag::AmbientTexture
@@ -97,7 +136,13 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
         enum class Flag: UnsignedByte {
             AmbientTexture = 1 << 0,    /**< The shader uses ambient texture instead of color */
             DiffuseTexture = 1 << 1,    /**< The shader uses diffuse texture instead of color */
-            SpecularTexture = 1 << 2    /**< The shader uses specular texture instead of color */
+            SpecularTexture = 1 << 2,   /**< The shader uses specular texture instead of color */
+
+            /**
+             * The shader transforms vertices using joint palette.
+             * @see @ref setJointTransformations()
+             */
+            Skinned = 1 << 3
         };
 
         /**
@@ -109,13 +154,22 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
 
         /**
          * @brief Constructor
-         * @param flags     Shader flags
+         * @param flags         Shader flags
+         * @param jointCount    Max count of joints in the palette. Used only
+         *      if @ref Flag::Skinned is set, in which case it must be nonzero.
+         *
+         * Note that the joint palette occupies two uniform vectors for each
+         * joint, so the joint count is limited by
+         * `GL_MAX_VERTEX_UNIFORM_VECTORS`.
          */
-        explicit Phong(Flags flags = Flags());
+        explicit Phong(Flags flags = Flags(), UnsignedInt jointCount = 0);
 
         /** @brief Shader flags */
         Flags flags() const { return _flags; }
 
+        /** @brief Max joint count */
+        UnsignedInt jointCount() const { return _jointCount; }
+
         /**
          * @brief Set ambient color
          * @return Reference to self (for method chaining)
@@ -201,6 +255,22 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
             return *this;
         }
 
+        /**
+         * @brief Set joint transformations
+         * @return Reference to self (for method chaining)
+         *
+         * Transformations of skeleton joints relative to bind pose, see
+         * @ref MeshTools::jointPalette(). The transformations are expected to
+         * be normalized, the count must not be larger than @ref jointCount().
+         * Has effect only if @ref Flag::Skinned is set.
+         */
+        Phong& setJointTransformations(const DualQuaternion* transformations, UnsignedInt count);
+
+        /** @overload */
+        Phong& setJointTransformations(const std::vector<DualQuaternion>& transformations) {
+            return setJointTransformations(transformations.data(), transformations.size());
+        }
+
     private:
         Int transformationMatrixUniform,
             projectionMatrixUniform,
@@ -210,9 +280,11 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
             ambientColorUniform,
             specularColorUniform,
             lightColorUniform,
-            shininessUniform;
+            shininessUniform,
+            jointTransformationsUniform;
 
         Flags _flags;
+        UnsignedInt _jointCount;
 };
 
 CORRADE_ENUMSET_OPERATORS(Phong::Flags)
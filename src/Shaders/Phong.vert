@@ -56,17 +56,67 @@ in mediump vec2 textureCoords;
 out mediump vec2 interpolatedTextureCoords;
 #endif
 
+#ifdef SKINNED
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 9) uniform vec4 jointDualQuaternions[JOINT_COUNT*2];
+#else
+uniform highp vec4 jointDualQuaternions[JOINT_COUNT*2];
+#endif
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = 3) in mediump vec4 jointIds;
+layout(location = 4) in mediump vec4 jointWeights;
+#else
+in mediump vec4 jointIds;
+in mediump vec4 jointWeights;
+#endif
+
+/* Adds weighted joint dual quaternion to the blend, flipping its sign if it
+   is in the other hemisphere than the first one */
+void blendJoint(float id, float weight, highp vec4 firstReal, inout highp vec4 real, inout highp vec4 dual) {
+    int i = int(id)*2;
+    highp vec4 jointReal = jointDualQuaternions[i];
+    highp float w = dot(firstReal, jointReal) < 0.0 ? -weight : weight;
+    real += w*jointReal;
+    dual += w*jointDualQuaternions[i + 1];
+}
+#endif
+
 out mediump vec3 transformedNormal;
 out highp vec3 lightDirection;
 out highp vec3 cameraDirection;
 
 void main() {
-    /* Transformed vertex position */
+    #ifdef SKINNED
+    /* Dual quaternion linear blending of joint transformations */
+    highp vec4 firstReal = jointDualQuaternions[int(jointIds.x)*2];
+    highp vec4 real = vec4(0.0);
+    highp vec4 dual = vec4(0.0);
+    blendJoint(jointIds.x, jointWeights.x, firstReal, real, dual);
+    blendJoint(jointIds.y, jointWeights.y, firstReal, real, dual);
+    blendJoint(jointIds.z, jointWeights.z, firstReal, real, dual);
+    blendJoint(jointIds.w, jointWeights.w, firstReal, real, dual);
+    highp float realLength = length(real);
+    real /= realLength;
+    dual /= realLength;
+
+    /* Rotate the position and the normal, translate the position */
+    highp vec3 skinnedPosition = position.xyz/position.w;
+    skinnedPosition += 2.0*cross(real.xyz, cross(real.xyz, skinnedPosition) + real.w*skinnedPosition) +
+        2.0*(real.w*dual.xyz - dual.w*real.xyz + cross(real.xyz, dual.xyz));
+    mediump vec3 skinnedNormal = normal + 2.0*cross(real.xyz, cross(real.xyz, normal) + real.w*normal);
+
+    highp vec4 transformedPosition4 = transformationMatrix*vec4(skinnedPosition, 1.0);
+    #else
     highp vec4 transformedPosition4 = transformationMatrix*position;
+    mediump vec3 skinnedNormal = normal;
+    #endif
+
+    /* Transformed vertex position */
     highp vec3 transformedPosition = transformedPosition4.xyz/transformedPosition4.w;
 
     /* Transformed normal vector */
-    transformedNormal = normalMatrix*normal;
+    transformedNormal = normalMatrix*skinnedNormal;
 
     /* Direction to the light */
     lightDirection = normalize(light - transformedPosition);
@@ -22,6 +22,16 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include "Buffer.h"
+#include "ColorFormat.h"
+#include "Framebuffer.h"
+#include "Image.h"
+#include "Mesh.h"
+#include "Renderbuffer.h"
+#include "RenderbufferFormat.h"
+#include "Renderer.h"
+#include "Math/Matrix4.h"
+#include "MeshTools/Skinning.h"
 #include "Shaders/Phong.h"
 #include "Test/AbstractOpenGLTester.h"
 
@@ -39,6 +49,9 @@ class PhongTest: public Magnum::Test::AbstractOpenGLTester {
         void compileAmbientSpecularTexture();
         void compileDiffuseSpecularTexture();
         void compileAmbientDiffuseSpecularTexture();
+        void compileSkinned();
+        void compileSkinnedTexture();
+        void skinnedMatchesCpu();
 };
 
 PhongTest::PhongTest() {
@@ -49,7 +62,10 @@ PhongTest::PhongTest() {
               &PhongTest::compileAmbientDiffuseTexture,
               &PhongTest::compileAmbientSpecularTexture,
               &PhongTest::compileDiffuseSpecularTexture,
-              &PhongTest::compileAmbientDiffuseSpecularTexture});
+              &PhongTest::compileAmbientDiffuseSpecularTexture,
+              &PhongTest::compileSkinned,
+              &PhongTest::compileSkinnedTexture,
+              &PhongTest::skinnedMatchesCpu});
 }
 
 void PhongTest::compile() {
@@ -92,6 +108,118 @@ void PhongTest::compileAmbientDiffuseSpecularTexture() {
     CORRADE_VERIFY(shader.validate().first);
 }
 
+void PhongTest::compileSkinned() {
+    Shaders::Phong shader(Shaders::Phong::Flag::Skinned, 16);
+    CORRADE_COMPARE(shader.jointCount(), 16);
+    CORRADE_VERIFY(shader.validate().first);
+
+    shader.setJointTransformations(std::vector<DualQuaternion>(16));
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void PhongTest::compileSkinnedTexture() {
+    Shaders::Phong shader(Shaders::Phong::Flag::Skinned|Shaders::Phong::Flag::DiffuseTexture, 16);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void PhongTest::skinnedMatchesCpu() {
+    /* Two joints, the second one rotated and translated */
+    const std::vector<DualQuaternion> palette{
+        DualQuaternion::translation({0.1f, -0.05f, 0.0f}),
+        DualQuaternion::rotation(Deg(35.0f), Vector3::zAxis())*DualQuaternion::translation({-0.2f, 0.1f, 0.0f})};
+    const std::vector<Vector3> positions{
+        {-0.5f, -0.5f, 0.0f},
+        { 0.3f, -0.4f, 0.0f},
+        { 0.0f,  0.5f, 0.0f},
+        { 0.6f,  0.2f, 0.0f},
+        {-0.4f,  0.3f, 0.0f}};
+    const std::vector<Vector3> normals(positions.size(), Vector3::zAxis());
+    const std::vector<Vector4ui> ids{
+        {0, 0, 0, 0},
+        {1, 0, 0, 0},
+        {0, 1, 0, 0},
+        {1, 0, 0, 0},
+        {0, 1, 1, 0}};
+    const std::vector<Vector4> weights{
+        {1.0f, 0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f, 0.0f},
+        {0.5f, 0.5f, 0.0f, 0.0f},
+        {0.25f, 0.75f, 0.0f, 0.0f},
+        {0.2f, 0.3f, 0.5f, 0.0f}};
+
+    /* Expected positions from the CPU implementation */
+    std::vector<Vector3> skinned = positions;
+    MeshTools::skinPointsInPlace(palette, ids, weights, skinned);
+
+    /* Render each vertex as a white point with identity transformation and
+       projection, so the skinned position maps directly to the framebuffer */
+    const Vector2i size(128);
+    Renderbuffer color;
+    color.setStorage(RenderbufferFormat::RGBA8, size);
+    Framebuffer framebuffer({{}, size});
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment(0), color)
+        .bind(FramebufferTarget::ReadDraw);
+    Renderer::setClearColor(Color4(0.0f, 0.0f, 0.0f, 1.0f));
+    framebuffer.clear(FramebufferClear::Color);
+
+    /* Joint IDs are float attributes */
+    std::vector<Vector4> floatIds;
+    for(const Vector4ui& id: ids) floatIds.push_back(Vector4(id));
+
+    Buffer positionBuffer, normalBuffer, idBuffer, weightBuffer;
+    positionBuffer.setData(positions, Buffer::Usage::StaticDraw);
+    normalBuffer.setData(normals, Buffer::Usage::StaticDraw);
+    idBuffer.setData(floatIds, Buffer::Usage::StaticDraw);
+    weightBuffer.setData(weights, Buffer::Usage::StaticDraw);
+
+    Mesh mesh;
+    mesh.setPrimitive(Mesh::Primitive::Points)
+        .setVertexCount(positions.size())
+        .addVertexBuffer(positionBuffer, 0, Shaders::Phong::Position())
+        .addVertexBuffer(normalBuffer, 0, Shaders::Phong::Normal())
+        .addVertexBuffer(idBuffer, 0, Shaders::Phong::JointIds())
+        .addVertexBuffer(weightBuffer, 0, Shaders::Phong::JointWeights());
+
+    Shaders::Phong shader(Shaders::Phong::Flag::Skinned, 2);
+    shader.setTransformationMatrix(Matrix4())
+        .setNormalMatrix(Matrix3x3())
+        .setProjectionMatrix(Matrix4())
+        .setAmbientColor(Color3(1.0f))
+        .setDiffuseColor(Color3(0.0f))
+        .setSpecularColor(Color3(0.0f))
+        .setLightPosition({0.0f, 0.0f, 1.0f})
+        .setJointTransformations(palette)
+        .use();
+    mesh.draw();
+    MAGNUM_VERIFY_NO_ERROR();
+
+    Image2D image(ColorFormat::RGBA, ColorType::UnsignedByte);
+    framebuffer.read({}, size, image);
+    MAGNUM_VERIFY_NO_ERROR();
+    const auto lit = [&image, &size](const Vector2i& pixel) {
+        return pixel.x() >= 0 && pixel.y() >= 0 && pixel.x() < size.x() && pixel.y() < size.y() &&
+            image.data()[(pixel.y()*size.x() + pixel.x())*4] > 127;
+    };
+
+    /* There is one point for each vertex ... */
+    std::size_t litCount = 0;
+    for(Int y = 0; y != size.y(); ++y)
+        for(Int x = 0; x != size.x(); ++x)
+            if(lit({x, y})) ++litCount;
+    CORRADE_COMPARE(litCount, positions.size());
+
+    /* ... and it is at the position computed on CPU, with one pixel
+       tolerance for rounding at pixel edges */
+    for(std::size_t i = 0; i != skinned.size(); ++i) {
+        const Vector2i expected((skinned[i].xy()*0.5f + Vector2(0.5f))*Vector2(size));
+        bool found = false;
+        for(Int y = -1; y <= 1; ++y)
+            for(Int x = -1; x <= 1; ++x)
+                if(lit(expected + Vector2i(x, y))) found = true;
+        CORRADE_VERIFY(found);
+    }
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shaders::Test::PhongTest)
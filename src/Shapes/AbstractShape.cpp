@@ -28,13 +28,18 @@
 
 #include "Shapes/ShapeGroup.h"
 #include "Shapes/Implementation/CollisionDispatch.h"
+#include "Shapes/Implementation/ShapeBoundingVolume.h"
 
 namespace Magnum { namespace Shapes {
 
-template<UnsignedInt dimensions> AbstractShape<dimensions>::AbstractShape(SceneGraph::AbstractObject<dimensions, Float>& object, ShapeGroup<dimensions>* group): SceneGraph::AbstractGroupedFeature<dimensions, AbstractShape<dimensions>, Float>(object, group) {
+template<UnsignedInt dimensions> AbstractShape<dimensions>::AbstractShape(SceneGraph::AbstractObject<dimensions, Float>& object, ShapeGroup<dimensions>* group): SceneGraph::AbstractGroupedFeature<dimensions, AbstractShape<dimensions>, Float>(object, group), _boundingVolume(nullptr) {
     SceneGraph::AbstractFeature<dimensions, Float>::setCachedTransformations(SceneGraph::CachedTransformation::Absolute);
 }
 
+template<UnsignedInt dimensions> AbstractShape<dimensions>::~AbstractShape() {
+    if(_boundingVolume) _boundingVolume->destroy();
+}
+
 template<UnsignedInt dimensions> ShapeGroup<dimensions>* AbstractShape<dimensions>::group() {
     return static_cast<ShapeGroup<dimensions>*>(SceneGraph::AbstractGroupedFeature<dimensions, AbstractShape<dimensions>, Float>::group());
 }
@@ -51,8 +56,13 @@ template<UnsignedInt dimensions> bool AbstractShape<dimensions>::collides(const
     return Implementation::collides(abstractTransformedShape(), other.abstractTransformedShape());
 }
 
+template<UnsignedInt dimensions> Collision<dimensions> AbstractShape<dimensions>::collision(const AbstractShape<dimensions>& other) const {
+    return Implementation::collision(abstractTransformedShape(), other.abstractTransformedShape());
+}
+
 template<UnsignedInt dimensions> void AbstractShape<dimensions>::markDirty() {
     if(group()) group()->setDirty();
+    if(_boundingVolume) _boundingVolume->markDirty();
 }
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
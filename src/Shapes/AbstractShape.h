@@ -30,6 +30,7 @@
 
 #include "Magnum.h"
 #include "DimensionTraits.h"
+#include "Shapes/Collision.h"
 #include "Shapes/magnumShapesVisibility.h"
 #include "Shapes/shapeImplementation.h"
 #include "SceneGraph/AbstractGroupedFeature.h"
@@ -37,6 +38,8 @@
 namespace Magnum { namespace Shapes {
 
 namespace Implementation {
+    template<UnsignedInt> class ShapeBoundingVolume;
+
     template<UnsignedInt dimensions> inline const AbstractShape<dimensions>& getAbstractShape(const Shapes::AbstractShape<dimensions>& shape) {
         return shape.abstractTransformedShape();
     }
@@ -51,6 +54,8 @@ brief introduction.
 */
 template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AbstractShape: public SceneGraph::AbstractGroupedFeature<dimensions, AbstractShape<dimensions>, Float> {
     friend const Implementation::AbstractShape<dimensions>& Implementation::getAbstractShape<>(const AbstractShape<dimensions>&);
+    friend class ShapeGroup<dimensions>;
+    friend class Implementation::ShapeBoundingVolume<dimensions>;
 
     public:
         enum: UnsignedInt {
@@ -67,6 +72,7 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AbstractShape: publi
             Capsule,        /**< Capsule */
             AxisAlignedBox, /**< @ref AxisAlignedBox "Axis aligned box" */
             Box,            /**< Box */
+            ConvexHull,     /**< @ref ConvexHull "Convex hull" */
             Composition,    /**< @ref Composition "Shape group" */
             Plane           /**< Plane (3D only) */
         };
@@ -81,6 +87,14 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AbstractShape: publi
          */
         explicit AbstractShape(SceneGraph::AbstractObject<dimensions, Float>& object, ShapeGroup<dimensions>* group = nullptr);
 
+        /**
+         * @brief Destructor
+         *
+         * Removes the shape also from bounding volume hierarchy of its
+         * @ref ShapeGroup.
+         */
+        ~AbstractShape();
+
         /**
          * @brief Shape group containing this shape
          *
@@ -101,12 +115,23 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AbstractShape: publi
          */
         bool collides(const AbstractShape<dimensions>& other) const;
 
+        /**
+         * @brief %Collision data with other shape
+         *
+         * Returns empty collision if the shapes don't collide or if contact
+         * generation is not implemented for given pair of shape types.
+         * @see @ref collides(), @ref ShapeGroup::collisionData()
+         */
+        Collision<dimensions> collision(const AbstractShape<dimensions>& other) const;
+
     protected:
         /** Marks also the group as dirty */
         void markDirty() override;
 
     private:
         virtual const Implementation::AbstractShape<dimensions> MAGNUM_SHAPES_LOCAL & abstractTransformedShape() const = 0;
+
+        Implementation::ShapeBoundingVolume<dimensions>* _boundingVolume;
 };
 
 /** @brief Base class for two-dimensional object shapes */
@@ -26,7 +26,11 @@
 
 #include "Math/Matrix3.h"
 #include "Math/Matrix4.h"
+#include "Shapes/Capsule.h"
+#include "Shapes/Cylinder.h"
 #include "Shapes/Point.h"
+#include "Shapes/Sphere.h"
+#include "Shapes/Implementation/ContactGeneration.h"
 
 namespace Magnum { namespace Shapes {
 
@@ -35,11 +39,55 @@ template<UnsignedInt dimensions> AxisAlignedBox<dimensions> AxisAlignedBox<dimen
                                       matrix.transformPoint(_max));
 }
 
+template<UnsignedInt dimensions> typename DimensionTraits<dimensions, Float>::VectorType AxisAlignedBox<dimensions>::support(const typename DimensionTraits<dimensions, Float>::VectorType& direction) const {
+    typename DimensionTraits<dimensions, Float>::VectorType out;
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        out[i] = direction[i] < 0.0f ? _min[i] : _max[i];
+    return out;
+}
+
 template<UnsignedInt dimensions> bool AxisAlignedBox<dimensions>::operator%(const Point<dimensions>& other) const {
     return (other.position() >= _min).all() &&
            (other.position() < _max).all();
 }
 
+template<UnsignedInt dimensions> Collision<dimensions> AxisAlignedBox<dimensions>::operator/(const Point<dimensions>& other) const {
+    return Implementation::boxSphereContact(Implementation::OrientedBox<dimensions>(*this), other.position(), 0.0f);
+}
+
+template<UnsignedInt dimensions> bool AxisAlignedBox<dimensions>::operator%(const Sphere<dimensions>& other) const {
+    return (Math::min(Math::max(other.position(), _min), _max) - other.position()).dot() <
+        Math::pow<2>(other.radius());
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> AxisAlignedBox<dimensions>::operator/(const Sphere<dimensions>& other) const {
+    return Implementation::boxSphereContact(Implementation::OrientedBox<dimensions>(*this), other.position(), other.radius());
+}
+
+template<UnsignedInt dimensions> bool AxisAlignedBox<dimensions>::operator%(const Cylinder<dimensions>& other) const {
+    return *this/other;
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> AxisAlignedBox<dimensions>::operator/(const Cylinder<dimensions>& other) const {
+    return Implementation::boxLineContact(Implementation::OrientedBox<dimensions>(*this), other.a(), other.b(), false, other.radius());
+}
+
+template<UnsignedInt dimensions> bool AxisAlignedBox<dimensions>::operator%(const Capsule<dimensions>& other) const {
+    return *this/other;
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> AxisAlignedBox<dimensions>::operator/(const Capsule<dimensions>& other) const {
+    return Implementation::boxLineContact(Implementation::OrientedBox<dimensions>(*this), other.a(), other.b(), true, other.radius());
+}
+
+template<UnsignedInt dimensions> bool AxisAlignedBox<dimensions>::operator%(const AxisAlignedBox<dimensions>& other) const {
+    return (_min < other._max).all() && (_max > other._min).all();
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> AxisAlignedBox<dimensions>::operator/(const AxisAlignedBox<dimensions>& other) const {
+    return Implementation::boxBoxContact(Implementation::OrientedBox<dimensions>(*this), Implementation::OrientedBox<dimensions>(other));
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class MAGNUM_SHAPES_EXPORT AxisAlignedBox<2>;
 template class MAGNUM_SHAPES_EXPORT AxisAlignedBox<3>;
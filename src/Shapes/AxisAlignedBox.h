@@ -30,6 +30,7 @@
 
 #include "Math/Vector3.h"
 #include "DimensionTraits.h"
+#include "Shapes/Collision.h"
 #include "Shapes/Shapes.h"
 #include "Shapes/magnumShapesVisibility.h"
 
@@ -81,9 +82,44 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AxisAlignedBox {
             _max = max;
         }
 
+        /**
+         * @brief Support point
+         *
+         * Point of the shape farthest in given direction, used for
+         * collision detection of arbitrary convex shapes.
+         */
+        typename DimensionTraits<dimensions, Float>::VectorType support(const typename DimensionTraits<dimensions, Float>::VectorType& direction) const;
+
         /** @brief %Collision occurence with point */
         bool operator%(const Point<dimensions>& other) const;
 
+        /** @brief %Collision with point */
+        Collision<dimensions> operator/(const Point<dimensions>& other) const;
+
+        /** @brief %Collision occurence with sphere */
+        bool operator%(const Sphere<dimensions>& other) const;
+
+        /** @brief %Collision with sphere */
+        Collision<dimensions> operator/(const Sphere<dimensions>& other) const;
+
+        /** @brief %Collision occurence with cylinder */
+        bool operator%(const Cylinder<dimensions>& other) const;
+
+        /** @brief %Collision with cylinder */
+        Collision<dimensions> operator/(const Cylinder<dimensions>& other) const;
+
+        /** @brief %Collision occurence with capsule */
+        bool operator%(const Capsule<dimensions>& other) const;
+
+        /** @brief %Collision with capsule */
+        Collision<dimensions> operator/(const Capsule<dimensions>& other) const;
+
+        /** @brief %Collision occurence with axis-aligned box */
+        bool operator%(const AxisAlignedBox<dimensions>& other) const;
+
+        /** @brief %Collision with axis-aligned box */
+        Collision<dimensions> operator/(const AxisAlignedBox<dimensions>& other) const;
+
     private:
         typename DimensionTraits<dimensions, Float>::VectorType _min, _max;
 };
@@ -97,6 +133,27 @@ typedef AxisAlignedBox<3> AxisAlignedBox3D;
 /** @collisionoccurenceoperator{Point,AxisAlignedBox} */
 template<UnsignedInt dimensions> inline bool operator%(const Point<dimensions>& a, const AxisAlignedBox<dimensions>& b) { return b % a; }
 
+/** @collisionoperator{Point,AxisAlignedBox} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Point<dimensions>& a, const AxisAlignedBox<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoccurenceoperator{Sphere,AxisAlignedBox} */
+template<UnsignedInt dimensions> inline bool operator%(const Sphere<dimensions>& a, const AxisAlignedBox<dimensions>& b) { return b % a; }
+
+/** @collisionoperator{Sphere,AxisAlignedBox} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Sphere<dimensions>& a, const AxisAlignedBox<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoccurenceoperator{Cylinder,AxisAlignedBox} */
+template<UnsignedInt dimensions> inline bool operator%(const Cylinder<dimensions>& a, const AxisAlignedBox<dimensions>& b) { return b % a; }
+
+/** @collisionoperator{Cylinder,AxisAlignedBox} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Cylinder<dimensions>& a, const AxisAlignedBox<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoccurenceoperator{Capsule,AxisAlignedBox} */
+template<UnsignedInt dimensions> inline bool operator%(const Capsule<dimensions>& a, const AxisAlignedBox<dimensions>& b) { return b % a; }
+
+/** @collisionoperator{Capsule,AxisAlignedBox} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Capsule<dimensions>& a, const AxisAlignedBox<dimensions>& b) { return (b/a).flipped(); }
+
 }}
 
 #endif
@@ -24,12 +24,80 @@
 
 #include "Box.h"
 
+#include "Shapes/AxisAlignedBox.h"
+#include "Shapes/Capsule.h"
+#include "Shapes/Cylinder.h"
+#include "Shapes/Point.h"
+#include "Shapes/Sphere.h"
+#include "Shapes/Implementation/ContactGeneration.h"
+
 namespace Magnum { namespace Shapes {
 
 template<UnsignedInt dimensions> Box<dimensions> Box<dimensions>::transformed(const typename DimensionTraits<dimensions, Float>::MatrixType& matrix) const {
     return Box<dimensions>(matrix*_transformation);
 }
 
+template<UnsignedInt dimensions> typename DimensionTraits<dimensions, Float>::VectorType Box<dimensions>::support(const typename DimensionTraits<dimensions, Float>::VectorType& direction) const {
+    /* Add or subtract each half-extent axis based on its direction */
+    typename DimensionTraits<dimensions, Float>::VectorType out = _transformation.translation();
+    for(UnsignedInt i = 0; i != dimensions; ++i) {
+        typename DimensionTraits<dimensions, Float>::VectorType axis;
+        for(UnsignedInt j = 0; j != dimensions; ++j)
+            axis[j] = _transformation[i][j];
+        if(Math::Vector<dimensions, Float>::dot(axis, direction) < 0.0f) out -= axis;
+        else out += axis;
+    }
+    return out;
+}
+
+template<UnsignedInt dimensions> bool Box<dimensions>::operator%(const Point<dimensions>& other) const {
+    return *this/other;
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> Box<dimensions>::operator/(const Point<dimensions>& other) const {
+    return Implementation::boxSphereContact(Implementation::OrientedBox<dimensions>(*this), other.position(), 0.0f);
+}
+
+template<UnsignedInt dimensions> bool Box<dimensions>::operator%(const Sphere<dimensions>& other) const {
+    return *this/other;
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> Box<dimensions>::operator/(const Sphere<dimensions>& other) const {
+    return Implementation::boxSphereContact(Implementation::OrientedBox<dimensions>(*this), other.position(), other.radius());
+}
+
+template<UnsignedInt dimensions> bool Box<dimensions>::operator%(const Cylinder<dimensions>& other) const {
+    return *this/other;
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> Box<dimensions>::operator/(const Cylinder<dimensions>& other) const {
+    return Implementation::boxLineContact(Implementation::OrientedBox<dimensions>(*this), other.a(), other.b(), false, other.radius());
+}
+
+template<UnsignedInt dimensions> bool Box<dimensions>::operator%(const Capsule<dimensions>& other) const {
+    return *this/other;
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> Box<dimensions>::operator/(const Capsule<dimensions>& other) const {
+    return Implementation::boxLineContact(Implementation::OrientedBox<dimensions>(*this), other.a(), other.b(), true, other.radius());
+}
+
+template<UnsignedInt dimensions> bool Box<dimensions>::operator%(const AxisAlignedBox<dimensions>& other) const {
+    return *this/other;
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> Box<dimensions>::operator/(const AxisAlignedBox<dimensions>& other) const {
+    return Implementation::boxBoxContact(Implementation::OrientedBox<dimensions>(*this), Implementation::OrientedBox<dimensions>(other));
+}
+
+template<UnsignedInt dimensions> bool Box<dimensions>::operator%(const Box<dimensions>& other) const {
+    return *this/other;
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> Box<dimensions>::operator/(const Box<dimensions>& other) const {
+    return Implementation::boxBoxContact(Implementation::OrientedBox<dimensions>(*this), Implementation::OrientedBox<dimensions>(other));
+}
+
 template class Box<2>;
 template class Box<3>;
 
@@ -31,6 +31,8 @@
 #include "Math/Matrix3.h"
 #include "Math/Matrix4.h"
 #include "DimensionTraits.h"
+#include "Shapes/Collision.h"
+#include "Shapes/Shapes.h"
 #include "Shapes/magnumShapesVisibility.h"
 
 namespace Magnum { namespace Shapes {
@@ -39,7 +41,10 @@ namespace Magnum { namespace Shapes {
 @brief Unit-size box with assigned transformation matrix
 
 Unit-size means that half extents are equal to 1, equivalent to e.g. sphere
-radius. See @ref shapes for brief introduction.
+radius. The transformation is expected to be without skew. Collisions with
+other boxes use separating axis theorem, collisions with capsules and
+cylinders search for the deepest point along their axis. See @ref shapes for
+brief introduction.
 @todo Use quat + position + size instead?
 @see Box2D, Box3D
 @todo Assert for skew
@@ -73,6 +78,50 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT Box {
             _transformation = transformation;
         }
 
+        /**
+         * @brief Support point
+         *
+         * Point of the shape farthest in given direction, used for
+         * collision detection of arbitrary convex shapes.
+         */
+        typename DimensionTraits<dimensions, Float>::VectorType support(const typename DimensionTraits<dimensions, Float>::VectorType& direction) const;
+
+        /** @brief %Collision occurence with point */
+        bool operator%(const Point<dimensions>& other) const;
+
+        /** @brief %Collision with point */
+        Collision<dimensions> operator/(const Point<dimensions>& other) const;
+
+        /** @brief %Collision occurence with sphere */
+        bool operator%(const Sphere<dimensions>& other) const;
+
+        /** @brief %Collision with sphere */
+        Collision<dimensions> operator/(const Sphere<dimensions>& other) const;
+
+        /** @brief %Collision occurence with cylinder */
+        bool operator%(const Cylinder<dimensions>& other) const;
+
+        /** @brief %Collision with cylinder */
+        Collision<dimensions> operator/(const Cylinder<dimensions>& other) const;
+
+        /** @brief %Collision occurence with capsule */
+        bool operator%(const Capsule<dimensions>& other) const;
+
+        /** @brief %Collision with capsule */
+        Collision<dimensions> operator/(const Capsule<dimensions>& other) const;
+
+        /** @brief %Collision occurence with axis-aligned box */
+        bool operator%(const AxisAlignedBox<dimensions>& other) const;
+
+        /** @brief %Collision with axis-aligned box */
+        Collision<dimensions> operator/(const AxisAlignedBox<dimensions>& other) const;
+
+        /** @brief %Collision occurence with box */
+        bool operator%(const Box<dimensions>& other) const;
+
+        /** @brief %Collision with box */
+        Collision<dimensions> operator/(const Box<dimensions>& other) const;
+
     private:
         typename DimensionTraits<dimensions, Float>::MatrixType _transformation;
 };
@@ -83,6 +132,36 @@ typedef Box<2> Box2D;
 /** @brief Three-dimensional box */
 typedef Box<3> Box3D;
 
+/** @collisionoccurenceoperator{Point,Box} */
+template<UnsignedInt dimensions> inline bool operator%(const Point<dimensions>& a, const Box<dimensions>& b) { return b % a; }
+
+/** @collisionoperator{Point,Box} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Point<dimensions>& a, const Box<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoccurenceoperator{Sphere,Box} */
+template<UnsignedInt dimensions> inline bool operator%(const Sphere<dimensions>& a, const Box<dimensions>& b) { return b % a; }
+
+/** @collisionoperator{Sphere,Box} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Sphere<dimensions>& a, const Box<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoccurenceoperator{Cylinder,Box} */
+template<UnsignedInt dimensions> inline bool operator%(const Cylinder<dimensions>& a, const Box<dimensions>& b) { return b % a; }
+
+/** @collisionoperator{Cylinder,Box} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Cylinder<dimensions>& a, const Box<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoccurenceoperator{Capsule,Box} */
+template<UnsignedInt dimensions> inline bool operator%(const Capsule<dimensions>& a, const Box<dimensions>& b) { return b % a; }
+
+/** @collisionoperator{Capsule,Box} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Capsule<dimensions>& a, const Box<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoccurenceoperator{AxisAlignedBox,Box} */
+template<UnsignedInt dimensions> inline bool operator%(const AxisAlignedBox<dimensions>& a, const Box<dimensions>& b) { return b % a; }
+
+/** @collisionoperator{AxisAlignedBox,Box} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const AxisAlignedBox<dimensions>& a, const Box<dimensions>& b) { return (b/a).flipped(); }
+
 }}
 
 #endif
@@ -29,8 +29,10 @@
 #include "Math/Matrix4.h"
 #include "Math/Geometry/Distance.h"
 #include "Magnum.h"
+#include "Shapes/Cylinder.h"
 #include "Shapes/Point.h"
 #include "Shapes/Sphere.h"
+#include "Shapes/Implementation/ContactGeneration.h"
 
 using namespace Magnum::Math::Geometry;
 
@@ -40,6 +42,12 @@ template<UnsignedInt dimensions> Capsule<dimensions> Capsule<dimensions>::transf
     return Capsule<dimensions>(matrix.transformPoint(_a), matrix.transformPoint(_b), matrix.uniformScaling()*_radius);
 }
 
+template<UnsignedInt dimensions> typename DimensionTraits<dimensions, Float>::VectorType Capsule<dimensions>::support(const typename DimensionTraits<dimensions, Float>::VectorType& direction) const {
+    const typename DimensionTraits<dimensions, Float>::VectorType end = Math::Vector<dimensions, Float>::dot(_a, direction) > Math::Vector<dimensions, Float>::dot(_b, direction) ? _a : _b;
+    const Float dot = direction.dot();
+    return dot == 0.0f ? end : end + direction*(_radius/Math::sqrt(dot));
+}
+
 template<UnsignedInt dimensions> bool Capsule<dimensions>::operator%(const Point<dimensions>& other) const {
     return Distance::lineSegmentPointSquared(_a, _b, other.position()) <
         Math::pow<2>(_radius);
@@ -50,6 +58,42 @@ template<UnsignedInt dimensions> bool Capsule<dimensions>::operator%(const Spher
         Math::pow<2>(_radius+other.radius());
 }
 
+template<UnsignedInt dimensions> Collision<dimensions> Capsule<dimensions>::operator/(const Point<dimensions>& other) const {
+    return *this/Sphere<dimensions>(other.position(), 0.0f);
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> Capsule<dimensions>::operator/(const Sphere<dimensions>& other) const {
+    Float s, t;
+    Implementation::closestPoints(_a, _b, true, other.position(), other.position(), true, s, t);
+    return Implementation::roundedContact<dimensions>(_a + (_b - _a)*s, _radius, other.position(), other.radius());
+}
+
+template<UnsignedInt dimensions> bool Capsule<dimensions>::operator%(const Cylinder<dimensions>& other) const {
+    Float s, t;
+    Implementation::closestPoints(_a, _b, true, other.a(), other.b(), false, s, t);
+    return ((_a + (_b - _a)*s) - (other.a() + (other.b() - other.a())*t)).dot() <
+        Math::pow<2>(_radius+other.radius());
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> Capsule<dimensions>::operator/(const Cylinder<dimensions>& other) const {
+    Float s, t;
+    Implementation::closestPoints(_a, _b, true, other.a(), other.b(), false, s, t);
+    return Implementation::roundedContact<dimensions>(_a + (_b - _a)*s, _radius, other.a() + (other.b() - other.a())*t, other.radius());
+}
+
+template<UnsignedInt dimensions> bool Capsule<dimensions>::operator%(const Capsule<dimensions>& other) const {
+    Float s, t;
+    Implementation::closestPoints(_a, _b, true, other._a, other._b, true, s, t);
+    return ((_a + (_b - _a)*s) - (other._a + (other._b - other._a)*t)).dot() <
+        Math::pow<2>(_radius+other._radius);
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> Capsule<dimensions>::operator/(const Capsule<dimensions>& other) const {
+    Float s, t;
+    Implementation::closestPoints(_a, _b, true, other._a, other._b, true, s, t);
+    return Implementation::roundedContact<dimensions>(_a + (_b - _a)*s, _radius, other._a + (other._b - other._a)*t, other._radius);
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class MAGNUM_SHAPES_EXPORT Capsule<2>;
 template class MAGNUM_SHAPES_EXPORT Capsule<3>;
@@ -25,8 +25,11 @@
 #include "Composition.h"
 
 #include <algorithm>
+#include <limits>
 #include <Utility/Assert.h>
 
+#include "Math/Functions.h"
+#include "Math/Vector3.h"
 #include "Shapes/Implementation/CollisionDispatch.h"
 
 namespace Magnum { namespace Shapes {
@@ -57,106 +60,198 @@ Shapes are merged together by concatenating its node and shape list and adding
 new node at the beginning with properly set `rightNode` and `rightShape`.
 Because these values are relative to parent, they don't need to be modified
 when concatenating.
+
+Nodes, bounds of all nodes and shapes, shape pointers, offsets of the shapes
+and the shapes themselves are stored in one memory block. Each shape is
+constructed in place in the shape data part, the pointer array points to the
+(polymorphic) base of each shape. Node bounds are union of bounds of its
+subtree, subtrees containing NOT operation have infinite bounds, because they
+can collide with anything.
 */
 
-template<UnsignedInt dimensions> Composition<dimensions>::Composition(const Composition<dimensions>& other): _shapeCount(other._shapeCount), _nodeCount(other._nodeCount) {
-    copyShapes(0, other);
+template<UnsignedInt dimensions> Composition<dimensions>::Composition(const Composition<dimensions>& other): _shapeCount(other._shapeCount), _nodeCount(other._nodeCount), _shapeDataSize(other._shapeDataSize) {
+    allocate();
     copyNodes(0, other);
+    copyShapes(0, 0, other);
+    std::copy(other.nodeBounds(), other.nodeBounds() + _nodeCount + _shapeCount, nodeBounds());
 }
 
-template<UnsignedInt dimensions> Composition<dimensions>::Composition(Composition<dimensions>&& other): _shapeCount(other._shapeCount), _nodeCount(other._nodeCount), _shapes(other._shapes), _nodes(other._nodes) {
-    other._shapes = nullptr;
-    other._shapeCount = 0;
-
-    other._nodes = nullptr;
-    other._nodeCount = 0;
+template<UnsignedInt dimensions> Composition<dimensions>::Composition(Composition<dimensions>&& other): _shapeCount(other._shapeCount), _nodeCount(other._nodeCount), _shapeDataSize(other._shapeDataSize), _data(other._data) {
+    other._shapeCount = other._nodeCount = other._shapeDataSize = 0;
+    other._data = nullptr;
 }
 
 template<UnsignedInt dimensions> Composition<dimensions>::~Composition() {
-    for(std::size_t i = 0; i != _shapeCount; ++i)
-        delete _shapes[i];
-
-    delete[] _shapes;
-    delete[] _nodes;
+    destroyShapes();
+    delete[] _data;
 }
 
 template<UnsignedInt dimensions> Composition<dimensions>& Composition<dimensions>::operator=(const Composition<dimensions>& other) {
-    for(std::size_t i = 0; i != _shapeCount; ++i)
-        delete _shapes[i];
+    if(&other == this) return *this;
 
-    if(_shapeCount != other._shapeCount) {
-        delete[] _shapes;
-        _shapeCount = other._shapeCount;
-        _shapes = new Implementation::AbstractShape<dimensions>*[_shapeCount];
-    }
+    destroyShapes();
 
-    if(_nodeCount != other._nodeCount) {
-        delete[] _nodes;
+    /* Reuse the memory if the layout is the same */
+    if(_shapeCount != other._shapeCount || _nodeCount != other._nodeCount || _shapeDataSize != other._shapeDataSize) {
+        delete[] _data;
+        _shapeCount = other._shapeCount;
         _nodeCount = other._nodeCount;
-        _nodes = new Node[_nodeCount];
+        _shapeDataSize = other._shapeDataSize;
+        allocate();
     }
 
-    copyShapes(0, other);
     copyNodes(0, other);
+    copyShapes(0, 0, other);
+    std::copy(other.nodeBounds(), other.nodeBounds() + _nodeCount + _shapeCount, nodeBounds());
     return *this;
 }
 
 template<UnsignedInt dimensions> Composition<dimensions>& Composition<dimensions>::operator=(Composition<dimensions>&& other) {
     std::swap(other._shapeCount, _shapeCount);
     std::swap(other._nodeCount, _nodeCount);
-    std::swap(other._shapes, _shapes);
-    std::swap(other._nodes, _nodes);
+    std::swap(other._shapeDataSize, _shapeDataSize);
+    std::swap(other._data, _data);
     return *this;
 }
 
-template<UnsignedInt dimensions> void Composition<dimensions>::copyShapes(const std::size_t offset, Composition<dimensions>&& other) {
-    std::move(other._shapes, other._shapes+other._shapeCount, _shapes+offset);
-    delete[] other._shapes;
-    other._shapes = nullptr;
-    other._shapeCount = 0;
+template<UnsignedInt dimensions> void Composition<dimensions>::allocate() {
+    const std::size_t size = shapeDataOffset() + _shapeDataSize;
+    _data = size ? new char[size] : nullptr;
 }
 
-template<UnsignedInt dimensions> void Composition<dimensions>::copyShapes(const std::size_t offset, const Composition<dimensions>& other) {
-    for(std::size_t i = 0; i != other._shapeCount; ++i)
-        _shapes[i+offset] = other._shapes[i]->clone();
+template<UnsignedInt dimensions> void Composition<dimensions>::destroyShapes() {
+    for(std::size_t i = 0; i != _shapeCount; ++i)
+        shapes()[i]->~AbstractShape();
+}
+
+template<UnsignedInt dimensions> void Composition<dimensions>::copyShapes(const std::size_t offset, const std::size_t dataOffset, const Composition<dimensions>& other) {
+    for(std::size_t i = 0; i != other._shapeCount; ++i) {
+        shapeOffsets()[i+offset] = other.shapeOffsets()[i] + dataOffset;
+        shapes()[i+offset] = other.shapes()[i]->clone(shapeData() + shapeOffsets()[i+offset]);
+    }
 }
 
 template<UnsignedInt dimensions> void Composition<dimensions>::copyNodes(std::size_t offset, const Composition<dimensions>& other) {
-    std::copy(other._nodes, other._nodes+other._nodeCount, _nodes+offset);
+    std::copy(other.nodes(), other.nodes()+other._nodeCount, nodes()+offset);
 }
 
 template<UnsignedInt dimensions> Composition<dimensions> Composition<dimensions>::transformed(const typename DimensionTraits<dimensions, Float>::MatrixType& matrix) const {
     Composition<dimensions> out(*this);
     for(std::size_t i = 0; i != _shapeCount; ++i)
-        _shapes[i]->transform(matrix, out._shapes[i]);
+        shapes()[i]->transform(matrix, out.shapes()[i]);
+    out.updateBounds();
     return out;
 }
 
-template<UnsignedInt dimensions> bool Composition<dimensions>::collides(const Implementation::AbstractShape<dimensions>& a, const std::size_t node, const std::size_t shapeBegin, const std::size_t shapeEnd) const {
+template<UnsignedInt dimensions> void Composition<dimensions>::updateBounds() {
+    for(std::size_t i = 0; i != _shapeCount; ++i)
+        Implementation::bounds(*shapes()[i], shapeBounds()[i].min, shapeBounds()[i].max);
+
+    if(_nodeCount) updateBounds(0, 0, _shapeCount);
+}
+
+template<UnsignedInt dimensions> void Composition<dimensions>::updateBounds(const std::size_t node, const std::size_t shapeBegin, const std::size_t shapeEnd) {
+    Bounds& bounds = nodeBounds()[node];
+
+    /* Empty group */
+    if(shapeBegin == shapeEnd) {
+        bounds.min = typename DimensionTraits<dimensions, Float>::VectorType(std::numeric_limits<Float>::infinity());
+        bounds.max = typename DimensionTraits<dimensions, Float>::VectorType(-std::numeric_limits<Float>::infinity());
+        return;
+    }
+
+    /* Left child, either shape or subtree */
+    if(nodes()[node].rightNode == 0 || nodes()[node].rightNode == 2)
+        bounds = shapeBounds()[shapeBegin];
+    else {
+        updateBounds(node+1, shapeBegin, shapeBegin+nodes()[node].rightShape);
+        bounds = nodeBounds()[node+1];
+    }
+
+    /* Negation of anything is unbounded */
+    if(nodes()[node].operation == CompositionOperation::Not) {
+        bounds.min = typename DimensionTraits<dimensions, Float>::VectorType(-std::numeric_limits<Float>::infinity());
+        bounds.max = typename DimensionTraits<dimensions, Float>::VectorType(std::numeric_limits<Float>::infinity());
+        return;
+    }
+
+    /* Both AND and OR can collide with anything touching any of the shapes,
+       thus the bounds are union of both children */
+    const Bounds* right;
+    if(nodes()[node].rightNode < 2)
+        right = shapeBounds() + shapeBegin + nodes()[node].rightShape;
+    else {
+        updateBounds(node+nodes()[node].rightNode-1, shapeBegin+nodes()[node].rightShape, shapeEnd);
+        right = nodeBounds() + node + nodes()[node].rightNode - 1;
+    }
+
+    bounds.min = Math::min(bounds.min, right->min);
+    bounds.max = Math::max(bounds.max, right->max);
+}
+
+namespace {
+    template<class Bounds> inline bool overlaps(const Bounds& a, const Bounds& b) {
+        for(std::size_t i = 0; i != decltype(a.min)::Size; ++i)
+            if(a.max[i] < b.min[i] || b.max[i] < a.min[i]) return false;
+        return true;
+    }
+}
+
+template<UnsignedInt dimensions> bool Composition<dimensions>::collides(const Implementation::AbstractShape<dimensions>& a) const {
+    /* Empty group */
+    if(!_shapeCount) return false;
+
+    Bounds aBounds;
+    Implementation::bounds(a, aBounds.min, aBounds.max);
+    return collides(a, aBounds, 0, 0, _shapeCount);
+}
+
+template<UnsignedInt dimensions> bool Composition<dimensions>::collides(const Implementation::AbstractShape<dimensions>& a, const Bounds& aBounds, const std::size_t shape) const {
+    return overlaps(aBounds, shapeBounds()[shape]) && Implementation::collides(a, *shapes()[shape]);
+}
+
+template<UnsignedInt dimensions> bool Composition<dimensions>::collides(const Implementation::AbstractShape<dimensions>& a, const Bounds& aBounds, const std::size_t node, const std::size_t shapeBegin, const std::size_t shapeEnd) const {
     /* Empty group */
     if(shapeBegin == shapeEnd) return false;
 
     CORRADE_INTERNAL_ASSERT(node < _nodeCount && shapeBegin < shapeEnd);
 
+    /* The shape is outside of the subtree bounds, so it can't collide with
+       it. Subtrees with NOT operation have infinite bounds. */
+    if(!overlaps(aBounds, nodeBounds()[node])) return false;
+
     /* Collision on the left child. If the node is leaf one (no left child
        exists), do it directly, recurse instead. */
-    const bool collidesLeft = (_nodes[node].rightNode == 0 || _nodes[node].rightNode == 2) ?
-        Implementation::collides(a, *_shapes[shapeBegin]) :
-        collides(a, node+1, shapeBegin, shapeBegin+_nodes[node].rightShape);
+    const bool collidesLeft = (nodes()[node].rightNode == 0 || nodes()[node].rightNode == 2) ?
+        collides(a, aBounds, shapeBegin) :
+        collides(a, aBounds, node+1, shapeBegin, shapeBegin+nodes()[node].rightShape);
 
     /* NOT operation */
-    if(_nodes[node].operation == CompositionOperation::Not)
+    if(nodes()[node].operation == CompositionOperation::Not)
         return !collidesLeft;
 
     /* Short-circuit evaluation for AND/OR */
-    if((_nodes[node].operation == CompositionOperation::Or) == collidesLeft)
+    if((nodes()[node].operation == CompositionOperation::Or) == collidesLeft)
         return collidesLeft;
 
     /* Now the collision result depends only on the right child. Similar to
        collision on the left child. */
-    return (_nodes[node].rightNode < 2) ?
-        Implementation::collides(a, *_shapes[shapeBegin+_nodes[node].rightShape]) :
-        collides(a, node+_nodes[node].rightNode-1, shapeBegin+_nodes[node].rightShape, shapeEnd);
+    return (nodes()[node].rightNode < 2) ?
+        collides(a, aBounds, shapeBegin+nodes()[node].rightShape) :
+        collides(a, aBounds, node+nodes()[node].rightNode-1, shapeBegin+nodes()[node].rightShape, shapeEnd);
+}
+
+template<UnsignedInt dimensions> void Composition<dimensions>::bounds(typename DimensionTraits<dimensions, Float>::VectorType& min, typename DimensionTraits<dimensions, Float>::VectorType& max) const {
+    /* Empty composition has inverted infinite bounds, thus it never overlaps
+       anything */
+    if(!_shapeCount) {
+        min = typename DimensionTraits<dimensions, Float>::VectorType(std::numeric_limits<Float>::infinity());
+        max = typename DimensionTraits<dimensions, Float>::VectorType(-std::numeric_limits<Float>::infinity());
+        return;
+    }
+
+    min = nodeBounds()[0].min;
+    max = nodeBounds()[0].max;
 }
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
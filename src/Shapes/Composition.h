@@ -28,6 +28,7 @@
  * @brief Class Magnum::Shapes::Composition, enum Magnum::Shapes::CompositionOperation
  */
 
+#include <new>
 #include <type_traits>
 #include <utility>
 #include <Utility/Assert.h>
@@ -41,12 +42,13 @@ namespace Magnum { namespace Shapes {
 
 namespace Implementation {
     template<class> struct ShapeHelper;
+    template<UnsignedInt dimensions> void bounds(const AbstractShape<dimensions>& shape, typename DimensionTraits<dimensions, Float>::VectorType& min, typename DimensionTraits<dimensions, Float>::VectorType& max);
 
     template<UnsignedInt dimensions> inline AbstractShape<dimensions>& getAbstractShape(Composition<dimensions>& group, std::size_t i) {
-        return *group._shapes[i];
+        return *group.shapes()[i];
     }
     template<UnsignedInt dimensions> inline const AbstractShape<dimensions>& getAbstractShape(const Composition<dimensions>& group, std::size_t i) {
-        return *group._shapes[i];
+        return *group.shapes()[i];
     }
 }
 
@@ -61,11 +63,18 @@ enum class CompositionOperation: UnsignedByte {
 @brief Composition of shapes
 
 Result of logical operations on shapes. See @ref shapes for brief introduction.
+
+The hierarchy, bounds of all subtrees and the shapes themselves are stored in
+one contiguous memory block, so creating, copying or transforming the
+composition needs at most one allocation. If the tested shape doesn't overlap
+bounds of a shape or of an AND/OR subtree, the exact collision test for it is
+skipped.
 */
 template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT Composition {
     friend Implementation::AbstractShape<dimensions>& Implementation::getAbstractShape<>(Composition<dimensions>&, std::size_t);
     friend const Implementation::AbstractShape<dimensions>& Implementation::getAbstractShape<>(const Composition<dimensions>&, std::size_t);
     friend struct Implementation::ShapeHelper<Composition<dimensions>>;
+    friend void Implementation::bounds<>(const Implementation::AbstractShape<dimensions>&, typename DimensionTraits<dimensions, Float>::VectorType&, typename DimensionTraits<dimensions, Float>::VectorType&);
 
     public:
         enum: UnsignedInt {
@@ -84,6 +93,7 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT Composition {
             Capsule,        /**< Capsule */
             AxisAlignedBox, /**< @ref AxisAlignedBox "Axis aligned box" */
             Box,            /**< Box */
+            ConvexHull,     /**< @ref ConvexHull "Convex hull" */
             Plane           /**< Plane (3D only) */
         };
         #else
@@ -95,7 +105,7 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT Composition {
          *
          * Creates empty hierarchy.
          */
-        explicit Composition(): _shapeCount(0), _nodeCount(0), _shapes(nullptr), _nodes(nullptr) {}
+        explicit Composition(): _shapeCount(0), _nodeCount(0), _shapeDataSize(0), _data(nullptr) {}
 
         /**
          * @brief Unary operation constructor
@@ -133,7 +143,7 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT Composition {
         std::size_t size() const { return _shapeCount; }
 
         /** @brief Type of shape at given position */
-        Type type(std::size_t i) const { return _shapes[i]->type(); }
+        Type type(std::size_t i) const { return shapes()[i]->type(); }
 
         /** @brief Shape at given position */
         template<class T> const T& get(std::size_t i) const;
@@ -153,11 +163,52 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT Composition {
             CompositionOperation operation;
         };
 
-        bool collides(const Implementation::AbstractShape<dimensions>& a) const {
-            return collides(a, 0, 0, _shapeCount);
+        struct Bounds {
+            typename DimensionTraits<dimensions, Float>::VectorType min, max;
+        };
+
+        /* Alignment of all parts of the data block */
+        enum: std::size_t {
+            Alignment = std::alignment_of<Implementation::AbstractShape<dimensions>>::value
+        };
+
+        constexpr static std::size_t alignedSize(std::size_t size) {
+            return (size + Alignment - 1)/Alignment*Alignment;
+        }
+
+        /* Data block layout: nodes, node bounds, shape bounds, shape
+           pointers, shape offsets and then the shapes themselves */
+        Node* nodes() { return reinterpret_cast<Node*>(_data); }
+        const Node* nodes() const { return reinterpret_cast<const Node*>(_data); }
+        Bounds* nodeBounds() { return reinterpret_cast<Bounds*>(_data + alignedSize(_nodeCount*sizeof(Node))); }
+        const Bounds* nodeBounds() const { return reinterpret_cast<const Bounds*>(_data + alignedSize(_nodeCount*sizeof(Node))); }
+        Bounds* shapeBounds() { return nodeBounds() + _nodeCount; }
+        const Bounds* shapeBounds() const { return nodeBounds() + _nodeCount; }
+        Implementation::AbstractShape<dimensions>** shapes() { return reinterpret_cast<Implementation::AbstractShape<dimensions>**>(_data + shapePointerOffset()); }
+        Implementation::AbstractShape<dimensions>* const* shapes() const { return reinterpret_cast<Implementation::AbstractShape<dimensions>* const*>(_data + shapePointerOffset()); }
+        std::size_t* shapeOffsets() { return reinterpret_cast<std::size_t*>(_data + shapePointerOffset() + alignedSize(_shapeCount*sizeof(void*))); }
+        const std::size_t* shapeOffsets() const { return reinterpret_cast<const std::size_t*>(_data + shapePointerOffset() + alignedSize(_shapeCount*sizeof(void*))); }
+        char* shapeData() { return _data + shapeDataOffset(); }
+
+        std::size_t shapePointerOffset() const {
+            return alignedSize(_nodeCount*sizeof(Node)) + alignedSize((_nodeCount + _shapeCount)*sizeof(Bounds));
         }
+        std::size_t shapeDataOffset() const {
+            return shapePointerOffset() + alignedSize(_shapeCount*sizeof(void*)) + alignedSize(_shapeCount*sizeof(std::size_t));
+        }
+
+        void allocate();
+        void destroyShapes();
+        void updateBounds();
+        void updateBounds(std::size_t node, std::size_t shapeBegin, std::size_t shapeEnd);
+
+        bool collides(const Implementation::AbstractShape<dimensions>& a) const;
+
+        bool collides(const Implementation::AbstractShape<dimensions>& a, const Bounds& aBounds, std::size_t node, std::size_t shapeBegin, std::size_t shapeEnd) const;
 
-        bool collides(const Implementation::AbstractShape<dimensions>& a, std::size_t node, std::size_t shapeBegin, std::size_t shapeEnd) const;
+        bool collides(const Implementation::AbstractShape<dimensions>& a, const Bounds& aBounds, std::size_t shape) const;
+
+        void bounds(typename DimensionTraits<dimensions, Float>::VectorType& min, typename DimensionTraits<dimensions, Float>::VectorType& max) const;
 
         template<class T> constexpr static std::size_t shapeCount(const T&) {
             return 1;
@@ -171,19 +222,25 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT Composition {
         constexpr static std::size_t nodeCount(const Composition<dimensions>& hierarchy) {
             return hierarchy._nodeCount;
         }
+        template<class T> constexpr static std::size_t shapeDataSize(const T&) {
+            return alignedSize(sizeof(Implementation::Shape<T>));
+        }
+        constexpr static std::size_t shapeDataSize(const Composition<dimensions>& hierarchy) {
+            return hierarchy._shapeDataSize;
+        }
 
-        template<class T> void copyShapes(std::size_t offset, const T& shape) {
-            _shapes[offset] = new Implementation::Shape<T>(shape);
+        template<class T> void copyShapes(std::size_t offset, std::size_t dataOffset, const T& shape) {
+            static_assert(std::alignment_of<Implementation::Shape<T>>::value <= Alignment, "Shapes::Composition: unsupported shape alignment");
+            shapeOffsets()[offset] = dataOffset;
+            shapes()[offset] = new(shapeData() + dataOffset) Implementation::Shape<T>(shape);
         }
-        void copyShapes(std::size_t offset, Composition<dimensions>&& other);
-        void copyShapes(std::size_t offset, const Composition<dimensions>& other);
+        void copyShapes(std::size_t offset, std::size_t dataOffset, const Composition<dimensions>& other);
 
         template<class T> void copyNodes(std::size_t, const T&) {}
         void copyNodes(std::size_t offset, const Composition<dimensions>& other);
 
-        std::size_t _shapeCount, _nodeCount;
-        Implementation::AbstractShape<dimensions>** _shapes;
-        Node* _nodes;
+        std::size_t _shapeCount, _nodeCount, _shapeDataSize;
+        char* _data;
 };
 
 /** @brief Two-dimensional shape hierarchy */
@@ -255,42 +312,46 @@ template<class T, class U> inline auto operator||(T&& a, U&& b) -> enableIfAreSh
 #undef enableIfAreShapeType
 #endif
 
-template<UnsignedInt dimensions> template<class T> Composition<dimensions>::Composition(CompositionOperation operation, T&& a): _shapeCount(shapeCount(a)), _nodeCount(nodeCount(a)+1), _shapes(new Implementation::AbstractShape<dimensions>*[_shapeCount]), _nodes(new Node[_nodeCount]) {
+template<UnsignedInt dimensions> template<class T> Composition<dimensions>::Composition(CompositionOperation operation, T&& a): _shapeCount(shapeCount(a)), _nodeCount(nodeCount(a)+1), _shapeDataSize(shapeDataSize(a)) {
     CORRADE_ASSERT(operation == CompositionOperation::Not,
         "Shapes::Composition::Composition(): unary operation expected", );
-    _nodes[0].operation = operation;
+    allocate();
+    nodes()[0].operation = operation;
 
     /* 0 = no children, 1 = left child only */
-    _nodes[0].rightNode = (nodeCount(a) == 0 ? 0 : 1);
-    _nodes[0].rightShape = shapeCount(a);
+    nodes()[0].rightNode = (nodeCount(a) == 0 ? 0 : 1);
+    nodes()[0].rightShape = shapeCount(a);
     copyNodes(1, a);
-    copyShapes(0, std::forward<T>(a));
+    copyShapes(0, 0, a);
+    updateBounds();
 }
 
-template<UnsignedInt dimensions> template<class T, class U> Composition<dimensions>::Composition(CompositionOperation operation, T&& a, U&& b): _shapeCount(shapeCount(a) + shapeCount(b)), _nodeCount(nodeCount(a) + nodeCount(b) + 1), _shapes(new Implementation::AbstractShape<dimensions>*[_shapeCount]), _nodes(new Node[_nodeCount]) {
+template<UnsignedInt dimensions> template<class T, class U> Composition<dimensions>::Composition(CompositionOperation operation, T&& a, U&& b): _shapeCount(shapeCount(a) + shapeCount(b)), _nodeCount(nodeCount(a) + nodeCount(b) + 1), _shapeDataSize(shapeDataSize(a) + shapeDataSize(b)) {
     CORRADE_ASSERT(operation != CompositionOperation::Not,
         "Shapes::Composition::Composition(): binary operation expected", );
-    _nodes[0].operation = operation;
+    allocate();
+    nodes()[0].operation = operation;
 
     /* 0 = no children, 1 = left child only, 2 = right child only, >2 = both */
     if(nodeCount(a) == 0 && nodeCount(b) == 0)
-        _nodes[0].rightNode = 0;
+        nodes()[0].rightNode = 0;
     else if(nodeCount(b) == 0)
-        _nodes[0].rightNode = 1;
-    else _nodes[0].rightNode = nodeCount(a) + 2;
+        nodes()[0].rightNode = 1;
+    else nodes()[0].rightNode = nodeCount(a) + 2;
 
-    _nodes[0].rightShape = shapeCount(a);
+    nodes()[0].rightShape = shapeCount(a);
     copyNodes(1, a);
     copyNodes(nodeCount(a) + 1, b);
-    copyShapes(shapeCount(a), std::forward<U>(b));
-    copyShapes(0, std::forward<T>(a));
+    copyShapes(0, 0, a);
+    copyShapes(shapeCount(a), shapeDataSize(a), b);
+    updateBounds();
 }
 
 template<UnsignedInt dimensions> template<class T> inline const T& Composition<dimensions>::get(std::size_t i) const {
-    CORRADE_ASSERT(_shapes[i]->type() == Implementation::TypeOf<T>::type(),
+    CORRADE_ASSERT(shapes()[i]->type() == Implementation::TypeOf<T>::type(),
         "Shapes::Composition::get(): given shape is not of type" << Implementation::TypeOf<T>::type() <<
-        "but" << _shapes[i]->type(), *static_cast<T*>(nullptr));
-    return static_cast<Implementation::Shape<T>*>(_shapes[i])->shape;
+        "but" << shapes()[i]->type(), *static_cast<T*>(nullptr));
+    return static_cast<const Implementation::Shape<T>*>(shapes()[i])->shape;
 }
 
 }}
@@ -0,0 +1,95 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "ConvexHull.h"
+
+#include "Math/Matrix3.h"
+#include "Math/Matrix4.h"
+#include "Shapes/AxisAlignedBox.h"
+#include "Shapes/Box.h"
+#include "Shapes/Capsule.h"
+#include "Shapes/LineSegment.h"
+#include "Shapes/Point.h"
+#include "Shapes/Sphere.h"
+#include "Shapes/Implementation/Gjk.h"
+
+namespace Magnum { namespace Shapes {
+
+template<UnsignedInt dimensions> ConvexHull<dimensions> ConvexHull<dimensions>::transformed(const typename DimensionTraits<dimensions, Float>::MatrixType& matrix) const {
+    std::vector<typename DimensionTraits<dimensions, Float>::VectorType> points;
+    points.reserve(_points.size());
+    for(const auto& point: _points)
+        points.push_back(matrix.transformPoint(point));
+    return ConvexHull<dimensions>(std::move(points));
+}
+
+template<UnsignedInt dimensions> typename DimensionTraits<dimensions, Float>::VectorType ConvexHull<dimensions>::support(const typename DimensionTraits<dimensions, Float>::VectorType& direction) const {
+    CORRADE_ASSERT(!_points.empty(), "Shapes::ConvexHull::support(): the hull is empty", {});
+
+    std::size_t farthest = 0;
+    Float distance = Math::Vector<dimensions, Float>::dot(_points[0], direction);
+    for(std::size_t i = 1; i != _points.size(); ++i) {
+        const Float d = Math::Vector<dimensions, Float>::dot(_points[i], direction);
+        if(d > distance) {
+            distance = d;
+            farthest = i;
+        }
+    }
+
+    return _points[farthest];
+}
+
+/* Empty hull doesn't collide with anything */
+#define _c(type)                                                            \
+    template<UnsignedInt dimensions> bool ConvexHull<dimensions>::operator%(const type<dimensions>& other) const { \
+        return !_points.empty() && Implementation::convexCollides(Implementation::convexSupport(*this), Implementation::convexSupport(other)); \
+    }                                                                       \
+    template<UnsignedInt dimensions> Collision<dimensions> ConvexHull<dimensions>::operator/(const type<dimensions>& other) const { \
+        if(_points.empty()) return {};                                      \
+        return Implementation::convexCollision(Implementation::convexSupport(*this), Implementation::convexSupport(other)); \
+    }
+_c(Point)
+_c(LineSegment)
+_c(Sphere)
+_c(Capsule)
+_c(AxisAlignedBox)
+_c(Box)
+#undef _c
+
+template<UnsignedInt dimensions> bool ConvexHull<dimensions>::operator%(const ConvexHull<dimensions>& other) const {
+    return !_points.empty() && !other._points.empty() && Implementation::convexCollides(Implementation::convexSupport(*this), Implementation::convexSupport(other));
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> ConvexHull<dimensions>::operator/(const ConvexHull<dimensions>& other) const {
+    if(_points.empty() || other._points.empty()) return {};
+    return Implementation::convexCollision(Implementation::convexSupport(*this), Implementation::convexSupport(other));
+}
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template class MAGNUM_SHAPES_EXPORT ConvexHull<2>;
+template class MAGNUM_SHAPES_EXPORT ConvexHull<3>;
+#endif
+
+}}
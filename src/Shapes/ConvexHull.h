@@ -0,0 +1,188 @@
+#ifndef Magnum_Shapes_ConvexHull_h
+#define Magnum_Shapes_ConvexHull_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::Shapes::ConvexHull, typedef Magnum::Shapes::ConvexHull2D, Magnum::Shapes::ConvexHull3D
+ */
+
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "Math/Vector3.h"
+#include "DimensionTraits.h"
+#include "Shapes/Collision.h"
+#include "Shapes/Shapes.h"
+#include "Shapes/magnumShapesVisibility.h"
+
+namespace Magnum { namespace Shapes {
+
+/**
+@brief Convex hull of a point cloud
+
+The points don't need to form the hull exactly, points inside the hull don't
+affect collision detection and are only making it slower. Collisions with
+other convex shapes are detected using GJK algorithm on support points of the
+shapes, collision data are computed with EPA algorithm, see @ref shapes for
+brief introduction.
+
+Unlike other shapes, the hull stores its points in dynamically allocated
+memory, so copying and transforming it is not as cheap as with the other
+shapes.
+@see ConvexHull2D, ConvexHull3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ConvexHull {
+    public:
+        enum: UnsignedInt {
+            Dimensions = dimensions /**< Dimension count */
+        };
+
+        /**
+         * @brief Default constructor
+         *
+         * Creates empty hull, which doesn't collide with anything.
+         */
+        /*implicit*/ ConvexHull() {}
+
+        /** @brief Constructor */
+        /*implicit*/ ConvexHull(std::vector<typename DimensionTraits<dimensions, Float>::VectorType> points): _points(std::move(points)) {}
+
+        /** @overload */
+        /*implicit*/ ConvexHull(std::initializer_list<typename DimensionTraits<dimensions, Float>::VectorType> points): _points(points) {}
+
+        /** @brief Transformed shape */
+        ConvexHull<dimensions> transformed(const typename DimensionTraits<dimensions, Float>::MatrixType& matrix) const;
+
+        /** @brief Points */
+        const std::vector<typename DimensionTraits<dimensions, Float>::VectorType>& points() const {
+            return _points;
+        }
+
+        /** @brief Set points */
+        void setPoints(std::vector<typename DimensionTraits<dimensions, Float>::VectorType> points) {
+            _points = std::move(points);
+        }
+
+        /**
+         * @brief Support point
+         *
+         * Point of the shape farthest in given direction, used for collision
+         * detection of arbitrary convex shapes. Expects that the hull is not
+         * empty.
+         */
+        typename DimensionTraits<dimensions, Float>::VectorType support(const typename DimensionTraits<dimensions, Float>::VectorType& direction) const;
+
+        /** @brief %Collision occurence with point */
+        bool operator%(const Point<dimensions>& other) const;
+
+        /** @brief %Collision with point */
+        Collision<dimensions> operator/(const Point<dimensions>& other) const;
+
+        /** @brief %Collision occurence with line segment */
+        bool operator%(const LineSegment<dimensions>& other) const;
+
+        /** @brief %Collision with line segment */
+        Collision<dimensions> operator/(const LineSegment<dimensions>& other) const;
+
+        /** @brief %Collision occurence with sphere */
+        bool operator%(const Sphere<dimensions>& other) const;
+
+        /** @brief %Collision with sphere */
+        Collision<dimensions> operator/(const Sphere<dimensions>& other) const;
+
+        /** @brief %Collision occurence with capsule */
+        bool operator%(const Capsule<dimensions>& other) const;
+
+        /** @brief %Collision with capsule */
+        Collision<dimensions> operator/(const Capsule<dimensions>& other) const;
+
+        /** @brief %Collision occurence with axis-aligned box */
+        bool operator%(const AxisAlignedBox<dimensions>& other) const;
+
+        /** @brief %Collision with axis-aligned box */
+        Collision<dimensions> operator/(const AxisAlignedBox<dimensions>& other) const;
+
+        /** @brief %Collision occurence with box */
+        bool operator%(const Box<dimensions>& other) const;
+
+        /** @brief %Collision with box */
+        Collision<dimensions> operator/(const Box<dimensions>& other) const;
+
+        /** @brief %Collision occurence with convex hull */
+        bool operator%(const ConvexHull<dimensions>& other) const;
+
+        /** @brief %Collision with convex hull */
+        Collision<dimensions> operator/(const ConvexHull<dimensions>& other) const;
+
+    private:
+        std::vector<typename DimensionTraits<dimensions, Float>::VectorType> _points;
+};
+
+/** @brief Two-dimensional convex hull */
+typedef ConvexHull<2> ConvexHull2D;
+
+/** @brief Three-dimensional convex hull */
+typedef ConvexHull<3> ConvexHull3D;
+
+/** @collisionoccurenceoperator{Point,ConvexHull} */
+template<UnsignedInt dimensions> inline bool operator%(const Point<dimensions>& a, const ConvexHull<dimensions>& b) { return b % a; }
+
+/** @collisionoperator{Point,ConvexHull} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Point<dimensions>& a, const ConvexHull<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoccurenceoperator{LineSegment,ConvexHull} */
+template<UnsignedInt dimensions> inline bool operator%(const LineSegment<dimensions>& a, const ConvexHull<dimensions>& b) { return b % a; }
+
+/** @collisionoperator{LineSegment,ConvexHull} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const LineSegment<dimensions>& a, const ConvexHull<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoccurenceoperator{Sphere,ConvexHull} */
+template<UnsignedInt dimensions> inline bool operator%(const Sphere<dimensions>& a, const ConvexHull<dimensions>& b) { return b % a; }
+
+/** @collisionoperator{Sphere,ConvexHull} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Sphere<dimensions>& a, const ConvexHull<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoccurenceoperator{Capsule,ConvexHull} */
+template<UnsignedInt dimensions> inline bool operator%(const Capsule<dimensions>& a, const ConvexHull<dimensions>& b) { return b % a; }
+
+/** @collisionoperator{Capsule,ConvexHull} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Capsule<dimensions>& a, const ConvexHull<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoccurenceoperator{AxisAlignedBox,ConvexHull} */
+template<UnsignedInt dimensions> inline bool operator%(const AxisAlignedBox<dimensions>& a, const ConvexHull<dimensions>& b) { return b % a; }
+
+/** @collisionoperator{AxisAlignedBox,ConvexHull} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const AxisAlignedBox<dimensions>& a, const ConvexHull<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoccurenceoperator{Box,ConvexHull} */
+template<UnsignedInt dimensions> inline bool operator%(const Box<dimensions>& a, const ConvexHull<dimensions>& b) { return b % a; }
+
+/** @collisionoperator{Box,ConvexHull} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Box<dimensions>& a, const ConvexHull<dimensions>& b) { return (b/a).flipped(); }
+
+}}
+
+#endif
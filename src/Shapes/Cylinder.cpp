@@ -31,6 +31,7 @@
 #include "Magnum.h"
 #include "Shapes/Point.h"
 #include "Shapes/Sphere.h"
+#include "Shapes/Implementation/ContactGeneration.h"
 
 using namespace Magnum::Math::Geometry;
 
@@ -50,6 +51,29 @@ template<UnsignedInt dimensions> bool Cylinder<dimensions>::operator%(const Sphe
         Math::pow<2>(_radius+other.radius());
 }
 
+template<UnsignedInt dimensions> Collision<dimensions> Cylinder<dimensions>::operator/(const Point<dimensions>& other) const {
+    return *this/Sphere<dimensions>(other.position(), 0.0f);
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> Cylinder<dimensions>::operator/(const Sphere<dimensions>& other) const {
+    Float s, t;
+    Implementation::closestPoints(_a, _b, false, other.position(), other.position(), true, s, t);
+    return Implementation::roundedContact<dimensions>(_a + (_b - _a)*s, _radius, other.position(), other.radius());
+}
+
+template<UnsignedInt dimensions> bool Cylinder<dimensions>::operator%(const Cylinder<dimensions>& other) const {
+    Float s, t;
+    Implementation::closestPoints(_a, _b, false, other._a, other._b, false, s, t);
+    return ((_a + (_b - _a)*s) - (other._a + (other._b - other._a)*t)).dot() <
+        Math::pow<2>(_radius+other._radius);
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> Cylinder<dimensions>::operator/(const Cylinder<dimensions>& other) const {
+    Float s, t;
+    Implementation::closestPoints(_a, _b, false, other._a, other._b, false, s, t);
+    return Implementation::roundedContact<dimensions>(_a + (_b - _a)*s, _radius, other._a + (other._b - other._a)*t, other._radius);
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class MAGNUM_SHAPES_EXPORT Cylinder<2>;
 template class MAGNUM_SHAPES_EXPORT Cylinder<3>;
@@ -30,6 +30,7 @@
 
 #include "Math/Vector3.h"
 #include "DimensionTraits.h"
+#include "Shapes/Collision.h"
 #include "Shapes/Shapes.h"
 #include "Shapes/magnumShapesVisibility.h"
 
@@ -92,9 +93,21 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT Cylinder {
         /** @brief %Collision occurence with point */
         bool operator%(const Point<dimensions>& other) const;
 
+        /** @brief %Collision with point */
+        Collision<dimensions> operator/(const Point<dimensions>& other) const;
+
         /** @brief %Collision occurence with sphere */
         bool operator%(const Sphere<dimensions>& other) const;
 
+        /** @brief %Collision with sphere */
+        Collision<dimensions> operator/(const Sphere<dimensions>& other) const;
+
+        /** @brief %Collision occurence with cylinder */
+        bool operator%(const Cylinder<dimensions>& other) const;
+
+        /** @brief %Collision with cylinder */
+        Collision<dimensions> operator/(const Cylinder<dimensions>& other) const;
+
     private:
         typename DimensionTraits<dimensions, Float>::VectorType _a, _b;
         Float _radius;
@@ -109,9 +122,15 @@ typedef Cylinder<3> Cylinder3D;
 /** @collisionoccurenceoperator{Point,Cylinder} */
 template<UnsignedInt dimensions> inline bool operator%(const Point<dimensions>& a, const Cylinder<dimensions>& b) { return b % a; }
 
+/** @collisionoperator{Point,Cylinder} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Point<dimensions>& a, const Cylinder<dimensions>& b) { return (b/a).flipped(); }
+
 /** @collisionoccurenceoperator{Sphere,Cylinder} */
 template<UnsignedInt dimensions> inline bool operator%(const Sphere<dimensions>& a, const Cylinder<dimensions>& b) { return b % a; }
 
+/** @collisionoperator{Sphere,Cylinder} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Sphere<dimensions>& a, const Cylinder<dimensions>& b) { return (b/a).flipped(); }
+
 }}
 
 #endif
@@ -24,20 +24,68 @@
 
 #include "CollisionDispatch.h"
 
+#include <algorithm>
+#include <limits>
+
+#include "Math/Functions.h"
 #include "Shapes/AxisAlignedBox.h"
 #include "Shapes/Box.h"
 #include "Shapes/Capsule.h"
+#include "Shapes/Composition.h"
+#include "Shapes/ConvexHull.h"
 #include "Shapes/Cylinder.h"
 #include "Shapes/LineSegment.h"
 #include "Shapes/Plane.h"
 #include "Shapes/Point.h"
 #include "Shapes/Sphere.h"
 #include "Shapes/shapeImplementation.h"
+#include "Shapes/Implementation/Gjk.h"
 
 namespace Magnum { namespace Shapes { namespace Implementation {
 
-template<> bool collides(const AbstractShape<2>& a, const AbstractShape<2>& b) {
-    if(a.type() < b.type()) return collides(b, a);
+namespace {
+
+/* Support mapping of convex shapes, returns false for other shape types */
+template<UnsignedInt dimensions> bool shapeSupport(const AbstractShape<dimensions>& shape, ConvexSupport<dimensions>& support) {
+    switch(shape.type()) {
+        #define _c(type) \
+            case ShapeDimensionTraits<dimensions>::Type::type: \
+                support = convexSupport(static_cast<const Shape<Shapes::type<dimensions>>&>(shape).shape); \
+                return true;
+        _c(Point)
+        _c(LineSegment)
+        _c(Sphere)
+        _c(Capsule)
+        _c(AxisAlignedBox)
+        _c(Box)
+        #undef _c
+
+        /* Empty hull doesn't collide with anything */
+        case ShapeDimensionTraits<dimensions>::Type::ConvexHull:
+            support = convexSupport(static_cast<const Shape<Shapes::ConvexHull<dimensions>>&>(shape).shape);
+            return !static_cast<const Shape<Shapes::ConvexHull<dimensions>>&>(shape).shape.points().empty();
+
+        default: return false;
+    }
+}
+
+/* GJK fallback for pairs of convex shapes without dedicated implementation */
+template<UnsignedInt dimensions> bool genericCollides(const AbstractShape<dimensions>& a, const AbstractShape<dimensions>& b, typename DimensionTraits<dimensions, Float>::VectorType* separatingAxis) {
+    ConvexSupport<dimensions> aSupport, bSupport;
+    return shapeSupport(a, aSupport) && shapeSupport(b, bSupport) &&
+        convexCollides(aSupport, bSupport, separatingAxis);
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> genericCollision(const AbstractShape<dimensions>& a, const AbstractShape<dimensions>& b) {
+    ConvexSupport<dimensions> aSupport, bSupport;
+    if(!shapeSupport(a, aSupport) || !shapeSupport(b, bSupport)) return {};
+    return convexCollision(aSupport, bSupport);
+}
+
+}
+
+template<> bool collides(const AbstractShape<2>& a, const AbstractShape<2>& b, Vector2* separatingAxis) {
+    if(a.type() < b.type()) return collides(b, a, separatingAxis);
 
     switch(UnsignedInt(a.type())*UnsignedInt(b.type())) {
         #define _c(aType, aClass, bType, bClass) \
@@ -53,19 +101,33 @@ template<> bool collides(const AbstractShape<2>& a, const AbstractShape<2>& b) {
 
         _c(Cylinder, Cylinder2D, Point, Point2D)
         _c(Cylinder, Cylinder2D, Sphere, Sphere2D)
+        _c(Cylinder, Cylinder2D, Cylinder, Cylinder2D)
 
         _c(Capsule, Capsule2D, Point, Point2D)
         _c(Capsule, Capsule2D, Sphere, Sphere2D)
+        _c(Capsule, Capsule2D, Cylinder, Cylinder2D)
+        _c(Capsule, Capsule2D, Capsule, Capsule2D)
 
         _c(AxisAlignedBox, AxisAlignedBox2D, Point, Point2D)
+        _c(AxisAlignedBox, AxisAlignedBox2D, Sphere, Sphere2D)
+        _c(AxisAlignedBox, AxisAlignedBox2D, Cylinder, Cylinder2D)
+        _c(AxisAlignedBox, AxisAlignedBox2D, Capsule, Capsule2D)
+        _c(AxisAlignedBox, AxisAlignedBox2D, AxisAlignedBox, AxisAlignedBox2D)
+
+        _c(Box, Box2D, Point, Point2D)
+        _c(Box, Box2D, Sphere, Sphere2D)
+        _c(Box, Box2D, Cylinder, Cylinder2D)
+        _c(Box, Box2D, Capsule, Capsule2D)
+        _c(Box, Box2D, AxisAlignedBox, AxisAlignedBox2D)
+        _c(Box, Box2D, Box, Box2D)
         #undef _c
     }
 
-    return false;
+    return genericCollides(a, b, separatingAxis);
 }
 
-template<> bool collides(const AbstractShape<3>& a, const AbstractShape<3>& b) {
-    if(a.type() < b.type()) return collides(b, a);
+template<> bool collides(const AbstractShape<3>& a, const AbstractShape<3>& b, Vector3* separatingAxis) {
+    if(a.type() < b.type()) return collides(b, a, separatingAxis);
 
     switch(UnsignedInt(a.type())*UnsignedInt(b.type())) {
         #define _c(aType, aClass, bType, bClass) \
@@ -81,18 +143,307 @@ template<> bool collides(const AbstractShape<3>& a, const AbstractShape<3>& b) {
 
         _c(Cylinder, Cylinder3D, Point, Point3D)
         _c(Cylinder, Cylinder3D, Sphere, Sphere3D)
+        _c(Cylinder, Cylinder3D, Cylinder, Cylinder3D)
 
         _c(Capsule, Capsule3D, Point, Point3D)
         _c(Capsule, Capsule3D, Sphere, Sphere3D)
+        _c(Capsule, Capsule3D, Cylinder, Cylinder3D)
+        _c(Capsule, Capsule3D, Capsule, Capsule3D)
 
         _c(AxisAlignedBox, AxisAlignedBox3D, Point, Point3D)
+        _c(AxisAlignedBox, AxisAlignedBox3D, Sphere, Sphere3D)
+        _c(AxisAlignedBox, AxisAlignedBox3D, Cylinder, Cylinder3D)
+        _c(AxisAlignedBox, AxisAlignedBox3D, Capsule, Capsule3D)
+        _c(AxisAlignedBox, AxisAlignedBox3D, AxisAlignedBox, AxisAlignedBox3D)
+
+        _c(Box, Box3D, Point, Point3D)
+        _c(Box, Box3D, Sphere, Sphere3D)
+        _c(Box, Box3D, Cylinder, Cylinder3D)
+        _c(Box, Box3D, Capsule, Capsule3D)
+        _c(Box, Box3D, AxisAlignedBox, AxisAlignedBox3D)
+        _c(Box, Box3D, Box, Box3D)
 
         _c(Plane, Plane, Line, Line3D)
         _c(Plane, Plane, LineSegment, LineSegment3D)
+        _c(Plane, Plane, Sphere, Sphere3D)
+        _c(Plane, Plane, Capsule, Capsule3D)
+        _c(Plane, Plane, AxisAlignedBox, AxisAlignedBox3D)
+        _c(Plane, Plane, Box, Box3D)
+        #undef _c
+    }
+
+    return genericCollides(a, b, separatingAxis);
+}
+
+/* Pairs with contact generation, the first type has always higher ID */
+#define _collisionPairs(dimensions)                                         \
+    _c(Sphere, Sphere, Point, Point, dimensions)                            \
+    _c(Sphere, Sphere, Sphere, Sphere, dimensions)                          \
+    _c(InvertedSphere, InvertedSphere, Point, Point, dimensions)            \
+    _c(InvertedSphere, InvertedSphere, Sphere, Sphere, dimensions)          \
+    _c(Cylinder, Cylinder, Point, Point, dimensions)                        \
+    _c(Cylinder, Cylinder, Sphere, Sphere, dimensions)                      \
+    _c(Cylinder, Cylinder, Cylinder, Cylinder, dimensions)                  \
+    _c(Capsule, Capsule, Point, Point, dimensions)                          \
+    _c(Capsule, Capsule, Sphere, Sphere, dimensions)                        \
+    _c(Capsule, Capsule, Cylinder, Cylinder, dimensions)                    \
+    _c(Capsule, Capsule, Capsule, Capsule, dimensions)                      \
+    _c(AxisAlignedBox, AxisAlignedBox, Point, Point, dimensions)            \
+    _c(AxisAlignedBox, AxisAlignedBox, Sphere, Sphere, dimensions)          \
+    _c(AxisAlignedBox, AxisAlignedBox, Cylinder, Cylinder, dimensions)      \
+    _c(AxisAlignedBox, AxisAlignedBox, Capsule, Capsule, dimensions)        \
+    _c(AxisAlignedBox, AxisAlignedBox, AxisAlignedBox, AxisAlignedBox, dimensions) \
+    _c(Box, Box, Point, Point, dimensions)                                  \
+    _c(Box, Box, Sphere, Sphere, dimensions)                                \
+    _c(Box, Box, Cylinder, Cylinder, dimensions)                            \
+    _c(Box, Box, Capsule, Capsule, dimensions)                              \
+    _c(Box, Box, AxisAlignedBox, AxisAlignedBox, dimensions)                \
+    _c(Box, Box, Box, Box, dimensions)
+
+template<> Collision<2> collision(const AbstractShape<2>& a, const AbstractShape<2>& b) {
+    if(a.type() < b.type()) return collision(b, a).flipped();
+
+    switch(UnsignedInt(a.type())*UnsignedInt(b.type())) {
+        #define _c(aType, aClass, bType, bClass, dimensions) \
+            case UnsignedInt(ShapeDimensionTraits<dimensions>::Type::aType)*UnsignedInt(ShapeDimensionTraits<dimensions>::Type::bType): \
+                return static_cast<const Shape<aClass<dimensions>>&>(a).shape / static_cast<const Shape<bClass<dimensions>>&>(b).shape;
+        _collisionPairs(2)
+        #undef _c
+    }
+
+    return genericCollision(a, b);
+}
+
+template<> Collision<3> collision(const AbstractShape<3>& a, const AbstractShape<3>& b) {
+    if(a.type() < b.type()) return collision(b, a).flipped();
+
+    switch(UnsignedInt(a.type())*UnsignedInt(b.type())) {
+        #define _c(aType, aClass, bType, bClass, dimensions) \
+            case UnsignedInt(ShapeDimensionTraits<dimensions>::Type::aType)*UnsignedInt(ShapeDimensionTraits<dimensions>::Type::bType): \
+                return static_cast<const Shape<aClass<dimensions>>&>(a).shape / static_cast<const Shape<bClass<dimensions>>&>(b).shape;
+        _collisionPairs(3)
         #undef _c
+
+        #define _c(bType, bClass) \
+            case UnsignedInt(ShapeDimensionTraits<3>::Type::Plane)*UnsignedInt(ShapeDimensionTraits<3>::Type::bType): \
+                return static_cast<const Shape<Plane>&>(a).shape / static_cast<const Shape<bClass>&>(b).shape;
+        _c(Sphere, Sphere3D)
+        _c(Capsule, Capsule3D)
+        _c(AxisAlignedBox, AxisAlignedBox3D)
+        _c(Box, Box3D)
+        #undef _c
+    }
+
+    return genericCollision(a, b);
+}
+
+namespace {
+
+struct CollisionEntry {
+    UnsignedInt key, index;
+    bool flipped;
+
+    bool operator<(const CollisionEntry& other) const { return key < other.key; }
+};
+
+template<class A, class B> void collisionRun(const std::vector<std::pair<const AbstractShape<A::Dimensions>*, const AbstractShape<A::Dimensions>*>>& pairs, std::vector<CollisionEntry>::const_iterator it, const std::vector<CollisionEntry>::const_iterator end, std::vector<Collision<A::Dimensions>>& out) {
+    for(; it != end; ++it) {
+        const auto& pair = pairs[it->index];
+        const AbstractShape<A::Dimensions>& a = *(it->flipped ? pair.second : pair.first);
+        const AbstractShape<A::Dimensions>& b = *(it->flipped ? pair.first : pair.second);
+        const Collision<A::Dimensions> collision = static_cast<const Shape<A>&>(a).shape / static_cast<const Shape<B>&>(b).shape;
+        out[it->index] = it->flipped ? collision.flipped() : collision;
+    }
+}
+
+template<UnsignedInt dimensions> void genericCollisionRun(const std::vector<std::pair<const AbstractShape<dimensions>*, const AbstractShape<dimensions>*>>& pairs, std::vector<CollisionEntry>::const_iterator it, const std::vector<CollisionEntry>::const_iterator end, std::vector<Collision<dimensions>>& out) {
+    for(; it != end; ++it)
+        out[it->index] = genericCollision(*pairs[it->index].first, *pairs[it->index].second);
+}
+
+template<UnsignedInt dimensions> std::vector<CollisionEntry> collisionEntries(const std::vector<std::pair<const AbstractShape<dimensions>*, const AbstractShape<dimensions>*>>& pairs) {
+    std::vector<CollisionEntry> entries;
+    entries.reserve(pairs.size());
+    for(std::size_t i = 0; i != pairs.size(); ++i) {
+        const auto aType = pairs[i].first->type();
+        const auto bType = pairs[i].second->type();
+        entries.push_back({UnsignedInt(aType)*UnsignedInt(bType), UnsignedInt(i), aType < bType});
+    }
+
+    /* Group the pairs by type combination */
+    std::stable_sort(entries.begin(), entries.end());
+    return entries;
+}
+
+}
+
+template<> void collisions(const std::vector<std::pair<const AbstractShape<2>*, const AbstractShape<2>*>>& pairs, std::vector<Collision<2>>& out) {
+    out.assign(pairs.size(), Collision<2>());
+    const std::vector<CollisionEntry> entries = collisionEntries(pairs);
+
+    for(auto begin = entries.begin(); begin != entries.end(); ) {
+        auto end = begin;
+        while(end != entries.end() && end->key == begin->key) ++end;
+
+        switch(begin->key) {
+            #define _c(aType, aClass, bType, bClass, dimensions) \
+                case UnsignedInt(ShapeDimensionTraits<dimensions>::Type::aType)*UnsignedInt(ShapeDimensionTraits<dimensions>::Type::bType): \
+                    collisionRun<aClass<dimensions>, bClass<dimensions>>(pairs, begin, end, out); \
+                    break;
+            _collisionPairs(2)
+            #undef _c
+
+            default:
+                genericCollisionRun(pairs, begin, end, out);
+        }
+
+        begin = end;
+    }
+}
+
+template<> void collisions(const std::vector<std::pair<const AbstractShape<3>*, const AbstractShape<3>*>>& pairs, std::vector<Collision<3>>& out) {
+    out.assign(pairs.size(), Collision<3>());
+    const std::vector<CollisionEntry> entries = collisionEntries(pairs);
+
+    for(auto begin = entries.begin(); begin != entries.end(); ) {
+        auto end = begin;
+        while(end != entries.end() && end->key == begin->key) ++end;
+
+        switch(begin->key) {
+            #define _c(aType, aClass, bType, bClass, dimensions) \
+                case UnsignedInt(ShapeDimensionTraits<dimensions>::Type::aType)*UnsignedInt(ShapeDimensionTraits<dimensions>::Type::bType): \
+                    collisionRun<aClass<dimensions>, bClass<dimensions>>(pairs, begin, end, out); \
+                    break;
+            _collisionPairs(3)
+            #undef _c
+
+            #define _c(bType, bClass) \
+                case UnsignedInt(ShapeDimensionTraits<3>::Type::Plane)*UnsignedInt(ShapeDimensionTraits<3>::Type::bType): \
+                    collisionRun<Plane, bClass>(pairs, begin, end, out); \
+                    break;
+            _c(Sphere, Sphere3D)
+            _c(Capsule, Capsule3D)
+            _c(AxisAlignedBox, AxisAlignedBox3D)
+            _c(Box, Box3D)
+            #undef _c
+
+            default:
+                genericCollisionRun(pairs, begin, end, out);
+        }
+
+        begin = end;
+    }
+}
+
+#undef _collisionPairs
+
+namespace {
+
+template<UnsignedInt dimensions> void infiniteBounds(typename DimensionTraits<dimensions, Float>::VectorType& min, typename DimensionTraits<dimensions, Float>::VectorType& max) {
+    min = typename DimensionTraits<dimensions, Float>::VectorType(-std::numeric_limits<Float>::infinity());
+    max = typename DimensionTraits<dimensions, Float>::VectorType(std::numeric_limits<Float>::infinity());
+}
+
+template<UnsignedInt dimensions> void shapeBounds(const Shapes::Point<dimensions>& shape, typename DimensionTraits<dimensions, Float>::VectorType& min, typename DimensionTraits<dimensions, Float>::VectorType& max) {
+    min = max = shape.position();
+}
+
+template<UnsignedInt dimensions> void shapeBounds(const Shapes::LineSegment<dimensions>& shape, typename DimensionTraits<dimensions, Float>::VectorType& min, typename DimensionTraits<dimensions, Float>::VectorType& max) {
+    min = Math::min(shape.a(), shape.b());
+    max = Math::max(shape.a(), shape.b());
+}
+
+template<UnsignedInt dimensions> void shapeBounds(const Shapes::Sphere<dimensions>& shape, typename DimensionTraits<dimensions, Float>::VectorType& min, typename DimensionTraits<dimensions, Float>::VectorType& max) {
+    min = shape.position() - typename DimensionTraits<dimensions, Float>::VectorType(shape.radius());
+    max = shape.position() + typename DimensionTraits<dimensions, Float>::VectorType(shape.radius());
+}
+
+template<UnsignedInt dimensions> void shapeBounds(const Shapes::Capsule<dimensions>& shape, typename DimensionTraits<dimensions, Float>::VectorType& min, typename DimensionTraits<dimensions, Float>::VectorType& max) {
+    min = Math::min(shape.a(), shape.b()) - typename DimensionTraits<dimensions, Float>::VectorType(shape.radius());
+    max = Math::max(shape.a(), shape.b()) + typename DimensionTraits<dimensions, Float>::VectorType(shape.radius());
+}
+
+template<UnsignedInt dimensions> void shapeBounds(const Shapes::AxisAlignedBox<dimensions>& shape, typename DimensionTraits<dimensions, Float>::VectorType& min, typename DimensionTraits<dimensions, Float>::VectorType& max) {
+    min = Math::min(shape.min(), shape.max());
+    max = Math::max(shape.min(), shape.max());
+}
+
+template<UnsignedInt dimensions> void shapeBounds(const Shapes::ConvexHull<dimensions>& shape, typename DimensionTraits<dimensions, Float>::VectorType& min, typename DimensionTraits<dimensions, Float>::VectorType& max) {
+    /* Empty hull never overlaps anything */
+    min = typename DimensionTraits<dimensions, Float>::VectorType(std::numeric_limits<Float>::infinity());
+    max = typename DimensionTraits<dimensions, Float>::VectorType(-std::numeric_limits<Float>::infinity());
+    for(const auto& point: shape.points()) {
+        min = Math::min(min, point);
+        max = Math::max(max, point);
+    }
+}
+
+template<UnsignedInt dimensions> void shapeBounds(const Shapes::Box<dimensions>& shape, typename DimensionTraits<dimensions, Float>::VectorType& min, typename DimensionTraits<dimensions, Float>::VectorType& max) {
+    /* Half extents of unit box projected onto the axes */
+    const typename DimensionTraits<dimensions, Float>::MatrixType& transformation = shape.transformation();
+    typename DimensionTraits<dimensions, Float>::VectorType extents;
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        for(UnsignedInt j = 0; j != dimensions; ++j)
+            extents[i] += Math::abs(transformation[j][i]);
+
+    min = transformation.translation() - extents;
+    max = transformation.translation() + extents;
+}
+
+
+}
+
+template<> void bounds(const AbstractShape<2>& shape, Vector2& min, Vector2& max) {
+    switch(shape.type()) {
+        #define _c(type, class) \
+            case ShapeDimensionTraits<2>::Type::type: \
+                return shapeBounds(static_cast<const Shape<class>&>(shape).shape, min, max);
+        _c(Point, Point2D)
+        _c(LineSegment, LineSegment2D)
+        _c(Sphere, Sphere2D)
+        _c(Capsule, Capsule2D)
+        _c(AxisAlignedBox, AxisAlignedBox2D)
+        _c(Box, Box2D)
+        _c(ConvexHull, ConvexHull2D)
+        #undef _c
+
+        case ShapeDimensionTraits<2>::Type::Composition:
+            return static_cast<const Shape<Composition2D>&>(shape).shape.bounds(min, max);
+
+        case ShapeDimensionTraits<2>::Type::Line:
+        case ShapeDimensionTraits<2>::Type::InvertedSphere:
+        case ShapeDimensionTraits<2>::Type::Cylinder:
+            break;
+    }
+
+    infiniteBounds<2>(min, max);
+}
+
+template<> void bounds(const AbstractShape<3>& shape, Vector3& min, Vector3& max) {
+    switch(shape.type()) {
+        #define _c(type, class) \
+            case ShapeDimensionTraits<3>::Type::type: \
+                return shapeBounds(static_cast<const Shape<class>&>(shape).shape, min, max);
+        _c(Point, Point3D)
+        _c(LineSegment, LineSegment3D)
+        _c(Sphere, Sphere3D)
+        _c(Capsule, Capsule3D)
+        _c(AxisAlignedBox, AxisAlignedBox3D)
+        _c(Box, Box3D)
+        _c(ConvexHull, ConvexHull3D)
+        #undef _c
+
+        case ShapeDimensionTraits<3>::Type::Composition:
+            return static_cast<const Shape<Composition3D>&>(shape).shape.bounds(min, max);
+
+        case ShapeDimensionTraits<3>::Type::Line:
+        case ShapeDimensionTraits<3>::Type::InvertedSphere:
+        case ShapeDimensionTraits<3>::Type::Cylinder:
+        case ShapeDimensionTraits<3>::Type::Plane:
+            break;
     }
 
-    return false;
+    infiniteBounds<3>(min, max);
 }
 
 }}}
@@ -24,7 +24,11 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <vector>
+
+#include "DimensionTraits.h"
 #include "Types.h"
+#include "Shapes/Shapes.h"
 
 namespace Magnum { namespace Shapes { namespace Implementation {
 
@@ -38,8 +42,35 @@ or Sphere vs. Point. Each type is specified by unique prime number. Then we
 multiply the two numbers together and switch() on the result. Because of
 multiplying two prime numbers, there is no ambiguity (the result is unique for
 each combination).
+
+Pairs of convex shapes without dedicated implementation fall back to generic
+GJK test. The separating axis is used to warm-start it, see convexCollides()
+in Implementation/Gjk.h, pairs with dedicated implementation don't touch it.
+*/
+template<UnsignedInt dimensions> bool collides(const AbstractShape<dimensions>& a, const AbstractShape<dimensions>& b, typename DimensionTraits<dimensions, Float>::VectorType* separatingAxis = nullptr);
+
+/*
+Collision data, dispatched the same way. If the shapes are passed in reversed
+order, the collision is flipped. Pairs of convex shapes without dedicated
+contact generation fall back to GJK and EPA, other pairs without contact
+generation return empty collision.
+*/
+template<UnsignedInt dimensions> Collision<dimensions> collision(const AbstractShape<dimensions>& a, const AbstractShape<dimensions>& b);
+
+/*
+Collision data for list of shape pairs. The pairs are grouped by type
+combination first, so the dispatch is done only once for each group and the
+contact generation for given combination runs in a tight loop.
+*/
+template<UnsignedInt dimensions> void collisions(const std::vector<std::pair<const AbstractShape<dimensions>*, const AbstractShape<dimensions>*>>& pairs, std::vector<Collision<dimensions>>& out);
+
+/*
+Axis-aligned bounds of the shape, used in ShapeGroup broadphase. Unbounded
+shapes (lines, planes, cylinders, inverted spheres and compositions containing
+NOT operation) have infinite bounds, empty composition and empty convex hull
+have inverted infinite bounds, thus they never overlap anything.
 */
-template<UnsignedInt dimensions> bool collides(const AbstractShape<dimensions>& a, const AbstractShape<dimensions>& b);
+template<UnsignedInt dimensions> void bounds(const AbstractShape<dimensions>& shape, typename DimensionTraits<dimensions, Float>::VectorType& min, typename DimensionTraits<dimensions, Float>::VectorType& max);
 
 }}}
 
@@ -0,0 +1,366 @@
+#ifndef Magnum_Shapes_Implementation_ContactGeneration_h
+#define Magnum_Shapes_Implementation_ContactGeneration_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <limits>
+
+#include "Math/Functions.h"
+#include "Math/Matrix3.h"
+#include "Math/Matrix4.h"
+#include "Magnum.h"
+#include "Shapes/AxisAlignedBox.h"
+#include "Shapes/Box.h"
+#include "Shapes/Collision.h"
+
+namespace Magnum { namespace Shapes { namespace Implementation {
+
+/*
+Contact generation helpers shared by shape collision operators.
+
+Swept shapes (capsules and cylinders) are reduced to closest points between
+their cores and then handled as spheres with given radius. Boxes and
+axis-aligned boxes are both handled as oriented box with normalized axes and
+half-extents, box pairs are separated using separating axis theorem.
+*/
+
+inline Float clampedIf(Float value, bool clamp) {
+    return clamp ? Math::clamp(value, 0.0f, 1.0f) : value;
+}
+
+/*
+Parameters of closest points on two lines or line segments, parameters for
+line segments are clamped to [0, 1]. See Ericson, Real-Time Collision
+Detection, chapter 5.1.9.
+*/
+template<class VectorType> void closestPoints(const VectorType& a1, const VectorType& b1, bool segment1, const VectorType& a2, const VectorType& b2, bool segment2, Float& s, Float& t) {
+    const VectorType d1 = b1 - a1;
+    const VectorType d2 = b2 - a2;
+    const VectorType r = a1 - a2;
+    const Float a = d1.dot();
+    const Float e = d2.dot();
+    const Float f = VectorType::dot(d2, r);
+
+    /* Both degenerate into points */
+    if(a < Math::TypeTraits<Float>::epsilon() && e < Math::TypeTraits<Float>::epsilon()) {
+        s = t = 0.0f;
+        return;
+    }
+
+    /* First degenerates into point */
+    if(a < Math::TypeTraits<Float>::epsilon()) {
+        s = 0.0f;
+        t = clampedIf(f/e, segment2);
+        return;
+    }
+
+    /* Second degenerates into point */
+    const Float c = VectorType::dot(d1, r);
+    if(e < Math::TypeTraits<Float>::epsilon()) {
+        t = 0.0f;
+        s = clampedIf(-c/a, segment1);
+        return;
+    }
+
+    /* For parallel lines pick arbitrary point on the first one */
+    const Float b = VectorType::dot(d1, d2);
+    const Float denominator = a*e - b*b;
+    s = denominator > Math::TypeTraits<Float>::epsilon()*a*e ?
+        clampedIf((b*f - c*e)/denominator, segment1) : 0.0f;
+
+    /* Closest point on second, if it's out of the segment, clamp it and
+       recompute closest point on first */
+    t = (b*s + f)/e;
+    if(segment2 && t < 0.0f) {
+        t = 0.0f;
+        s = clampedIf(-c/a, segment1);
+    } else if(segment2 && t > 1.0f) {
+        t = 1.0f;
+        s = clampedIf((b - c)/a, segment1);
+    }
+}
+
+/*
+Collision of two spheres given by closest points on cores of shapes A and B
+and their radii. Contact position is on surface of B.
+*/
+template<UnsignedInt dimensions> Collision<dimensions> roundedContact(const typename DimensionTraits<dimensions, Float>::VectorType& a, Float aRadius, const typename DimensionTraits<dimensions, Float>::VectorType& b, Float bRadius) {
+    const Float minDistance = aRadius + bRadius;
+    const typename DimensionTraits<dimensions, Float>::VectorType separating = a - b;
+    const Float dot = separating.dot();
+
+    /* No collision occured */
+    if(dot >= Math::pow<2>(minDistance)) return {};
+
+    /* Actual distance */
+    const Float distance = Math::sqrt(dot);
+
+    /* Separating normal. If can't decide on direction, just move up. */
+    const typename DimensionTraits<dimensions, Float>::VectorType separatingNormal =
+        Math::TypeTraits<Float>::equals(dot, 0.0f) ?
+        DimensionTraits<dimensions, Float>::VectorType::yAxis() :
+        separating/distance;
+
+    return Collision<dimensions>(b + separatingNormal*bRadius, separatingNormal, minDistance - distance);
+}
+
+/* Box with normalized axes and half-extents */
+template<UnsignedInt dimensions> struct OrientedBox {
+    typedef typename DimensionTraits<dimensions, Float>::VectorType VectorType;
+
+    explicit OrientedBox(const Shapes::Box<dimensions>& box): center(box.transformation().translation()) {
+        const auto rotationScaling = box.transformation().rotationScaling();
+        for(UnsignedInt i = 0; i != dimensions; ++i) {
+            const VectorType axis = rotationScaling[i];
+            extents[i] = axis.length();
+
+            /* Flat box, pick any axis */
+            if(extents[i] < Math::TypeTraits<Float>::epsilon()) {
+                axes[i] = VectorType();
+                axes[i][i] = 1.0f;
+            } else axes[i] = axis/extents[i];
+        }
+    }
+
+    explicit OrientedBox(const Shapes::AxisAlignedBox<dimensions>& box): center((box.min() + box.max())*0.5f) {
+        const VectorType halfSize = Math::abs(box.max() - box.min())*0.5f;
+        for(UnsignedInt i = 0; i != dimensions; ++i) {
+            axes[i] = VectorType();
+            axes[i][i] = 1.0f;
+            extents[i] = halfSize[i];
+        }
+    }
+
+    /* Point coordinates along box axes, relative to box center */
+    VectorType local(const VectorType& point) const {
+        const VectorType distance = point - center;
+        VectorType out;
+        for(UnsignedInt i = 0; i != dimensions; ++i)
+            out[i] = VectorType::dot(distance, axes[i]);
+        return out;
+    }
+
+    /* Signed distance of the point from box surface, negative inside */
+    Float signedDistance(const VectorType& point) const {
+        const VectorType l = local(point);
+        Float outside = 0.0f;
+        Float inside = -std::numeric_limits<Float>::infinity();
+        for(UnsignedInt i = 0; i != dimensions; ++i) {
+            const Float d = Math::abs(l[i]) - extents[i];
+            if(d > 0.0f) outside += d*d;
+            inside = Math::max(inside, d);
+        }
+        return outside > 0.0f ? Math::sqrt(outside) : inside;
+    }
+
+    /* Closest point on box surface or inside the box */
+    VectorType closestPoint(const VectorType& point) const {
+        const VectorType l = local(point);
+        VectorType out = center;
+        for(UnsignedInt i = 0; i != dimensions; ++i)
+            out += axes[i]*Math::clamp(l[i], -extents[i], extents[i]);
+        return out;
+    }
+
+    /* Half-extents projected onto normalized axis */
+    Float projectedRadius(const VectorType& axis) const {
+        Float out = 0.0f;
+        for(UnsignedInt i = 0; i != dimensions; ++i)
+            out += extents[i]*Math::abs(VectorType::dot(axes[i], axis));
+        return out;
+    }
+
+    /* Farthest point in given direction, for directions perpendicular to
+       some box axis returns center of given edge or face */
+    VectorType support(const VectorType& direction) const {
+        VectorType out = center;
+        for(UnsignedInt i = 0; i != dimensions; ++i) {
+            const Float d = VectorType::dot(axes[i], direction);
+            if(d > Math::TypeTraits<Float>::epsilon()) out += axes[i]*extents[i];
+            else if(d < -Math::TypeTraits<Float>::epsilon()) out -= axes[i]*extents[i];
+        }
+        return out;
+    }
+
+    VectorType center;
+    VectorType axes[dimensions];
+    Float extents[dimensions];
+};
+
+/*
+Collision of box A with sphere B. If the sphere center is outside, the contact
+is with closest point on box surface, otherwise the box is separated along the
+axis with smallest penetration.
+*/
+template<UnsignedInt dimensions> Collision<dimensions> boxSphereContact(const OrientedBox<dimensions>& box, const typename DimensionTraits<dimensions, Float>::VectorType& position, Float radius) {
+    const typename DimensionTraits<dimensions, Float>::VectorType local = box.local(position);
+
+    /* Center outside the box */
+    bool inside = true;
+    typename DimensionTraits<dimensions, Float>::VectorType closest = box.center;
+    for(UnsignedInt i = 0; i != dimensions; ++i) {
+        const Float clamped = Math::clamp(local[i], -box.extents[i], box.extents[i]);
+        if(clamped != local[i]) inside = false;
+        closest += box.axes[i]*clamped;
+    }
+    if(!inside) return roundedContact<dimensions>(closest, 0.0f, position, radius);
+
+    /* Center inside the box, find axis with smallest penetration */
+    UnsignedInt axis = 0;
+    Float penetration = std::numeric_limits<Float>::infinity();
+    for(UnsignedInt i = 0; i != dimensions; ++i) {
+        const Float p = box.extents[i] - Math::abs(local[i]);
+        if(p < penetration) {
+            penetration = p;
+            axis = i;
+        }
+    }
+
+    const typename DimensionTraits<dimensions, Float>::VectorType separatingNormal = local[axis] < 0.0f ? box.axes[axis] : -box.axes[axis];
+    return Collision<dimensions>(position + separatingNormal*radius, separatingNormal, penetration + radius);
+}
+
+/*
+Collision of box A with line or line segment B inflated by given radius. Signed
+distance to the box is convex along the line, thus the deepest point is found
+using golden section search and then handled as sphere. If the line touches or
+penetrates the box along some part, middle of that part is used. Infinite line is
+limited to the part which can touch box bounding sphere.
+*/
+template<UnsignedInt dimensions> Collision<dimensions> boxLineContact(const OrientedBox<dimensions>& box, const typename DimensionTraits<dimensions, Float>::VectorType& a, const typename DimensionTraits<dimensions, Float>::VectorType& b, bool segment, Float radius) {
+    const typename DimensionTraits<dimensions, Float>::VectorType direction = b - a;
+    const Float dot = direction.dot();
+
+    /* Degenerate line */
+    if(dot < Math::TypeTraits<Float>::epsilon())
+        return boxSphereContact(box, a, radius);
+
+    Float min = 0.0f, max = 1.0f;
+    if(!segment) {
+        Float boundingRadius = 0.0f;
+        for(UnsignedInt i = 0; i != dimensions; ++i)
+            boundingRadius += Math::pow<2>(box.extents[i]);
+        const Float center = DimensionTraits<dimensions, Float>::VectorType::dot(box.center - a, direction)/dot;
+        const Float halfRange = (Math::sqrt(boundingRadius) + radius)/Math::sqrt(dot);
+        min = center - halfRange;
+        max = center + halfRange;
+    }
+
+    constexpr Float ratio = 0.618034f;
+    Float t1 = max - ratio*(max - min);
+    Float t2 = min + ratio*(max - min);
+    Float d1 = box.signedDistance(a + direction*t1);
+    Float d2 = box.signedDistance(a + direction*t2);
+    for(UnsignedInt i = 0; i != 32; ++i) {
+        /* Minimum is between the two points, shrink from both sides so the
+           search converges to the middle of flat parts */
+        if(d1 == d2) {
+            min = t1;
+            max = t2;
+            t1 = max - ratio*(max - min);
+            t2 = min + ratio*(max - min);
+            d1 = box.signedDistance(a + direction*t1);
+            d2 = box.signedDistance(a + direction*t2);
+        } else if(d1 < d2) {
+            max = t2;
+            t2 = t1;
+            d2 = d1;
+            t1 = max - ratio*(max - min);
+            d1 = box.signedDistance(a + direction*t1);
+        } else {
+            min = t1;
+            t1 = t2;
+            d1 = d2;
+            t2 = min + ratio*(max - min);
+            d2 = box.signedDistance(a + direction*t2);
+        }
+    }
+
+    /* The search converges only near the segment endpoints, use them
+       directly if they are better */
+    Float t = (min + max)*0.5f;
+    if(segment) {
+        const Float d = box.signedDistance(a + direction*t);
+        if(box.signedDistance(a) < d) t = 0.0f;
+        else if(box.signedDistance(b) < d) t = 1.0f;
+    }
+
+    return boxSphereContact(box, a + direction*t, radius);
+}
+
+template<UnsignedInt dimensions> bool separatingAxis(const OrientedBox<dimensions>& a, const OrientedBox<dimensions>& b, typename DimensionTraits<dimensions, Float>::VectorType axis, Float& minOverlap, typename DimensionTraits<dimensions, Float>::VectorType& minAxis) {
+    /* Degenerate axis (from parallel edges), skip */
+    const Float dot = axis.dot();
+    if(dot < Math::TypeTraits<Float>::epsilon()) return false;
+    axis /= Math::sqrt(dot);
+
+    const Float distance = DimensionTraits<dimensions, Float>::VectorType::dot(b.center - a.center, axis);
+    const Float overlap = a.projectedRadius(axis) + b.projectedRadius(axis) - Math::abs(distance);
+    if(overlap <= 0.0f) return true;
+
+    /* A is moved away from B */
+    if(overlap < minOverlap) {
+        minOverlap = overlap;
+        minAxis = distance < 0.0f ? axis : -axis;
+    }
+    return false;
+}
+
+/* In 2D face normals are the only axes */
+inline bool separatingEdgeAxis(const OrientedBox<2>&, const OrientedBox<2>&, Float&, Vector2&) {
+    return false;
+}
+
+inline bool separatingEdgeAxis(const OrientedBox<3>& a, const OrientedBox<3>& b, Float& minOverlap, Vector3& minAxis) {
+    for(UnsignedInt i = 0; i != 3; ++i)
+        for(UnsignedInt j = 0; j != 3; ++j)
+            if(separatingAxis(a, b, Vector3::cross(a.axes[i], b.axes[j]), minOverlap, minAxis))
+                return true;
+    return false;
+}
+
+/*
+Collision of box A with box B. Tests face normals of both boxes and (in 3D)
+cross products of their edges, A is separated along the axis with minimal
+overlap. Contact position is the deepest point of A moved onto surface of B.
+*/
+template<UnsignedInt dimensions> Collision<dimensions> boxBoxContact(const OrientedBox<dimensions>& a, const OrientedBox<dimensions>& b) {
+    Float minOverlap = std::numeric_limits<Float>::infinity();
+    typename DimensionTraits<dimensions, Float>::VectorType minAxis;
+
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        if(separatingAxis(a, b, a.axes[i], minOverlap, minAxis) ||
+           separatingAxis(a, b, b.axes[i], minOverlap, minAxis))
+            return {};
+    if(separatingEdgeAxis(a, b, minOverlap, minAxis)) return {};
+
+    /* All axes degenerate (zero-sized boxes) */
+    if(minOverlap == std::numeric_limits<Float>::infinity()) return {};
+
+    return Collision<dimensions>(a.support(-minAxis) + minAxis*minOverlap, minAxis, minOverlap);
+}
+
+}}}
+
+#endif
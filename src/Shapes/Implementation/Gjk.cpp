@@ -0,0 +1,597 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "Gjk.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "Math/Functions.h"
+#include "Math/Vector2.h"
+#include "Math/Vector3.h"
+#include "Magnum.h"
+#include "Shapes/Collision.h"
+
+namespace Magnum { namespace Shapes { namespace Implementation {
+
+namespace {
+
+enum: UnsignedInt { MaxIterations = 64 };
+
+/* Relative precision of the closest point search and polytope expansion */
+constexpr Float Tolerance = 1.0e-4f;
+
+/* Vertices of Minkowski difference A - B with corresponding support points on
+   A and barycentric weights of the point closest to origin */
+template<UnsignedInt dimensions> struct Simplex {
+    typename DimensionTraits<dimensions, Float>::VectorType w[dimensions + 1], a[dimensions + 1];
+    Float weights[dimensions + 1];
+    UnsignedInt size;
+};
+
+template<UnsignedInt dimensions> Simplex<dimensions> vertex(const Simplex<dimensions>& s, UnsignedInt i) {
+    Simplex<dimensions> out;
+    out.w[0] = s.w[i];
+    out.a[0] = s.a[i];
+    out.weights[0] = 1.0f;
+    out.size = 1;
+    return out;
+}
+
+template<UnsignedInt dimensions> Simplex<dimensions> edge(const Simplex<dimensions>& s, UnsignedInt i, UnsignedInt j, Float t) {
+    Simplex<dimensions> out;
+    out.w[0] = s.w[i];
+    out.w[1] = s.w[j];
+    out.a[0] = s.a[i];
+    out.a[1] = s.a[j];
+    out.weights[0] = 1.0f - t;
+    out.weights[1] = t;
+    out.size = 2;
+    return out;
+}
+
+template<UnsignedInt dimensions> Simplex<dimensions> face(const Simplex<dimensions>& s, UnsignedInt i, UnsignedInt j, UnsignedInt k, Float v, Float w) {
+    Simplex<dimensions> out;
+    out.w[0] = s.w[i];
+    out.w[1] = s.w[j];
+    out.w[2] = s.w[k];
+    out.a[0] = s.a[i];
+    out.a[1] = s.a[j];
+    out.a[2] = s.a[k];
+    out.weights[0] = 1.0f - v - w;
+    out.weights[1] = v;
+    out.weights[2] = w;
+    out.size = 3;
+    return out;
+}
+
+template<UnsignedInt dimensions> typename DimensionTraits<dimensions, Float>::VectorType closestPoint(const Simplex<dimensions>& s) {
+    typename DimensionTraits<dimensions, Float>::VectorType out;
+    for(UnsignedInt i = 0; i != s.size; ++i)
+        out += s.w[i]*s.weights[i];
+    return out;
+}
+
+template<UnsignedInt dimensions> typename DimensionTraits<dimensions, Float>::VectorType closestPointOnA(const Simplex<dimensions>& s) {
+    typename DimensionTraits<dimensions, Float>::VectorType out;
+    for(UnsignedInt i = 0; i != s.size; ++i)
+        out += s.a[i]*s.weights[i];
+    return out;
+}
+
+/* Sub-simplex of segment closest to origin */
+template<UnsignedInt dimensions> Simplex<dimensions> closestSegment(const Simplex<dimensions>& s, UnsignedInt i, UnsignedInt j) {
+    const typename DimensionTraits<dimensions, Float>::VectorType ab = s.w[j] - s.w[i];
+    const Float t = -Math::Vector<dimensions, Float>::dot(s.w[i], ab);
+    if(t <= 0.0f) return vertex(s, i);
+
+    const Float length = ab.dot();
+    if(t >= length) return vertex(s, j);
+
+    return edge(s, i, j, t/length);
+}
+
+/* Sub-simplex of triangle closest to origin, using Voronoi regions of the
+   triangle features. Works in both 2D and 3D. */
+template<UnsignedInt dimensions> Simplex<dimensions> closestTriangle(const Simplex<dimensions>& s, UnsignedInt i, UnsignedInt j, UnsignedInt k) {
+    const typename DimensionTraits<dimensions, Float>::VectorType ab = s.w[j] - s.w[i];
+    const typename DimensionTraits<dimensions, Float>::VectorType ac = s.w[k] - s.w[i];
+
+    const Float d1 = -Math::Vector<dimensions, Float>::dot(ab, s.w[i]);
+    const Float d2 = -Math::Vector<dimensions, Float>::dot(ac, s.w[i]);
+    if(d1 <= 0.0f && d2 <= 0.0f) return vertex(s, i);
+
+    const Float d3 = -Math::Vector<dimensions, Float>::dot(ab, s.w[j]);
+    const Float d4 = -Math::Vector<dimensions, Float>::dot(ac, s.w[j]);
+    if(d3 >= 0.0f && d4 <= d3) return vertex(s, j);
+
+    const Float vc = d1*d4 - d3*d2;
+    if(vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+        return edge(s, i, j, d1/(d1 - d3));
+
+    const Float d5 = -Math::Vector<dimensions, Float>::dot(ab, s.w[k]);
+    const Float d6 = -Math::Vector<dimensions, Float>::dot(ac, s.w[k]);
+    if(d6 >= 0.0f && d5 <= d6) return vertex(s, k);
+
+    const Float vb = d5*d2 - d1*d6;
+    if(vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+        return edge(s, i, k, d2/(d2 - d6));
+
+    const Float va = d3*d6 - d5*d4;
+    if(va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f)
+        return edge(s, j, k, (d4 - d3)/((d4 - d3) + (d5 - d6)));
+
+    /* Degenerate triangle, pick the closest edge */
+    const Float denominator = va + vb + vc;
+    if(denominator <= 0.0f) {
+        const Simplex<dimensions> edges[] = {
+            closestSegment(s, i, j),
+            closestSegment(s, i, k),
+            closestSegment(s, j, k)
+        };
+        UnsignedInt closest = 0;
+        for(UnsignedInt e = 1; e != 3; ++e)
+            if(closestPoint(edges[e]).dot() < closestPoint(edges[closest]).dot())
+                closest = e;
+        return edges[closest];
+    }
+
+    return face(s, i, j, k, vb/denominator, vc/denominator);
+}
+
+/* Reduces the simplex to sub-simplex closest to origin. If the origin is
+   inside, the simplex is kept full. */
+Simplex<2> closestSimplex(const Simplex<2>& s) {
+    switch(s.size) {
+        case 1: return vertex(s, 0);
+        case 2: return closestSegment(s, 0, 1);
+    }
+
+    /* In 2D the face region means the origin is inside the triangle */
+    return closestTriangle(s, 0, 1, 2);
+}
+
+Simplex<3> closestSimplex(const Simplex<3>& s) {
+    switch(s.size) {
+        case 1: return vertex(s, 0);
+        case 2: return closestSegment(s, 0, 1);
+        case 3: return closestTriangle(s, 0, 1, 2);
+    }
+
+    /* Test faces of the tetrahedron which have the origin on the other side
+       than the remaining vertex, if there is none, the origin is inside */
+    constexpr UnsignedInt faces[][4] = {
+        {0, 1, 2, 3},
+        {0, 1, 3, 2},
+        {0, 2, 3, 1},
+        {1, 2, 3, 0}
+    };
+    Simplex<3> out = s;
+    Float distance = std::numeric_limits<Float>::infinity();
+    for(const auto& f: faces) {
+        const Vector3 normal = Vector3::cross(s.w[f[1]] - s.w[f[0]], s.w[f[2]] - s.w[f[0]]);
+        const Float origin = -Vector3::dot(normal, s.w[f[0]]);
+        const Float opposite = Vector3::dot(normal, s.w[f[3]] - s.w[f[0]]);
+        if(origin*opposite > 0.0f) continue;
+
+        const Simplex<3> candidate = closestTriangle(s, f[0], f[1], f[2]);
+        const Float candidateDistance = closestPoint(candidate).dot();
+        if(candidateDistance < distance) {
+            out = candidate;
+            distance = candidateDistance;
+        }
+    }
+
+    return out;
+}
+
+/* Finds the closest point of Minkowski difference of the cores to origin.
+   Returns true if the cores intersect, otherwise the closest point is in `v`
+   and its length in `distance`. If the cores are farther than `maxDistance`,
+   returns early with `v` being only the separating axis and `distance` lower
+   bound of the actual distance. */
+template<UnsignedInt dimensions> bool gjk(const ConvexSupport<dimensions>& a, const ConvexSupport<dimensions>& b, typename DimensionTraits<dimensions, Float>::VectorType& v, Simplex<dimensions>& s, const Float maxDistance, Float& distance) {
+    if(v.dot() == 0.0f) v[0] = 1.0f;
+
+    s.size = 0;
+    Float vv = std::numeric_limits<Float>::infinity();
+    Float scale = 0.0f;
+    for(UnsignedInt i = 0; i != MaxIterations; ++i) {
+        const typename DimensionTraits<dimensions, Float>::VectorType supportA = a(-v);
+        const typename DimensionTraits<dimensions, Float>::VectorType w = supportA - b(v);
+        const Float vw = Math::Vector<dimensions, Float>::dot(v, w);
+
+        /* The separating axis is good enough, early out */
+        if(vw > 0.0f && vw*vw > v.dot()*maxDistance*maxDistance) {
+            distance = vw/v.length();
+            return false;
+        }
+
+        /* No more progress, `v` is the closest point */
+        if(s.size != 0 && vv - vw <= Tolerance*vv) break;
+
+        s.w[s.size] = w;
+        s.a[s.size] = supportA;
+        ++s.size;
+        s = closestSimplex(s);
+        v = closestPoint(s);
+
+        /* Origin is inside the simplex or touches it */
+        scale = Math::max(scale, w.dot());
+        const Float previous = vv;
+        vv = v.dot();
+        if(s.size == dimensions + 1 || vv <= 1.0e-10f*scale) return true;
+
+        /* Numerical issues, the distance didn't decrease */
+        if(vv >= previous) break;
+    }
+
+    distance = Math::sqrt(vv);
+    return false;
+}
+
+/* Core support of shape translated by given offset, used in convexCast() */
+template<UnsignedInt dimensions> struct TranslatedSupport {
+    const ConvexSupport<dimensions>* support;
+    typename DimensionTraits<dimensions, Float>::VectorType offset;
+};
+
+template<UnsignedInt dimensions> typename DimensionTraits<dimensions, Float>::VectorType translatedSupport(const void* shape, const typename DimensionTraits<dimensions, Float>::VectorType& direction) {
+    const TranslatedSupport<dimensions>& translated = *static_cast<const TranslatedSupport<dimensions>*>(shape);
+    return (*translated.support)(direction) + translated.offset;
+}
+
+/* Support point of Minkowski difference of the cores in given direction */
+template<UnsignedInt dimensions> void support(const ConvexSupport<dimensions>& a, const ConvexSupport<dimensions>& b, const typename DimensionTraits<dimensions, Float>::VectorType& direction, typename DimensionTraits<dimensions, Float>::VectorType& w, typename DimensionTraits<dimensions, Float>::VectorType& supportA) {
+    supportA = a(direction);
+    w = supportA - b(-direction);
+}
+
+/* Expands the simplex returned from GJK so it has full dimension, in case the
+   origin lies on its boundary. Returns false if the Minkowski difference is
+   degenerate. */
+bool fillSimplex(const ConvexSupport<2>& a, const ConvexSupport<2>& b, Simplex<2>& s) {
+    const Vector2 axes[] = {Vector2::xAxis(), Vector2::yAxis()};
+    for(UnsignedInt i = 0; s.size == 1 && i != 4; ++i) {
+        support(a, b, axes[i/2]*(i % 2 ? -1.0f : 1.0f), s.w[1], s.a[1]);
+        if((s.w[1] - s.w[0]).dot() > Tolerance*Tolerance) s.size = 2;
+    }
+    if(s.size != 2) return s.size == 3;
+
+    const Vector2 normal = (s.w[1] - s.w[0]).perpendicular();
+    for(Float sign: {1.0f, -1.0f}) {
+        support(a, b, normal*sign, s.w[2], s.a[2]);
+        if(Math::abs(Vector2::dot(normal, s.w[2] - s.w[0])) > Tolerance*normal.length()) {
+            s.size = 3;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool fillSimplex(const ConvexSupport<3>& a, const ConvexSupport<3>& b, Simplex<3>& s) {
+    const Vector3 axes[] = {Vector3::xAxis(), Vector3::yAxis(), Vector3::zAxis()};
+    for(UnsignedInt i = 0; s.size == 1 && i != 6; ++i) {
+        support(a, b, axes[i/2]*(i % 2 ? -1.0f : 1.0f), s.w[1], s.a[1]);
+        if((s.w[1] - s.w[0]).dot() > Tolerance*Tolerance) s.size = 2;
+    }
+    if(s.size == 1) return false;
+
+    if(s.size == 2) {
+        const Vector3 direction = s.w[1] - s.w[0];
+        for(UnsignedInt i = 0; s.size == 2 && i != 6; ++i) {
+            const Vector3 normal = Vector3::cross(direction, axes[i/2])*(i % 2 ? -1.0f : 1.0f);
+            if(normal.dot() == 0.0f) continue;
+            support(a, b, normal, s.w[2], s.a[2]);
+            if(Vector3::cross(direction, s.w[2] - s.w[0]).length() > Tolerance*direction.length())
+                s.size = 3;
+        }
+        if(s.size == 2) return false;
+    }
+
+    if(s.size == 3) {
+        const Vector3 normal = Vector3::cross(s.w[1] - s.w[0], s.w[2] - s.w[0]);
+        for(Float sign: {1.0f, -1.0f}) {
+            support(a, b, normal*sign, s.w[3], s.a[3]);
+            if(Math::abs(Vector3::dot(normal, s.w[3] - s.w[0])) > Tolerance*normal.length()) {
+                s.size = 4;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    return true;
+}
+
+/* Expanding polytope algorithm. Finds face of Minkowski difference of the
+   cores closest to the origin, `normal` is its outward normal, `depth` its
+   distance, `pointA` and `pointB` the corresponding points on core surfaces. */
+struct PolytopeVertex2D {
+    Vector2 w, a;
+};
+
+bool epa(const ConvexSupport<2>& a, const ConvexSupport<2>& b, const Simplex<2>& s, Vector2& normal, Float& depth, Vector2& pointA, Vector2& pointB) {
+    /* Counterclockwise polygon */
+    std::vector<PolytopeVertex2D> polygon{{s.w[0], s.a[0]}, {s.w[1], s.a[1]}, {s.w[2], s.a[2]}};
+    if(Vector2::cross(s.w[1] - s.w[0], s.w[2] - s.w[0]) < 0.0f)
+        std::swap(polygon[1], polygon[2]);
+
+    std::size_t closest = 0;
+    for(UnsignedInt iteration = 0; iteration != MaxIterations; ++iteration) {
+        /* Find the closest edge */
+        depth = std::numeric_limits<Float>::infinity();
+        for(std::size_t i = 0; i != polygon.size(); ++i) {
+            const Vector2 edgeNormal = -(polygon[(i + 1) % polygon.size()].w - polygon[i].w).perpendicular();
+            const Float length = edgeNormal.length();
+            if(length == 0.0f) continue;
+
+            const Float distance = Vector2::dot(edgeNormal, polygon[i].w)/length;
+            if(distance < depth) {
+                depth = distance;
+                normal = edgeNormal/length;
+                closest = i;
+            }
+        }
+        if(depth == std::numeric_limits<Float>::infinity()) return false;
+
+        /* Expand the polygon in direction of the edge, if possible */
+        PolytopeVertex2D vertex;
+        support(a, b, normal, vertex.w, vertex.a);
+        if(Vector2::dot(vertex.w, normal) - depth <= Tolerance*Math::max(depth, 1.0f)) break;
+        polygon.insert(polygon.begin() + closest + 1, vertex);
+    }
+
+    /* Point on the edge closest to origin */
+    const PolytopeVertex2D& first = polygon[closest];
+    const PolytopeVertex2D& second = polygon[(closest + 1) % polygon.size()];
+    const Vector2 edgeVector = second.w - first.w;
+    const Float t = Math::clamp(-Vector2::dot(first.w, edgeVector)/edgeVector.dot(), 0.0f, 1.0f);
+    pointA = first.a + (second.a - first.a)*t;
+    pointB = pointA - (first.w + edgeVector*t);
+    return true;
+}
+
+struct PolytopeVertex3D {
+    Vector3 w, a;
+};
+
+struct PolytopeFace {
+    UnsignedInt vertices[3];
+    Vector3 normal;
+    Float distance;
+};
+
+PolytopeFace polytopeFace(const std::vector<PolytopeVertex3D>& vertices, UnsignedInt a, UnsignedInt b, UnsignedInt c) {
+    PolytopeFace face{{a, b, c}, Vector3::cross(vertices[b].w - vertices[a].w, vertices[c].w - vertices[a].w), std::numeric_limits<Float>::infinity()};
+
+    /* Degenerate faces are never closest */
+    const Float length = face.normal.length();
+    if(length != 0.0f) {
+        face.normal /= length;
+        face.distance = Vector3::dot(face.normal, vertices[a].w);
+    }
+
+    return face;
+}
+
+bool epa(const ConvexSupport<3>& a, const ConvexSupport<3>& b, const Simplex<3>& s, Vector3& normal, Float& depth, Vector3& pointA, Vector3& pointB) {
+    std::vector<PolytopeVertex3D> vertices;
+    for(UnsignedInt i = 0; i != 4; ++i)
+        vertices.push_back({s.w[i], s.a[i]});
+
+    /* Tetrahedron faces with counterclockwise winding from outside */
+    const bool flip = Vector3::dot(Vector3::cross(s.w[1] - s.w[0], s.w[2] - s.w[0]), s.w[3] - s.w[0]) > 0.0f;
+    constexpr UnsignedInt tetrahedron[][3] = {
+        {0, 1, 2},
+        {0, 3, 1},
+        {0, 2, 3},
+        {1, 3, 2}
+    };
+    std::vector<PolytopeFace> faces;
+    for(const auto& f: tetrahedron)
+        faces.push_back(flip ? polytopeFace(vertices, f[0], f[2], f[1]) : polytopeFace(vertices, f[0], f[1], f[2]));
+
+    std::vector<std::pair<UnsignedInt, UnsignedInt>> horizon;
+    std::size_t closest = 0;
+    for(UnsignedInt iteration = 0; iteration != MaxIterations; ++iteration) {
+        /* Find the closest face */
+        closest = 0;
+        for(std::size_t i = 1; i != faces.size(); ++i)
+            if(faces[i].distance < faces[closest].distance) closest = i;
+        if(faces[closest].distance == std::numeric_limits<Float>::infinity()) return false;
+
+        /* Expand the polytope in direction of the face, if possible */
+        PolytopeVertex3D vertex;
+        support(a, b, faces[closest].normal, vertex.w, vertex.a);
+        if(Vector3::dot(vertex.w, faces[closest].normal) - faces[closest].distance <= Tolerance*Math::max(faces[closest].distance, 1.0f)) break;
+
+        /* Remove all faces visible from the new vertex, keeping edges of the
+           hole boundary */
+        horizon.clear();
+        for(std::size_t i = 0; i != faces.size(); ) {
+            const PolytopeFace& face = faces[i];
+            if(Vector3::dot(face.normal, vertex.w - vertices[face.vertices[0]].w) <= 0.0f) {
+                ++i;
+                continue;
+            }
+
+            for(UnsignedInt e = 0; e != 3; ++e) {
+                const std::pair<UnsignedInt, UnsignedInt> edge{face.vertices[e], face.vertices[(e + 1) % 3]};
+                auto found = std::find(horizon.begin(), horizon.end(), std::make_pair(edge.second, edge.first));
+                if(found != horizon.end()) horizon.erase(found);
+                else horizon.push_back(edge);
+            }
+
+            faces[i] = faces.back();
+            faces.pop_back();
+        }
+
+        /* Numerical issues, the closest face should be always visible */
+        if(horizon.empty()) break;
+
+        /* Fill the hole with faces connected to the new vertex */
+        vertices.push_back(vertex);
+        for(const auto& edge: horizon)
+            faces.push_back(polytopeFace(vertices, edge.first, edge.second, vertices.size() - 1));
+        closest = 0;
+        for(std::size_t i = 1; i != faces.size(); ++i)
+            if(faces[i].distance < faces[closest].distance) closest = i;
+    }
+
+    const PolytopeFace& face = faces[closest];
+    normal = face.normal;
+    depth = face.distance;
+
+    /* Barycentric coordinates of origin projected onto the face */
+    const Vector3 point = normal*depth;
+    const PolytopeVertex3D& v0 = vertices[face.vertices[0]];
+    const PolytopeVertex3D& v1 = vertices[face.vertices[1]];
+    const PolytopeVertex3D& v2 = vertices[face.vertices[2]];
+    const Vector3 e0 = v1.w - v0.w;
+    const Vector3 e1 = v2.w - v0.w;
+    const Vector3 e2 = point - v0.w;
+    const Float d00 = e0.dot();
+    const Float d01 = Vector3::dot(e0, e1);
+    const Float d11 = e1.dot();
+    const Float d20 = Vector3::dot(e2, e0);
+    const Float d21 = Vector3::dot(e2, e1);
+    const Float denominator = d00*d11 - d01*d01;
+    const Float u = (d11*d20 - d01*d21)/denominator;
+    const Float v = (d00*d21 - d01*d20)/denominator;
+    pointA = v0.a + (v1.a - v0.a)*u + (v2.a - v0.a)*v;
+    pointB = pointA - point;
+    return true;
+}
+
+}
+
+template<UnsignedInt dimensions> bool convexCollides(const ConvexSupport<dimensions>& a, const ConvexSupport<dimensions>& b, typename DimensionTraits<dimensions, Float>::VectorType* separatingAxis) {
+    typename DimensionTraits<dimensions, Float>::VectorType v;
+    if(separatingAxis) v = *separatingAxis;
+
+    Simplex<dimensions> s;
+    Float distance;
+    const Float radius = a.radius + b.radius;
+    const bool intersects = gjk(a, b, v, s, radius, distance);
+
+    /* Save the axis only if it is usable */
+    if(separatingAxis && v.dot() != 0.0f) *separatingAxis = v;
+
+    return intersects || distance < radius;
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> convexCollision(const ConvexSupport<dimensions>& a, const ConvexSupport<dimensions>& b) {
+    typename DimensionTraits<dimensions, Float>::VectorType v;
+    Simplex<dimensions> s;
+    const Float radius = a.radius + b.radius;
+
+    /* The cores don't intersect, the shapes can still collide with their
+       radii. Move A in direction from closest point on B to closest point on
+       A, contact point is on B surface. */
+    Float distance;
+    if(!gjk(a, b, v, s, std::numeric_limits<Float>::infinity(), distance)) {
+        if(distance >= radius) return {};
+
+        const typename DimensionTraits<dimensions, Float>::VectorType normal = v/distance;
+        const typename DimensionTraits<dimensions, Float>::VectorType pointB = closestPointOnA(s) - v;
+        return Collision<dimensions>(pointB + normal*b.radius, normal, radius - distance);
+    }
+
+    /* The cores intersect, find the penetration with EPA. A is moved against
+       the normal of the closest face. */
+    typename DimensionTraits<dimensions, Float>::VectorType normal, pointA, pointB;
+    Float depth;
+    if(!fillSimplex(a, b, s) || !epa(a, b, s, normal, depth, pointA, pointB))
+        return {};
+
+    return Collision<dimensions>(pointB - normal*b.radius, -normal, depth + radius);
+}
+
+template<UnsignedInt dimensions> bool convexCast(const ConvexSupport<dimensions>& a, const ConvexSupport<dimensions>& b, const typename DimensionTraits<dimensions, Float>::VectorType& direction, Float& distance, typename DimensionTraits<dimensions, Float>::VectorType& normal) {
+    typedef typename DimensionTraits<dimensions, Float>::VectorType VectorType;
+
+    TranslatedSupport<dimensions> translated{&a, {}};
+    const ConvexSupport<dimensions> moved{&translated, translatedSupport<dimensions>, 0.0f};
+    const Float radius = a.radius + b.radius;
+    const Float tolerance = Tolerance*Math::max(radius, 1.0f);
+
+    VectorType v, axis;
+    Float t = 0.0f;
+    for(UnsignedInt i = 0; i != MaxIterations; ++i) {
+        translated.offset = direction*t;
+
+        /* The cores intersect. Either already at the beginning or the advance
+           ended just behind the contact because of limited precision. */
+        Simplex<dimensions> s;
+        Float d;
+        if(gjk(moved, b, v, s, std::numeric_limits<Float>::infinity(), d)) {
+            if(i == 0) {
+                distance = 0.0f;
+                normal = -direction;
+                return true;
+            }
+
+            distance = t;
+            normal = axis;
+            return true;
+        }
+
+        axis = v/d;
+        if(d - radius <= tolerance) {
+            /* Overlapping at the beginning */
+            if(i == 0 && d < radius) {
+                distance = 0.0f;
+                normal = -direction;
+                return true;
+            }
+
+            distance = t;
+            normal = axis;
+            return true;
+        }
+
+        /* Moving away or parallel to the closest feature, the shapes won't
+           get any closer */
+        const Float speed = -Math::Vector<dimensions, Float>::dot(direction, axis);
+        if(speed <= 0.0f) return false;
+
+        t += (d - radius)/speed;
+        if(t > distance) return false;
+    }
+
+    return false;
+}
+
+template bool convexCollides(const ConvexSupport<2>&, const ConvexSupport<2>&, Vector2*);
+template bool convexCollides(const ConvexSupport<3>&, const ConvexSupport<3>&, Vector3*);
+template Collision<2> convexCollision(const ConvexSupport<2>&, const ConvexSupport<2>&);
+template Collision<3> convexCollision(const ConvexSupport<3>&, const ConvexSupport<3>&);
+template bool convexCast(const ConvexSupport<2>&, const ConvexSupport<2>&, const Vector2&, Float&, Vector2&);
+template bool convexCast(const ConvexSupport<3>&, const ConvexSupport<3>&, const Vector3&, Float&, Vector3&);
+
+}}}
@@ -0,0 +1,106 @@
+#ifndef Magnum_Shapes_Implementation_Gjk_h
+#define Magnum_Shapes_Implementation_Gjk_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Math/Vector.h"
+#include "DimensionTraits.h"
+#include "Types.h"
+#include "Shapes/Shapes.h"
+
+namespace Magnum { namespace Shapes { namespace Implementation {
+
+/*
+Support mapping of convex shape for GJK and EPA. Spheres and capsules are
+represented by their core (center or axis segment) and radius, which is added
+to the result afterwards -- it is faster and more precise than iterating on
+curved surface. Other shapes use their support() function directly, the shape
+is referenced, not copied.
+*/
+template<UnsignedInt dimensions> struct ConvexSupport {
+    typename DimensionTraits<dimensions, Float>::VectorType operator()(const typename DimensionTraits<dimensions, Float>::VectorType& direction) const {
+        return function(shape, direction);
+    }
+
+    const void* shape;
+    typename DimensionTraits<dimensions, Float>::VectorType(*function)(const void*, const typename DimensionTraits<dimensions, Float>::VectorType&);
+    Float radius;
+};
+
+template<class T> inline typename DimensionTraits<T::Dimensions, Float>::VectorType coreSupport(const T& shape, const typename DimensionTraits<T::Dimensions, Float>::VectorType& direction) {
+    return shape.support(direction);
+}
+
+template<UnsignedInt dimensions> inline typename DimensionTraits<dimensions, Float>::VectorType coreSupport(const Shapes::Sphere<dimensions>& shape, const typename DimensionTraits<dimensions, Float>::VectorType&) {
+    return shape.position();
+}
+
+template<UnsignedInt dimensions> inline typename DimensionTraits<dimensions, Float>::VectorType coreSupport(const Shapes::Capsule<dimensions>& shape, const typename DimensionTraits<dimensions, Float>::VectorType& direction) {
+    return Math::Vector<dimensions, Float>::dot(shape.a(), direction) > Math::Vector<dimensions, Float>::dot(shape.b(), direction) ? shape.a() : shape.b();
+}
+
+template<class T> inline Float coreRadius(const T&) { return 0.0f; }
+template<UnsignedInt dimensions> inline Float coreRadius(const Shapes::Sphere<dimensions>& shape) { return shape.radius(); }
+template<UnsignedInt dimensions> inline Float coreRadius(const Shapes::Capsule<dimensions>& shape) { return shape.radius(); }
+
+template<class T> typename DimensionTraits<T::Dimensions, Float>::VectorType supportFunction(const void* shape, const typename DimensionTraits<T::Dimensions, Float>::VectorType& direction) {
+    return coreSupport(*static_cast<const T*>(shape), direction);
+}
+
+template<class T> inline ConvexSupport<T::Dimensions> convexSupport(const T& shape) {
+    return {&shape, supportFunction<T>, coreRadius(shape)};
+}
+
+/*
+Collision occurence of two convex shapes using GJK. If separating axis is
+specified, it is used as initial search direction and on return it is filled
+with the last search direction, so it can be reused to speed up next test of
+the same pair in the same order, e.g. in next frame. Zero axis means no
+initial direction.
+*/
+template<UnsignedInt dimensions> bool convexCollides(const ConvexSupport<dimensions>& a, const ConvexSupport<dimensions>& b, typename DimensionTraits<dimensions, Float>::VectorType* separatingAxis = nullptr);
+
+/*
+Collision data of two convex shapes. If the shape cores don't intersect, the
+collision is computed from their closest points found by GJK, otherwise the
+penetration is found with EPA. Returns empty collision if the Minkowski
+difference of the cores is degenerate (e.g. two points or two coplanar
+segments).
+*/
+template<UnsignedInt dimensions> Collision<dimensions> convexCollision(const ConvexSupport<dimensions>& a, const ConvexSupport<dimensions>& b);
+
+/*
+Convex shape A moving in given normalized direction against convex shape B,
+using conservative advancement -- A is moved by the distance of the shapes
+divided by the speed of approach along the last separating axis, which never
+overshoots. Returns true if the shapes touch not farther than `distance`, in
+that case `distance` is set to the distance traveled and `normal` to the
+normalized separating axis pointing from B to A. If the shapes overlap at the
+beginning, the distance is zero and normal opposite to the direction.
+*/
+template<UnsignedInt dimensions> bool convexCast(const ConvexSupport<dimensions>& a, const ConvexSupport<dimensions>& b, const typename DimensionTraits<dimensions, Float>::VectorType& direction, Float& distance, typename DimensionTraits<dimensions, Float>::VectorType& normal);
+
+}}}
+
+#endif
@@ -0,0 +1,525 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Raycast.h"
+
+#include <limits>
+
+#include "Math/Geometry/Distance.h"
+#include "Shapes/AxisAlignedBox.h"
+#include "Shapes/Box.h"
+#include "Shapes/Capsule.h"
+#include "Shapes/ConvexHull.h"
+#include "Shapes/Cylinder.h"
+#include "Shapes/LineSegment.h"
+#include "Shapes/Plane.h"
+#include "Shapes/Point.h"
+#include "Shapes/Sphere.h"
+#include "Shapes/shapeImplementation.h"
+#include "Shapes/Implementation/CollisionDispatch.h"
+#include "Shapes/Implementation/ContactGeneration.h"
+#include "Shapes/Implementation/Gjk.h"
+
+using namespace Magnum::Math::Geometry;
+
+namespace Magnum { namespace Shapes { namespace Implementation {
+
+namespace {
+
+/* Origin inside the shape, hit at zero distance */
+template<class VectorType> inline bool insideHit(const VectorType& direction, Float& distance, VectorType& normal) {
+    distance = 0.0f;
+    normal = -direction;
+    return true;
+}
+
+template<class VectorType> bool raySphere(const VectorType& origin, const VectorType& direction, const VectorType& position, Float radius, Float& distance, VectorType& normal) {
+    const VectorType relative = origin - position;
+    const Float c = relative.dot() - Math::pow<2>(radius);
+    if(c < 0.0f) return insideHit(direction, distance, normal);
+
+    /* Pointing away or missing the sphere */
+    const Float b = VectorType::dot(relative, direction);
+    if(b > 0.0f) return false;
+    const Float discriminant = b*b - c;
+    if(discriminant < 0.0f) return false;
+
+    const Float t = -b - Math::sqrt(discriminant);
+    if(t > distance) return false;
+
+    distance = t;
+    normal = radius > 0.0f ? (relative + direction*t)/radius : -direction;
+    return true;
+}
+
+/* Infinite cylinder or capsule, depending on `segment` */
+template<class VectorType> bool rayCylinder(const VectorType& origin, const VectorType& direction, const VectorType& a, const VectorType& b, bool segment, Float radius, Float& distance, VectorType& normal) {
+    const VectorType axis = b - a;
+    const Float length = axis.length();
+
+    /* Degenerate axis */
+    if(length < Math::TypeTraits<Float>::epsilon())
+        return segment && raySphere(origin, direction, a, radius, distance, normal);
+
+    /* Origin and direction perpendicular to the axis */
+    const VectorType axisNormalized = axis/length;
+    const VectorType relative = origin - a;
+    const Float height = VectorType::dot(relative, axisNormalized);
+    const VectorType relativePerpendicular = relative - axisNormalized*height;
+    const VectorType directionPerpendicular = direction - axisNormalized*VectorType::dot(direction, axisNormalized);
+
+    const Float c = relativePerpendicular.dot() - Math::pow<2>(radius);
+    if(c < 0.0f && (!segment || (height >= 0.0f && height <= length)))
+        return insideHit(direction, distance, normal);
+
+    /* Hit of the cylindrical part */
+    bool hit = false;
+    const Float aa = directionPerpendicular.dot();
+    if(c >= 0.0f && aa > Math::TypeTraits<Float>::epsilon()) {
+        const Float bb = VectorType::dot(relativePerpendicular, directionPerpendicular);
+        const Float discriminant = bb*bb - aa*c;
+        if(bb <= 0.0f && discriminant >= 0.0f) {
+            const Float t = (-bb - Math::sqrt(discriminant))/aa;
+            const Float hitHeight = height + VectorType::dot(direction, axisNormalized)*t;
+            if(t <= distance && (!segment || (hitHeight >= 0.0f && hitHeight <= length))) {
+                distance = t;
+                normal = radius > 0.0f ? (relativePerpendicular + directionPerpendicular*t)/radius : -direction;
+                hit = true;
+            }
+        }
+    }
+
+    /* Capsule caps */
+    if(segment) {
+        if(raySphere(origin, direction, a, radius, distance, normal)) hit = true;
+        if(raySphere(origin, direction, b, radius, distance, normal)) hit = true;
+    }
+
+    return hit;
+}
+
+/* Box inflated by the radius. The slab test on box with extents enlarged by
+   the radius is exact for hits on faces, edges and corners are rounded so the
+   hit is refined using sphere tracing. */
+template<UnsignedInt dimensions> bool rayBox(const typename DimensionTraits<dimensions, Float>::VectorType& origin, const typename DimensionTraits<dimensions, Float>::VectorType& direction, const OrientedBox<dimensions>& box, Float radius, Float& distance, typename DimensionTraits<dimensions, Float>::VectorType& normal) {
+    typedef typename DimensionTraits<dimensions, Float>::VectorType VectorType;
+
+    const VectorType localOrigin = box.local(origin);
+    Float entry = -std::numeric_limits<Float>::infinity();
+    Float exit = std::numeric_limits<Float>::infinity();
+    VectorType entryNormal;
+    for(UnsignedInt i = 0; i != dimensions; ++i) {
+        const Float extent = box.extents[i] + radius;
+        const Float localDirection = VectorType::dot(direction, box.axes[i]);
+
+        /* Parallel to the slab */
+        if(Math::abs(localDirection) < Math::TypeTraits<Float>::epsilon()) {
+            if(Math::abs(localOrigin[i]) > extent) return false;
+            continue;
+        }
+
+        const Float near = (-Math::sign(localDirection)*extent - localOrigin[i])/localDirection;
+        const Float far = (Math::sign(localDirection)*extent - localOrigin[i])/localDirection;
+        if(near > entry) {
+            entry = near;
+            entryNormal = localDirection > 0.0f ? -box.axes[i] : box.axes[i];
+        }
+        exit = Math::min(exit, far);
+        if(entry > exit) return false;
+    }
+
+    /* Behind the ray or too far */
+    if(exit < 0.0f || entry > distance) return false;
+
+    /* Origin inside the box */
+    if(entry < 0.0f) {
+        if(radius == 0.0f) return insideHit(direction, distance, normal);
+        entry = 0.0f;
+    }
+
+    if(radius == 0.0f) {
+        distance = entry;
+        normal = entryNormal;
+        return true;
+    }
+
+    /* Signed distance to the inflated box is never larger than the distance
+       along the ray, so the steps never overshoot */
+    Float t = entry;
+    for(UnsignedInt i = 0; i != 64; ++i) {
+        const VectorType position = origin + direction*t;
+        const Float d = box.signedDistance(position) - radius;
+        if(d < Math::TypeTraits<Float>::epsilon()) {
+            if(d < 0.0f && t == 0.0f) return insideHit(direction, distance, normal);
+
+            distance = t;
+            normal = (position - box.closestPoint(position)).normalized();
+            return true;
+        }
+
+        t += d;
+        if(t > exit || t > distance) return false;
+    }
+
+    return false;
+}
+
+template<UnsignedInt dimensions> bool shapeRaycast(const Shapes::Point<dimensions>& shape, const typename DimensionTraits<dimensions, Float>::VectorType& origin, const typename DimensionTraits<dimensions, Float>::VectorType& direction, Float radius, Float& distance, typename DimensionTraits<dimensions, Float>::VectorType& normal) {
+    return radius > 0.0f && raySphere(origin, direction, shape.position(), radius, distance, normal);
+}
+
+template<UnsignedInt dimensions> bool shapeRaycast(const Shapes::Line<dimensions>& shape, const typename DimensionTraits<dimensions, Float>::VectorType& origin, const typename DimensionTraits<dimensions, Float>::VectorType& direction, Float radius, Float& distance, typename DimensionTraits<dimensions, Float>::VectorType& normal) {
+    return radius > 0.0f && rayCylinder(origin, direction, shape.a(), shape.b(), false, radius, distance, normal);
+}
+
+template<UnsignedInt dimensions> bool shapeRaycast(const Shapes::LineSegment<dimensions>& shape, const typename DimensionTraits<dimensions, Float>::VectorType& origin, const typename DimensionTraits<dimensions, Float>::VectorType& direction, Float radius, Float& distance, typename DimensionTraits<dimensions, Float>::VectorType& normal) {
+    return radius > 0.0f && rayCylinder(origin, direction, shape.a(), shape.b(), true, radius, distance, normal);
+}
+
+template<UnsignedInt dimensions> bool shapeRaycast(const Shapes::Sphere<dimensions>& shape, const typename DimensionTraits<dimensions, Float>::VectorType& origin, const typename DimensionTraits<dimensions, Float>::VectorType& direction, Float radius, Float& distance, typename DimensionTraits<dimensions, Float>::VectorType& normal) {
+    return raySphere(origin, direction, shape.position(), shape.radius() + radius, distance, normal);
+}
+
+template<UnsignedInt dimensions> bool shapeRaycast(const Shapes::Cylinder<dimensions>& shape, const typename DimensionTraits<dimensions, Float>::VectorType& origin, const typename DimensionTraits<dimensions, Float>::VectorType& direction, Float radius, Float& distance, typename DimensionTraits<dimensions, Float>::VectorType& normal) {
+    return rayCylinder(origin, direction, shape.a(), shape.b(), false, shape.radius() + radius, distance, normal);
+}
+
+template<UnsignedInt dimensions> bool shapeRaycast(const Shapes::Capsule<dimensions>& shape, const typename DimensionTraits<dimensions, Float>::VectorType& origin, const typename DimensionTraits<dimensions, Float>::VectorType& direction, Float radius, Float& distance, typename DimensionTraits<dimensions, Float>::VectorType& normal) {
+    return rayCylinder(origin, direction, shape.a(), shape.b(), true, shape.radius() + radius, distance, normal);
+}
+
+template<UnsignedInt dimensions> bool shapeRaycast(const Shapes::AxisAlignedBox<dimensions>& shape, const typename DimensionTraits<dimensions, Float>::VectorType& origin, const typename DimensionTraits<dimensions, Float>::VectorType& direction, Float radius, Float& distance, typename DimensionTraits<dimensions, Float>::VectorType& normal) {
+    return rayBox(origin, direction, OrientedBox<dimensions>(shape), radius, distance, normal);
+}
+
+template<UnsignedInt dimensions> bool shapeRaycast(const Shapes::Box<dimensions>& shape, const typename DimensionTraits<dimensions, Float>::VectorType& origin, const typename DimensionTraits<dimensions, Float>::VectorType& direction, Float radius, Float& distance, typename DimensionTraits<dimensions, Float>::VectorType& normal) {
+    return rayBox(origin, direction, OrientedBox<dimensions>(shape), radius, distance, normal);
+}
+
+/* Swept sphere (or point, if the radius is zero) against the support mapping
+   of the hull */
+template<UnsignedInt dimensions> bool shapeRaycast(const Shapes::ConvexHull<dimensions>& shape, const typename DimensionTraits<dimensions, Float>::VectorType& origin, const typename DimensionTraits<dimensions, Float>::VectorType& direction, Float radius, Float& distance, typename DimensionTraits<dimensions, Float>::VectorType& normal) {
+    if(shape.points().empty()) return false;
+
+    const Shapes::Sphere<dimensions> sphere(origin, radius);
+    return convexCast(convexSupport(sphere), convexSupport(shape), direction, distance, normal);
+}
+
+bool shapeRaycast(const Shapes::Plane& shape, const Vector3& origin, const Vector3& direction, Float radius, Float& distance, Vector3& normal) {
+    const Vector3 planeNormal = shape.normal().normalized();
+    const Float originDistance = Vector3::dot(origin - shape.position(), planeNormal);
+    if(Math::abs(originDistance) <= radius)
+        return insideHit(direction, distance, normal);
+
+    /* Moving away or parallel */
+    const Float d = Vector3::dot(direction, planeNormal);
+    if(originDistance*d >= 0.0f) return false;
+
+    const Float t = (Math::abs(originDistance) - radius)/Math::abs(d);
+    if(t > distance) return false;
+
+    distance = t;
+    normal = originDistance > 0.0f ? planeNormal : -planeNormal;
+    return true;
+}
+
+/* Shapes which can be swept as segment with radius */
+template<UnsignedInt dimensions> bool roundedShape(const AbstractShape<dimensions>& shape, typename DimensionTraits<dimensions, Float>::VectorType& a, typename DimensionTraits<dimensions, Float>::VectorType& b, Float& radius) {
+    switch(shape.type()) {
+        case ShapeDimensionTraits<dimensions>::Type::Point:
+            a = b = static_cast<const Shape<Shapes::Point<dimensions>>&>(shape).shape.position();
+            radius = 0.0f;
+            return true;
+        case ShapeDimensionTraits<dimensions>::Type::Sphere: {
+            const Shapes::Sphere<dimensions>& sphere = static_cast<const Shape<Shapes::Sphere<dimensions>>&>(shape).shape;
+            a = b = sphere.position();
+            radius = sphere.radius();
+            return true;
+        }
+        case ShapeDimensionTraits<dimensions>::Type::LineSegment: {
+            const Shapes::LineSegment<dimensions>& segment = static_cast<const Shape<Shapes::LineSegment<dimensions>>&>(shape).shape;
+            a = segment.a();
+            b = segment.b();
+            radius = 0.0f;
+            return true;
+        }
+        case ShapeDimensionTraits<dimensions>::Type::Capsule: {
+            const Shapes::Capsule<dimensions>& capsule = static_cast<const Shape<Shapes::Capsule<dimensions>>&>(shape).shape;
+            a = capsule.a();
+            b = capsule.b();
+            radius = capsule.radius();
+            return true;
+        }
+        default: return false;
+    }
+}
+
+/* Segments in 2D first touch always with endpoint of one of them */
+inline bool edgeEdgeTime(const Vector2&, const Vector2&, const Vector2&, const Vector2&, bool, const Vector2&, Float, Float&) {
+    return false;
+}
+
+/* Contact of interior of segment A moving by given displacement with interior
+   of segment or line B. Separation along common normal of the lines changes
+   linearly, parallel lines touch first with endpoints. */
+bool edgeEdgeTime(const Vector3& aA, const Vector3& aB, const Vector3& bA, const Vector3& bB, bool bSegment, const Vector3& displacement, Float radius, Float& time) {
+    const Vector3 normal = Vector3::cross(aB - aA, bB - bA);
+    const Float normalLength = normal.length();
+    if(normalLength < Math::TypeTraits<Float>::epsilon()*(aB - aA).length()*(bB - bA).length())
+        return false;
+
+    const Vector3 normalized = normal/normalLength;
+    const Float separation = Vector3::dot(aA - bA, normalized);
+    const Float speed = Vector3::dot(displacement, normalized);
+    if(separation*speed >= 0.0f || Math::abs(separation) <= radius) return false;
+
+    const Float t = (Math::abs(separation) - radius)/Math::abs(speed);
+    if(t > time) return false;
+
+    Float s, r;
+    closestPoints(aA + displacement*t, aB + displacement*t, false, bA, bB, false, s, r);
+    if(s < 0.0f || s > 1.0f || (bSegment && (r < 0.0f || r > 1.0f))) return false;
+
+    time = t;
+    return true;
+}
+
+/* Segment A moving from given position by given displacement against segment
+   or line B */
+template<class VectorType> Float segmentSegmentTime(const VectorType& aA, const VectorType& aB, const VectorType& bA, const VectorType& bB, bool bSegment, const VectorType& displacement, Float radius) {
+    Float s, r;
+    closestPoints(aA, aB, true, bA, bB, bSegment, s, r);
+    if(((aA + (aB - aA)*s) - (bA + (bB - bA)*r)).dot() <= Math::pow<2>(radius))
+        return 0.0f;
+
+    const Float length = displacement.length();
+    const VectorType direction = displacement/length;
+    Float distance = length;
+    VectorType normal;
+    bool hit = false;
+
+    /* Endpoints of A against B, endpoints of B against A */
+    hit = rayCylinder(aA, direction, bA, bB, bSegment, radius, distance, normal) || hit;
+    hit = rayCylinder(aB, direction, bA, bB, bSegment, radius, distance, normal) || hit;
+    if(bSegment) {
+        hit = rayCylinder(bA, -direction, aA, aB, true, radius, distance, normal) || hit;
+        hit = rayCylinder(bB, -direction, aA, aB, true, radius, distance, normal) || hit;
+    }
+
+    Float time = hit ? distance/length : 1.0f;
+    hit = edgeEdgeTime(aA, aB, bA, bB, bSegment, displacement, radius, time) || hit;
+    return hit ? time : std::numeric_limits<Float>::infinity();
+}
+
+/* Segment A moving from given position by given displacement against box */
+template<UnsignedInt dimensions> Float segmentBoxTime(const typename DimensionTraits<dimensions, Float>::VectorType& a, const typename DimensionTraits<dimensions, Float>::VectorType& b, const OrientedBox<dimensions>& box, const typename DimensionTraits<dimensions, Float>::VectorType& displacement, Float radius) {
+    typedef typename DimensionTraits<dimensions, Float>::VectorType VectorType;
+
+    if(boxLineContact(box, a, b, true, radius)) return 0.0f;
+
+    const Float length = displacement.length();
+    const VectorType direction = displacement/length;
+    Float distance = length;
+    VectorType normal;
+    bool hit = false;
+
+    /* Segment endpoints against the box */
+    hit = rayBox(a, direction, box, radius, distance, normal) || hit;
+    hit = rayBox(b, direction, box, radius, distance, normal) || hit;
+
+    /* Box vertices against the segment */
+    VectorType vertices[1 << dimensions];
+    for(UnsignedInt i = 0; i != 1 << dimensions; ++i) {
+        vertices[i] = box.center;
+        for(UnsignedInt j = 0; j != dimensions; ++j)
+            vertices[i] += box.axes[j]*(i & (1 << j) ? box.extents[j] : -box.extents[j]);
+        hit = rayCylinder(vertices[i], -direction, a, b, true, radius, distance, normal) || hit;
+    }
+
+    /* Box edges against the segment */
+    Float time = hit ? distance/length : 1.0f;
+    for(UnsignedInt i = 0; i != 1 << dimensions; ++i)
+        for(UnsignedInt j = 0; j != dimensions; ++j)
+            if(!(i & (1 << j)))
+                hit = edgeEdgeTime(a, b, vertices[i], vertices[i | (1 << j)], true, displacement, radius, time) || hit;
+
+    return hit ? time : std::numeric_limits<Float>::infinity();
+}
+
+/* Segment touches the plane first with one of its endpoints */
+inline bool segmentPlaneTime(const Vector2&, const Vector2&, const AbstractShape<2>&, const Vector2&, Float, Float&) {
+    return false;
+}
+
+bool segmentPlaneTime(const Vector3& a, const Vector3& b, const AbstractShape<3>& shape, const Vector3& displacement, Float radius, Float& time) {
+    if(shape.type() != ShapeDimensionTraits<3>::Type::Plane) return false;
+
+    const Shapes::Plane& plane = static_cast<const Shape<Shapes::Plane>&>(shape).shape;
+    const Vector3 planeNormal = plane.normal().normalized();
+    const Float aDistance = Vector3::dot(a - plane.position(), planeNormal);
+    const Float bDistance = Vector3::dot(b - plane.position(), planeNormal);
+    if(aDistance*bDistance <= 0.0f) {
+        time = 0.0f;
+        return true;
+    }
+
+    const Float length = displacement.length();
+    Float distance = length;
+    Vector3 normal;
+    const bool hit = shapeRaycast(plane, a, displacement/length, radius, distance, normal) |
+        shapeRaycast(plane, b, displacement/length, radius, distance, normal);
+    time = hit ? distance/length : std::numeric_limits<Float>::infinity();
+    return true;
+}
+
+template<UnsignedInt dimensions> inline bool isSweepable(typename ShapeDimensionTraits<dimensions>::Type type) {
+    return type != ShapeDimensionTraits<dimensions>::Type::InvertedSphere &&
+        type != ShapeDimensionTraits<dimensions>::Type::Composition;
+}
+
+}
+
+template<> bool raycast(const AbstractShape<2>& shape, const Vector2& origin, const Vector2& direction, Float radius, Float& distance, Vector2& normal) {
+    switch(shape.type()) {
+        #define _c(type, class) \
+            case ShapeDimensionTraits<2>::Type::type: \
+                return shapeRaycast(static_cast<const Shape<class>&>(shape).shape, origin, direction, radius, distance, normal);
+        _c(Point, Point2D)
+        _c(Line, Line2D)
+        _c(LineSegment, LineSegment2D)
+        _c(Sphere, Sphere2D)
+        _c(Cylinder, Cylinder2D)
+        _c(Capsule, Capsule2D)
+        _c(AxisAlignedBox, AxisAlignedBox2D)
+        _c(Box, Box2D)
+        _c(ConvexHull, ConvexHull2D)
+        #undef _c
+
+        case ShapeDimensionTraits<2>::Type::InvertedSphere:
+        case ShapeDimensionTraits<2>::Type::Composition:
+            break;
+    }
+
+    return false;
+}
+
+template<> bool raycast(const AbstractShape<3>& shape, const Vector3& origin, const Vector3& direction, Float radius, Float& distance, Vector3& normal) {
+    switch(shape.type()) {
+        #define _c(type, class) \
+            case ShapeDimensionTraits<3>::Type::type: \
+                return shapeRaycast(static_cast<const Shape<class>&>(shape).shape, origin, direction, radius, distance, normal);
+        _c(Point, Point3D)
+        _c(Line, Line3D)
+        _c(LineSegment, LineSegment3D)
+        _c(Sphere, Sphere3D)
+        _c(Cylinder, Cylinder3D)
+        _c(Capsule, Capsule3D)
+        _c(AxisAlignedBox, AxisAlignedBox3D)
+        _c(Box, Box3D)
+        _c(ConvexHull, ConvexHull3D)
+        _c(Plane, Plane)
+        #undef _c
+
+        case ShapeDimensionTraits<3>::Type::InvertedSphere:
+        case ShapeDimensionTraits<3>::Type::Composition:
+            break;
+    }
+
+    return false;
+}
+
+template<UnsignedInt dimensions> Float timeOfImpact(const AbstractShape<dimensions>& a, const typename DimensionTraits<dimensions, Float>::VectorType& aDisplacement, const AbstractShape<dimensions>& b, const typename DimensionTraits<dimensions, Float>::VectorType& bDisplacement) {
+    typedef typename DimensionTraits<dimensions, Float>::VectorType VectorType;
+
+    /* Relative movement of A, not moving at all */
+    const VectorType displacement = aDisplacement - bDisplacement;
+    const Float length = displacement.length();
+    if(length < Math::TypeTraits<Float>::epsilon())
+        return collides(a, b) ? 0.0f : std::numeric_limits<Float>::infinity();
+
+    VectorType aA, aB, bA, bB;
+    Float aRadius, bRadius;
+    const bool aRounded = roundedShape(a, aA, aB, aRadius);
+    const bool bRounded = roundedShape(b, bA, bB, bRadius);
+    if(!aRounded && bRounded) return timeOfImpact(b, bDisplacement, a, aDisplacement);
+
+    /* Unsupported pair, test only the final position */
+    if(!aRounded || !isSweepable<dimensions>(b.type()))
+        return collides(a, b) ? 1.0f : std::numeric_limits<Float>::infinity();
+
+    const VectorType direction = displacement/length;
+    Float distance = length;
+    VectorType normal;
+
+    /* Moving sphere, cast it against B in its final position */
+    if(aA == aB)
+        return raycast(b, aA - displacement, direction, aRadius, distance, normal) ?
+            distance/length : std::numeric_limits<Float>::infinity();
+
+    /* B is sphere, cast it in opposite direction against A in its final
+       position */
+    if(bRounded && bA == bB)
+        return raycast(a, bA + displacement, -direction, bRadius, distance, normal) ?
+            distance/length : std::numeric_limits<Float>::infinity();
+
+    /* Moving segment from its initial position */
+    aA -= displacement;
+    aB -= displacement;
+    if(bRounded)
+        return segmentSegmentTime(aA, aB, bA, bB, true, displacement, aRadius + bRadius);
+
+    switch(b.type()) {
+        case ShapeDimensionTraits<dimensions>::Type::Line: {
+            const Shapes::Line<dimensions>& line = static_cast<const Shape<Shapes::Line<dimensions>>&>(b).shape;
+            return segmentSegmentTime(aA, aB, line.a(), line.b(), false, displacement, aRadius);
+        }
+        case ShapeDimensionTraits<dimensions>::Type::Cylinder: {
+            const Shapes::Cylinder<dimensions>& cylinder = static_cast<const Shape<Shapes::Cylinder<dimensions>>&>(b).shape;
+            return segmentSegmentTime(aA, aB, cylinder.a(), cylinder.b(), false, displacement, aRadius + cylinder.radius());
+        }
+        case ShapeDimensionTraits<dimensions>::Type::AxisAlignedBox:
+            return segmentBoxTime(aA, aB, OrientedBox<dimensions>(static_cast<const Shape<Shapes::AxisAlignedBox<dimensions>>&>(b).shape), displacement, aRadius);
+        case ShapeDimensionTraits<dimensions>::Type::Box:
+            return segmentBoxTime(aA, aB, OrientedBox<dimensions>(static_cast<const Shape<Shapes::Box<dimensions>>&>(b).shape), displacement, aRadius);
+        case ShapeDimensionTraits<dimensions>::Type::ConvexHull: {
+            const Shapes::ConvexHull<dimensions>& hull = static_cast<const Shape<Shapes::ConvexHull<dimensions>>&>(b).shape;
+            if(hull.points().empty()) return std::numeric_limits<Float>::infinity();
+
+            const Shapes::Capsule<dimensions> capsule(aA, aB, aRadius);
+            return convexCast(convexSupport(capsule), convexSupport(hull), direction, distance, normal) ?
+                distance/length : std::numeric_limits<Float>::infinity();
+        }
+        default: break;
+    }
+
+    Float time;
+    if(segmentPlaneTime(aA, aB, b, displacement, aRadius, time)) return time;
+
+    return collides(a, b) ? 1.0f : std::numeric_limits<Float>::infinity();
+}
+
+template Float timeOfImpact<2>(const AbstractShape<2>&, const Vector2&, const AbstractShape<2>&, const Vector2&);
+template Float timeOfImpact<3>(const AbstractShape<3>&, const Vector3&, const AbstractShape<3>&, const Vector3&);
+
+}}}
@@ -0,0 +1,65 @@
+#ifndef Magnum_Shapes_Implementation_Raycast_h
+#define Magnum_Shapes_Implementation_Raycast_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DimensionTraits.h"
+#include "Types.h"
+
+namespace Magnum { namespace Shapes { namespace Implementation {
+
+template<UnsignedInt> struct AbstractShape;
+
+/*
+Ray or swept sphere intersection with the shape, used in ShapeGroup queries.
+The direction is expected to be normalized, swept sphere of zero radius is a
+ray. Returns true if the shape is hit not farther than `distance`, in that
+case `distance` is set to the hit distance and `normal` to the normalized
+surface normal (of the shape inflated by the radius). Convex hulls are cast
+against using their support function, see convexCast() in Implementation/Gjk.h.
+Inverted spheres and compositions are never hit, lines, line segments and
+points can be hit only by swept sphere.
+*/
+template<UnsignedInt dimensions> bool raycast(const AbstractShape<dimensions>& shape, const typename DimensionTraits<dimensions, Float>::VectorType& origin, const typename DimensionTraits<dimensions, Float>::VectorType& direction, Float radius, Float& distance, typename DimensionTraits<dimensions, Float>::VectorType& normal);
+
+/*
+Earliest time of contact of shapes moving by given displacements, used in
+ShapeGroup continuous collision detection. The shapes are passed in their
+final position, the movement is only linear translation. Returns value in
+range [0, 1], zero if the shapes overlap already at the beginning, infinity if
+they don't touch during the whole movement.
+
+Moving points and spheres are swept against all shapes supported by
+raycast(), capsules and line segments against all shapes except inverted
+spheres and compositions, convex hulls using their support function. Swept segment touches the other shape either with
+its endpoint or the other shape touches the segment with its vertex, in 3D
+the segment can also touch other segment or box edge with its interior. Other
+pairs are tested only at the end of the movement, returning either one or
+infinity.
+*/
+template<UnsignedInt dimensions> Float timeOfImpact(const AbstractShape<dimensions>& a, const typename DimensionTraits<dimensions, Float>::VectorType& aDisplacement, const AbstractShape<dimensions>& b, const typename DimensionTraits<dimensions, Float>::VectorType& bDisplacement);
+
+}}}
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef Magnum_Shapes_Implementation_ShapeBoundingVolume_h
+#define Magnum_Shapes_Implementation_ShapeBoundingVolume_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SceneGraph/BoundingVolume.h"
+#include "SceneGraph/MatrixTransformation2D.h"
+#include "SceneGraph/MatrixTransformation3D.h"
+#include "SceneGraph/Object.h"
+#include "Shapes/AbstractShape.h"
+#include "Shapes/Implementation/CollisionDispatch.h"
+
+namespace Magnum { namespace Shapes { namespace Implementation {
+
+template<UnsignedInt> struct ShapeBoundingVolumeObject;
+template<> struct ShapeBoundingVolumeObject<2> {
+    typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Type;
+};
+template<> struct ShapeBoundingVolumeObject<3> {
+    typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Type;
+};
+
+/*
+Bounding volume of a shape in ShapeGroup hierarchy. Absolute bounds are taken
+directly from the transformed shape, the volume is marked dirty together with
+the shape. Each volume has its own untransformed object, so no features are
+added to the object of the shape. The volume is destroyed together with the
+shape or when the shape is removed from the group.
+*/
+template<UnsignedInt dimensions> class ShapeBoundingVolume: public SceneGraph::BoundingVolume<dimensions, Float> {
+    public:
+        static ShapeBoundingVolume<dimensions>* create(Shapes::AbstractShape<dimensions>& shape, SceneGraph::BoundingVolumeHierarchy<dimensions, Float>& hierarchy) {
+            return new ShapeBoundingVolume<dimensions>(*new typename ShapeBoundingVolumeObject<dimensions>::Type, shape, hierarchy);
+        }
+
+        ~ShapeBoundingVolume() { _shape._boundingVolume = nullptr; }
+
+        /* Deletes the object, which deletes also the volume */
+        void destroy() { delete &this->object(); }
+
+        Shapes::AbstractShape<dimensions>& shape() { return _shape; }
+
+        using SceneGraph::BoundingVolume<dimensions, Float>::markDirty;
+
+    protected:
+        void clean(const typename DimensionTraits<dimensions, Float>::MatrixType&) override {
+            typename DimensionTraits<dimensions, Float>::VectorType min, max;
+            bounds(getAbstractShape(_shape), min, max);
+            this->setAbsoluteBounds(min, max);
+        }
+
+    private:
+        explicit ShapeBoundingVolume(SceneGraph::AbstractObject<dimensions, Float>& object, Shapes::AbstractShape<dimensions>& shape, SceneGraph::BoundingVolumeHierarchy<dimensions, Float>& hierarchy): SceneGraph::BoundingVolume<dimensions, Float>(object, &hierarchy), _shape(shape) {
+            _shape._boundingVolume = this;
+        }
+
+        Shapes::AbstractShape<dimensions>& _shape;
+};
+
+}}}
+
+#endif
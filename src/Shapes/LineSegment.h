@@ -55,6 +55,16 @@ template<UnsignedInt dimensions> class LineSegment: public Line<dimensions> {
             return Line<dimensions>::transformed(matrix);
         }
 
+        /**
+         * @brief Support point
+         *
+         * Point of the shape farthest in given direction, used for collision
+         * detection of arbitrary convex shapes. Always one of the endpoints.
+         */
+        typename DimensionTraits<dimensions, Float>::VectorType support(const typename DimensionTraits<dimensions, Float>::VectorType& direction) const {
+            return Math::Vector<dimensions, Float>::dot(this->a(), direction) > Math::Vector<dimensions, Float>::dot(this->b(), direction) ? this->a() : this->b();
+        }
+
     private:
         constexpr LineSegment(const Line<dimensions>& line): Line<dimensions>(line) {}
 };
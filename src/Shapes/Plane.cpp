@@ -28,12 +28,35 @@
 
 #include "Math/Matrix4.h"
 #include "Math/Geometry/Intersection.h"
+#include "Shapes/Capsule.h"
 #include "Shapes/LineSegment.h"
+#include "Shapes/Sphere.h"
+#include "Shapes/Implementation/ContactGeneration.h"
 
 using namespace Magnum::Math::Geometry;
 
 namespace Magnum { namespace Shapes {
 
+namespace {
+
+/* Plane is moved to the nearer of the extremal points of the other shape
+   along plane normal, min and max are signed distances of these points */
+Collision3D planeContact(const Vector3& normal, Float min, Float max, const Vector3& minPoint, const Vector3& maxPoint) {
+    /* No collision occured */
+    if(min >= 0.0f || max <= 0.0f) return {};
+
+    return -min < max ? Collision3D(minPoint, -normal, -min) :
+                        Collision3D(maxPoint, normal, max);
+}
+
+Collision3D planeBoxContact(const Vector3& position, const Vector3& normal, const Implementation::OrientedBox<3>& box) {
+    const Float distance = Vector3::dot(box.center - position, normal);
+    const Float radius = box.projectedRadius(normal);
+    return planeContact(normal, distance - radius, distance + radius, box.support(-normal), box.support(normal));
+}
+
+}
+
 Plane Plane::transformed(const Matrix4& matrix) const {
     /* Using matrix.rotation() would result in two more normalizations (slow),
        using .normalized() instead of matrix.uniformScaling() would not check
@@ -52,4 +75,45 @@ bool Plane::operator%(const LineSegment3D& other) const {
     return t > 0.0f && t < 1.0f;
 }
 
+bool Plane::operator%(const Sphere3D& other) const {
+    return Math::abs(Vector3::dot(other.position() - _position, _normal)) <
+        other.radius()*_normal.length();
+}
+
+Collision3D Plane::operator/(const Sphere3D& other) const {
+    const Vector3 normal = _normal.normalized();
+    const Float distance = Vector3::dot(other.position() - _position, normal);
+    return planeContact(normal, distance - other.radius(), distance + other.radius(),
+        other.position() - normal*other.radius(), other.position() + normal*other.radius());
+}
+
+bool Plane::operator%(const Capsule3D& other) const {
+    return *this/other;
+}
+
+Collision3D Plane::operator/(const Capsule3D& other) const {
+    const Vector3 normal = _normal.normalized();
+    const Float a = Vector3::dot(other.a() - _position, normal);
+    const Float b = Vector3::dot(other.b() - _position, normal);
+    return planeContact(normal, Math::min(a, b) - other.radius(), Math::max(a, b) + other.radius(),
+        (a < b ? other.a() : other.b()) - normal*other.radius(),
+        (a < b ? other.b() : other.a()) + normal*other.radius());
+}
+
+bool Plane::operator%(const AxisAlignedBox3D& other) const {
+    return *this/other;
+}
+
+Collision3D Plane::operator/(const AxisAlignedBox3D& other) const {
+    return planeBoxContact(_position, _normal.normalized(), Implementation::OrientedBox<3>(other));
+}
+
+bool Plane::operator%(const Box3D& other) const {
+    return *this/other;
+}
+
+Collision3D Plane::operator/(const Box3D& other) const {
+    return planeBoxContact(_position, _normal.normalized(), Implementation::OrientedBox<3>(other));
+}
+
 }}
@@ -30,6 +30,7 @@
 
 #include "Math/Vector3.h"
 #include "Magnum.h"
+#include "Shapes/Collision.h"
 #include "Shapes/Shapes.h"
 #include "Shapes/magnumShapesVisibility.h"
 
@@ -38,7 +39,9 @@ namespace Magnum { namespace Shapes {
 /**
 @brief Infinite plane, defined by position and normal (3D only)
 
-Unlike other elements the plane expects uniform scaling. See @ref shapes for
+Unlike other elements the plane expects uniform scaling. The plane is
+infinitely thin, volume shapes are separated from it in the direction which
+requires shorter movement. See @ref shapes for
 brief introduction.
 */
 class MAGNUM_SHAPES_EXPORT Plane {
@@ -82,6 +85,30 @@ class MAGNUM_SHAPES_EXPORT Plane {
         /** @brief %Collision occurence with line segment */
         bool operator%(const LineSegment3D& other) const;
 
+        /** @brief %Collision occurence with sphere */
+        bool operator%(const Sphere3D& other) const;
+
+        /** @brief %Collision with sphere */
+        Collision3D operator/(const Sphere3D& other) const;
+
+        /** @brief %Collision occurence with capsule */
+        bool operator%(const Capsule3D& other) const;
+
+        /** @brief %Collision with capsule */
+        Collision3D operator/(const Capsule3D& other) const;
+
+        /** @brief %Collision occurence with axis-aligned box */
+        bool operator%(const AxisAlignedBox3D& other) const;
+
+        /** @brief %Collision with axis-aligned box */
+        Collision3D operator/(const AxisAlignedBox3D& other) const;
+
+        /** @brief %Collision occurence with box */
+        bool operator%(const Box3D& other) const;
+
+        /** @brief %Collision with box */
+        Collision3D operator/(const Box3D& other) const;
+
     private:
         Vector3 _position, _normal;
 };
@@ -92,6 +119,30 @@ inline bool operator%(const Line3D& a, const Plane& b) { return b % a; }
 /** @collisionoccurenceoperator{LineSegment,Plane} */
 inline bool operator%(const LineSegment3D& a, const Plane& b) { return b % a; }
 
+/** @collisionoccurenceoperator{Sphere,Plane} */
+inline bool operator%(const Sphere3D& a, const Plane& b) { return b % a; }
+
+/** @collisionoperator{Sphere,Plane} */
+inline Collision3D operator/(const Sphere3D& a, const Plane& b) { return (b/a).flipped(); }
+
+/** @collisionoccurenceoperator{Capsule,Plane} */
+inline bool operator%(const Capsule3D& a, const Plane& b) { return b % a; }
+
+/** @collisionoperator{Capsule,Plane} */
+inline Collision3D operator/(const Capsule3D& a, const Plane& b) { return (b/a).flipped(); }
+
+/** @collisionoccurenceoperator{AxisAlignedBox,Plane} */
+inline bool operator%(const AxisAlignedBox3D& a, const Plane& b) { return b % a; }
+
+/** @collisionoperator{AxisAlignedBox,Plane} */
+inline Collision3D operator/(const AxisAlignedBox3D& a, const Plane& b) { return (b/a).flipped(); }
+
+/** @collisionoccurenceoperator{Box,Plane} */
+inline bool operator%(const Box3D& a, const Plane& b) { return b % a; }
+
+/** @collisionoperator{Box,Plane} */
+inline Collision3D operator/(const Box3D& a, const Plane& b) { return (b/a).flipped(); }
+
 
 }}
 
@@ -69,6 +69,16 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT Point {
             _position = position;
         }
 
+        /**
+         * @brief Support point
+         *
+         * Point of the shape farthest in given direction, used for collision
+         * detection of arbitrary convex shapes. Always the point itself.
+         */
+        typename DimensionTraits<dimensions, Float>::VectorType support(const typename DimensionTraits<dimensions, Float>::VectorType&) const {
+            return _position;
+        }
+
     private:
         typename DimensionTraits<dimensions, Float>::VectorType _position;
 };
@@ -0,0 +1,102 @@
+#ifndef Magnum_Shapes_RaycastHit_h
+#define Magnum_Shapes_RaycastHit_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shapes::RaycastHit
+ */
+
+#include <limits>
+
+#include "Math/Vector2.h"
+#include "Math/Vector3.h"
+#include "DimensionTraits.h"
+#include "Shapes/Shapes.h"
+
+namespace Magnum { namespace Shapes {
+
+/**
+@brief Raycast hit
+
+Result of @ref ShapeGroup::raycast(), @ref ShapeGroup::raycastAll() and
+@ref ShapeGroup::sphereCast(). Contains the hit shape, distance along the ray,
+hit position on shape surface and surface normal at that position, pointing
+against the ray.
+
+If the ray origin is inside the shape, distance is zero and the normal is
+opposite to ray direction.
+@see @ref RaycastHit2D, @ref RaycastHit3D
+*/
+template<UnsignedInt dimensions> class RaycastHit {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Creates empty hit with no shape and infinite distance.
+         */
+        /*implicit*/ RaycastHit(): _shape(nullptr), _distance(std::numeric_limits<Float>::infinity()) {}
+
+        /** @brief Constructor */
+        explicit RaycastHit(AbstractShape<dimensions>* shape, Float distance, typename DimensionTraits<dimensions, Float>::VectorType position, typename DimensionTraits<dimensions, Float>::VectorType normal): _shape(shape), _distance(distance), _position(position), _normal(normal) {}
+
+        /** @brief Whether any shape was hit */
+        operator bool() const { return _shape; }
+
+        /** @brief Hit shape or `nullptr` if nothing was hit */
+        AbstractShape<dimensions>* shape() const { return _shape; }
+
+        /**
+         * @brief Distance along the ray
+         *
+         * For sphere cast it is distance of the sphere center.
+         */
+        Float distance() const { return _distance; }
+
+        /** @brief Hit position on shape surface */
+        typename DimensionTraits<dimensions, Float>::VectorType position() const {
+            return _position;
+        }
+
+        /** @brief Normalized surface normal at hit position */
+        typename DimensionTraits<dimensions, Float>::VectorType normal() const {
+            return _normal;
+        }
+
+    private:
+        AbstractShape<dimensions>* _shape;
+        Float _distance;
+        typename DimensionTraits<dimensions, Float>::VectorType _position;
+        typename DimensionTraits<dimensions, Float>::VectorType _normal;
+};
+
+/** @brief Two-dimensional raycast hit */
+typedef RaycastHit<2> RaycastHit2D;
+
+/** @brief Three-dimensional raycast hit */
+typedef RaycastHit<3> RaycastHit3D;
+
+}}
+
+#endif
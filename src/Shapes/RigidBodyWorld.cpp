@@ -0,0 +1,591 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "RigidBodyWorld.h"
+
+#include <algorithm>
+#include <tuple>
+#include <Utility/Assert.h>
+
+#include "Math/Batch.h"
+#include "Math/Functions.h"
+#include "Math/Matrix4.h"
+#include "SceneGraph/AbstractObject.h"
+#include "SceneGraph/AbstractTranslationRotation3D.h"
+#include "Shapes/AbstractShape.h"
+#include "Shapes/Collision.h"
+#include "Shapes/ShapeGroup.h"
+#include "Timeline.h"
+
+namespace Magnum { namespace Shapes {
+
+namespace {
+    /* Contacts farther than this are removed from the manifold, new contacts
+       closer than this to existing ones replace them */
+    constexpr Float ContactThreshold = 0.02f;
+
+    /* Allowed penetration and fraction of the rest corrected in each step */
+    constexpr Float Slop = 0.005f;
+    constexpr Float Baumgarte = 0.2f;
+
+    /* Restitution is applied only for faster impacts to avoid jitter */
+    constexpr Float RestitutionVelocity = 1.0f;
+
+    /* Island falls asleep if all its bodies are slower than this for given
+       time */
+    constexpr Float LinearSleepVelocity = 0.05f;
+    constexpr Float AngularSleepVelocity = 0.05f;
+    constexpr Float TimeToSleep = 0.5f;
+
+    UnsignedInt findRoot(std::vector<UnsignedInt>& parents, UnsignedInt id) {
+        while(parents[id] != id) id = parents[id] = parents[parents[id]];
+        return id;
+    }
+}
+
+RigidBodyWorld::RigidBodyWorld(ShapeGroup3D& shapes, Float timeStep): _group(shapes), _timeStep(timeStep), _accumulator(0.0f), _gravity(0.0f, -9.81f, 0.0f), _iterations(10), _maxSteps(8), _threadCount(1), _friction(0.5f), _restitution(0.0f) {}
+
+RigidBodyWorld& RigidBodyWorld::setThreadCount(UnsignedInt count) {
+    CORRADE_ASSERT(count, "Shapes::RigidBodyWorld::setThreadCount(): at least one thread is needed", *this);
+    _threadCount = count;
+    return *this;
+}
+
+UnsignedInt RigidBodyWorld::addBody(AbstractShape3D& shape, SceneGraph::AbstractTranslationRotation3D& transformation, Float mass, const Vector3& inertia) {
+    CORRADE_ASSERT(shape.group() == &_group, "Shapes::RigidBodyWorld::addBody(): the shape is not part of the group", NoBody);
+    CORRADE_ASSERT(bodyId(&shape) == NoBody, "Shapes::RigidBodyWorld::addBody(): the shape is already added", NoBody);
+
+    const Matrix4 matrix = shape.object().absoluteTransformationMatrix();
+    const UnsignedInt id = _bodyShapes.size();
+    _positions.push_back(matrix.translation());
+    _orientations.push_back(Quaternion::fromMatrix(matrix.rotation()));
+    _linearVelocities.push_back({});
+    _angularVelocities.push_back({});
+    _inverseMasses.push_back(mass == 0.0f ? 0.0f : 1.0f/mass);
+    _inverseInertias.push_back(mass == 0.0f ? Vector3() :
+        Vector3(1.0f/inertia.x(), 1.0f/inertia.y(), 1.0f/inertia.z()));
+    _sleepTimes.push_back(0.0f);
+    _sleeping.push_back(false);
+    _bodyShapes.push_back(&shape);
+    _transformations.push_back(&transformation);
+
+    const std::pair<const AbstractShape3D*, UnsignedInt> entry(&shape, id);
+    _bodyIds.insert(std::lower_bound(_bodyIds.begin(), _bodyIds.end(), entry), entry);
+    return id;
+}
+
+RigidBodyWorld& RigidBodyWorld::removeBody(UnsignedInt id) {
+    CORRADE_ASSERT(id < _bodyShapes.size(), "Shapes::RigidBodyWorld::removeBody(): body" << id << "out of range for" << _bodyShapes.size() << "bodies", *this);
+    const UnsignedInt last = _bodyShapes.size() - 1;
+
+    /* Wake up bodies touching the removed one, as they might lose support.
+       Manifolds of the last body are dropped too instead of renaming them, as
+       that would break ordering of the pair, the contacts are found again in
+       next step. */
+    std::vector<Manifold> manifolds;
+    manifolds.reserve(_manifolds.size());
+    for(const Manifold& manifold: _manifolds) {
+        if(manifold.a == id || manifold.b == id) {
+            if(manifold.a != id) wakeUp(manifold.a);
+            if(manifold.b != id && manifold.b != NoBody) wakeUp(manifold.b);
+        } else if(manifold.a != last && manifold.b != last)
+            manifolds.push_back(manifold);
+    }
+    _manifolds.swap(manifolds);
+
+    /* Remove the shape from ID lookup, the last body gets the removed ID */
+    _bodyIds.erase(std::lower_bound(_bodyIds.begin(), _bodyIds.end(), std::make_pair(const_cast<const AbstractShape3D*>(_bodyShapes[id]), id)));
+    if(id != last) std::lower_bound(_bodyIds.begin(), _bodyIds.end(), std::make_pair(const_cast<const AbstractShape3D*>(_bodyShapes[last]), last))->second = id;
+
+    _positions[id] = _positions[last];
+    _orientations[id] = _orientations[last];
+    _linearVelocities[id] = _linearVelocities[last];
+    _angularVelocities[id] = _angularVelocities[last];
+    _inverseMasses[id] = _inverseMasses[last];
+    _inverseInertias[id] = _inverseInertias[last];
+    _sleepTimes[id] = _sleepTimes[last];
+    _sleeping[id] = _sleeping[last];
+    _bodyShapes[id] = _bodyShapes[last];
+    _transformations[id] = _transformations[last];
+
+    _positions.pop_back();
+    _orientations.pop_back();
+    _linearVelocities.pop_back();
+    _angularVelocities.pop_back();
+    _inverseMasses.pop_back();
+    _inverseInertias.pop_back();
+    _sleepTimes.pop_back();
+    _sleeping.pop_back();
+    _bodyShapes.pop_back();
+    _transformations.pop_back();
+    return *this;
+}
+
+RigidBodyWorld& RigidBodyWorld::setPosition(UnsignedInt id, const Vector3& position) {
+    _positions[id] = position;
+    updateTransformation(id);
+    return wakeUp(id);
+}
+
+RigidBodyWorld& RigidBodyWorld::setOrientation(UnsignedInt id, const Quaternion& orientation) {
+    CORRADE_ASSERT(orientation.isNormalized(), "Shapes::RigidBodyWorld::setOrientation(): the quaternion must be normalized", *this);
+    _orientations[id] = orientation;
+    updateTransformation(id);
+    return wakeUp(id);
+}
+
+RigidBodyWorld& RigidBodyWorld::setLinearVelocity(UnsignedInt id, const Vector3& velocity) {
+    _linearVelocities[id] = velocity;
+    return wakeUp(id);
+}
+
+RigidBodyWorld& RigidBodyWorld::setAngularVelocity(UnsignedInt id, const Vector3& velocity) {
+    _angularVelocities[id] = velocity;
+    return wakeUp(id);
+}
+
+RigidBodyWorld& RigidBodyWorld::applyImpulse(UnsignedInt id, const Vector3& impulse, const Vector3& point) {
+    addImpulse(id, impulse, point - _positions[id]);
+    return wakeUp(id);
+}
+
+RigidBodyWorld& RigidBodyWorld::wakeUp(UnsignedInt id) {
+    _sleeping[id] = false;
+    _sleepTimes[id] = 0.0f;
+    return *this;
+}
+
+UnsignedInt RigidBodyWorld::step(const Timeline& timeline) {
+    return step(timeline.previousFrameDuration());
+}
+
+UnsignedInt RigidBodyWorld::step(Float frameDuration) {
+    _accumulator += frameDuration;
+
+    UnsignedInt steps = 0;
+    for(; _accumulator >= _timeStep && steps != _maxSteps; ++steps) {
+        updateManifolds();
+        updateIslands();
+
+        /* Islands don't share any data, so they can be solved in parallel */
+        const UnsignedInt islandCount = _islandBodyOffsets.size() - 1;
+        Math::Batch::Implementation::parallelRanges(islandCount, 1, _threadCount, [this](std::size_t, std::size_t begin, std::size_t end) {
+            for(std::size_t i = begin; i != end; ++i) solveIsland(i);
+        });
+
+        /* Kinematic bodies aren't part of any island, they just move with
+           given velocity */
+        for(std::size_t i = 0; i != _bodyShapes.size(); ++i)
+            if(_inverseMasses[i] == 0.0f) integrate(i);
+
+        updateTransformations();
+        updateSleeping();
+        _accumulator -= _timeStep;
+    }
+
+    /* Drop the rest if the simulation can't catch up */
+    if(_accumulator >= _timeStep) _accumulator = 0.0f;
+
+    return steps;
+}
+
+bool RigidBodyWorld::isActive(UnsignedInt id) const {
+    if(id == NoBody) return false;
+    if(_inverseMasses[id] != 0.0f) return !_sleeping[id];
+    return _linearVelocities[id] != Vector3() || _angularVelocities[id] != Vector3();
+}
+
+void RigidBodyWorld::updateManifolds() {
+    const auto pairs = _group.collisions();
+
+    /* Sleeping bodies touched by active ones are woken up */
+    std::vector<std::pair<AbstractShape3D*, AbstractShape3D*>> activePairs;
+    std::vector<std::pair<UnsignedInt, UnsignedInt>> activeIds;
+    for(const auto& pair: pairs) {
+        const UnsignedInt a = bodyId(pair.first);
+        const UnsignedInt b = bodyId(pair.second);
+        if(isActive(a) && b != NoBody && _sleeping[b]) wakeUp(b);
+        if(isActive(b) && a != NoBody && _sleeping[a]) wakeUp(a);
+    }
+    for(const auto& pair: pairs) {
+        UnsignedInt a = bodyId(pair.first);
+        UnsignedInt b = bodyId(pair.second);
+        if(!isActive(a) && !isActive(b)) continue;
+        if((a == NoBody || _inverseMasses[a] == 0.0f) && (b == NoBody || _inverseMasses[b] == 0.0f)) continue;
+
+        /* Order the pair by body IDs with static shapes last, so the
+           contacts and solve order don't depend on memory layout */
+        if(b < a) {
+            activePairs.push_back({pair.second, pair.first});
+            std::swap(a, b);
+        } else activePairs.push_back(pair);
+        activeIds.push_back({a, b});
+    }
+
+    const std::vector<Collision3D> collisions = _group.collisionData(activePairs);
+
+    /* Keep manifolds of inactive bodies, so sleeping bodies have their
+       contacts when they wake up */
+    std::vector<Manifold> manifolds;
+    manifolds.reserve(_manifolds.size());
+    for(const Manifold& manifold: _manifolds)
+        if(!isActive(manifold.a) && !isActive(manifold.b))
+            manifolds.push_back(manifold);
+
+    for(std::size_t i = 0; i != activePairs.size(); ++i) {
+        const Collision3D& collision = collisions[i];
+        if(!collision) continue;
+
+        const UnsignedInt a = activeIds[i].first;
+        const UnsignedInt b = activeIds[i].second;
+        const AbstractShape3D* const shapeB = activePairs[i].second;
+        auto found = std::lower_bound(_manifolds.begin(), _manifolds.end(), std::make_tuple(a, b, shapeB), [](const Manifold& manifold, const std::tuple<UnsignedInt, UnsignedInt, const AbstractShape3D*>& key) {
+            return std::make_tuple(manifold.a, manifold.b, manifold.shapeB) < key;
+        });
+
+        Manifold manifold;
+        if(found != _manifolds.end() && found->a == a && found->b == b && found->shapeB == shapeB) {
+            manifold = *found;
+
+            /* Contact impulses are not usable if the normal changed too
+               much */
+            if(Vector3::dot(manifold.normal, collision.separationNormal()) < 0.95f)
+                for(UnsignedInt j = 0; j != manifold.contactCount; ++j)
+                    manifold.contacts[j].normalImpulse = manifold.contacts[j].tangentImpulses[0] = manifold.contacts[j].tangentImpulses[1] = 0.0f;
+        } else {
+            manifold.shapeB = shapeB;
+            manifold.a = a;
+            manifold.b = b;
+            manifold.contactCount = 0;
+        }
+        manifold.normal = collision.separationNormal();
+
+        /* Remove contacts which are separated or slid away, update depth of
+           the others */
+        for(UnsignedInt j = 0; j != manifold.contactCount; ) {
+            Contact& contact = manifold.contacts[j];
+            const Vector3 pointA = toWorld(manifold.a, contact.localA);
+            const Vector3 pointB = toWorld(manifold.b, contact.localB);
+            contact.depth = Vector3::dot(pointB - pointA, manifold.normal);
+            if(contact.depth < -ContactThreshold || (pointB - pointA - manifold.normal*contact.depth).dot() > ContactThreshold*ContactThreshold)
+                contact = manifold.contacts[--manifold.contactCount];
+            else ++j;
+        }
+
+        /* Add the new contact or replace the nearest existing one. The point
+           is on surface of the second shape, deepest point of the first
+           shape is opposite to the separation normal. */
+        const Vector3 pointB = collision.position();
+        const Vector3 pointA = pointB - manifold.normal*collision.separationDistance();
+        UnsignedInt nearest = manifold.contactCount;
+        for(UnsignedInt j = 0; j != manifold.contactCount; ++j)
+            if((toWorld(manifold.b, manifold.contacts[j].localB) - pointB).dot() < ContactThreshold*ContactThreshold) {
+                nearest = j;
+                break;
+            }
+
+        Contact contact;
+        if(nearest != manifold.contactCount) contact = manifold.contacts[nearest];
+        else contact.normalImpulse = contact.tangentImpulses[0] = contact.tangentImpulses[1] = 0.0f;
+        contact.localA = toLocal(manifold.a, pointA);
+        contact.localB = toLocal(manifold.b, pointB);
+        contact.depth = collision.separationDistance();
+
+        if(nearest != manifold.contactCount) manifold.contacts[nearest] = contact;
+        else if(manifold.contactCount != 4) manifold.contacts[manifold.contactCount++] = contact;
+        else reduceContacts(manifold, contact);
+
+        manifolds.push_back(manifold);
+    }
+
+    std::sort(manifolds.begin(), manifolds.end(), [](const Manifold& a, const Manifold& b) {
+        return std::make_tuple(a.a, a.b, a.shapeB) < std::make_tuple(b.a, b.b, b.shapeB);
+    });
+    std::swap(_manifolds, manifolds);
+}
+
+void RigidBodyWorld::reduceContacts(Manifold& manifold, const Contact& contact) {
+    /* Keep the deepest contact and replace the one which gives largest
+       contact area */
+    Contact contacts[5];
+    Vector3 points[5];
+    std::copy(manifold.contacts, manifold.contacts + 4, contacts);
+    contacts[4] = contact;
+    UnsignedInt deepest = 0;
+    for(UnsignedInt i = 0; i != 5; ++i) {
+        points[i] = toWorld(manifold.b, contacts[i].localB);
+        if(contacts[i].depth > contacts[deepest].depth) deepest = i;
+    }
+
+    UnsignedInt removed = deepest == 0 ? 1 : 0;
+    Float largestArea = -1.0f;
+    for(UnsignedInt i = 0; i != 5; ++i) {
+        if(i == deepest) continue;
+
+        Vector3 remaining[4];
+        for(UnsignedInt j = 0, k = 0; j != 5; ++j)
+            if(j != i) remaining[k++] = points[j];
+
+        const Float area = Vector3::cross(remaining[0] - remaining[2], remaining[1] - remaining[3]).dot();
+        if(area > largestArea) {
+            largestArea = area;
+            removed = i;
+        }
+    }
+
+    for(UnsignedInt j = 0, k = 0; j != 5; ++j)
+        if(j != removed) manifold.contacts[k++] = contacts[j];
+}
+
+void RigidBodyWorld::updateIslands() {
+    /* Connect dynamic bodies touching each other */
+    std::vector<UnsignedInt> parents(_bodyShapes.size());
+    for(UnsignedInt i = 0; i != parents.size(); ++i) parents[i] = i;
+    for(const Manifold& manifold: _manifolds) {
+        if(!isDynamic(manifold.a) || !isDynamic(manifold.b)) continue;
+        parents[findRoot(parents, manifold.a)] = findRoot(parents, manifold.b);
+    }
+
+    /* Island is awake if any of its bodies is awake, wake up the others */
+    std::vector<UnsignedByte> awake(parents.size(), false);
+    for(UnsignedInt i = 0; i != parents.size(); ++i)
+        if(isDynamic(i) && !_sleeping[i]) awake[findRoot(parents, i)] = true;
+
+    /* Number the awake islands in order of their first body, so the order
+       doesn't depend on anything else than body IDs */
+    std::vector<UnsignedInt> islands(parents.size(), NoBody);
+    UnsignedInt islandCount = 0;
+    for(UnsignedInt i = 0; i != parents.size(); ++i) {
+        if(!isDynamic(i)) continue;
+        const UnsignedInt root = findRoot(parents, i);
+        if(!awake[root]) continue;
+        if(_sleeping[i]) wakeUp(i);
+        if(islands[root] == NoBody) islands[root] = islandCount++;
+        islands[i] = islands[root];
+    }
+
+    /* Distribute the bodies and manifolds into the islands */
+    _islandBodyOffsets.assign(islandCount + 1, 0);
+    for(UnsignedInt i = 0; i != parents.size(); ++i)
+        if(isDynamic(i) && islands[i] != NoBody) ++_islandBodyOffsets[islands[i] + 1];
+    for(UnsignedInt i = 0; i != islandCount; ++i)
+        _islandBodyOffsets[i + 1] += _islandBodyOffsets[i];
+    _islandBodies.resize(_islandBodyOffsets.back());
+    std::vector<UnsignedInt> offsets(_islandBodyOffsets.begin(), _islandBodyOffsets.end() - 1);
+    for(UnsignedInt i = 0; i != parents.size(); ++i)
+        if(isDynamic(i) && islands[i] != NoBody) _islandBodies[offsets[islands[i]]++] = i;
+
+    std::vector<std::pair<UnsignedInt, UnsignedInt>> manifoldIslands;
+    for(UnsignedInt i = 0; i != _manifolds.size(); ++i) {
+        const Manifold& manifold = _manifolds[i];
+        const UnsignedInt island = islands[isDynamic(manifold.a) ? manifold.a : manifold.b];
+        if(island != NoBody) manifoldIslands.push_back({island, i});
+    }
+
+    /* Manifolds are sorted by body IDs, keep the order in each island */
+    std::stable_sort(manifoldIslands.begin(), manifoldIslands.end(), [](const std::pair<UnsignedInt, UnsignedInt>& a, const std::pair<UnsignedInt, UnsignedInt>& b) {
+        return a.first < b.first;
+    });
+
+    _islandManifoldOffsets.assign(islandCount + 1, 0);
+    _islandManifolds.resize(manifoldIslands.size());
+    for(std::size_t i = 0; i != manifoldIslands.size(); ++i) {
+        ++_islandManifoldOffsets[manifoldIslands[i].first + 1];
+        _islandManifolds[i] = manifoldIslands[i].second;
+    }
+    for(UnsignedInt i = 0; i != islandCount; ++i)
+        _islandManifoldOffsets[i + 1] += _islandManifoldOffsets[i];
+}
+
+void RigidBodyWorld::solveIsland(UnsignedInt island) {
+    const UnsignedInt* const bodiesBegin = _islandBodies.data() + _islandBodyOffsets[island];
+    const UnsignedInt* const bodiesEnd = _islandBodies.data() + _islandBodyOffsets[island + 1];
+    const UnsignedInt* const manifoldsBegin = _islandManifolds.data() + _islandManifoldOffsets[island];
+    const UnsignedInt* const manifoldsEnd = _islandManifolds.data() + _islandManifoldOffsets[island + 1];
+
+    /* Integrate velocities */
+    for(const UnsignedInt* id = bodiesBegin; id != bodiesEnd; ++id)
+        _linearVelocities[*id] += _gravity*_timeStep;
+
+    /* Prepare contacts and apply impulses from previous step */
+    for(const UnsignedInt* m = manifoldsBegin; m != manifoldsEnd; ++m) {
+        Manifold& manifold = _manifolds[*m];
+        const Vector3 n = manifold.normal;
+
+        for(UnsignedInt j = 0; j != manifold.contactCount; ++j) {
+            Contact& contact = manifold.contacts[j];
+            contact.armA = manifold.a == NoBody ? Vector3() : toWorld(manifold.a, contact.localA) - _positions[manifold.a];
+            contact.armB = manifold.b == NoBody ? Vector3() : toWorld(manifold.b, contact.localB) - _positions[manifold.b];
+
+            contact.tangents[0] = Math::abs(n.x()) < 0.57735f ?
+                Vector3::cross(n, Vector3::xAxis()).normalized() :
+                Vector3::cross(n, Vector3::yAxis()).normalized();
+            contact.tangents[1] = Vector3::cross(n, contact.tangents[0]);
+
+            contact.normalMass = 1.0f/(effectiveMass(manifold.a, contact.armA, n) + effectiveMass(manifold.b, contact.armB, n));
+            for(UnsignedInt k = 0; k != 2; ++k)
+                contact.tangentMasses[k] = 1.0f/(effectiveMass(manifold.a, contact.armA, contact.tangents[k]) + effectiveMass(manifold.b, contact.armB, contact.tangents[k]));
+
+            /* Push the bodies apart if they penetrate too much, bounce off if
+               the impact is fast enough */
+            contact.bias = Baumgarte/_timeStep*std::max(contact.depth - Slop, 0.0f);
+            const Float normalVelocity = Vector3::dot(velocity(manifold.a, contact.armA) - velocity(manifold.b, contact.armB), n);
+            if(normalVelocity < -RestitutionVelocity)
+                contact.bias = std::max(contact.bias, -_restitution*normalVelocity);
+
+            const Vector3 impulse = n*contact.normalImpulse +
+                contact.tangents[0]*contact.tangentImpulses[0] +
+                contact.tangents[1]*contact.tangentImpulses[1];
+            addImpulse(manifold.a, impulse, contact.armA);
+            addImpulse(manifold.b, -impulse, contact.armB);
+        }
+    }
+
+    /* Sequential impulses */
+    for(UnsignedInt i = 0; i != _iterations; ++i) {
+        for(const UnsignedInt* m = manifoldsBegin; m != manifoldsEnd; ++m) {
+            Manifold& manifold = _manifolds[*m];
+            const Vector3 n = manifold.normal;
+
+            for(UnsignedInt j = 0; j != manifold.contactCount; ++j) {
+                Contact& contact = manifold.contacts[j];
+
+                /* Friction, limited by current normal impulse */
+                const Float maxFriction = _friction*contact.normalImpulse;
+                for(UnsignedInt k = 0; k != 2; ++k) {
+                    const Vector3 relativeVelocity = velocity(manifold.a, contact.armA) - velocity(manifold.b, contact.armB);
+                    const Float lambda = -Vector3::dot(relativeVelocity, contact.tangents[k])*contact.tangentMasses[k];
+                    const Float accumulated = Math::clamp(contact.tangentImpulses[k] + lambda, -maxFriction, maxFriction);
+                    const Vector3 impulse = contact.tangents[k]*(accumulated - contact.tangentImpulses[k]);
+                    contact.tangentImpulses[k] = accumulated;
+                    addImpulse(manifold.a, impulse, contact.armA);
+                    addImpulse(manifold.b, -impulse, contact.armB);
+                }
+
+                /* Non-penetration, the bodies can only be pushed apart */
+                const Vector3 relativeVelocity = velocity(manifold.a, contact.armA) - velocity(manifold.b, contact.armB);
+                const Float lambda = (contact.bias - Vector3::dot(relativeVelocity, n))*contact.normalMass;
+                const Float accumulated = std::max(contact.normalImpulse + lambda, 0.0f);
+                const Vector3 impulse = n*(accumulated - contact.normalImpulse);
+                contact.normalImpulse = accumulated;
+                addImpulse(manifold.a, impulse, contact.armA);
+                addImpulse(manifold.b, -impulse, contact.armB);
+            }
+        }
+    }
+
+    /* Integrate positions and update sleep timers */
+    for(const UnsignedInt* id = bodiesBegin; id != bodiesEnd; ++id) {
+        integrate(*id);
+
+        if(_linearVelocities[*id].dot() < LinearSleepVelocity*LinearSleepVelocity &&
+           _angularVelocities[*id].dot() < AngularSleepVelocity*AngularSleepVelocity)
+            _sleepTimes[*id] += _timeStep;
+        else _sleepTimes[*id] = 0.0f;
+    }
+}
+
+void RigidBodyWorld::updateSleeping() {
+    for(UnsignedInt island = 0; island != _islandBodyOffsets.size() - 1; ++island) {
+        const UnsignedInt* const begin = _islandBodies.data() + _islandBodyOffsets[island];
+        const UnsignedInt* const end = _islandBodies.data() + _islandBodyOffsets[island + 1];
+
+        bool resting = true;
+        for(const UnsignedInt* id = begin; id != end && resting; ++id)
+            resting = _sleepTimes[*id] >= TimeToSleep;
+        if(!resting) continue;
+
+        for(const UnsignedInt* id = begin; id != end; ++id) {
+            _sleeping[*id] = true;
+            _linearVelocities[*id] = {};
+            _angularVelocities[*id] = {};
+        }
+    }
+}
+
+void RigidBodyWorld::integrate(UnsignedInt id) {
+    const Vector3& angularVelocity = _angularVelocities[id];
+    _positions[id] += _linearVelocities[id]*_timeStep;
+    _orientations[id] = (_orientations[id] + Quaternion(angularVelocity*(0.5f*_timeStep))*_orientations[id]).normalized();
+}
+
+bool RigidBodyWorld::isDynamic(UnsignedInt id) const {
+    return id != NoBody && _inverseMasses[id] != 0.0f;
+}
+
+Vector3 RigidBodyWorld::toWorld(UnsignedInt id, const Vector3& point) const {
+    if(id == NoBody) return point;
+    return _orientations[id].transformVectorNormalized(point) + _positions[id];
+}
+
+Vector3 RigidBodyWorld::toLocal(UnsignedInt id, const Vector3& point) const {
+    if(id == NoBody) return point;
+    return _orientations[id].conjugated().transformVectorNormalized(point - _positions[id]);
+}
+
+Vector3 RigidBodyWorld::inverseInertia(UnsignedInt id, const Vector3& vector) const {
+    const Quaternion& orientation = _orientations[id];
+    return orientation.transformVectorNormalized(_inverseInertias[id]*orientation.conjugated().transformVectorNormalized(vector));
+}
+
+Float RigidBodyWorld::effectiveMass(UnsignedInt id, const Vector3& arm, const Vector3& direction) const {
+    if(!isDynamic(id)) return 0.0f;
+    return _inverseMasses[id] + Vector3::dot(direction, Vector3::cross(inverseInertia(id, Vector3::cross(arm, direction)), arm));
+}
+
+Vector3 RigidBodyWorld::velocity(UnsignedInt id, const Vector3& arm) const {
+    if(id == NoBody) return {};
+    return _linearVelocities[id] + Vector3::cross(_angularVelocities[id], arm);
+}
+
+void RigidBodyWorld::addImpulse(UnsignedInt id, const Vector3& impulse, const Vector3& arm) {
+    if(!isDynamic(id)) return;
+    _linearVelocities[id] += impulse*_inverseMasses[id];
+    _angularVelocities[id] += inverseInertia(id, Vector3::cross(arm, impulse));
+}
+
+UnsignedInt RigidBodyWorld::bodyId(const AbstractShape3D* shape) const {
+    auto found = std::lower_bound(_bodyIds.begin(), _bodyIds.end(), shape, [](const std::pair<const AbstractShape3D*, UnsignedInt>& entry, const AbstractShape3D* shape) {
+        return entry.first < shape;
+    });
+    return found != _bodyIds.end() && found->first == shape ? found->second : NoBody;
+}
+
+void RigidBodyWorld::updateTransformations() {
+    for(UnsignedInt i = 0; i != _bodyShapes.size(); ++i)
+        if(isActive(i)) updateTransformation(i);
+}
+
+void RigidBodyWorld::updateTransformation(UnsignedInt id) {
+    const Quaternion& orientation = _orientations[id];
+    const Float sine = orientation.vector().length();
+
+    SceneGraph::AbstractTranslationRotation3D& transformation = *_transformations[id];
+    transformation.resetTransformation();
+    if(sine > 1.0e-6f)
+        transformation.rotate(Rad(2.0f*std::atan2(sine, orientation.scalar())), orientation.vector()/sine);
+    transformation.translate(_positions[id]);
+}
+
+}}
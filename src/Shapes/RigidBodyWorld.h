@@ -0,0 +1,409 @@
+#ifndef Magnum_Shapes_RigidBodyWorld_h
+#define Magnum_Shapes_RigidBodyWorld_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::Shapes::RigidBodyWorld
+ */
+
+#include <utility>
+#include <vector>
+
+#include "Math/Quaternion.h"
+#include "Math/Vector3.h"
+#include "Magnum.h"
+#include "SceneGraph/SceneGraph.h"
+#include "Shapes/Shapes.h"
+
+#include "magnumShapesVisibility.h"
+
+namespace Magnum { namespace Shapes {
+
+/**
+@brief Rigid body world
+
+Simulates rigid bodies attached to shapes in given @ref ShapeGroup3D. Each
+body is represented by a shape and transformation of the object the shape is
+attached to. Center of mass of the body is in origin of the object, the
+object is expected to be direct child of the scene. Shapes in the group which
+are not added as bodies are treated as static geometry. See @ref shapes for
+brief introduction.
+
+@section RigidBodyWorld-simulation Simulation
+
+The simulation runs with fixed time step, @ref step() subdivides given frame
+duration into whole time steps and keeps the remainder for the next call:
+@code
+Shapes::ShapeGroup3D shapes;
+Shapes::RigidBodyWorld world(shapes);
+
+Object3D box(&scene);
+Shapes::Shape<Shapes::Box3D> boxShape(box, Matrix4(), &shapes);
+world.addBody(boxShape, box, 1.0f, Vector3(2.0f/3.0f));
+
+// in draw event
+world.step(timeline);
+@endcode
+
+The world keeps references to shapes and objects of all bodies, so a body must
+be removed using @ref removeBody() before its shape or object is destroyed:
+@code
+world.removeBody(id);
+@endcode
+
+Each time step collects colliding pairs using @ref ShapeGroup::collisions()
+and @ref ShapeGroup::collisionData(). Contact points of each pair are kept
+between time steps (up to four points per pair), so resting bodies have
+stable support. Contacts are resolved using sequential impulses with
+accumulated impulses from last step used as initial guess, then velocities
+and positions are integrated with semi-implicit Euler method. Body state is
+stored in separate arrays for each property, so the solver and integrator
+access them sequentially.
+
+@section RigidBodyWorld-sleeping Islands and sleeping
+
+Bodies touching each other (directly or through other bodies) form islands,
+which are solved independently. When all bodies in an island are resting
+for some time, the island is put to sleep and is not simulated until other
+body touches it or until any body in it is woken up using @ref wakeUp().
+
+@section RigidBodyWorld-threads Multi-threaded simulation
+
+Islands can be solved in multiple threads from a shared worker pool if Magnum
+is built with @ref MAGNUM_BUILD_THREADS, see @ref setThreadCount(). The
+bodies are always solved in the same order regardless of thread count, so
+the simulation is deterministic and gives the same results in single- and
+multi-threaded mode.
+
+@todo Two-dimensional version
+*/
+class MAGNUM_SHAPES_EXPORT RigidBodyWorld {
+    public:
+        /**
+         * @brief Constructor
+         * @param shapes        Group of shapes
+         * @param timeStep      Fixed time step (in seconds)
+         */
+        explicit RigidBodyWorld(ShapeGroup3D& shapes, Float timeStep = 1.0f/60.0f);
+
+        /** @brief Copying is not allowed */
+        RigidBodyWorld(const RigidBodyWorld&) = delete;
+
+        /** @brief Moving is not allowed */
+        RigidBodyWorld(RigidBodyWorld&&) = delete;
+
+        /** @brief Copying is not allowed */
+        RigidBodyWorld& operator=(const RigidBodyWorld&) = delete;
+
+        /** @brief Moving is not allowed */
+        RigidBodyWorld& operator=(RigidBodyWorld&&) = delete;
+
+        /** @brief Group of shapes */
+        ShapeGroup3D& shapes() { return _group; }
+
+        /** @brief Fixed time step (in seconds) */
+        Float timeStep() const { return _timeStep; }
+
+        /** @brief Gravity */
+        Vector3 gravity() const { return _gravity; }
+
+        /**
+         * @brief Set gravity
+         * @return Reference to self (for method chaining)
+         *
+         * Default is `{0.0f, -9.81f, 0.0f}`.
+         */
+        RigidBodyWorld& setGravity(const Vector3& gravity) {
+            _gravity = gravity;
+            return *this;
+        }
+
+        /** @brief Solver iteration count */
+        UnsignedInt iterations() const { return _iterations; }
+
+        /**
+         * @brief Set solver iteration count
+         * @return Reference to self (for method chaining)
+         *
+         * More iterations give more stable stacking. Default is `10`.
+         */
+        RigidBodyWorld& setIterations(UnsignedInt iterations) {
+            _iterations = iterations;
+            return *this;
+        }
+
+        /** @brief Friction coefficient */
+        Float friction() const { return _friction; }
+
+        /**
+         * @brief Set friction coefficient
+         * @return Reference to self (for method chaining)
+         *
+         * Default is `0.5f`.
+         */
+        RigidBodyWorld& setFriction(Float friction) {
+            _friction = friction;
+            return *this;
+        }
+
+        /** @brief Restitution */
+        Float restitution() const { return _restitution; }
+
+        /**
+         * @brief Set restitution
+         * @return Reference to self (for method chaining)
+         *
+         * Value `0.0f` means that colliding bodies don't bounce off each
+         * other, `1.0f` means perfectly elastic collision. Default is `0.0f`.
+         */
+        RigidBodyWorld& setRestitution(Float restitution) {
+            _restitution = restitution;
+            return *this;
+        }
+
+        /** @brief Max count of time steps in one step() call */
+        UnsignedInt maxSteps() const { return _maxSteps; }
+
+        /**
+         * @brief Set max count of time steps in one step() call
+         * @return Reference to self (for method chaining)
+         *
+         * If the frame takes longer than given count of time steps, the rest
+         * is dropped so the simulation can catch up. Default is `8`.
+         */
+        RigidBodyWorld& setMaxSteps(UnsignedInt count) {
+            _maxSteps = count;
+            return *this;
+        }
+
+        /** @brief Thread count */
+        UnsignedInt threadCount() const { return _threadCount; }
+
+        /**
+         * @brief Set thread count
+         * @return Reference to self (for method chaining)
+         *
+         * Islands are distributed to given count of worker threads. Value
+         * `1` or Magnum built without @ref MAGNUM_BUILD_THREADS solves
+         * everything in calling thread. The result doesn't depend on
+         * thread count. Default is `1`.
+         */
+        RigidBodyWorld& setThreadCount(UnsignedInt count);
+
+        /** @brief Body count */
+        UnsignedInt bodyCount() const { return _bodyShapes.size(); }
+
+        /**
+         * @brief Add body
+         * @param shape             %Shape of the body
+         * @param transformation    Transformation of object to which the
+         *      shape is attached
+         * @param mass              Mass of the body. Bodies with zero mass
+         *      are kinematic -- they move with given velocity, but they are
+         *      not affected by collisions and gravity.
+         * @param inertia           Diagonal of inertia tensor in body space
+         * @return ID of the body
+         *
+         * Initial position and orientation is taken from absolute
+         * transformation of the object, the transformation is expected to be
+         * rigid. The shape must be part of the group passed in constructor.
+         * The world references both the shape and the object, so the body
+         * must be removed using @ref removeBody() before any of them is
+         * destroyed.
+         */
+        UnsignedInt addBody(AbstractShape3D& shape, SceneGraph::AbstractTranslationRotation3D& transformation, Float mass, const Vector3& inertia);
+
+        /**
+         * @brief Remove body
+         * @return Reference to self (for method chaining)
+         *
+         * The shape and the object are not destroyed, the shape stays in the
+         * group and is treated as static afterwards. The last body is moved
+         * in place of the removed one, i.e. its ID changes to @p id. Bodies
+         * touching the removed one are woken up.
+         */
+        RigidBodyWorld& removeBody(UnsignedInt id);
+
+        /** @brief Body position */
+        Vector3 position(UnsignedInt id) const { return _positions[id]; }
+
+        /**
+         * @brief Set body position
+         * @return Reference to self (for method chaining)
+         *
+         * Wakes the body up.
+         */
+        RigidBodyWorld& setPosition(UnsignedInt id, const Vector3& position);
+
+        /** @brief Body orientation */
+        Quaternion orientation(UnsignedInt id) const { return _orientations[id]; }
+
+        /**
+         * @brief Set body orientation
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the quaternion is normalized. Wakes the body up.
+         */
+        RigidBodyWorld& setOrientation(UnsignedInt id, const Quaternion& orientation);
+
+        /** @brief Linear velocity of the body */
+        Vector3 linearVelocity(UnsignedInt id) const { return _linearVelocities[id]; }
+
+        /**
+         * @brief Set linear velocity of the body
+         * @return Reference to self (for method chaining)
+         *
+         * Wakes the body up.
+         */
+        RigidBodyWorld& setLinearVelocity(UnsignedInt id, const Vector3& velocity);
+
+        /** @brief Angular velocity of the body (in world space) */
+        Vector3 angularVelocity(UnsignedInt id) const { return _angularVelocities[id]; }
+
+        /**
+         * @brief Set angular velocity of the body (in world space)
+         * @return Reference to self (for method chaining)
+         *
+         * Wakes the body up.
+         */
+        RigidBodyWorld& setAngularVelocity(UnsignedInt id, const Vector3& velocity);
+
+        /**
+         * @brief Apply impulse to the body
+         * @param id        Body ID
+         * @param impulse   Impulse
+         * @param point     Point where the impulse is applied (in world
+         *      space)
+         * @return Reference to self (for method chaining)
+         *
+         * Wakes the body up. Has no effect on kinematic bodies.
+         */
+        RigidBodyWorld& applyImpulse(UnsignedInt id, const Vector3& impulse, const Vector3& point);
+
+        /** @brief Whether the body is sleeping */
+        bool isSleeping(UnsignedInt id) const { return _sleeping[id]; }
+
+        /**
+         * @brief Wake the body up
+         * @return Reference to self (for method chaining)
+         */
+        RigidBodyWorld& wakeUp(UnsignedInt id);
+
+        /**
+         * @brief Advance the simulation
+         * @param frameDuration     Duration of the frame (in seconds)
+         * @return Count of simulated time steps
+         *
+         * Simulates as many fixed time steps as fit into given duration
+         * together with remainder from previous call, but at most
+         * @ref maxSteps(). Updates transformation of all moved bodies.
+         */
+        UnsignedInt step(Float frameDuration);
+
+        /**
+         * @brief Advance the simulation by duration of previous frame
+         *
+         * Equivalent to calling @ref step(Float) with
+         * @ref Timeline::previousFrameDuration().
+         */
+        UnsignedInt step(const Timeline& timeline);
+
+    private:
+        /* Contact point, anchored in body space of both bodies (or in world
+           space if there is no body) */
+        struct Contact {
+            Vector3 localA, localB;
+            Float depth;
+            Float normalImpulse, tangentImpulses[2];
+
+            /* Solver data computed before each iteration */
+            Vector3 armA, armB, tangents[2];
+            Float normalMass, tangentMasses[2], bias;
+        };
+
+        /* Persistent contacts of shape pair, body IDs are NoBody for static
+           shapes. The first body has always lower ID. */
+        struct Manifold {
+            const AbstractShape3D* shapeB;
+            UnsignedInt a, b;
+            Vector3 normal;
+            Contact contacts[4];
+            UnsignedInt contactCount;
+        };
+
+        enum: UnsignedInt { NoBody = ~UnsignedInt(0) };
+
+        bool MAGNUM_SHAPES_LOCAL isDynamic(UnsignedInt id) const;
+        bool MAGNUM_SHAPES_LOCAL isActive(UnsignedInt id) const;
+        UnsignedInt MAGNUM_SHAPES_LOCAL bodyId(const AbstractShape3D* shape) const;
+
+        void MAGNUM_SHAPES_LOCAL updateManifolds();
+        void MAGNUM_SHAPES_LOCAL reduceContacts(Manifold& manifold, const Contact& contact);
+        void MAGNUM_SHAPES_LOCAL updateIslands();
+        void MAGNUM_SHAPES_LOCAL solveIsland(UnsignedInt island);
+        void MAGNUM_SHAPES_LOCAL integrate(UnsignedInt id);
+        void MAGNUM_SHAPES_LOCAL updateSleeping();
+        void MAGNUM_SHAPES_LOCAL updateTransformations();
+        void MAGNUM_SHAPES_LOCAL updateTransformation(UnsignedInt id);
+
+        Vector3 MAGNUM_SHAPES_LOCAL toWorld(UnsignedInt id, const Vector3& point) const;
+        Vector3 MAGNUM_SHAPES_LOCAL toLocal(UnsignedInt id, const Vector3& point) const;
+        Vector3 MAGNUM_SHAPES_LOCAL inverseInertia(UnsignedInt id, const Vector3& vector) const;
+        Float MAGNUM_SHAPES_LOCAL effectiveMass(UnsignedInt id, const Vector3& arm, const Vector3& direction) const;
+        Vector3 MAGNUM_SHAPES_LOCAL velocity(UnsignedInt id, const Vector3& arm) const;
+        void MAGNUM_SHAPES_LOCAL addImpulse(UnsignedInt id, const Vector3& impulse, const Vector3& arm);
+
+        ShapeGroup3D& _group;
+        Float _timeStep, _accumulator;
+        Vector3 _gravity;
+        UnsignedInt _iterations, _maxSteps, _threadCount;
+        Float _friction, _restitution;
+
+        /* Body state, indexed by body ID */
+        std::vector<Vector3> _positions;
+        std::vector<Quaternion> _orientations;
+        std::vector<Vector3> _linearVelocities, _angularVelocities;
+        std::vector<Float> _inverseMasses;
+        std::vector<Vector3> _inverseInertias;
+        std::vector<Float> _sleepTimes;
+        std::vector<UnsignedByte> _sleeping;
+        std::vector<AbstractShape3D*> _bodyShapes;
+        std::vector<SceneGraph::AbstractTranslationRotation3D*> _transformations;
+
+        /* Body IDs sorted by shape pointer */
+        std::vector<std::pair<const AbstractShape3D*, UnsignedInt>> _bodyIds;
+
+        /* Contact manifolds sorted by body IDs */
+        std::vector<Manifold> _manifolds;
+
+        /* Islands of awake bodies and their manifolds, both ranges are
+           delimited by offsets */
+        std::vector<UnsignedInt> _islandBodies, _islandBodyOffsets;
+        std::vector<UnsignedInt> _islandManifolds, _islandManifoldOffsets;
+};
+
+}}
+
+#endif
@@ -39,7 +39,8 @@ template<UnsignedInt dimensions> void ShapeHelper<Composition<dimensions>>::set(
 template<UnsignedInt dimensions> void ShapeHelper<Composition<dimensions>>::transform(Shapes::Shape<Composition<dimensions>>& shape, const typename DimensionTraits<dimensions, Float>::MatrixType& absoluteTransformationMatrix) {
     CORRADE_INTERNAL_ASSERT(shape._shape.shape.size() == shape._transformedShape.shape.size());
     for(std::size_t i = 0; i != shape.shape().size(); ++i)
-        shape._shape.shape._shapes[i]->transform(absoluteTransformationMatrix, shape._transformedShape.shape._shapes[i]);
+        shape._shape.shape.shapes()[i]->transform(absoluteTransformationMatrix, shape._transformedShape.shape.shapes()[i]);
+    shape._transformedShape.shape.updateBounds();
 }
 
 template struct MAGNUM_SHAPES_EXPORT ShapeHelper<Composition<2>>;
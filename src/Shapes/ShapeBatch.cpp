@@ -0,0 +1,125 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ShapeBatch.h"
+
+#include "Math/Functions.h"
+
+/*
+The kernels are written as simple loops over contiguous component arrays with
+fixed-size inner loop over dimensions and without any branches, so they can be
+vectorized by the compiler for whatever instruction set is available.
+Comparisons must be the same as in scalar versions to give the same results.
+*/
+
+namespace Magnum { namespace Shapes {
+
+template<UnsignedInt dimensions> void collides(const Point<dimensions>& a, const ShapeBatch<Sphere<dimensions>>& b, UnsignedByte* const out) {
+    const Float* position[dimensions];
+    for(UnsignedInt j = 0; j != dimensions; ++j) position[j] = b.component(j);
+    const Float* const radius = b.component(dimensions);
+    const typename DimensionTraits<dimensions, Float>::VectorType point = a.position();
+
+    for(std::size_t i = 0, size = b.size(); i != size; ++i) {
+        Float distanceSquared = 0.0f;
+        for(UnsignedInt j = 0; j != dimensions; ++j)
+            distanceSquared += Math::pow<2>(position[j][i] - point[j]);
+        out[i] = distanceSquared < radius[i]*radius[i];
+    }
+}
+
+template<UnsignedInt dimensions> void collides(const Point<dimensions>& a, const ShapeBatch<AxisAlignedBox<dimensions>>& b, UnsignedByte* const out) {
+    const Float* min[dimensions];
+    const Float* max[dimensions];
+    for(UnsignedInt j = 0; j != dimensions; ++j) {
+        min[j] = b.component(j);
+        max[j] = b.component(dimensions + j);
+    }
+    const typename DimensionTraits<dimensions, Float>::VectorType point = a.position();
+
+    for(std::size_t i = 0, size = b.size(); i != size; ++i) {
+        UnsignedByte inside = 1;
+        for(UnsignedInt j = 0; j != dimensions; ++j)
+            inside &= (point[j] >= min[j][i]) & (point[j] < max[j][i]);
+        out[i] = inside;
+    }
+}
+
+template<UnsignedInt dimensions> void collides(const Sphere<dimensions>& a, const ShapeBatch<Point<dimensions>>& b, UnsignedByte* const out) {
+    const Float* position[dimensions];
+    for(UnsignedInt j = 0; j != dimensions; ++j) position[j] = b.component(j);
+    const typename DimensionTraits<dimensions, Float>::VectorType center = a.position();
+    const Float radiusSquared = Math::pow<2>(a.radius());
+
+    for(std::size_t i = 0, size = b.size(); i != size; ++i) {
+        Float distanceSquared = 0.0f;
+        for(UnsignedInt j = 0; j != dimensions; ++j)
+            distanceSquared += Math::pow<2>(center[j] - position[j][i]);
+        out[i] = distanceSquared < radiusSquared;
+    }
+}
+
+template<UnsignedInt dimensions> void collides(const Sphere<dimensions>& a, const ShapeBatch<Sphere<dimensions>>& b, UnsignedByte* const out) {
+    const Float* position[dimensions];
+    for(UnsignedInt j = 0; j != dimensions; ++j) position[j] = b.component(j);
+    const Float* const radius = b.component(dimensions);
+    const typename DimensionTraits<dimensions, Float>::VectorType center = a.position();
+    const Float centerRadius = a.radius();
+
+    for(std::size_t i = 0, size = b.size(); i != size; ++i) {
+        Float distanceSquared = 0.0f;
+        for(UnsignedInt j = 0; j != dimensions; ++j)
+            distanceSquared += Math::pow<2>(center[j] - position[j][i]);
+        out[i] = distanceSquared < Math::pow<2>(centerRadius + radius[i]);
+    }
+}
+
+template<UnsignedInt dimensions> void collides(const AxisAlignedBox<dimensions>& a, const ShapeBatch<Point<dimensions>>& b, UnsignedByte* const out) {
+    const Float* position[dimensions];
+    for(UnsignedInt j = 0; j != dimensions; ++j) position[j] = b.component(j);
+    const typename DimensionTraits<dimensions, Float>::VectorType min = a.min();
+    const typename DimensionTraits<dimensions, Float>::VectorType max = a.max();
+
+    for(std::size_t i = 0, size = b.size(); i != size; ++i) {
+        UnsignedByte inside = 1;
+        for(UnsignedInt j = 0; j != dimensions; ++j)
+            inside &= (position[j][i] >= min[j]) & (position[j][i] < max[j]);
+        out[i] = inside;
+    }
+}
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template void MAGNUM_SHAPES_EXPORT collides(const Point<2>&, const ShapeBatch<Sphere<2>>&, UnsignedByte*);
+template void MAGNUM_SHAPES_EXPORT collides(const Point<3>&, const ShapeBatch<Sphere<3>>&, UnsignedByte*);
+template void MAGNUM_SHAPES_EXPORT collides(const Point<2>&, const ShapeBatch<AxisAlignedBox<2>>&, UnsignedByte*);
+template void MAGNUM_SHAPES_EXPORT collides(const Point<3>&, const ShapeBatch<AxisAlignedBox<3>>&, UnsignedByte*);
+template void MAGNUM_SHAPES_EXPORT collides(const Sphere<2>&, const ShapeBatch<Point<2>>&, UnsignedByte*);
+template void MAGNUM_SHAPES_EXPORT collides(const Sphere<3>&, const ShapeBatch<Point<3>>&, UnsignedByte*);
+template void MAGNUM_SHAPES_EXPORT collides(const Sphere<2>&, const ShapeBatch<Sphere<2>>&, UnsignedByte*);
+template void MAGNUM_SHAPES_EXPORT collides(const Sphere<3>&, const ShapeBatch<Sphere<3>>&, UnsignedByte*);
+template void MAGNUM_SHAPES_EXPORT collides(const AxisAlignedBox<2>&, const ShapeBatch<Point<2>>&, UnsignedByte*);
+template void MAGNUM_SHAPES_EXPORT collides(const AxisAlignedBox<3>&, const ShapeBatch<Point<3>>&, UnsignedByte*);
+#endif
+
+}}
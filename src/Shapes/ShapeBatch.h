@@ -0,0 +1,229 @@
+#ifndef Magnum_Shapes_ShapeBatch_h
+#define Magnum_Shapes_ShapeBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::Shapes::ShapeBatch, function Magnum::Shapes::collides()
+ */
+
+#include <vector>
+
+#include "Shapes/AxisAlignedBox.h"
+#include "Shapes/Point.h"
+#include "Shapes/Sphere.h"
+
+namespace Magnum { namespace Shapes {
+
+namespace Implementation {
+    template<class> struct ShapeBatchTraits;
+
+    template<UnsignedInt dimensions> struct ShapeBatchTraits<Point<dimensions>> {
+        enum: std::size_t { ComponentCount = dimensions };
+
+        static void scatter(const Point<dimensions>& shape, std::vector<Float>* components) {
+            for(UnsignedInt i = 0; i != dimensions; ++i)
+                components[i].push_back(shape.position()[i]);
+        }
+
+        static Point<dimensions> gather(const std::vector<Float>* components, std::size_t i) {
+            typename DimensionTraits<dimensions, Float>::VectorType position;
+            for(UnsignedInt j = 0; j != dimensions; ++j)
+                position[j] = components[j][i];
+            return {position};
+        }
+    };
+
+    template<UnsignedInt dimensions> struct ShapeBatchTraits<Sphere<dimensions>> {
+        enum: std::size_t { ComponentCount = dimensions + 1 };
+
+        static void scatter(const Sphere<dimensions>& shape, std::vector<Float>* components) {
+            for(UnsignedInt i = 0; i != dimensions; ++i)
+                components[i].push_back(shape.position()[i]);
+            components[dimensions].push_back(shape.radius());
+        }
+
+        static Sphere<dimensions> gather(const std::vector<Float>* components, std::size_t i) {
+            typename DimensionTraits<dimensions, Float>::VectorType position;
+            for(UnsignedInt j = 0; j != dimensions; ++j)
+                position[j] = components[j][i];
+            return {position, components[dimensions][i]};
+        }
+    };
+
+    template<UnsignedInt dimensions> struct ShapeBatchTraits<AxisAlignedBox<dimensions>> {
+        enum: std::size_t { ComponentCount = dimensions*2 };
+
+        static void scatter(const AxisAlignedBox<dimensions>& shape, std::vector<Float>* components) {
+            for(UnsignedInt i = 0; i != dimensions; ++i) {
+                components[i].push_back(shape.min()[i]);
+                components[dimensions + i].push_back(shape.max()[i]);
+            }
+        }
+
+        static AxisAlignedBox<dimensions> gather(const std::vector<Float>* components, std::size_t i) {
+            typename DimensionTraits<dimensions, Float>::VectorType min, max;
+            for(UnsignedInt j = 0; j != dimensions; ++j) {
+                min[j] = components[j][i];
+                max[j] = components[dimensions + j][i];
+            }
+            return {min, max};
+        }
+    };
+}
+
+/**
+@brief Batch of shapes of the same type
+
+Stores shapes in structure-of-arrays layout, i.e. each coordinate of all shapes
+in separate contiguous array, which allows the collision detection of one shape
+against the whole batch to be vectorized by the compiler. Supported types are
+@ref Point, @ref Sphere and @ref AxisAlignedBox. Components are stored in
+following order:
+
+-   @ref Point -- position coordinates
+-   @ref Sphere -- position coordinates, radius
+-   @ref AxisAlignedBox -- minimal corner coordinates, maximal corner
+    coordinates
+
+Example usage:
+@code
+Shapes::ShapeBatch<Shapes::Sphere3D> spheres;
+spheres.add({{1.0f, 2.0f, 0.0f}, 0.5f})
+       .add({{-1.0f, 0.0f, 3.0f}, 1.0f});
+
+std::vector<UnsignedByte> result(spheres.size());
+Shapes::collides(Shapes::Sphere3D({}, 1.0f), spheres, result.data());
+@endcode
+
+@ref ShapeGroup uses the batches internally for queries of single shape
+against the whole group.
+@see @ref collides()
+*/
+template<class T> class ShapeBatch {
+    public:
+        enum: UnsignedInt {
+            Dimensions = T::Dimensions /**< Dimension count */
+        };
+
+        enum: std::size_t {
+            /** Count of components of each shape */
+            ComponentCount = Implementation::ShapeBatchTraits<T>::ComponentCount
+        };
+
+        /** @brief Count of shapes in the batch */
+        std::size_t size() const { return _components[0].size(); }
+
+        /** @brief Whether the batch is empty */
+        bool isEmpty() const { return _components[0].empty(); }
+
+        /**
+         * @brief Component array
+         *
+         * Array of given component of all shapes, see
+         * @ref ShapeBatch "class documentation" for component order.
+         */
+        const Float* component(std::size_t i) const { return _components[i].data(); }
+
+        /** @brief Shape at given position */
+        T operator[](std::size_t i) const {
+            return Implementation::ShapeBatchTraits<T>::gather(_components, i);
+        }
+
+        /**
+         * @brief Add shape to the batch
+         * @return Reference to self (for method chaining)
+         */
+        ShapeBatch<T>& add(const T& shape) {
+            Implementation::ShapeBatchTraits<T>::scatter(shape, _components);
+            return *this;
+        }
+
+        /**
+         * @brief Clear the batch
+         *
+         * Removes all shapes, but keeps allocated memory.
+         */
+        void clear() {
+            for(std::size_t i = 0; i != ComponentCount; ++i)
+                _components[i].clear();
+        }
+
+        /** @brief Reserve memory for given count of shapes */
+        void reserve(std::size_t size) {
+            for(std::size_t i = 0; i != ComponentCount; ++i)
+                _components[i].reserve(size);
+        }
+
+    private:
+        std::vector<Float> _components[ComponentCount];
+};
+
+/**
+@brief Collision of point with batch of spheres
+@param a        Point
+@param b        Batch of spheres
+@param[out] out Collision occurence for each sphere in the batch. Expected to
+    have at least @ref ShapeBatch::size() "b.size()" items.
+
+Equivalent to calling `a % b[i]` for each sphere in the batch, but done in
+one pass over contiguous arrays.
+*/
+template<UnsignedInt dimensions> void MAGNUM_SHAPES_EXPORT collides(const Point<dimensions>& a, const ShapeBatch<Sphere<dimensions>>& b, UnsignedByte* out);
+
+/**
+@brief Collision of point with batch of axis-aligned boxes
+
+See @ref collides(const Point<dimensions>&, const ShapeBatch<Sphere<dimensions>>&, UnsignedByte*)
+for more information.
+*/
+template<UnsignedInt dimensions> void MAGNUM_SHAPES_EXPORT collides(const Point<dimensions>& a, const ShapeBatch<AxisAlignedBox<dimensions>>& b, UnsignedByte* out);
+
+/**
+@brief Collision of sphere with batch of points
+
+See @ref collides(const Point<dimensions>&, const ShapeBatch<Sphere<dimensions>>&, UnsignedByte*)
+for more information.
+*/
+template<UnsignedInt dimensions> void MAGNUM_SHAPES_EXPORT collides(const Sphere<dimensions>& a, const ShapeBatch<Point<dimensions>>& b, UnsignedByte* out);
+
+/**
+@brief Collision of sphere with batch of spheres
+
+See @ref collides(const Point<dimensions>&, const ShapeBatch<Sphere<dimensions>>&, UnsignedByte*)
+for more information.
+*/
+template<UnsignedInt dimensions> void MAGNUM_SHAPES_EXPORT collides(const Sphere<dimensions>& a, const ShapeBatch<Sphere<dimensions>>& b, UnsignedByte* out);
+
+/**
+@brief Collision of axis-aligned box with batch of points
+
+See @ref collides(const Point<dimensions>&, const ShapeBatch<Sphere<dimensions>>&, UnsignedByte*)
+for more information.
+*/
+template<UnsignedInt dimensions> void MAGNUM_SHAPES_EXPORT collides(const AxisAlignedBox<dimensions>& a, const ShapeBatch<Point<dimensions>>& b, UnsignedByte* out);
+
+}}
+
+#endif
@@ -24,10 +24,24 @@
 
 #include "ShapeGroup.h"
 
+#include <algorithm>
+#include <limits>
+
+#include "Math/Functions.h"
+#include "Math/Matrix3.h"
+#include "Math/Matrix4.h"
 #include "Shapes/AbstractShape.h"
+#include "Shapes/Implementation/CollisionDispatch.h"
+#include "Shapes/Implementation/Raycast.h"
+#include "Shapes/Implementation/ShapeBoundingVolume.h"
 
 namespace Magnum { namespace Shapes {
 
+template<UnsignedInt dimensions> ShapeGroup<dimensions>::~ShapeGroup() {
+    while(!_hierarchy.isEmpty())
+        static_cast<Implementation::ShapeBoundingVolume<dimensions>&>(_hierarchy[0]).destroy();
+}
+
 template<UnsignedInt dimensions> void ShapeGroup<dimensions>::setClean() {
     /* Clean all objects */
     if(!this->isEmpty()) {
@@ -42,12 +56,427 @@ template<UnsignedInt dimensions> void ShapeGroup<dimensions>::setClean() {
 }
 
 template<UnsignedInt dimensions> AbstractShape<dimensions>* ShapeGroup<dimensions>::firstCollision(const AbstractShape<dimensions>& shape) {
+    batchCollisions(shape);
+    for(std::size_t i = 0; i != _collisions.size(); ++i)
+        if(_collisions[i]) return &(*this)[i];
+
+    return nullptr;
+}
+
+template<UnsignedInt dimensions> std::vector<AbstractShape<dimensions>*> ShapeGroup<dimensions>::collisions(const AbstractShape<dimensions>& shape) {
+    batchCollisions(shape);
+    std::vector<AbstractShape<dimensions>*> out;
+    for(std::size_t i = 0; i != _collisions.size(); ++i)
+        if(_collisions[i]) out.push_back(&(*this)[i]);
+
+    return out;
+}
+
+template<UnsignedInt dimensions> void ShapeGroup<dimensions>::updateBatches() {
+    /* Rebuild the batches only if any shape changed or shapes were added or
+       removed */
+    bool changed = _batchesDirty || _batchedShapes.size() != this->size();
+    for(std::size_t i = 0; !changed && i != this->size(); ++i)
+        changed = _batchedShapes[i] != &(*this)[i];
+    if(!changed) return;
+
+    _batchedShapes.resize(this->size());
+    _points.clear();
+    _spheres.clear();
+    _boxes.clear();
+    _pointIds.clear();
+    _sphereIds.clear();
+    _boxIds.clear();
+    _otherIds.clear();
+
+    for(std::size_t i = 0; i != this->size(); ++i) {
+        _batchedShapes[i] = &(*this)[i];
+        const Implementation::AbstractShape<dimensions>& shape = Implementation::getAbstractShape((*this)[i]);
+        switch(shape.type()) {
+            case Implementation::ShapeDimensionTraits<dimensions>::Type::Point:
+                _points.add(static_cast<const Implementation::Shape<Point<dimensions>>&>(shape).shape);
+                _pointIds.push_back(i);
+                break;
+            case Implementation::ShapeDimensionTraits<dimensions>::Type::Sphere:
+                _spheres.add(static_cast<const Implementation::Shape<Sphere<dimensions>>&>(shape).shape);
+                _sphereIds.push_back(i);
+                break;
+            case Implementation::ShapeDimensionTraits<dimensions>::Type::AxisAlignedBox:
+                _boxes.add(static_cast<const Implementation::Shape<AxisAlignedBox<dimensions>>&>(shape).shape);
+                _boxIds.push_back(i);
+                break;
+            default:
+                _otherIds.push_back(i);
+        }
+    }
+
+    _batchesDirty = false;
+}
+
+namespace {
+    template<class T, class U> void collideBatch(const T& shape, const ShapeBatch<U>& batch, const std::vector<UnsignedInt>& ids, std::vector<UnsignedByte>& batchCollisions, std::vector<UnsignedByte>& collisions) {
+        batchCollisions.resize(batch.size());
+        collides(shape, batch, batchCollisions.data());
+        for(std::size_t i = 0; i != ids.size(); ++i)
+            collisions[ids[i]] = batchCollisions[i];
+    }
+}
+
+template<UnsignedInt dimensions> void ShapeGroup<dimensions>::batchCollisions(const AbstractShape<dimensions>& shape) {
     setClean();
+    updateBatches();
+
+    /* Pairs without collision implementation don't collide */
+    _collisions.assign(this->size(), 0);
+
+    /* Test against whole batches for supported pairs, the remaining shapes
+       one by one */
+    const Implementation::AbstractShape<dimensions>& abstractShape = Implementation::getAbstractShape(shape);
+    std::vector<UnsignedInt>* remaining[]{&_otherIds, &_pointIds, &_sphereIds, &_boxIds};
+    std::size_t remainingCount = 4;
+    switch(abstractShape.type()) {
+        case Implementation::ShapeDimensionTraits<dimensions>::Type::Point: {
+            const Point<dimensions>& point = static_cast<const Implementation::Shape<Point<dimensions>>&>(abstractShape).shape;
+            collideBatch(point, _spheres, _sphereIds, _batchCollisions, _collisions);
+            collideBatch(point, _boxes, _boxIds, _batchCollisions, _collisions);
+            remainingCount = 1;
+        } break;
+        case Implementation::ShapeDimensionTraits<dimensions>::Type::Sphere: {
+            const Sphere<dimensions>& sphere = static_cast<const Implementation::Shape<Sphere<dimensions>>&>(abstractShape).shape;
+            collideBatch(sphere, _points, _pointIds, _batchCollisions, _collisions);
+            collideBatch(sphere, _spheres, _sphereIds, _batchCollisions, _collisions);
+            remaining[1] = &_boxIds;
+            remainingCount = 2;
+        } break;
+        case Implementation::ShapeDimensionTraits<dimensions>::Type::AxisAlignedBox: {
+            const AxisAlignedBox<dimensions>& box = static_cast<const Implementation::Shape<AxisAlignedBox<dimensions>>&>(abstractShape).shape;
+            collideBatch(box, _points, _pointIds, _batchCollisions, _collisions);
+            remaining[1] = &_sphereIds;
+            remaining[2] = &_boxIds;
+            remainingCount = 3;
+        } break;
+        default: break;
+    }
+
+    for(std::size_t i = 0; i != remainingCount; ++i)
+        for(UnsignedInt id: *remaining[i])
+            _collisions[id] = (*this)[id].collides(shape);
+
+    /* The shape doesn't collide with itself */
     for(std::size_t i = 0; i != this->size(); ++i)
-        if(&(*this)[i] != &shape && (*this)[i].collides(shape))
-            return &(*this)[i];
+        if(&(*this)[i] == &shape) _collisions[i] = 0;
+}
 
-    return nullptr;
+template<UnsignedInt dimensions> std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> ShapeGroup<dimensions>::collisions() {
+    setClean();
+    updateBroadphase(false);
+
+    typedef std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*> Pair;
+    typedef std::pair<Pair, typename DimensionTraits<dimensions, Float>::VectorType> SeparatingAxis;
+    const auto compare = [](const SeparatingAxis& a, const SeparatingAxis& b) { return a.first < b.first; };
+
+    ShapeGroup<dimensions>& group = *this;
+    const std::vector<SeparatingAxis>& separatingAxes = _separatingAxes;
+    std::vector<SeparatingAxis>& nextSeparatingAxes = _nextSeparatingAxes;
+    nextSeparatingAxes.clear();
+    std::vector<Pair> out = broadphase([&group, &separatingAxes, &nextSeparatingAxes, &compare](UnsignedInt a, UnsignedInt b) {
+        /* Test the pair always in the same order so the separating axis from
+           last time can be reused */
+        SeparatingAxis axis{{&group[a], &group[b]}, {}};
+        if(axis.first.second < axis.first.first)
+            std::swap(axis.first.first, axis.first.second);
+        if(!separatingAxes.empty()) {
+            auto found = std::lower_bound(separatingAxes.begin(), separatingAxes.end(), axis, compare);
+            if(found != separatingAxes.end() && found->first == axis.first)
+                axis.second = found->second;
+        }
+
+        const bool collides = Implementation::collides(Implementation::getAbstractShape(*axis.first.first), Implementation::getAbstractShape(*axis.first.second), &axis.second);
+        if(axis.second != typename DimensionTraits<dimensions, Float>::VectorType())
+            nextSeparatingAxes.push_back(axis);
+        return collides;
+    });
+
+    std::sort(nextSeparatingAxes.begin(), nextSeparatingAxes.end(), compare);
+    std::swap(_separatingAxes, _nextSeparatingAxes);
+    return out;
+}
+
+template<UnsignedInt dimensions> template<class T> std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> ShapeGroup<dimensions>::broadphase(T narrowphase) {
+    /* Sweep along the axis, keeping list of shapes whose bounds contain
+       current position */
+    std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> out;
+    _active.clear();
+    for(const Endpoint& endpoint: _endpoints) {
+        const UnsignedInt id = endpoint.data >> 1;
+        const auto& bounds = _bounds[id];
+
+        /* Empty bounds (e.g. empty composition) can't collide with anything */
+        if(bounds.first[_sweepAxis] > bounds.second[_sweepAxis]) continue;
+
+        /* End of the bounds, remove the shape from active list */
+        if(endpoint.data & 1) {
+            auto found = std::find(_active.begin(), _active.end(), id);
+            CORRADE_INTERNAL_ASSERT(found != _active.end());
+            *found = _active.back();
+            _active.pop_back();
+            continue;
+        }
+
+        /* Beginning of the bounds, test against all active shapes whose
+           bounds overlap also on other axes */
+        for(UnsignedInt other: _active) {
+            const auto& otherBounds = _bounds[other];
+            bool overlaps = true;
+            for(UnsignedInt i = 0; i != dimensions; ++i) {
+                if(bounds.second[i] < otherBounds.first[i] || otherBounds.second[i] < bounds.first[i]) {
+                    overlaps = false;
+                    break;
+                }
+            }
+
+            if(overlaps && narrowphase(other, id))
+                out.emplace_back(&(*this)[other], &(*this)[id]);
+        }
+
+        _active.push_back(id);
+    }
+
+    return out;
+}
+
+namespace {
+    /* Minimal endpoints go before maximal ones, so touching bounds are
+       treated as overlapping */
+    template<class Endpoint> inline bool endpointLess(const Endpoint& a, const Endpoint& b) {
+        return a.value < b.value || (a.value == b.value && (a.data & 1) < (b.data & 1));
+    }
+}
+
+template<UnsignedInt dimensions> void ShapeGroup<dimensions>::updateBroadphase(const bool swept) {
+    /* Update bounds of all shapes, extend them to cover also the saved
+       position if requested */
+    _bounds.resize(this->size());
+    for(std::size_t i = 0; i != this->size(); ++i) {
+        auto& bounds = _bounds[i];
+        Implementation::bounds(Implementation::getAbstractShape((*this)[i]), bounds.first, bounds.second);
+        if(swept) {
+            bounds.first = Math::min(bounds.first, bounds.first - _displacements[i]);
+            bounds.second = Math::max(bounds.second, bounds.second - _displacements[i]);
+        }
+    }
+
+    /* Shapes were added or removed, rebuild the endpoint list. Sweep along
+       the axis with the largest spread of bounded shapes. */
+    if(_endpoints.size() != 2*_bounds.size()) {
+        typename DimensionTraits<dimensions, Float>::VectorType min(std::numeric_limits<Float>::infinity()),
+            max(-std::numeric_limits<Float>::infinity());
+        for(const auto& bounds: _bounds) for(UnsignedInt i = 0; i != dimensions; ++i) {
+            if(bounds.first[i] == -std::numeric_limits<Float>::infinity() ||
+               bounds.second[i] == std::numeric_limits<Float>::infinity() ||
+               bounds.first[i] > bounds.second[i]) continue;
+            const Float center = (bounds.first[i] + bounds.second[i])*0.5f;
+            min[i] = std::min(min[i], center);
+            max[i] = std::max(max[i], center);
+        }
+
+        _sweepAxis = 0;
+        for(UnsignedInt i = 1; i != dimensions; ++i)
+            if(max[i] - min[i] > max[_sweepAxis] - min[_sweepAxis]) _sweepAxis = i;
+
+        _endpoints.resize(2*_bounds.size());
+        for(std::size_t i = 0; i != _bounds.size(); ++i) {
+            _endpoints[2*i] = {_bounds[i].first[_sweepAxis], UnsignedInt(i << 1)};
+            _endpoints[2*i+1] = {_bounds[i].second[_sweepAxis], UnsignedInt(i << 1|1)};
+        }
+
+        std::sort(_endpoints.begin(), _endpoints.end(), endpointLess<Endpoint>);
+        return;
+    }
+
+    /* Update endpoint values and resort using insertion sort, which is nearly
+       linear if the shapes moved only slightly since last time */
+    for(Endpoint& endpoint: _endpoints) {
+        const auto& bounds = _bounds[endpoint.data >> 1];
+        endpoint.value = (endpoint.data & 1 ? bounds.second : bounds.first)[_sweepAxis];
+    }
+
+    for(std::size_t i = 1; i < _endpoints.size(); ++i) {
+        const Endpoint endpoint = _endpoints[i];
+        std::size_t j = i;
+        for(; j != 0 && endpointLess(endpoint, _endpoints[j-1]); --j)
+            _endpoints[j] = _endpoints[j-1];
+        _endpoints[j] = endpoint;
+    }
+}
+
+template<UnsignedInt dimensions> std::vector<Collision<dimensions>> ShapeGroup<dimensions>::collisionData(const std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>>& pairs) {
+    setClean();
+
+    std::vector<std::pair<const Implementation::AbstractShape<dimensions>*, const Implementation::AbstractShape<dimensions>*>> transformedPairs;
+    transformedPairs.reserve(pairs.size());
+    for(const auto& pair: pairs)
+        transformedPairs.push_back({&Implementation::getAbstractShape(*pair.first), &Implementation::getAbstractShape(*pair.second)});
+
+    std::vector<Collision<dimensions>> out;
+    Implementation::collisions(transformedPairs, out);
+    return out;
+}
+
+template<UnsignedInt dimensions> void ShapeGroup<dimensions>::updateHierarchy() {
+    /* Update the volumes only if shapes were added or removed, movement of
+       the shapes is tracked by the volumes themselves */
+    bool changed = _hierarchyShapes.size() != this->size();
+    for(std::size_t i = 0; !changed && i != this->size(); ++i)
+        changed = _hierarchyShapes[i] != &(*this)[i];
+    if(!changed) return;
+
+    /* Delete volumes of shapes removed from the group */
+    for(std::size_t i = _hierarchy.size(); i != 0; --i) {
+        Implementation::ShapeBoundingVolume<dimensions>& volume = static_cast<Implementation::ShapeBoundingVolume<dimensions>&>(_hierarchy[i-1]);
+        if(volume.shape().group() != this) volume.destroy();
+    }
+
+    _hierarchyShapes.resize(this->size());
+    _unboundedIds.clear();
+    for(std::size_t i = 0; i != this->size(); ++i) {
+        AbstractShape<dimensions>& shape = (*this)[i];
+        _hierarchyShapes[i] = &shape;
+
+        typename DimensionTraits<dimensions, Float>::VectorType min, max;
+        Implementation::bounds(Implementation::getAbstractShape(shape), min, max);
+
+        /* Unbounded shapes are tested separately, empty bounds (e.g. empty
+           composition) can't be hit by anything */
+        bool unbounded = false, empty = false;
+        for(UnsignedInt j = 0; j != dimensions; ++j) {
+            if(min[j] == -std::numeric_limits<Float>::infinity() ||
+               max[j] == std::numeric_limits<Float>::infinity())
+                unbounded = true;
+            else if(min[j] > max[j])
+                empty = true;
+        }
+
+        if(unbounded) _unboundedIds.push_back(i);
+
+        /* The volume might be left in previous group if the shape was moved
+           from it */
+        if(unbounded || empty) {
+            if(shape._boundingVolume) shape._boundingVolume->destroy();
+        } else if(!shape._boundingVolume)
+            Implementation::ShapeBoundingVolume<dimensions>::create(shape, _hierarchy);
+        else if(shape._boundingVolume->hierarchy() != &_hierarchy)
+            _hierarchy.add(*shape._boundingVolume);
+    }
+}
+
+namespace {
+    template<UnsignedInt dimensions> inline bool hitLess(const RaycastHit<dimensions>& a, const RaycastHit<dimensions>& b) {
+        return a.distance() < b.distance();
+    }
+}
+
+template<UnsignedInt dimensions> RaycastHit<dimensions> ShapeGroup<dimensions>::cast(const typename DimensionTraits<dimensions, Float>::VectorType& origin, const typename DimensionTraits<dimensions, Float>::VectorType& direction, const Float radius, const Float maxDistance, std::vector<RaycastHit<dimensions>>* const all) {
+    setClean();
+    updateHierarchy();
+
+    RaycastHit<dimensions> nearest;
+    Float nearestDistance = maxDistance;
+    auto test = [&](AbstractShape<dimensions>& shape) {
+        Float distance = all ? maxDistance : nearestDistance;
+        typename DimensionTraits<dimensions, Float>::VectorType normal;
+        if(!Implementation::raycast(Implementation::getAbstractShape(shape), origin, direction, radius, distance, normal))
+            return;
+
+        RaycastHit<dimensions> hit(&shape, distance, origin + direction*distance - normal*radius, normal);
+        if(all) all->push_back(hit);
+        else if(distance < nearestDistance || !nearest) {
+            nearest = hit;
+            nearestDistance = distance;
+        }
+    };
+
+    for(UnsignedInt id: _unboundedIds) test((*this)[id]);
+
+    /* Candidates are sorted by distance to their bounds, so no nearer hit can
+       be found after the first one farther than the nearest hit */
+    for(const std::pair<Float, SceneGraph::BoundingVolume<dimensions, Float>*>& candidate: _hierarchy.sphereCast(origin, direction, radius, maxDistance)) {
+        if(!all && nearest && candidate.first > nearestDistance) break;
+        test(static_cast<Implementation::ShapeBoundingVolume<dimensions>*>(candidate.second)->shape());
+    }
+
+    if(all) std::stable_sort(all->begin(), all->end(), hitLess<dimensions>);
+    return nearest;
+}
+
+template<UnsignedInt dimensions> RaycastHit<dimensions> ShapeGroup<dimensions>::raycast(const typename DimensionTraits<dimensions, Float>::VectorType& origin, const typename DimensionTraits<dimensions, Float>::VectorType& direction, const Float maxDistance) {
+    CORRADE_ASSERT(direction.isNormalized(), "Shapes::ShapeGroup::raycast(): direction is not normalized", {});
+    return cast(origin, direction, 0.0f, maxDistance, nullptr);
+}
+
+template<UnsignedInt dimensions> std::vector<RaycastHit<dimensions>> ShapeGroup<dimensions>::raycastAll(const typename DimensionTraits<dimensions, Float>::VectorType& origin, const typename DimensionTraits<dimensions, Float>::VectorType& direction, const Float maxDistance) {
+    CORRADE_ASSERT(direction.isNormalized(), "Shapes::ShapeGroup::raycastAll(): direction is not normalized", {});
+    std::vector<RaycastHit<dimensions>> out;
+    cast(origin, direction, 0.0f, maxDistance, &out);
+    return out;
+}
+
+template<UnsignedInt dimensions> RaycastHit<dimensions> ShapeGroup<dimensions>::sphereCast(const typename DimensionTraits<dimensions, Float>::VectorType& origin, const typename DimensionTraits<dimensions, Float>::VectorType& direction, const Float radius, const Float maxDistance) {
+    CORRADE_ASSERT(direction.isNormalized(), "Shapes::ShapeGroup::sphereCast(): direction is not normalized", {});
+    return cast(origin, direction, radius, maxDistance, nullptr);
+}
+
+namespace {
+    template<class T> inline bool savedPositionLess(const T& a, const T& b) {
+        return a.first < b.first;
+    }
+}
+
+template<UnsignedInt dimensions> void ShapeGroup<dimensions>::savePositions() {
+    setClean();
+
+    _savedPositions.resize(this->size());
+    for(std::size_t i = 0; i != this->size(); ++i)
+        _savedPositions[i] = {&(*this)[i], (*this)[i].object().absoluteTransformationMatrix().translation()};
+
+    std::sort(_savedPositions.begin(), _savedPositions.end(), savedPositionLess<typename decltype(_savedPositions)::value_type>);
+}
+
+template<UnsignedInt dimensions> typename DimensionTraits<dimensions, Float>::VectorType ShapeGroup<dimensions>::displacement(AbstractShape<dimensions>* const shape) const {
+    const typename decltype(_savedPositions)::value_type key{shape, {}};
+    auto found = std::lower_bound(_savedPositions.begin(), _savedPositions.end(), key, savedPositionLess<typename decltype(_savedPositions)::value_type>);
+    if(found == _savedPositions.end() || found->first != shape) return {};
+
+    return shape->object().absoluteTransformationMatrix().translation() - found->second;
+}
+
+template<UnsignedInt dimensions> void ShapeGroup<dimensions>::updateDisplacements() {
+    _displacements.resize(this->size());
+    for(std::size_t i = 0; i != this->size(); ++i)
+        _displacements[i] = displacement(&(*this)[i]);
+}
+
+template<UnsignedInt dimensions> std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> ShapeGroup<dimensions>::sweptCollisions() {
+    setClean();
+    updateDisplacements();
+    updateBroadphase(true);
+
+    const std::vector<typename DimensionTraits<dimensions, Float>::VectorType>& displacements = _displacements;
+    ShapeGroup<dimensions>& group = *this;
+    return broadphase([&displacements, &group](UnsignedInt a, UnsignedInt b) {
+        return Implementation::timeOfImpact(Implementation::getAbstractShape(group[a]), displacements[a], Implementation::getAbstractShape(group[b]), displacements[b]) <= 1.0f;
+    });
+}
+
+template<UnsignedInt dimensions> std::vector<Float> ShapeGroup<dimensions>::timesOfImpact(const std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>>& pairs) {
+    setClean();
+
+    std::vector<Float> out;
+    out.reserve(pairs.size());
+    for(const auto& pair: pairs)
+        out.push_back(Implementation::timeOfImpact(Implementation::getAbstractShape(*pair.first), displacement(pair.first), Implementation::getAbstractShape(*pair.second), displacement(pair.second)));
+
+    return out;
 }
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -28,9 +28,15 @@
  * @brief Class Magnum::Shapes::ShapeGroup, typedef Magnum::Shapes::ShapeGroup2D, Magnum::Shapes::ShapeGroup3D
  */
 
+#include <limits>
+#include <utility>
 #include <vector>
 
+#include "Math/Vector3.h"
 #include "Shapes/AbstractShape.h"
+#include "Shapes/RaycastHit.h"
+#include "Shapes/ShapeBatch.h"
+#include "SceneGraph/BoundingVolumeHierarchy.h"
 #include "SceneGraph/FeatureGroup.h"
 
 #include "magnumShapesVisibility.h"
@@ -41,6 +47,96 @@ namespace Magnum { namespace Shapes {
 @brief Group of shapes
 
 See Shape for more information. See @ref shapes for brief introduction.
+
+@section ShapeGroup-broadphase Broadphase
+
+@ref collisions() returns all pairs of colliding shapes in the group. Instead
+of testing all pairs, the group uses sweep and prune on axis-aligned bounds of
+the shapes. Sorted list of bound endpoints along one axis is kept between
+calls, so if the shapes move only slightly, it is only partially resorted and
+the query has nearly linear complexity. The endpoint list is rebuilt if shapes
+are added or removed.
+@code
+for(auto collision: shapes.collisions()) {
+    Shapes::AbstractShape3D* a = collision.first;
+    Shapes::AbstractShape3D* b = collision.second;
+    // ...
+}
+@endcode
+
+Unbounded shapes (e.g. @ref Line, @ref Plane or @ref Cylinder) are tested
+against all other shapes.
+
+Pairs of convex shapes without dedicated collision test (e.g. @ref ConvexHull
+with anything) are tested using GJK algorithm. Last separating axis of each
+such pair is remembered and used as initial search direction in next call, so
+if the shapes are far enough from each other, usually only one iteration is
+needed to prove they don't collide.
+
+Collision data for the colliding pairs can be computed in bulk using
+@ref collisionData(). The pairs are grouped by type combination, so the type
+dispatch is done only once for each combination:
+@code
+auto collisions = shapes.collisions();
+for(const Shapes::Collision3D& collision: shapes.collisionData(collisions)) {
+    // ...
+}
+@endcode
+
+@section ShapeGroup-batching Batched queries
+
+Queries of single shape against the whole group (@ref firstCollision() and
+@ref collisions(const AbstractShape<dimensions>&)) keep all points, spheres
+and axis-aligned boxes in the group sorted by type in @ref ShapeBatch
+instances, so the collision is dispatched only once for each shape type
+instead of once for each shape and the batched test can be vectorized. The
+batches are refreshed only if any shape in the group changes. Other shape
+types are tested one by one.
+
+@section ShapeGroup-raycast Ray casting
+
+@ref raycast() returns nearest shape hit by given ray, @ref raycastAll() all
+shapes hit by the ray sorted by distance and @ref sphereCast() nearest shape
+hit by sphere moving along the ray, e.g. for mouse picking or for checking
+whether character can move in given direction:
+@code
+Shapes::RaycastHit3D hit = shapes.raycast(camera.position(), direction);
+if(hit) {
+    Shapes::AbstractShape3D* picked = hit.shape();
+    // ...
+}
+@endcode
+
+The queries are accelerated using @ref SceneGraph::BoundingVolumeHierarchy.
+Only the shapes which moved are updated in the hierarchy and the shapes are
+tested in order of distance to their bounds. Unbounded shapes (e.g.
+@ref Line, @ref Plane or @ref Cylinder) are tested separately. @ref InvertedSphere and @ref Composition are never hit,
+@ref Point, @ref Line and @ref LineSegment can be hit only with
+@ref sphereCast().
+
+@section ShapeGroup-continuous Continuous collision detection
+
+Fast moving shapes can pass through other shapes between two frames without
+being detected by @ref collisions(). Save positions of all shapes using
+@ref savePositions() before moving them, @ref sweptCollisions() then returns
+all pairs of shapes which touched during the movement and @ref timesOfImpact()
+time of their first contact, relative to the movement:
+@code
+shapes.savePositions();
+
+// move the objects...
+
+auto collisions = shapes.sweptCollisions();
+std::vector<Float> times = shapes.timesOfImpact(collisions);
+@endcode
+
+The movement is approximated with linear translation of the objects, rotation
+is not taken into account. Swept bounds of the shapes are put into the same
+sweep and prune broadphase as with @ref collisions(). Time of impact is
+computed exactly for moving points, spheres, line segments and capsules
+against all shape types except @ref InvertedSphere and @ref Composition,
+other pairs are tested only at their final position. Time of impact against
+@ref ConvexHull is found iteratively using its support function.
 @see @ref scenegraph, ShapeGroup2D, ShapeGroup3D
 */
 template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public SceneGraph::FeatureGroup<dimensions, AbstractShape<dimensions>, Float> {
@@ -52,7 +148,14 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public S
          *
          * Marks the group as dirty.
          */
-        explicit ShapeGroup(): dirty(true) {}
+        explicit ShapeGroup(): dirty(true), _sweepAxis(0), _batchesDirty(true) {}
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes bounding volumes created for the shapes.
+         */
+        ~ShapeGroup();
 
         /**
          * @brief Whether the group is dirty
@@ -69,7 +172,7 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public S
          *
          * @see setClean()
          */
-        void setDirty() { dirty = true; }
+        void setDirty() { dirty = _batchesDirty = true; }
 
         /**
          * @brief Set the group and all bodies as clean
@@ -84,12 +187,160 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public S
          *
          * Returns first shape colliding with given one. If there aren't any
          * collisions, returns `nullptr`. Calls setClean() before the
-         * operation.
+         * operation. See @ref ShapeGroup-batching "class documentation" for
+         * more information.
          */
         AbstractShape<dimensions>* firstCollision(const AbstractShape<dimensions>& shape);
 
+        /**
+         * @brief All collisions of given shape with other shapes in the group
+         *
+         * Returns all shapes colliding with given one in the order in which
+         * they are in the group. Calls setClean() before the operation. See
+         * @ref ShapeGroup-batching "class documentation" for more
+         * information.
+         */
+        std::vector<AbstractShape<dimensions>*> collisions(const AbstractShape<dimensions>& shape);
+
+        /**
+         * @brief All collisions in the group
+         *
+         * Returns all pairs of colliding shapes, each pair only once. Calls
+         * setClean() before the operation. See
+         * @ref ShapeGroup-broadphase "class documentation" for more
+         * information.
+         */
+        std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> collisions();
+
+        /**
+         * @brief %Collision data for given pairs of shapes
+         *
+         * Returns collision data for each pair, e.g. for pairs returned from
+         * @ref collisions(). Pairs for which the contact generation is not
+         * implemented have empty collision. Calls setClean() before the
+         * operation. See @ref ShapeGroup-broadphase "class documentation" for
+         * more information.
+         * @see @ref AbstractShape::collision()
+         */
+        std::vector<Collision<dimensions>> collisionData(const std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>>& pairs);
+
+        /**
+         * @brief Nearest shape hit by given ray
+         * @param origin        Ray origin
+         * @param direction     Ray direction, expected to be normalized
+         * @param maxDistance   Max distance along the ray
+         *
+         * If there is no shape hit in given distance, returns empty hit. If
+         * the origin is inside a shape, the shape is hit at zero distance.
+         * Calls setClean() before the operation. See
+         * @ref ShapeGroup-raycast "class documentation" for more information.
+         * @see @ref raycastAll(), @ref sphereCast()
+         */
+        RaycastHit<dimensions> raycast(const typename DimensionTraits<dimensions, Float>::VectorType& origin, const typename DimensionTraits<dimensions, Float>::VectorType& direction, Float maxDistance = std::numeric_limits<Float>::infinity());
+
+        /**
+         * @brief All shapes hit by given ray
+         *
+         * Returns hits of all shapes in given distance, sorted by distance.
+         * Calls setClean() before the operation.
+         * @see @ref raycast()
+         */
+        std::vector<RaycastHit<dimensions>> raycastAll(const typename DimensionTraits<dimensions, Float>::VectorType& origin, const typename DimensionTraits<dimensions, Float>::VectorType& direction, Float maxDistance = std::numeric_limits<Float>::infinity());
+
+        /**
+         * @brief Nearest shape hit by sphere moving along given ray
+         * @param origin        Initial sphere center
+         * @param direction     Direction of the movement, expected to be
+         *      normalized
+         * @param radius        Sphere radius
+         * @param maxDistance   Max distance of the movement
+         *
+         * Returned distance is distance which the sphere can move before it
+         * touches the shape, position is the touching point on the shape.
+         * Sphere with zero radius is equivalent to @ref raycast(). Calls
+         * setClean() before the operation.
+         */
+        RaycastHit<dimensions> sphereCast(const typename DimensionTraits<dimensions, Float>::VectorType& origin, const typename DimensionTraits<dimensions, Float>::VectorType& direction, Float radius, Float maxDistance = std::numeric_limits<Float>::infinity());
+
+        /**
+         * @brief Save positions of all shapes
+         *
+         * Saves absolute translation of objects of all shapes in the group
+         * as starting point of their movement for @ref sweptCollisions() and
+         * @ref timesOfImpact(). Shapes added after last call are treated as
+         * not moving. Calls setClean() before the operation. See
+         * @ref ShapeGroup-continuous "class documentation" for more
+         * information.
+         */
+        void savePositions();
+
+        /**
+         * @brief All collisions during the movement
+         *
+         * Returns all pairs of shapes which touched anytime during their
+         * movement since last call to @ref savePositions(), each pair only
+         * once. Calls setClean() before the operation.
+         * @see @ref collisions()
+         */
+        std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> sweptCollisions();
+
+        /**
+         * @brief Times of impact for given pairs of shapes
+         *
+         * Returns time of first contact for each pair during their movement
+         * since last call to @ref savePositions(), e.g. for pairs returned
+         * from @ref sweptCollisions(). The time is in range @f$ [0, 1] @f$,
+         * where `0` is the saved position and `1` the current one. If the
+         * shapes don't touch during the movement, the time is infinity. Calls
+         * setClean() before the operation.
+         */
+        std::vector<Float> timesOfImpact(const std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>>& pairs);
+
     private:
+        /* Bound value along sweep axis, shape ID shifted left by one bit and
+           lowest bit set for maximal endpoint */
+        struct Endpoint {
+            Float value;
+            UnsignedInt data;
+        };
+
+        void MAGNUM_SHAPES_LOCAL updateBroadphase(bool swept);
+        template<class T> std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> MAGNUM_SHAPES_LOCAL broadphase(T narrowphase);
+        void MAGNUM_SHAPES_LOCAL updateDisplacements();
+        typename DimensionTraits<dimensions, Float>::VectorType MAGNUM_SHAPES_LOCAL displacement(AbstractShape<dimensions>* shape) const;
+        void MAGNUM_SHAPES_LOCAL updateBatches();
+        void MAGNUM_SHAPES_LOCAL batchCollisions(const AbstractShape<dimensions>& shape);
+        void MAGNUM_SHAPES_LOCAL updateHierarchy();
+        RaycastHit<dimensions> MAGNUM_SHAPES_LOCAL cast(const typename DimensionTraits<dimensions, Float>::VectorType& origin, const typename DimensionTraits<dimensions, Float>::VectorType& direction, Float radius, Float maxDistance, std::vector<RaycastHit<dimensions>>* all);
+
         bool dirty;
+        UnsignedInt _sweepAxis;
+        std::vector<std::pair<typename DimensionTraits<dimensions, Float>::VectorType, typename DimensionTraits<dimensions, Float>::VectorType>> _bounds;
+        std::vector<Endpoint> _endpoints;
+        std::vector<UnsignedInt> _active;
+
+        bool _batchesDirty;
+        std::vector<AbstractShape<dimensions>*> _batchedShapes;
+        ShapeBatch<Point<dimensions>> _points;
+        ShapeBatch<Sphere<dimensions>> _spheres;
+        ShapeBatch<AxisAlignedBox<dimensions>> _boxes;
+        std::vector<UnsignedInt> _pointIds, _sphereIds, _boxIds, _otherIds;
+        std::vector<UnsignedByte> _batchCollisions, _collisions;
+
+        /* Bounded shapes have their bounding volume in the hierarchy,
+           unbounded shapes are listed separately */
+        SceneGraph::BoundingVolumeHierarchy<dimensions, Float> _hierarchy;
+        std::vector<AbstractShape<dimensions>*> _hierarchyShapes;
+        std::vector<UnsignedInt> _unboundedIds;
+
+        /* Saved positions sorted by shape pointer, current displacements in
+           group order */
+        std::vector<std::pair<AbstractShape<dimensions>*, typename DimensionTraits<dimensions, Float>::VectorType>> _savedPositions;
+        std::vector<typename DimensionTraits<dimensions, Float>::VectorType> _displacements;
+
+        /* Separating axes of pairs tested with GJK in last collisions() call
+           sorted by the pair, the pair is ordered by shape pointer */
+        std::vector<std::pair<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>, typename DimensionTraits<dimensions, Float>::VectorType>> _separatingAxes, _nextSeparatingAxes;
 };
 
 /**
@@ -56,6 +56,10 @@ template<UnsignedInt> class Composition;
 typedef Composition<2> Composition2D;
 typedef Composition<3> Composition3D;
 
+template<UnsignedInt> class ConvexHull;
+typedef ConvexHull<2> ConvexHull2D;
+typedef ConvexHull<3> ConvexHull3D;
+
 template<UnsignedInt> class Cylinder;
 typedef Cylinder<2> Cylinder2D;
 typedef Cylinder<3> Cylinder3D;
@@ -68,7 +72,14 @@ template<UnsignedInt> class LineSegment;
 typedef LineSegment<2> LineSegment2D;
 typedef LineSegment<3> LineSegment3D;
 
+template<UnsignedInt> class RaycastHit;
+typedef RaycastHit<2> RaycastHit2D;
+typedef RaycastHit<3> RaycastHit3D;
+
+class RigidBodyWorld;
+
 template<class> class Shape;
+template<class> class ShapeBatch;
 
 template<UnsignedInt> class ShapeGroup;
 typedef ShapeGroup<2> ShapeGroup2D;
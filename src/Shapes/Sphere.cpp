@@ -40,6 +40,11 @@ template<UnsignedInt dimensions> Sphere<dimensions> Sphere<dimensions>::transfor
     return Sphere<dimensions>(matrix.transformPoint(_position), matrix.uniformScaling()*_radius);
 }
 
+template<UnsignedInt dimensions> typename DimensionTraits<dimensions, Float>::VectorType Sphere<dimensions>::support(const typename DimensionTraits<dimensions, Float>::VectorType& direction) const {
+    const Float dot = direction.dot();
+    return dot == 0.0f ? _position : _position + direction*(_radius/Math::sqrt(dot));
+}
+
 template<UnsignedInt dimensions> bool Sphere<dimensions>::operator%(const Point<dimensions>& other) const {
     return (_position - other.position()).dot() < Math::pow<2>(_radius);
 }
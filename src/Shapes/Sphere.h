@@ -80,6 +80,14 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT Sphere {
         /** @brief Set radius */
         void setRadius(Float radius) { _radius = radius; }
 
+        /**
+         * @brief Support point
+         *
+         * Point of the shape farthest in given direction, used for
+         * collision detection of arbitrary convex shapes.
+         */
+        typename DimensionTraits<dimensions, Float>::VectorType support(const typename DimensionTraits<dimensions, Float>::VectorType& direction) const;
+
         /** @brief %Collision occurence with point */
         bool operator%(const Point<dimensions>& other) const;
 
@@ -25,7 +25,10 @@
 #include "Math/Matrix4.h"
 #include "Magnum.h"
 #include "Shapes/AxisAlignedBox.h"
+#include "Shapes/Capsule.h"
+#include "Shapes/Cylinder.h"
 #include "Shapes/Point.h"
+#include "Shapes/Sphere.h"
 
 #include "ShapeTestBase.h"
 
@@ -37,11 +40,23 @@ class AxisAlignedBoxTest: public TestSuite::Tester {
 
         void transformed();
         void collisionPoint();
+        void collisionPointData();
+        void collisionSphere();
+        void collisionCylinder();
+        void collisionCapsule();
+        void collisionCapsuleInside();
+        void collisionAxisAlignedBox();
 };
 
 AxisAlignedBoxTest::AxisAlignedBoxTest() {
     addTests({&AxisAlignedBoxTest::transformed,
-              &AxisAlignedBoxTest::collisionPoint});
+              &AxisAlignedBoxTest::collisionPoint,
+              &AxisAlignedBoxTest::collisionPointData,
+              &AxisAlignedBoxTest::collisionSphere,
+              &AxisAlignedBoxTest::collisionCylinder,
+              &AxisAlignedBoxTest::collisionCapsule,
+              &AxisAlignedBoxTest::collisionCapsuleInside,
+              &AxisAlignedBoxTest::collisionAxisAlignedBox});
 }
 
 void AxisAlignedBoxTest::transformed() {
@@ -60,6 +75,105 @@ void AxisAlignedBoxTest::collisionPoint() {
     VERIFY_COLLIDES(box, point2);
 }
 
+void AxisAlignedBoxTest::collisionPointData() {
+    const Shapes::AxisAlignedBox3D box(Vector3(-1.0f), Vector3(1.0f));
+    const Shapes::Point3D point({0.5f, 0.2f, 0.0f});
+
+    /* Separated along the axis with smallest penetration */
+    const Collision3D collision = box/point;
+    CORRADE_COMPARE(collision.position(), point.position());
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Flipped */
+    CORRADE_COMPARE((point/box).separationNormal(), Vector3::xAxis());
+
+    /* No collision */
+    CORRADE_VERIFY(!(box/Shapes::Point3D({1.5f, 0.2f, 0.0f})));
+}
+
+void AxisAlignedBoxTest::collisionSphere() {
+    const Shapes::AxisAlignedBox3D box(Vector3(-1.0f), Vector3(1.0f));
+    const Shapes::Sphere3D sphere({2.0f, 0.5f, 0.0f}, 1.5f);
+    const Shapes::Sphere3D sphere1({2.0f, 2.0f, 0.0f}, 1.5f);
+    const Shapes::Sphere3D sphere2({3.0f, 0.0f, 0.0f}, 1.5f);
+
+    VERIFY_COLLIDES(box, sphere);
+    VERIFY_COLLIDES(box, sphere1);
+    VERIFY_NOT_COLLIDES(box, sphere2);
+
+    const Collision3D collision = box/sphere;
+    CORRADE_COMPARE(collision.position(), Vector3(0.5f, 0.5f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Contact with the corner */
+    const Collision3D collision1 = box/sphere1;
+    CORRADE_COMPARE(collision1.separationNormal(), Vector3(-1.0f, -1.0f, 0.0f).normalized());
+    CORRADE_COMPARE(collision1.separationDistance(), 1.5f - Constants::sqrt2());
+
+    /* Flipped */
+    const Collision3D flipped = sphere/box;
+    CORRADE_COMPARE(flipped.position(), Vector3(1.0f, 0.5f, 0.0f));
+    CORRADE_COMPARE(flipped.separationNormal(), Vector3::xAxis());
+}
+
+void AxisAlignedBoxTest::collisionCylinder() {
+    const Shapes::AxisAlignedBox3D box(Vector3(-1.0f), Vector3(1.0f));
+    const Shapes::Cylinder3D cylinder({2.0f, 0.0f, 0.0f}, {2.0f, 1.0f, 0.0f}, 1.5f);
+    const Shapes::Cylinder3D cylinder1({3.0f, 0.0f, 0.0f}, {3.0f, 1.0f, 0.0f}, 1.5f);
+
+    VERIFY_COLLIDES(box, cylinder);
+    VERIFY_NOT_COLLIDES(box, cylinder1);
+
+    const Collision3D collision = box/cylinder;
+    CORRADE_COMPARE(collision.position().x(), 0.5f);
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+}
+
+void AxisAlignedBoxTest::collisionCapsule() {
+    const Shapes::AxisAlignedBox3D box(Vector3(-1.0f), Vector3(1.0f));
+    const Shapes::Capsule3D capsule({2.0f, -3.0f, 0.0f}, {2.0f, 3.0f, 0.0f}, 1.5f);
+    const Shapes::Capsule3D capsule1({3.0f, 0.0f, 0.0f}, {5.0f, 0.0f, 0.0f}, 1.5f);
+
+    VERIFY_COLLIDES(box, capsule);
+    VERIFY_NOT_COLLIDES(box, capsule1);
+
+    const Collision3D collision = box/capsule;
+    CORRADE_COMPARE(collision.position().x(), 0.5f);
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+}
+
+void AxisAlignedBoxTest::collisionCapsuleInside() {
+    const Shapes::AxisAlignedBox3D box(Vector3(-1.0f), Vector3(1.0f));
+    const Shapes::Capsule3D capsule({0.0f, 3.0f, 0.0f}, {0.0f, 0.5f, 0.0f}, 0.25f);
+
+    /* The deepest point of the capsule axis is separated */
+    const Collision3D collision = box/capsule;
+    CORRADE_COMPARE(collision.position(), Vector3(0.0f, 0.25f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.75f);
+}
+
+void AxisAlignedBoxTest::collisionAxisAlignedBox() {
+    const Shapes::AxisAlignedBox3D box(Vector3(-1.0f), Vector3(1.0f));
+    const Shapes::AxisAlignedBox3D box1({0.5f, -3.0f, -3.0f}, {4.0f, 3.0f, 3.0f});
+    const Shapes::AxisAlignedBox3D box2({1.5f, -3.0f, -3.0f}, {4.0f, 3.0f, 3.0f});
+
+    CORRADE_VERIFY(box % box1);
+    CORRADE_VERIFY(box1 % box);
+    CORRADE_VERIFY(!(box % box2));
+    CORRADE_VERIFY(!(box2 % box));
+
+    const Collision3D collision = box/box1;
+    CORRADE_COMPARE(collision.position(), Vector3(0.5f, 0.0f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+    CORRADE_VERIFY(!(box/box2));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shapes::Test::AxisAlignedBoxTest)
@@ -22,11 +22,18 @@
     DEALINGS IN THE SOFTWARE.
 */
 
-#include <TestSuite/Tester.h>
-
+#include "Math/Constants.h"
+#include "Math/Matrix3.h"
 #include "Math/Matrix4.h"
 #include "Magnum.h"
+#include "Shapes/AxisAlignedBox.h"
 #include "Shapes/Box.h"
+#include "Shapes/Capsule.h"
+#include "Shapes/Cylinder.h"
+#include "Shapes/Point.h"
+#include "Shapes/Sphere.h"
+
+#include "ShapeTestBase.h"
 
 namespace Magnum { namespace Shapes { namespace Test {
 
@@ -35,10 +42,24 @@ class BoxTest: public TestSuite::Tester {
         BoxTest();
 
         void transformed();
+        void collisionPoint();
+        void collisionSphere();
+        void collisionCylinder();
+        void collisionCapsule();
+        void collisionAxisAlignedBox();
+        void collisionBox();
+        void collisionBox2D();
 };
 
 BoxTest::BoxTest() {
-    addTests({&BoxTest::transformed});
+    addTests({&BoxTest::transformed,
+              &BoxTest::collisionPoint,
+              &BoxTest::collisionSphere,
+              &BoxTest::collisionCylinder,
+              &BoxTest::collisionCapsule,
+              &BoxTest::collisionAxisAlignedBox,
+              &BoxTest::collisionBox,
+              &BoxTest::collisionBox2D});
 }
 
 void BoxTest::transformed() {
@@ -47,6 +68,123 @@ void BoxTest::transformed() {
     CORRADE_COMPARE(box.transformation(), Matrix4::scaling({2.0f, -1.0f, 1.5f})*Matrix4::translation({1.0f, 2.0f, -3.0f}));
 }
 
+void BoxTest::collisionPoint() {
+    const Shapes::Box3D box(Matrix4::translation({1.0f, 0.0f, 0.0f})*Matrix4::rotationZ(Deg(30.0f)));
+    const Shapes::Point3D point({1.0f, 0.5f, 0.0f});
+    const Shapes::Point3D point1({2.0f, 1.0f, 0.0f});
+
+    VERIFY_COLLIDES(box, point);
+    VERIFY_NOT_COLLIDES(box, point1);
+
+    /* Separated along the rotated Y axis */
+    const Collision3D collision = box/point;
+    CORRADE_COMPARE(collision.position(), point.position());
+    CORRADE_COMPARE(collision.separationNormal(), Vector3(0.5f, -Constants::sqrt3()*0.5f, 0.0f));
+    CORRADE_COMPARE(collision.separationDistance(), 1.0f - Constants::sqrt3()*0.25f);
+}
+
+void BoxTest::collisionSphere() {
+    const Shapes::Box3D box(Matrix4::rotationZ(Deg(90.0f))*Matrix4::scaling({2.0f, 1.0f, 1.0f}));
+    const Shapes::Sphere3D sphere({1.5f, 0.0f, 0.0f}, 1.0f);
+    const Shapes::Sphere3D sphere1({2.5f, 0.0f, 0.0f}, 1.0f);
+
+    VERIFY_COLLIDES(box, sphere);
+    VERIFY_NOT_COLLIDES(box, sphere1);
+
+    const Collision3D collision = box/sphere;
+    CORRADE_COMPARE(collision.position(), Vector3(0.5f, 0.0f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Flipped */
+    const Collision3D flipped = sphere/box;
+    CORRADE_COMPARE(flipped.position(), Vector3(1.0f, 0.0f, 0.0f));
+    CORRADE_COMPARE(flipped.separationNormal(), Vector3::xAxis());
+    CORRADE_COMPARE(flipped.separationDistance(), 0.5f);
+}
+
+void BoxTest::collisionCylinder() {
+    const Shapes::Box3D box(Matrix4{});
+    const Shapes::Cylinder3D cylinder({1.5f, -1.0f, 0.0f}, {1.5f, 1.0f, 0.0f}, 1.0f);
+    const Shapes::Cylinder3D cylinder1({2.5f, -1.0f, 0.0f}, {2.5f, 1.0f, 0.0f}, 1.0f);
+
+    VERIFY_COLLIDES(box, cylinder);
+    VERIFY_NOT_COLLIDES(box, cylinder1);
+
+    const Collision3D collision = box/cylinder;
+    CORRADE_COMPARE(collision.position().x(), 0.5f);
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+}
+
+void BoxTest::collisionCapsule() {
+    const Shapes::Box3D box(Matrix4{});
+    const Shapes::Capsule3D capsule({3.0f, 0.0f, 0.0f}, {1.5f, 0.0f, 0.0f}, 1.0f);
+    const Shapes::Capsule3D capsule1({3.0f, 0.0f, 0.0f}, {2.5f, 0.0f, 0.0f}, 1.0f);
+
+    VERIFY_COLLIDES(box, capsule);
+    VERIFY_NOT_COLLIDES(box, capsule1);
+
+    const Collision3D collision = box/capsule;
+    CORRADE_COMPARE(collision.position(), Vector3(0.5f, 0.0f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+}
+
+void BoxTest::collisionAxisAlignedBox() {
+    const Shapes::Box3D box(Matrix4::translation({1.5f, 0.0f, 0.0f})*Matrix4::rotationZ(Deg(45.0f)));
+    const Shapes::AxisAlignedBox3D aabb(Vector3(-1.0f), Vector3(1.0f));
+    const Shapes::AxisAlignedBox3D aabb1(Vector3(-1.0f), {-0.5f, 1.0f, 1.0f});
+
+    VERIFY_COLLIDES(box, aabb);
+    VERIFY_NOT_COLLIDES(box, aabb1);
+
+    /* Box corner is moved onto the face of the axis-aligned box */
+    const Collision3D collision = box/aabb;
+    CORRADE_COMPARE(collision.position(), Vector3(1.0f, 0.0f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 1.0f + Constants::sqrt2() - 1.5f);
+}
+
+void BoxTest::collisionBox() {
+    const Shapes::Box3D box(Matrix4{});
+    const Shapes::Box3D box1(Matrix4::translation({1.5f, 0.0f, 0.0f})*Matrix4::rotationZ(Deg(45.0f)));
+    const Shapes::Box3D box2(Matrix4::translation({2.5f, 0.0f, 0.0f})*Matrix4::rotationZ(Deg(45.0f)));
+
+    /* Separated only along edge cross product */
+    const Shapes::Box3D box3(Matrix4::translation({1.8f, 1.8f, 0.0f})*Matrix4::rotationX(Deg(45.0f))*Matrix4::rotationY(Deg(45.0f)));
+
+    VERIFY_COLLIDES(box, box1);
+    VERIFY_NOT_COLLIDES(box, box2);
+
+    const Collision3D collision = box/box1;
+    CORRADE_COMPARE(collision.position(), Vector3(1.5f - Constants::sqrt2(), 0.0f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 1.0f + Constants::sqrt2() - 1.5f);
+
+    /* Flipped */
+    const Collision3D flipped = box1/box;
+    CORRADE_COMPARE(flipped.separationNormal(), Vector3::xAxis());
+    CORRADE_COMPARE(flipped.separationDistance(), 1.0f + Constants::sqrt2() - 1.5f);
+
+    /* The result is the same as exhaustive test of projections on all axes */
+    CORRADE_COMPARE(bool(box/box3), bool(box3/box));
+}
+
+void BoxTest::collisionBox2D() {
+    const Shapes::Box2D box(Matrix3::scaling({2.0f, 1.0f}));
+    const Shapes::Box2D box1(Matrix3::translation({0.0f, 1.5f})*Matrix3::rotation(Deg(45.0f)));
+    const Shapes::Box2D box2(Matrix3::translation({0.0f, 2.5f})*Matrix3::rotation(Deg(45.0f)));
+
+    VERIFY_COLLIDES(box, box1);
+    VERIFY_NOT_COLLIDES(box, box2);
+
+    const Collision2D collision = box/box1;
+    CORRADE_COMPARE(collision.position(), Vector2(0.0f, 1.5f - Constants::sqrt2()));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector2::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 1.0f + Constants::sqrt2() - 1.5f);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shapes::Test::BoxTest)
@@ -26,6 +26,7 @@
 #include "Math/Matrix4.h"
 #include "Magnum.h"
 #include "Shapes/Capsule.h"
+#include "Shapes/Cylinder.h"
 #include "Shapes/Point.h"
 #include "Shapes/Sphere.h"
 
@@ -41,12 +42,22 @@ class CapsuleTest: public TestSuite::Tester {
         void transformedAverageScaling();
         void collisionPoint();
         void collisionSphere();
+        void collisionPointData();
+        void collisionSphereData();
+        void collisionCylinder();
+        void collisionCapsule();
+        void collisionCapsuleParallel();
 };
 
 CapsuleTest::CapsuleTest() {
     addTests({&CapsuleTest::transformed,
               &CapsuleTest::collisionPoint,
-              &CapsuleTest::collisionSphere});
+              &CapsuleTest::collisionSphere,
+              &CapsuleTest::collisionPointData,
+              &CapsuleTest::collisionSphereData,
+              &CapsuleTest::collisionCylinder,
+              &CapsuleTest::collisionCapsule,
+              &CapsuleTest::collisionCapsuleParallel});
 }
 
 void CapsuleTest::transformed() {
@@ -80,6 +91,86 @@ void CapsuleTest::collisionSphere() {
     VERIFY_NOT_COLLIDES(capsule, sphere2);
 }
 
+void CapsuleTest::collisionPointData() {
+    const Shapes::Capsule3D capsule({-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, 1.0f);
+    const Shapes::Point3D point({1.5f, 0.0f, 0.0f});
+
+    const Collision3D collision = capsule/point;
+    CORRADE_COMPARE(collision.position(), point.position());
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Flipped */
+    CORRADE_COMPARE((point/capsule).separationNormal(), Vector3::xAxis());
+
+    /* No collision */
+    CORRADE_VERIFY(!(capsule/Shapes::Point3D({2.5f, 0.0f, 0.0f})));
+}
+
+void CapsuleTest::collisionSphereData() {
+    const Shapes::Capsule3D capsule({-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, 1.0f);
+    const Shapes::Sphere3D sphere({0.5f, 1.5f, 0.0f}, 1.0f);
+
+    const Collision3D collision = capsule/sphere;
+    CORRADE_COMPARE(collision.position(), Vector3(0.5f, 0.5f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Flipped */
+    CORRADE_COMPARE((sphere/capsule).separationNormal(), Vector3::yAxis());
+
+    /* No collision */
+    CORRADE_VERIFY(!(capsule/Shapes::Sphere3D({0.5f, 2.5f, 0.0f}, 1.0f)));
+}
+
+void CapsuleTest::collisionCylinder() {
+    const Shapes::Capsule3D capsule({-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, 1.0f);
+    const Shapes::Cylinder3D cylinder({0.0f, 2.0f, -1.0f}, {0.0f, 2.0f, 1.0f}, 1.5f);
+    const Shapes::Cylinder3D cylinder1({0.0f, 2.0f, -1.0f}, {0.0f, 2.0f, 1.0f}, 0.5f);
+
+    VERIFY_COLLIDES(capsule, cylinder);
+    VERIFY_NOT_COLLIDES(capsule, cylinder1);
+
+    const Collision3D collision = capsule/cylinder;
+    CORRADE_COMPARE(collision.position(), Vector3(0.0f, 0.5f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+}
+
+void CapsuleTest::collisionCapsule() {
+    const Shapes::Capsule3D capsule({-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, 1.0f);
+    const Shapes::Capsule3D capsule1({0.0f, 1.2f, -1.0f}, {0.0f, 1.2f, 1.0f}, 0.5f);
+    const Shapes::Capsule3D capsule2({0.0f, 1.6f, -1.0f}, {0.0f, 1.6f, 1.0f}, 0.5f);
+
+    /* Endpoints are rounded */
+    const Shapes::Capsule3D capsule3({2.5f, 0.0f, 1.0f}, {2.5f, 0.0f, 3.0f}, 0.5f);
+
+    VERIFY_COLLIDES(capsule, capsule1);
+    VERIFY_NOT_COLLIDES(capsule, capsule2);
+    VERIFY_NOT_COLLIDES(capsule, capsule3);
+
+    const Collision3D collision = capsule/capsule1;
+    CORRADE_COMPARE(collision.position(), Vector3(0.0f, 0.7f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.3f);
+
+    /* Flipped */
+    const Collision3D flipped = capsule1/capsule;
+    CORRADE_COMPARE(flipped.position(), Vector3(0.0f, 1.0f, 0.0f));
+    CORRADE_COMPARE(flipped.separationNormal(), Vector3::yAxis());
+    CORRADE_COMPARE(flipped.separationDistance(), 0.3f);
+}
+
+void CapsuleTest::collisionCapsuleParallel() {
+    const Shapes::Capsule3D capsule({-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, 1.0f);
+    const Shapes::Capsule3D capsule1({-0.5f, 1.5f, 0.0f}, {3.0f, 1.5f, 0.0f}, 0.75f);
+
+    const Collision3D collision = capsule/capsule1;
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.25f);
+    CORRADE_COMPARE(collision.position().y(), 0.75f);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shapes::Test::CapsuleTest)
@@ -22,8 +22,10 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <random>
 #include <TestSuite/Tester.h>
 
+#include "Math/Matrix3.h"
 #include "Math/Matrix4.h"
 #include "Shapes/Point.h"
 #include "Shapes/AxisAlignedBox.h"
@@ -44,6 +46,10 @@ class CompositionTest: public TestSuite::Tester {
         void multipleUnary();
         void hierarchy();
         void empty();
+        void copy();
+        void move();
+        void transformed();
+        void bounds();
 };
 
 CompositionTest::CompositionTest() {
@@ -52,7 +58,11 @@ CompositionTest::CompositionTest() {
               &CompositionTest::ored,
               &CompositionTest::multipleUnary,
               &CompositionTest::hierarchy,
-              &CompositionTest::empty});
+              &CompositionTest::empty,
+              &CompositionTest::copy,
+              &CompositionTest::move,
+              &CompositionTest::transformed,
+              &CompositionTest::bounds});
 }
 
 void CompositionTest::negated() {
@@ -125,6 +135,94 @@ void CompositionTest::empty() {
     VERIFY_NOT_COLLIDES(a, Shapes::Sphere2D({}, 1.0f));
 }
 
+void CompositionTest::copy() {
+    const Shapes::Composition3D a = Shapes::Sphere3D({}, 1.0f) &&
+        (Shapes::Point3D(Vector3::xAxis(1.5f)) || !Shapes::AxisAlignedBox3D({}, Vector3(0.5f)));
+
+    /* Copy construction */
+    Shapes::Composition3D b(a);
+    CORRADE_COMPARE(b.size(), 3);
+    CORRADE_COMPARE(b.type(2), Composition3D::Type::AxisAlignedBox);
+    CORRADE_COMPARE(b.get<Shapes::Point3D>(1).position(), Vector3::xAxis(1.5f));
+    CORRADE_VERIFY(&b.get<Shapes::Point3D>(1) != &a.get<Shapes::Point3D>(1));
+    VERIFY_COLLIDES(b, Shapes::Sphere3D(Vector3::xAxis(1.5f), 0.6f));
+    VERIFY_NOT_COLLIDES(b, Shapes::Point3D(Vector3(0.25f)));
+
+    /* Copy assignment to the same layout reuses the memory */
+    Shapes::Composition3D c = Shapes::Sphere3D(Vector3::xAxis(5.0f), 1.0f) &&
+        (Shapes::Point3D() || !Shapes::AxisAlignedBox3D({}, Vector3(0.5f)));
+    const Shapes::Point3D* point = &c.get<Shapes::Point3D>(1);
+    c = a;
+    CORRADE_VERIFY(&c.get<Shapes::Point3D>(1) == point);
+    CORRADE_COMPARE(c.get<Shapes::Sphere3D>(0).position(), Vector3());
+    VERIFY_COLLIDES(c, Shapes::Sphere3D(Vector3::xAxis(1.5f), 0.6f));
+
+    /* Copy assignment to different layout */
+    Shapes::Composition3D d = !Shapes::Point3D();
+    d = a;
+    CORRADE_COMPARE(d.size(), 3);
+    VERIFY_COLLIDES(d, Shapes::Sphere3D(Vector3::xAxis(1.5f), 0.6f));
+    VERIFY_NOT_COLLIDES(d, Shapes::Point3D(Vector3(0.25f)));
+
+    /* Copying composition into another one */
+    const Shapes::Composition3D e = Shapes::Composition3D(a) || Shapes::Point3D(Vector3::yAxis(5.0f));
+    CORRADE_COMPARE(e.size(), 4);
+    CORRADE_COMPARE(e.get<Shapes::Point3D>(3).position(), Vector3::yAxis(5.0f));
+    VERIFY_COLLIDES(e, Shapes::Sphere3D(Vector3::yAxis(5.0f), 0.1f));
+    VERIFY_COLLIDES(e, Shapes::Sphere3D(Vector3::xAxis(1.5f), 0.6f));
+}
+
+void CompositionTest::move() {
+    Shapes::Composition2D a = Shapes::Sphere2D({}, 1.0f) || Shapes::Point2D(Vector2::xAxis(1.5f));
+    const Shapes::Point2D* point = &a.get<Shapes::Point2D>(1);
+
+    /* Move construction doesn't copy anything */
+    Shapes::Composition2D b(std::move(a));
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(b.size(), 2);
+    CORRADE_VERIFY(&b.get<Shapes::Point2D>(1) == point);
+    VERIFY_NOT_COLLIDES(a, Shapes::Point2D());
+    VERIFY_COLLIDES(b, Shapes::Point2D());
+
+    /* Move assignment */
+    Shapes::Composition2D c;
+    c = std::move(b);
+    CORRADE_COMPARE(c.size(), 2);
+    CORRADE_VERIFY(&c.get<Shapes::Point2D>(1) == point);
+    VERIFY_COLLIDES(c, Shapes::Sphere2D(Vector2::xAxis(1.5f), 0.25f));
+}
+
+void CompositionTest::transformed() {
+    const Shapes::Composition2D a = Shapes::Sphere2D({}, 1.0f) && Shapes::Point2D(Vector2::xAxis(0.5f));
+    const Shapes::Composition2D b = a.transformed(Matrix3::translation(Vector2::yAxis(5.0f)));
+
+    CORRADE_COMPARE(b.get<Shapes::Point2D>(1).position(), Vector2(0.5f, 5.0f));
+    VERIFY_NOT_COLLIDES(b, Shapes::Sphere2D(Vector2::xAxis(0.5f), 0.25f));
+    VERIFY_COLLIDES(b, Shapes::Sphere2D({0.5f, 5.0f}, 0.25f));
+}
+
+void CompositionTest::bounds() {
+    const Shapes::Sphere3D s1({}, 1.0f);
+    const Shapes::Sphere3D s2(Vector3::xAxis(1.0f), 1.0f);
+    const Shapes::AxisAlignedBox3D s3({3.0f, -1.0f, -1.0f}, {5.0f, 1.0f, 1.0f});
+    const Shapes::Sphere3D s4(Vector3::xAxis(4.0f), 0.5f);
+    const Shapes::Composition3D a = (Shapes::Sphere3D(s1) && Shapes::Sphere3D(s2)) ||
+        (Shapes::AxisAlignedBox3D(s3) && !Shapes::Sphere3D(s4));
+
+    /* Subtrees skipped based on bounds give the same result as testing all
+       shapes */
+    std::mt19937 random(1);
+    std::uniform_real_distribution<Float> position(-3.0f, 7.0f);
+    std::size_t count = 0;
+    for(std::size_t i = 0; i != 1000; ++i) {
+        const Shapes::Point3D p({position(random), position(random)/2.0f, position(random)/2.0f});
+        const bool expected = (p % s1 && p % s2) || (p % s3 && !(p % s4));
+        CORRADE_COMPARE(a % p, expected);
+        if(expected) ++count;
+    }
+    CORRADE_VERIFY(count);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shapes::Test::CompositionTest)
@@ -0,0 +1,284 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <random>
+
+#include "Math/Functions.h"
+#include "Math/Matrix3.h"
+#include "Math/Matrix4.h"
+#include "Magnum.h"
+#include "Shapes/AxisAlignedBox.h"
+#include "Shapes/Box.h"
+#include "Shapes/Capsule.h"
+#include "Shapes/ConvexHull.h"
+#include "Shapes/LineSegment.h"
+#include "Shapes/Point.h"
+#include "Shapes/Sphere.h"
+
+#include "ShapeTestBase.h"
+
+namespace Magnum { namespace Shapes { namespace Test {
+
+class ConvexHullTest: public TestSuite::Tester {
+    public:
+        ConvexHullTest();
+
+        void transformed();
+        void support();
+        void empty();
+        void collisionPoint();
+        void collisionLineSegment();
+        void collisionSphere();
+        void collisionCapsule();
+        void collisionAxisAlignedBox();
+        void collisionBox();
+        void collisionConvexHull();
+        void collisionConvexHull2D();
+        void collisionSphereData();
+        void collisionSphereDataDeep();
+        void collisionConvexHullData();
+        void collisionConvexHullData2D();
+        void collisionBoxRandom();
+};
+
+ConvexHullTest::ConvexHullTest() {
+    addTests({&ConvexHullTest::transformed,
+              &ConvexHullTest::support,
+              &ConvexHullTest::empty,
+              &ConvexHullTest::collisionPoint,
+              &ConvexHullTest::collisionLineSegment,
+              &ConvexHullTest::collisionSphere,
+              &ConvexHullTest::collisionCapsule,
+              &ConvexHullTest::collisionAxisAlignedBox,
+              &ConvexHullTest::collisionBox,
+              &ConvexHullTest::collisionConvexHull,
+              &ConvexHullTest::collisionConvexHull2D,
+              &ConvexHullTest::collisionSphereData,
+              &ConvexHullTest::collisionSphereDataDeep,
+              &ConvexHullTest::collisionConvexHullData,
+              &ConvexHullTest::collisionConvexHullData2D,
+              &ConvexHullTest::collisionBoxRandom});
+}
+
+namespace {
+
+/* Hull of box with given transformation, equivalent to Shapes::Box */
+Shapes::ConvexHull3D box(const Matrix4& transformation) {
+    std::vector<Vector3> points;
+    for(Int i = 0; i != 8; ++i)
+        points.push_back(transformation.transformPoint({i & 1 ? 1.0f : -1.0f,
+                                                        i & 2 ? 1.0f : -1.0f,
+                                                        i & 4 ? 1.0f : -1.0f}));
+    return points;
+}
+
+}
+
+void ConvexHullTest::transformed() {
+    const Shapes::ConvexHull3D hull{{1.0f, 2.0f, 3.0f}, {-1.0f, 0.0f, 2.0f}};
+
+    const auto transformed = hull.transformed(Matrix4::scaling(Vector3(2.0f))*Matrix4::rotation(Deg(90.0f), Vector3::zAxis()));
+    CORRADE_COMPARE(transformed.points().size(), 2);
+    CORRADE_COMPARE(transformed.points()[0], Vector3(-4.0f, 2.0f, 6.0f));
+    CORRADE_COMPARE(transformed.points()[1], Vector3(0.0f, -2.0f, 4.0f));
+}
+
+void ConvexHullTest::support() {
+    /* Interior point is never returned */
+    const Shapes::ConvexHull2D hull{{-1.0f, -1.0f}, {1.0f, -1.0f}, {0.0f, 0.0f}, {0.0f, 2.0f}};
+    CORRADE_COMPARE(hull.support(Vector2::yAxis()), Vector2(0.0f, 2.0f));
+    CORRADE_COMPARE(hull.support({1.0f, -1.0f}), Vector2(1.0f, -1.0f));
+    CORRADE_COMPARE(hull.support(-Vector2::xAxis()), Vector2(-1.0f, -1.0f));
+
+    /* Support of other shapes */
+    CORRADE_COMPARE(Shapes::Sphere2D({1.0f, 2.0f}, 2.0f).support({0.0f, -3.0f}), Vector2(1.0f, 0.0f));
+    CORRADE_COMPARE(Shapes::Capsule2D({1.0f, 2.0f}, {1.0f, -2.0f}, 1.0f).support({1.0f, 1.0f}), Vector2(1.0f + Constants::sqrt2()/2, 2.0f + Constants::sqrt2()/2));
+    CORRADE_COMPARE(Shapes::AxisAlignedBox2D({-1.0f, -2.0f}, {3.0f, 4.0f}).support({-1.0f, 1.0f}), Vector2(-1.0f, 4.0f));
+    CORRADE_COMPARE(Shapes::Box2D(Matrix3::translation({1.0f, 1.0f})*Matrix3::scaling({2.0f, 1.0f})).support({1.0f, -1.0f}), Vector2(3.0f, 0.0f));
+    CORRADE_COMPARE(Shapes::LineSegment2D({0.0f, 1.0f}, {2.0f, 0.0f}).support({1.0f, 1.0f}), Vector2(2.0f, 0.0f));
+}
+
+void ConvexHullTest::empty() {
+    const Shapes::ConvexHull3D hull;
+    VERIFY_NOT_COLLIDES(hull, Shapes::Sphere3D({}, 1.0f));
+    VERIFY_NOT_COLLIDES(hull, hull);
+    CORRADE_VERIFY(!(hull/Shapes::Sphere3D({}, 1.0f)));
+}
+
+void ConvexHullTest::collisionPoint() {
+    const Shapes::ConvexHull3D hull = box(Matrix4::rotation(Deg(45.0f), Vector3::zAxis()));
+
+    VERIFY_COLLIDES(hull, Shapes::Point3D({1.3f, 0.0f, 0.5f}));
+    VERIFY_NOT_COLLIDES(hull, Shapes::Point3D({1.0f, 1.0f, 0.0f}));
+    VERIFY_NOT_COLLIDES(hull, Shapes::Point3D({0.0f, 0.0f, 1.1f}));
+}
+
+void ConvexHullTest::collisionLineSegment() {
+    const Shapes::ConvexHull3D hull = box({});
+
+    /* Passing through without endpoints inside */
+    VERIFY_COLLIDES(hull, Shapes::LineSegment3D({-2.0f, 0.5f, 0.5f}, {2.0f, 0.5f, 0.5f}));
+    VERIFY_NOT_COLLIDES(hull, Shapes::LineSegment3D({-2.0f, 1.6f, 0.5f}, {2.0f, 0.6f, 1.6f}));
+}
+
+void ConvexHullTest::collisionSphere() {
+    const Shapes::ConvexHull3D hull = box({});
+
+    VERIFY_COLLIDES(hull, Shapes::Sphere3D({1.5f, 0.0f, 0.0f}, 0.6f));
+    VERIFY_COLLIDES(hull, Shapes::Sphere3D({}, 0.1f));
+
+    /* Near the corner, but farther than the radius */
+    VERIFY_NOT_COLLIDES(hull, Shapes::Sphere3D({1.5f, 1.5f, 1.5f}, 0.8f));
+}
+
+void ConvexHullTest::collisionCapsule() {
+    const Shapes::ConvexHull2D hull{{-1.0f, -1.0f}, {1.0f, -1.0f}, {0.0f, 1.0f}};
+
+    VERIFY_COLLIDES(hull, Shapes::Capsule2D({-2.0f, 1.5f}, {2.0f, 1.5f}, 0.6f));
+    VERIFY_NOT_COLLIDES(hull, Shapes::Capsule2D({-2.0f, 1.5f}, {2.0f, 1.5f}, 0.4f));
+}
+
+void ConvexHullTest::collisionAxisAlignedBox() {
+    const Shapes::ConvexHull3D hull = box(Matrix4::rotation(Deg(45.0f), Vector3::zAxis()));
+
+    VERIFY_COLLIDES(hull, Shapes::AxisAlignedBox3D({1.0f, -0.5f, -0.5f}, {2.0f, 0.5f, 0.5f}));
+    VERIFY_NOT_COLLIDES(hull, Shapes::AxisAlignedBox3D({1.5f, -0.5f, -0.5f}, {2.5f, 0.5f, 0.5f}));
+}
+
+void ConvexHullTest::collisionBox() {
+    const Shapes::ConvexHull3D hull = box({});
+
+    VERIFY_COLLIDES(hull, Shapes::Box3D(Matrix4::translation({2.3f, 0.0f, 0.0f})*Matrix4::rotation(Deg(45.0f), Vector3::zAxis())));
+    VERIFY_NOT_COLLIDES(hull, Shapes::Box3D(Matrix4::translation({2.5f, 0.0f, 0.0f})*Matrix4::rotation(Deg(45.0f), Vector3::zAxis())));
+}
+
+void ConvexHullTest::collisionConvexHull() {
+    const Shapes::ConvexHull3D hull = box({});
+
+    /* Tetrahedron touching the box face with its vertex */
+    const Shapes::ConvexHull3D tetrahedron{{0.0f, 0.0f, 0.9f}, {-1.0f, -1.0f, 2.0f}, {1.0f, -1.0f, 2.0f}, {0.0f, 1.0f, 2.0f}};
+    const Shapes::ConvexHull3D tetrahedron1{{0.0f, 0.0f, 1.1f}, {-1.0f, -1.0f, 2.0f}, {1.0f, -1.0f, 2.0f}, {0.0f, 1.0f, 2.0f}};
+
+    VERIFY_COLLIDES(hull, tetrahedron);
+    VERIFY_NOT_COLLIDES(hull, tetrahedron1);
+}
+
+void ConvexHullTest::collisionConvexHull2D() {
+    const Shapes::ConvexHull2D triangle{{-1.0f, -1.0f}, {1.0f, -1.0f}, {0.0f, 1.0f}};
+    const Shapes::ConvexHull2D triangle1{{0.2f, 0.5f}, {2.0f, 0.0f}, {2.0f, 1.0f}};
+    const Shapes::ConvexHull2D triangle2{{0.3f, 0.5f}, {2.0f, 0.0f}, {2.0f, 1.0f}};
+
+    VERIFY_COLLIDES(triangle, triangle1);
+    VERIFY_NOT_COLLIDES(triangle, triangle2);
+}
+
+void ConvexHullTest::collisionSphereData() {
+    /* Sphere center outside, collision data from closest points */
+    const Shapes::ConvexHull3D hull = box({});
+    const Shapes::Sphere3D sphere({1.5f, 0.5f, 0.0f}, 1.0f);
+
+    const Collision3D collision = hull/sphere;
+    CORRADE_COMPARE(collision.position(), Vector3(0.5f, 0.5f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Flipped */
+    const Collision3D flipped = sphere/hull;
+    CORRADE_COMPARE(flipped.position(), Vector3(1.0f, 0.5f, 0.0f));
+    CORRADE_COMPARE(flipped.separationNormal(), Vector3::xAxis());
+    CORRADE_COMPARE(flipped.separationDistance(), 0.5f);
+
+    /* No collision */
+    CORRADE_VERIFY(!(hull/Shapes::Sphere3D({2.5f, 0.5f, 0.0f}, 1.0f)));
+}
+
+void ConvexHullTest::collisionSphereDataDeep() {
+    /* Sphere center inside, collision data from expanding polytope */
+    const Shapes::ConvexHull3D hull = box({});
+    const Shapes::Sphere3D sphere({0.75f, 0.25f, -0.25f}, 0.5f);
+
+    const Collision3D collision = hull/sphere;
+    CORRADE_COMPARE(collision.position(), Vector3(0.25f, 0.25f, -0.25f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.75f);
+}
+
+void ConvexHullTest::collisionConvexHullData() {
+    const Shapes::ConvexHull3D hull = box({});
+    const Shapes::ConvexHull3D hull1 = box(Matrix4::translation({0.2f, 1.3f, 0.1f})*Matrix4::scaling(Vector3(0.5f)));
+
+    const Collision3D collision = hull1/hull;
+    CORRADE_COMPARE(collision.separationNormal(), Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.2f);
+    CORRADE_COMPARE(collision.position().y(), 1.0f);
+
+    /* Box in the same configuration */
+    const Collision3D boxCollision = Shapes::Box3D(Matrix4::translation({0.2f, 1.3f, 0.1f})*Matrix4::scaling(Vector3(0.5f)))/Shapes::Box3D(Matrix4());
+    CORRADE_COMPARE(collision.separationNormal(), boxCollision.separationNormal());
+    CORRADE_COMPARE(collision.separationDistance(), boxCollision.separationDistance());
+}
+
+void ConvexHullTest::collisionConvexHullData2D() {
+    const Shapes::ConvexHull2D triangle{{-1.0f, -1.0f}, {1.0f, -1.0f}, {0.0f, 1.0f}};
+    const Shapes::ConvexHull2D square{{-0.5f, -1.8f}, {0.5f, -1.8f}, {0.5f, -0.8f}, {-0.5f, -0.8f}};
+
+    const Collision2D collision = square/triangle;
+    CORRADE_COMPARE(collision.separationNormal(), -Vector2::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.2f);
+    CORRADE_COMPARE(collision.position().y(), -1.0f);
+}
+
+void ConvexHullTest::collisionBoxRandom() {
+    /* Compare the generic algorithm with separating axis test of boxes */
+    std::mt19937 random(7);
+    std::uniform_real_distribution<Float> position(-2.0f, 2.0f);
+    std::uniform_real_distribution<Float> size(0.2f, 1.5f);
+    std::uniform_real_distribution<Float> angle(0.0f, 360.0f);
+
+    for(std::size_t i = 0; i != 200; ++i) {
+        Matrix4 transformations[2];
+        for(Matrix4& transformation: transformations)
+            transformation = Matrix4::translation({position(random), position(random), position(random)})*
+                Matrix4::rotation(Deg(angle(random)), Vector3(position(random), position(random), position(random)).normalized())*
+                Matrix4::scaling({size(random), size(random), size(random)});
+
+        const Shapes::Box3D a(transformations[0]), b(transformations[1]);
+        const Collision3D expected = a/b;
+        const Collision3D actual = box(transformations[0])/box(transformations[1]);
+
+        /* Skip barely touching pairs */
+        if(Math::abs(expected.separationDistance()) < 1.0e-3f) continue;
+
+        CORRADE_COMPARE(box(transformations[0]) % box(transformations[1]), a % b);
+        CORRADE_COMPARE(bool(actual), bool(expected));
+        if(!expected) continue;
+
+        CORRADE_VERIFY(Math::abs(actual.separationDistance() - expected.separationDistance()) < 1.0e-3f);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shapes::Test::ConvexHullTest)
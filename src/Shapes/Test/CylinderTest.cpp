@@ -41,12 +41,18 @@ class CylinderTest: public TestSuite::Tester {
         void transformedAverageScaling();
         void collisionPoint();
         void collisionSphere();
+        void collisionPointData();
+        void collisionSphereData();
+        void collisionCylinder();
 };
 
 CylinderTest::CylinderTest() {
     addTests({&CylinderTest::transformed,
               &CylinderTest::collisionPoint,
-              &CylinderTest::collisionSphere});
+              &CylinderTest::collisionSphere,
+              &CylinderTest::collisionPointData,
+              &CylinderTest::collisionSphereData,
+              &CylinderTest::collisionCylinder});
 }
 
 void CylinderTest::transformed() {
@@ -80,6 +86,55 @@ void CylinderTest::collisionSphere() {
     VERIFY_NOT_COLLIDES(cylinder, sphere2);
 }
 
+void CylinderTest::collisionPointData() {
+    const Shapes::Cylinder3D cylinder({-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, 2.0f);
+    const Shapes::Point3D point({5.0f, 1.5f, 0.0f});
+
+    const Collision3D collision = cylinder/point;
+    CORRADE_COMPARE(collision.position(), point.position());
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Flipped */
+    CORRADE_COMPARE((point/cylinder).separationNormal(), Vector3::yAxis());
+
+    /* No collision */
+    CORRADE_VERIFY(!(cylinder/Shapes::Point3D({5.0f, 2.5f, 0.0f})));
+}
+
+void CylinderTest::collisionSphereData() {
+    const Shapes::Cylinder3D cylinder({-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, 2.0f);
+    const Shapes::Sphere3D sphere({5.0f, 1.5f, 0.0f}, 1.0f);
+
+    const Collision3D collision = cylinder/sphere;
+    CORRADE_COMPARE(collision.position(), Vector3(5.0f, 0.5f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 1.5f);
+
+    /* Flipped */
+    const Collision3D flipped = sphere/cylinder;
+    CORRADE_COMPARE(flipped.position(), Vector3(5.0f, 2.0f, 0.0f));
+    CORRADE_COMPARE(flipped.separationNormal(), Vector3::yAxis());
+    CORRADE_COMPARE(flipped.separationDistance(), 1.5f);
+
+    /* No collision */
+    CORRADE_VERIFY(!(cylinder/Shapes::Sphere3D({5.0f, 3.5f, 0.0f}, 1.0f)));
+}
+
+void CylinderTest::collisionCylinder() {
+    const Shapes::Cylinder3D cylinder({-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, 2.0f);
+    const Shapes::Cylinder3D cylinder1({0.0f, 3.0f, -1.0f}, {0.0f, 3.0f, 1.0f}, 1.5f);
+    const Shapes::Cylinder3D cylinder2({0.0f, 3.0f, -1.0f}, {0.0f, 3.0f, 1.0f}, 0.5f);
+
+    VERIFY_COLLIDES(cylinder, cylinder1);
+    VERIFY_NOT_COLLIDES(cylinder, cylinder2);
+
+    const Collision3D collision = cylinder/cylinder1;
+    CORRADE_COMPARE(collision.position(), Vector3(0.0f, 1.5f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shapes::Test::CylinderTest)
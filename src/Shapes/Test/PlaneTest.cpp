@@ -23,9 +23,13 @@
 */
 
 #include "Math/Matrix4.h"
+#include "Shapes/AxisAlignedBox.h"
+#include "Shapes/Box.h"
+#include "Shapes/Capsule.h"
 #include "Shapes/LineSegment.h"
 #include "Shapes/Point.h"
 #include "Shapes/Plane.h"
+#include "Shapes/Sphere.h"
 
 #include "ShapeTestBase.h"
 
@@ -38,12 +42,20 @@ class PlaneTest: public TestSuite::Tester {
         void transformed();
         void collisionLine();
         void collisionLineSegment();
+        void collisionSphere();
+        void collisionCapsule();
+        void collisionAxisAlignedBox();
+        void collisionBox();
 };
 
 PlaneTest::PlaneTest() {
     addTests({&PlaneTest::transformed,
               &PlaneTest::collisionLine,
-              &PlaneTest::collisionLineSegment});
+              &PlaneTest::collisionLineSegment,
+              &PlaneTest::collisionSphere,
+              &PlaneTest::collisionCapsule,
+              &PlaneTest::collisionAxisAlignedBox,
+              &PlaneTest::collisionBox});
 }
 
 void PlaneTest::transformed() {
@@ -77,6 +89,70 @@ void PlaneTest::collisionLineSegment() {
     VERIFY_NOT_COLLIDES(plane, line3);
 }
 
+void PlaneTest::collisionSphere() {
+    /* Normal doesn't need to be normalized */
+    const Shapes::Plane plane({}, {0.0f, 2.0f, 0.0f});
+    const Shapes::Sphere3D sphere({0.0f, 0.5f, 0.0f}, 1.0f);
+    const Shapes::Sphere3D sphere1({0.0f, 1.5f, 0.0f}, 1.0f);
+
+    VERIFY_COLLIDES(plane, sphere);
+    VERIFY_NOT_COLLIDES(plane, sphere1);
+
+    /* Plane is moved to the nearer side */
+    const Collision3D collision = plane/sphere;
+    CORRADE_COMPARE(collision.position(), Vector3(0.0f, -0.5f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Flipped */
+    const Collision3D flipped = sphere/plane;
+    CORRADE_COMPARE(flipped.position(), Vector3());
+    CORRADE_COMPARE(flipped.separationNormal(), Vector3::yAxis());
+    CORRADE_COMPARE(flipped.separationDistance(), 0.5f);
+}
+
+void PlaneTest::collisionCapsule() {
+    const Shapes::Plane plane({}, Vector3::yAxis());
+    const Shapes::Capsule3D capsule({0.0f, 0.25f, 0.0f}, {0.0f, 3.0f, 0.0f}, 0.5f);
+    const Shapes::Capsule3D capsule1({0.0f, 0.75f, 0.0f}, {0.0f, 3.0f, 0.0f}, 0.5f);
+
+    VERIFY_COLLIDES(plane, capsule);
+    VERIFY_NOT_COLLIDES(plane, capsule1);
+
+    const Collision3D collision = plane/capsule;
+    CORRADE_COMPARE(collision.position(), Vector3(0.0f, -0.25f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.25f);
+}
+
+void PlaneTest::collisionAxisAlignedBox() {
+    const Shapes::Plane plane({}, Vector3::yAxis());
+    const Shapes::AxisAlignedBox3D box({-1.0f, -0.2f, -1.0f}, {1.0f, 3.0f, 1.0f});
+    const Shapes::AxisAlignedBox3D box1({-1.0f, -3.0f, -1.0f}, {1.0f, -0.5f, 1.0f});
+
+    VERIFY_COLLIDES(plane, box);
+    VERIFY_NOT_COLLIDES(plane, box1);
+
+    const Collision3D collision = plane/box;
+    CORRADE_COMPARE(collision.position(), Vector3(0.0f, -0.2f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.2f);
+}
+
+void PlaneTest::collisionBox() {
+    const Shapes::Plane plane({}, Vector3::yAxis());
+    const Shapes::Box3D box(Matrix4::translation({0.0f, -0.5f, 0.0f})*Matrix4::rotationY(Deg(45.0f)));
+    const Shapes::Box3D box1(Matrix4::translation({0.0f, -1.5f, 0.0f})*Matrix4::rotationY(Deg(45.0f)));
+
+    VERIFY_COLLIDES(plane, box);
+    VERIFY_NOT_COLLIDES(plane, box1);
+
+    const Collision3D collision = plane/box;
+    CORRADE_COMPARE(collision.position(), Vector3(0.0f, 0.5f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shapes::Test::PlaneTest)
@@ -0,0 +1,303 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <memory>
+#include <vector>
+#include <TestSuite/Tester.h>
+
+#include "Math/Functions.h"
+#include "Shapes/Box.h"
+#include "Shapes/RigidBodyWorld.h"
+#include "Shapes/Shape.h"
+#include "Shapes/ShapeGroup.h"
+#include "Shapes/Sphere.h"
+#include "SceneGraph/MatrixTransformation3D.h"
+#include "SceneGraph/Scene.h"
+
+namespace Magnum { namespace Shapes { namespace Test {
+
+class RigidBodyWorldTest: public TestSuite::Tester {
+    public:
+        RigidBodyWorldTest();
+
+        void addBody();
+        void step();
+        void fall();
+        void kinematic();
+        void rest();
+        void stack();
+        void wakeUp();
+        void removeBody();
+        void threads();
+};
+
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+
+RigidBodyWorldTest::RigidBodyWorldTest() {
+    addTests({&RigidBodyWorldTest::addBody,
+              &RigidBodyWorldTest::step,
+              &RigidBodyWorldTest::fall,
+              &RigidBodyWorldTest::kinematic,
+              &RigidBodyWorldTest::rest,
+              &RigidBodyWorldTest::stack,
+              &RigidBodyWorldTest::wakeUp,
+              &RigidBodyWorldTest::removeBody,
+              &RigidBodyWorldTest::threads});
+}
+
+namespace {
+    /* Ground with top face at y = 0 */
+    Object3D* addGround(Scene3D& scene, ShapeGroup3D& shapes) {
+        Object3D* ground = new Object3D(&scene);
+        new Shape<Box3D>(*ground, Matrix4::translation({0.0f, -1.0f, 0.0f})*Matrix4::scaling({20.0f, 1.0f, 20.0f}), &shapes);
+        return ground;
+    }
+
+    /* Unit cube with unit mass */
+    UnsignedInt addCube(Scene3D& scene, ShapeGroup3D& shapes, RigidBodyWorld& world, const Vector3& position) {
+        Object3D* object = new Object3D(&scene);
+        object->translate(position);
+        auto shape = new Shape<Box3D>(*object, Matrix4::scaling(Vector3(0.5f)), &shapes);
+        return world.addBody(*shape, *object, 1.0f, Vector3(1.0f/6.0f));
+    }
+}
+
+void RigidBodyWorldTest::addBody() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+    RigidBodyWorld world(shapes);
+
+    Object3D object(&scene);
+    object.rotateY(Deg(90.0f))
+        .translate({1.0f, 2.0f, 3.0f});
+    Shape<Sphere3D> shape(object, {{}, 1.0f}, &shapes);
+
+    CORRADE_COMPARE(world.addBody(shape, object, 2.0f, Vector3(0.8f)), 0);
+    CORRADE_COMPARE(world.bodyCount(), 1);
+    CORRADE_COMPARE(world.position(0), Vector3(1.0f, 2.0f, 3.0f));
+    CORRADE_COMPARE(world.orientation(0), Quaternion::rotation(Deg(90.0f), Vector3::yAxis()));
+    CORRADE_VERIFY(!world.isSleeping(0));
+
+    /* Transformation is updated from the body */
+    world.setPosition(0, {-1.0f, 0.0f, 0.0f});
+    CORRADE_COMPARE(object.transformation().translation(), Vector3(-1.0f, 0.0f, 0.0f));
+    CORRADE_COMPARE(object.transformation().rotation(), Matrix4::rotationY(Deg(90.0f)).rotation());
+}
+
+void RigidBodyWorldTest::step() {
+    ShapeGroup3D shapes;
+    RigidBodyWorld world(shapes, 0.1f);
+    world.setMaxSteps(5);
+
+    /* Remainder is kept for next call */
+    CORRADE_COMPARE(world.step(0.25f), 2);
+    CORRADE_COMPARE(world.step(0.06f), 1);
+    CORRADE_COMPARE(world.step(0.05f), 0);
+
+    /* Can't catch up, the rest is dropped */
+    CORRADE_COMPARE(world.step(1.0f), 5);
+    CORRADE_COMPARE(world.step(0.0f), 0);
+}
+
+void RigidBodyWorldTest::fall() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+    RigidBodyWorld world(shapes, 0.01f);
+
+    Object3D object(&scene);
+    object.translate({0.0f, 10.0f, 0.0f});
+    Shape<Sphere3D> shape(object, {{}, 1.0f}, &shapes);
+    world.addBody(shape, object, 1.0f, Vector3(0.4f));
+    world.setAngularVelocity(0, {0.0f, 1.0f, 0.0f});
+
+    /* Semi-implicit Euler: velocity is integrated first */
+    for(std::size_t i = 0; i != 100; ++i) world.step(0.01f);
+    CORRADE_COMPARE(world.linearVelocity(0), Vector3(0.0f, -9.81f, 0.0f));
+    CORRADE_VERIFY(Math::abs(world.position(0).y() - (10.0f - 9.81f*0.01f*0.01f*100*101/2)) < 1.0e-3f);
+    CORRADE_COMPARE(object.transformation().translation(), world.position(0));
+
+    /* Rotates about Y axis */
+    CORRADE_VERIFY(Math::abs(Float(Rad(world.orientation(0).angle())) - 1.0f) < 1.0e-3f);
+    CORRADE_VERIFY(Math::abs(world.orientation(0).axis().y() - 1.0f) < 1.0e-3f);
+}
+
+void RigidBodyWorldTest::kinematic() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+    RigidBodyWorld world(shapes, 0.01f);
+
+    Object3D object(&scene);
+    Shape<Box3D> shape(object, Matrix4::scaling(Vector3(0.5f)), &shapes);
+    world.addBody(shape, object, 0.0f, {});
+    world.setLinearVelocity(0, {1.0f, 0.0f, 0.0f});
+
+    /* Not affected by gravity */
+    for(std::size_t i = 0; i != 50; ++i) world.step(0.01f);
+    CORRADE_VERIFY(Math::abs(world.position(0).x() - 0.5f) < 1.0e-4f);
+    CORRADE_COMPARE(world.position(0).y(), 0.0f);
+    CORRADE_COMPARE(world.linearVelocity(0), Vector3(1.0f, 0.0f, 0.0f));
+
+    /* Applying impulse has no effect */
+    world.applyImpulse(0, {0.0f, 1.0f, 0.0f}, {});
+    CORRADE_COMPARE(world.linearVelocity(0), Vector3(1.0f, 0.0f, 0.0f));
+}
+
+void RigidBodyWorldTest::rest() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+    RigidBodyWorld world(shapes);
+    std::unique_ptr<Object3D> ground(addGround(scene, shapes));
+
+    const UnsignedInt cube = addCube(scene, shapes, world, {0.0f, 2.0f, 0.0f});
+    for(std::size_t i = 0; i != 180; ++i) world.step(1.0f/60.0f);
+
+    /* The cube lies on the ground and sleeps */
+    CORRADE_VERIFY(Math::abs(world.position(cube).y() - 0.5f) < 0.02f);
+    CORRADE_VERIFY(Math::abs(world.position(cube).x()) < 1.0e-3f);
+    CORRADE_VERIFY(world.isSleeping(cube));
+    CORRADE_COMPARE(world.linearVelocity(cube), Vector3());
+
+    /* Sleeping body doesn't move */
+    const Vector3 position = world.position(cube);
+    world.step(1.0f);
+    CORRADE_COMPARE(world.position(cube), position);
+}
+
+void RigidBodyWorldTest::stack() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+    RigidBodyWorld world(shapes);
+    world.setIterations(20);
+    std::unique_ptr<Object3D> ground(addGround(scene, shapes));
+
+    for(std::size_t i = 0; i != 5; ++i)
+        addCube(scene, shapes, world, {0.0f, 0.5f + i*1.0f, 0.0f});
+
+    for(std::size_t i = 0; i != 300; ++i) world.step(1.0f/60.0f);
+
+    /* The stack doesn't collapse */
+    for(UnsignedInt i = 0; i != 5; ++i) {
+        CORRADE_VERIFY(Math::abs(world.position(i).y() - (0.5f + i*1.0f)) < 0.05f);
+        CORRADE_VERIFY(Math::abs(world.position(i).x()) < 0.01f);
+        CORRADE_VERIFY(Math::abs(world.position(i).z()) < 0.01f);
+        CORRADE_VERIFY(world.isSleeping(i));
+    }
+}
+
+void RigidBodyWorldTest::wakeUp() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+    RigidBodyWorld world(shapes);
+    std::unique_ptr<Object3D> ground(addGround(scene, shapes));
+
+    const UnsignedInt bottom = addCube(scene, shapes, world, {0.0f, 0.5f, 0.0f});
+    const UnsignedInt top = addCube(scene, shapes, world, {0.0f, 1.5f, 0.0f});
+    const UnsignedInt other = addCube(scene, shapes, world, {5.0f, 0.5f, 0.0f});
+    for(std::size_t i = 0; i != 120; ++i) world.step(1.0f/60.0f);
+    CORRADE_VERIFY(world.isSleeping(bottom));
+    CORRADE_VERIFY(world.isSleeping(top));
+    CORRADE_VERIFY(world.isSleeping(other));
+
+    /* Waking up the top cube wakes up the whole island, but not the other
+       cube */
+    world.wakeUp(top);
+    world.step(1.0f/60.0f);
+    CORRADE_VERIFY(!world.isSleeping(bottom));
+    CORRADE_VERIFY(!world.isSleeping(top));
+    CORRADE_VERIFY(world.isSleeping(other));
+
+    /* Body falling on sleeping one wakes it up */
+    const UnsignedInt falling = addCube(scene, shapes, world, {5.0f, 3.0f, 0.0f});
+    for(std::size_t i = 0; i != 50 && world.isSleeping(other); ++i)
+        world.step(1.0f/60.0f);
+    CORRADE_VERIFY(!world.isSleeping(other));
+    CORRADE_VERIFY(world.position(falling).y() < 2.0f);
+}
+
+void RigidBodyWorldTest::removeBody() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+    RigidBodyWorld world(shapes);
+    std::unique_ptr<Object3D> ground(addGround(scene, shapes));
+
+    std::unique_ptr<Object3D> bottom(new Object3D(&scene));
+    bottom->translate({0.0f, 0.5f, 0.0f});
+    auto bottomShape = new Shape<Box3D>(*bottom, Matrix4::scaling(Vector3(0.5f)), &shapes);
+    CORRADE_COMPARE(world.addBody(*bottomShape, *bottom, 1.0f, Vector3(1.0f/6.0f)), 0);
+    const UnsignedInt top = addCube(scene, shapes, world, {0.0f, 1.5f, 0.0f});
+    addCube(scene, shapes, world, {5.0f, 0.5f, 0.0f});
+    for(std::size_t i = 0; i != 120; ++i) world.step(1.0f/60.0f);
+    CORRADE_VERIFY(world.isSleeping(top));
+
+    /* The last body is moved in place of the removed one, the top cube lost
+       its support and is woken up */
+    world.removeBody(0);
+    bottom.reset();
+    CORRADE_COMPARE(world.bodyCount(), 2);
+    CORRADE_VERIFY(!world.isSleeping(top));
+    CORRADE_VERIFY(world.isSleeping(0));
+    CORRADE_VERIFY(Math::abs(world.position(0).x() - 5.0f) < 0.01f);
+
+    /* The top cube falls on the ground */
+    for(std::size_t i = 0; i != 120; ++i) world.step(1.0f/60.0f);
+    CORRADE_VERIFY(Math::abs(world.position(top).y() - 0.5f) < 0.02f);
+    CORRADE_VERIFY(Math::abs(world.position(top).x()) < 0.01f);
+    CORRADE_VERIFY(world.isSleeping(0));
+}
+
+void RigidBodyWorldTest::threads() {
+    /* Several separate piles of tilted cubes and spheres, simulated with
+       one and four threads */
+    Vector3 positions[2][12];
+    for(UnsignedInt run = 0; run != 2; ++run) {
+        Scene3D scene;
+        ShapeGroup3D shapes;
+        RigidBodyWorld world(shapes);
+        world.setThreadCount(run ? 4 : 1);
+        std::unique_ptr<Object3D> ground(addGround(scene, shapes));
+
+        std::vector<std::unique_ptr<Object3D>> objects;
+        for(UnsignedInt i = 0; i != 12; ++i) {
+            objects.emplace_back(new Object3D(&scene));
+            objects.back()->rotate(Deg(10.0f*i), Vector3(1.0f, 0.0f, 1.0f).normalized())
+                .translate({(i % 4)*3.0f, 1.0f + (i/4)*1.2f, 0.1f*(i/4)});
+            AbstractShape3D* shape;
+            if(i % 2) shape = new Shape<Sphere3D>(*objects.back(), {{}, 0.5f}, &shapes);
+            else shape = new Shape<Box3D>(*objects.back(), Matrix4::scaling(Vector3(0.5f)), &shapes);
+            world.addBody(*shape, *objects.back(), 1.0f, Vector3(1.0f/6.0f));
+        }
+
+        for(std::size_t i = 0; i != 60; ++i) world.step(1.0f/60.0f);
+        for(UnsignedInt i = 0; i != 12; ++i) positions[run][i] = world.position(i);
+    }
+
+    /* The results are exactly the same */
+    for(UnsignedInt i = 0; i != 12; ++i)
+        CORRADE_VERIFY(positions[0][i] == positions[1][i]);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shapes::Test::RigidBodyWorldTest)
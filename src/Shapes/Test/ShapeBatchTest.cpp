@@ -0,0 +1,168 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <random>
+#include <TestSuite/Tester.h>
+
+#include "Magnum.h"
+#include "Shapes/ShapeBatch.h"
+
+namespace Magnum { namespace Shapes { namespace Test {
+
+class ShapeBatchTest: public TestSuite::Tester {
+    public:
+        ShapeBatchTest();
+
+        void construct();
+        void clear();
+
+        void pointSphere();
+        void pointAxisAlignedBox();
+        void spherePoint();
+        void sphereSphere();
+        void axisAlignedBoxPoint();
+
+    private:
+        template<class T, class U, class GenerateT, class GenerateU> void verifyBatch(GenerateT generateT, GenerateU generateU);
+};
+
+ShapeBatchTest::ShapeBatchTest() {
+    addTests({&ShapeBatchTest::construct,
+              &ShapeBatchTest::clear,
+
+              &ShapeBatchTest::pointSphere,
+              &ShapeBatchTest::pointAxisAlignedBox,
+              &ShapeBatchTest::spherePoint,
+              &ShapeBatchTest::sphereSphere,
+              &ShapeBatchTest::axisAlignedBoxPoint});
+}
+
+void ShapeBatchTest::construct() {
+    ShapeBatch<Shapes::Sphere3D> batch;
+    CORRADE_VERIFY(batch.isEmpty());
+
+    batch.add({{1.0f, 2.0f, 3.0f}, 0.5f})
+         .add({{-4.0f, 5.0f, 6.0f}, 1.5f});
+    CORRADE_VERIFY(!batch.isEmpty());
+    CORRADE_COMPARE(batch.size(), 2);
+
+    /* The data are stored as structure of arrays */
+    CORRADE_COMPARE(ShapeBatch<Shapes::Sphere3D>::ComponentCount, 4);
+    CORRADE_COMPARE(batch.component(0)[1], -4.0f);
+    CORRADE_COMPARE(batch.component(2)[0], 3.0f);
+    CORRADE_COMPARE(batch.component(3)[1], 1.5f);
+
+    CORRADE_COMPARE(batch[1].position(), Vector3(-4.0f, 5.0f, 6.0f));
+    CORRADE_COMPARE(batch[1].radius(), 1.5f);
+
+    ShapeBatch<Shapes::AxisAlignedBox2D> boxes;
+    boxes.add({{1.0f, 2.0f}, {3.0f, 4.0f}});
+    CORRADE_COMPARE(ShapeBatch<Shapes::AxisAlignedBox2D>::ComponentCount, 4);
+    CORRADE_COMPARE(boxes.component(1)[0], 2.0f);
+    CORRADE_COMPARE(boxes.component(2)[0], 3.0f);
+    CORRADE_COMPARE(boxes[0].max(), Vector2(3.0f, 4.0f));
+}
+
+void ShapeBatchTest::clear() {
+    ShapeBatch<Shapes::Point2D> batch;
+    batch.add({{1.0f, 2.0f}})
+         .add({{3.0f, 4.0f}});
+    CORRADE_COMPARE(batch.size(), 2);
+
+    batch.clear();
+    CORRADE_VERIFY(batch.isEmpty());
+}
+
+/* Compare batched result with scalar operator% for random shapes */
+template<class T, class U, class GenerateT, class GenerateU> void ShapeBatchTest::verifyBatch(GenerateT generateT, GenerateU generateU) {
+    std::mt19937 random(5);
+    ShapeBatch<U> batch;
+    std::vector<U> shapes;
+    for(std::size_t i = 0; i != 1001; ++i) {
+        shapes.push_back(generateU(random));
+        batch.add(shapes.back());
+    }
+
+    std::vector<UnsignedByte> result(batch.size());
+    std::size_t count = 0;
+    for(std::size_t i = 0; i != 10; ++i) {
+        const T shape = generateT(random);
+        collides(shape, batch, result.data());
+
+        for(std::size_t j = 0; j != shapes.size(); ++j) {
+            CORRADE_COMPARE(bool(result[j]), shape % shapes[j]);
+            count += result[j];
+        }
+    }
+
+    /* Verify that there was actually something to compare */
+    CORRADE_VERIFY(count);
+}
+
+namespace {
+    std::uniform_real_distribution<Float> coordinate(-5.0f, 5.0f);
+    std::uniform_real_distribution<Float> size(0.5f, 2.0f);
+
+    Shapes::Point3D point(std::mt19937& random) {
+        return {{coordinate(random), coordinate(random), coordinate(random)}};
+    }
+
+    Shapes::Sphere3D sphere(std::mt19937& random) {
+        return {{coordinate(random), coordinate(random), coordinate(random)}, size(random)};
+    }
+
+    Shapes::AxisAlignedBox3D box(std::mt19937& random) {
+        const Vector3 min(coordinate(random), coordinate(random), coordinate(random));
+        return {min, min + Vector3(size(random), size(random), size(random))};
+    }
+
+    Shapes::Sphere2D sphere2D(std::mt19937& random) {
+        return {{coordinate(random), coordinate(random)}, size(random)};
+    }
+}
+
+void ShapeBatchTest::pointSphere() {
+    verifyBatch<Shapes::Point3D, Shapes::Sphere3D>(point, sphere);
+}
+
+void ShapeBatchTest::pointAxisAlignedBox() {
+    verifyBatch<Shapes::Point3D, Shapes::AxisAlignedBox3D>(point, box);
+}
+
+void ShapeBatchTest::spherePoint() {
+    verifyBatch<Shapes::Sphere3D, Shapes::Point3D>(sphere, point);
+}
+
+void ShapeBatchTest::sphereSphere() {
+    verifyBatch<Shapes::Sphere3D, Shapes::Sphere3D>(sphere, sphere);
+    verifyBatch<Shapes::Sphere2D, Shapes::Sphere2D>(sphere2D, sphere2D);
+}
+
+void ShapeBatchTest::axisAlignedBoxPoint() {
+    verifyBatch<Shapes::AxisAlignedBox3D, Shapes::Point3D>(box, point);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shapes::Test::ShapeBatchTest)
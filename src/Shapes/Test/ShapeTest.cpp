@@ -22,12 +22,24 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <random>
 #include <TestSuite/Tester.h>
 
+#include "Math/Functions.h"
 #include "Shapes/ShapeGroup.h"
 #include "Shapes/Shape.h"
+#include "Shapes/AxisAlignedBox.h"
+#include "Shapes/Box.h"
+#include "Shapes/Capsule.h"
+#include "Shapes/ConvexHull.h"
+#include "Shapes/Cylinder.h"
+#include "Shapes/Plane.h"
 #include "Shapes/Point.h"
 #include "Shapes/Composition.h"
+#include "Shapes/LineSegment.h"
 #include "Shapes/Sphere.h"
 #include "SceneGraph/MatrixTransformation2D.h"
 #include "SceneGraph/MatrixTransformation3D.h"
@@ -41,6 +53,25 @@ class ShapeTest: public TestSuite::Tester {
 
         void clean();
         void firstCollision();
+        void collisions();
+        void collisionsAddRemove();
+        void collisionsUnbounded();
+        void collisionsMoving();
+        void collisionsShape();
+        void collisionsShapeBatched();
+        void collisionsConvex();
+        void collisionData();
+        void collisionDataBulk();
+        void raycast();
+        void raycastAll();
+        void sphereCast();
+        void sphereCastConvexHull();
+        void raycastMoving();
+        void raycastAddRemove();
+        void timesOfImpact();
+        void timesOfImpact2D();
+        void timesOfImpactConvexHull();
+        void sweptCollisions();
         void shapeGroup();
 };
 
@@ -52,6 +83,25 @@ typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
 ShapeTest::ShapeTest() {
     addTests({&ShapeTest::clean,
               &ShapeTest::firstCollision,
+              &ShapeTest::collisions,
+              &ShapeTest::collisionsAddRemove,
+              &ShapeTest::collisionsUnbounded,
+              &ShapeTest::collisionsMoving,
+              &ShapeTest::collisionsShape,
+              &ShapeTest::collisionsShapeBatched,
+              &ShapeTest::collisionsConvex,
+              &ShapeTest::collisionData,
+              &ShapeTest::collisionDataBulk,
+              &ShapeTest::raycast,
+              &ShapeTest::raycastAll,
+              &ShapeTest::sphereCast,
+              &ShapeTest::sphereCastConvexHull,
+              &ShapeTest::raycastMoving,
+              &ShapeTest::raycastAddRemove,
+              &ShapeTest::timesOfImpact,
+              &ShapeTest::timesOfImpact2D,
+              &ShapeTest::timesOfImpactConvexHull,
+              &ShapeTest::sweptCollisions,
               &ShapeTest::shapeGroup});
 }
 
@@ -123,6 +173,839 @@ void ShapeTest::firstCollision() {
     CORRADE_VERIFY(!shapes.isDirty());
 }
 
+void ShapeTest::collisions() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    Object3D a(&scene);
+    Shape<Shapes::Sphere3D> aShape(a, {{1.0f, -2.0f, 3.0f}, 1.5f}, &shapes);
+
+    Object3D b(&scene);
+    Shape<Shapes::Point3D> bShape(b, {{3.0f, -2.0f, 3.0f}}, &shapes);
+
+    Object3D c(&scene);
+    Shape<Shapes::Point3D> cShape(c, {{1.0f, -2.0f, 4.0f}}, &shapes);
+
+    /* Empty composition doesn't collide with anything */
+    Object3D d(&scene);
+    Shape<Shapes::Composition3D> dShape(d, &shapes);
+
+    /* The point is inside sphere bounds, but outside the sphere */
+    Object3D e(&scene);
+    Shape<Shapes::Point3D> eShape(e, {{2.2f, -0.8f, 3.0f}}, &shapes);
+
+    auto collisions = shapes.collisions();
+    CORRADE_VERIFY(!shapes.isDirty());
+    CORRADE_COMPARE(collisions.size(), 1);
+    CORRADE_VERIFY((collisions[0] == std::make_pair<AbstractShape3D*, AbstractShape3D*>(&aShape, &cShape) ||
+                    collisions[0] == std::make_pair<AbstractShape3D*, AbstractShape3D*>(&cShape, &aShape)));
+
+    /* Move the other point into sphere, the first one out of it */
+    b.translate(Vector3::xAxis(-1.0f));
+    c.translate(Vector3::zAxis(1.0f));
+    collisions = shapes.collisions();
+    CORRADE_COMPARE(collisions.size(), 1);
+    CORRADE_VERIFY((collisions[0] == std::make_pair<AbstractShape3D*, AbstractShape3D*>(&aShape, &bShape) ||
+                    collisions[0] == std::make_pair<AbstractShape3D*, AbstractShape3D*>(&bShape, &aShape)));
+}
+
+void ShapeTest::collisionsAddRemove() {
+    Scene2D scene;
+    ShapeGroup2D shapes;
+
+    Object2D a(&scene);
+    Shape<Shapes::Sphere2D> aShape(a, {{}, 1.0f}, &shapes);
+
+    Object2D b(&scene);
+    Shape<Shapes::Point2D> bShape(b, {{0.5f, 0.0f}}, &shapes);
+    CORRADE_COMPARE(shapes.collisions().size(), 1);
+
+    /* Shape destroyed, the endpoint list is rebuilt */
+    {
+        Object2D c(&scene);
+        Shape<Shapes::Point2D> cShape(c, {{0.0f, 0.5f}}, &shapes);
+        CORRADE_COMPARE(shapes.collisions().size(), 2);
+    }
+    CORRADE_COMPARE(shapes.collisions().size(), 1);
+
+    /* Shape removed from the group and other added */
+    Object2D c(&scene);
+    Shape<Shapes::Point2D> cShape(c, {{0.0f, -0.5f}});
+    shapes.remove(bShape);
+    shapes.add(cShape);
+    auto collisions = shapes.collisions();
+    CORRADE_COMPARE(collisions.size(), 1);
+    CORRADE_VERIFY(collisions[0].first == &cShape || collisions[0].second == &cShape);
+}
+
+void ShapeTest::collisionsUnbounded() {
+    Scene2D scene;
+    ShapeGroup2D shapes;
+
+    Object2D a(&scene);
+    Shape<Shapes::Line2D> aShape(a, {{-1.0f, -1.0f}, {1.0f, 1.0f}}, &shapes);
+
+    Object2D b(&scene);
+    Shape<Shapes::Sphere2D> bShape(b, {{100.0f, 100.5f}, 1.0f}, &shapes);
+
+    Object2D c(&scene);
+    Shape<Shapes::Sphere2D> cShape(c, {{-100.0f, 100.5f}, 1.0f}, &shapes);
+
+    /* Only the sphere on the line collides with it */
+    auto collisions = shapes.collisions();
+    CORRADE_COMPARE(collisions.size(), 1);
+    CORRADE_VERIFY(collisions[0].first == &bShape || collisions[0].second == &bShape);
+}
+
+void ShapeTest::collisionsMoving() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    std::mt19937 random(1);
+    std::uniform_real_distribution<Float> position(-10.0f, 10.0f);
+    std::uniform_real_distribution<Float> step(-0.5f, 0.5f);
+
+    std::vector<std::unique_ptr<Object3D>> objects;
+    for(std::size_t i = 0; i != 200; ++i) {
+        objects.emplace_back(new Object3D(&scene));
+        objects.back()->translate({position(random), position(random), position(random)});
+        if(i % 4) new Shape<Shapes::Sphere3D>(*objects.back(), {{}, 0.5f + (i % 3)*0.5f}, &shapes);
+        else new Shape<Shapes::AxisAlignedBox3D>(*objects.back(), {Vector3(-0.5f), Vector3(0.5f)}, &shapes);
+    }
+
+    /* Compare with naive all-pairs test over multiple frames */
+    for(std::size_t frame = 0; frame != 10; ++frame) {
+        for(auto& object: objects)
+            object->translate({step(random), step(random), step(random)});
+
+        std::vector<std::pair<AbstractShape3D*, AbstractShape3D*>> collisions = shapes.collisions();
+        for(auto& collision: collisions)
+            if(collision.first > collision.second) std::swap(collision.first, collision.second);
+        std::sort(collisions.begin(), collisions.end());
+
+        std::vector<std::pair<AbstractShape3D*, AbstractShape3D*>> expected;
+        for(std::size_t i = 0; i != shapes.size(); ++i) for(std::size_t j = i + 1; j != shapes.size(); ++j) {
+            if(!shapes[i].collides(shapes[j])) continue;
+            AbstractShape3D* a = &shapes[i];
+            AbstractShape3D* b = &shapes[j];
+            expected.emplace_back(std::min(a, b), std::max(a, b));
+        }
+        std::sort(expected.begin(), expected.end());
+
+        CORRADE_VERIFY(!expected.empty());
+        CORRADE_VERIFY(collisions == expected);
+    }
+}
+
+void ShapeTest::collisionsShape() {
+    Scene2D scene;
+    ShapeGroup2D shapes;
+
+    Object2D a(&scene);
+    Shape<Shapes::Sphere2D> aShape(a, {{}, 1.0f}, &shapes);
+
+    Object2D b(&scene);
+    Shape<Shapes::Point2D> bShape(b, {{0.5f, 0.0f}}, &shapes);
+
+    Object2D c(&scene);
+    Shape<Shapes::Capsule2D> cShape(c, {{-1.0f, 0.0f}, {1.0f, 0.0f}, 0.25f}, &shapes);
+
+    Object2D d(&scene);
+    Shape<Shapes::Point2D> dShape(d, {{0.0f, 0.5f}}, &shapes);
+
+    /* The shape itself is not included */
+    CORRADE_VERIFY(shapes.collisions(aShape) == (std::vector<AbstractShape2D*>{&bShape, &cShape, &dShape}));
+    CORRADE_VERIFY(shapes.collisions(bShape) == (std::vector<AbstractShape2D*>{&aShape, &cShape}));
+    CORRADE_VERIFY(shapes.firstCollision(bShape) == &aShape);
+
+    /* Batches are updated after moving */
+    b.translate(Vector2::yAxis(3.0f));
+    CORRADE_VERIFY(shapes.collisions(aShape) == (std::vector<AbstractShape2D*>{&cShape, &dShape}));
+    CORRADE_VERIFY(shapes.collisions(bShape).empty());
+    CORRADE_VERIFY(!shapes.firstCollision(bShape));
+
+    /* ... and after changing the shape */
+    aShape.setShape({{}, 5.0f});
+    CORRADE_VERIFY(shapes.collisions(aShape) == (std::vector<AbstractShape2D*>{&bShape, &cShape, &dShape}));
+
+    /* Shape not in the group */
+    Object2D e(&scene);
+    Shape<Shapes::Point2D> eShape(e, {{-0.9f, 0.0f}});
+    CORRADE_VERIFY(shapes.collisions(eShape) == (std::vector<AbstractShape2D*>{&aShape, &cShape}));
+}
+
+void ShapeTest::collisionsShapeBatched() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    std::mt19937 random(3);
+    std::uniform_real_distribution<Float> position(-5.0f, 5.0f);
+
+    std::vector<std::unique_ptr<Object3D>> objects;
+    for(std::size_t i = 0; i != 100; ++i) {
+        objects.emplace_back(new Object3D(&scene));
+        objects.back()->translate({position(random), position(random), position(random)});
+        switch(i % 4) {
+            case 0: new Shape<Shapes::Sphere3D>(*objects.back(), {{}, 1.0f}, &shapes); break;
+            case 1: new Shape<Shapes::Point3D>(*objects.back(), {{}}, &shapes); break;
+            case 2: new Shape<Shapes::AxisAlignedBox3D>(*objects.back(), {Vector3(-1.0f), Vector3(1.0f)}, &shapes); break;
+            case 3: new Shape<Shapes::Capsule3D>(*objects.back(), {Vector3(-1.0f), Vector3(1.0f), 0.5f}, &shapes); break;
+        }
+    }
+
+    /* Batched query gives the same result as testing the shapes one by one */
+    shapes.setClean();
+    std::size_t count = 0;
+    for(std::size_t i = 0; i != shapes.size(); ++i) {
+        std::vector<AbstractShape3D*> expected;
+        for(std::size_t j = 0; j != shapes.size(); ++j)
+            if(i != j && shapes[j].collides(shapes[i])) expected.push_back(&shapes[j]);
+
+        CORRADE_VERIFY(shapes.collisions(shapes[i]) == expected);
+        CORRADE_VERIFY(shapes.firstCollision(shapes[i]) == (expected.empty() ? nullptr : expected.front()));
+        count += expected.size();
+    }
+    CORRADE_VERIFY(count);
+}
+
+void ShapeTest::collisionsConvex() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    /* Tetrahedrons and segments don't have dedicated collision tests with
+       anything, they are tested with GJK */
+    std::vector<std::unique_ptr<Object3D>> objects;
+    std::vector<AbstractShape3D*> shapeList;
+    std::vector<std::unique_ptr<AbstractShape3D>> features;
+    std::mt19937 random(5);
+    std::uniform_real_distribution<Float> position(-3.0f, 3.0f);
+    for(std::size_t i = 0; i != 30; ++i) {
+        objects.emplace_back(new Object3D(&scene));
+        objects.back()->translate({position(random), position(random), position(random)});
+        switch(i % 3) {
+            case 0: features.emplace_back(new Shape<Shapes::ConvexHull3D>(*objects.back(), {{0.0f, 0.0f, 1.0f}, {-1.0f, -1.0f, -1.0f}, {1.0f, -1.0f, -1.0f}, {0.0f, 1.0f, -1.0f}}, &shapes)); break;
+            case 1: features.emplace_back(new Shape<Shapes::LineSegment3D>(*objects.back(), {{-1.0f, 0.5f, 0.0f}, {1.0f, -0.5f, 0.5f}}, &shapes)); break;
+            case 2: features.emplace_back(new Shape<Shapes::Box3D>(*objects.back(), {Matrix4::rotation(Deg(30.0f), Vector3::yAxis())}, &shapes)); break;
+        }
+    }
+
+    /* Compare with testing all pairs while moving the objects, the second
+       and later queries start with separating axes from the previous one */
+    std::uniform_real_distribution<Float> movement(-0.2f, 0.2f);
+    for(std::size_t frame = 0; frame != 10; ++frame) {
+        for(const auto& object: objects)
+            object->translate({movement(random), movement(random), movement(random)});
+
+        auto collisions = shapes.collisions();
+        for(auto& collision: collisions)
+            if(collision.second < collision.first) std::swap(collision.first, collision.second);
+        std::sort(collisions.begin(), collisions.end());
+
+        std::vector<std::pair<AbstractShape3D*, AbstractShape3D*>> expected;
+        for(std::size_t i = 0; i != shapes.size(); ++i) for(std::size_t j = i + 1; j != shapes.size(); ++j) {
+            if(!shapes[i].collides(shapes[j])) continue;
+            expected.emplace_back(&shapes[i], &shapes[j]);
+            if(expected.back().second < expected.back().first)
+                std::swap(expected.back().first, expected.back().second);
+        }
+        std::sort(expected.begin(), expected.end());
+
+        CORRADE_VERIFY(!expected.empty());
+        CORRADE_VERIFY(collisions == expected);
+    }
+}
+
+void ShapeTest::collisionData() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    Object3D a(&scene);
+    Shape<Shapes::Sphere3D> aShape(a, {{}, 1.0f}, &shapes);
+    a.translate(Vector3::xAxis(1.5f));
+
+    Object3D b(&scene);
+    Shape<Shapes::Box3D> bShape(b, {Matrix4()}, &shapes);
+
+    Object3D c(&scene);
+    Shape<Shapes::Line3D> cShape(c, {{}, Vector3::xAxis()}, &shapes);
+
+    /* Shape order doesn't matter, the result is flipped */
+    shapes.setClean();
+    const Collision3D collision = aShape.collision(bShape);
+    CORRADE_COMPARE(collision.position(), Vector3(1.0f, 0.0f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+    const Collision3D flipped = bShape.collision(aShape);
+    CORRADE_COMPARE(flipped.position(), Vector3(0.5f, 0.0f, 0.0f));
+    CORRADE_COMPARE(flipped.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(flipped.separationDistance(), 0.5f);
+
+    /* Pair without contact generation */
+    CORRADE_VERIFY(aShape.collides(cShape));
+    CORRADE_VERIFY(!aShape.collision(cShape));
+
+    /* Pair of convex shapes without dedicated contact generation */
+    Object3D d(&scene);
+    Shape<Shapes::LineSegment3D> dShape(d, {{-0.5f, 0.75f, 0.0f}, {0.5f, 0.75f, 0.0f}});
+    d.setClean();
+    const Collision3D generic = dShape.collision(bShape);
+    CORRADE_COMPARE(generic.separationNormal(), Vector3::yAxis());
+    CORRADE_COMPARE(generic.separationDistance(), 0.25f);
+
+    /* Bulk query */
+    const std::vector<Collision3D> data = shapes.collisionData({{&aShape, &bShape}, {&bShape, &aShape}, {&cShape, &aShape}});
+    CORRADE_COMPARE(data.size(), 3);
+    CORRADE_COMPARE(data[0].position(), collision.position());
+    CORRADE_COMPARE(data[0].separationNormal(), collision.separationNormal());
+    CORRADE_COMPARE(data[1].position(), flipped.position());
+    CORRADE_COMPARE(data[1].separationNormal(), flipped.separationNormal());
+    CORRADE_VERIFY(!data[2]);
+}
+
+void ShapeTest::collisionDataBulk() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    std::mt19937 random(5);
+    std::uniform_real_distribution<Float> position(-4.0f, 4.0f);
+    std::uniform_real_distribution<Float> angle(0.0f, 360.0f);
+
+    std::vector<std::unique_ptr<Object3D>> objects;
+    for(std::size_t i = 0; i != 60; ++i) {
+        objects.emplace_back(new Object3D(&scene));
+        objects.back()->rotateZ(Deg(angle(random)))
+            .translate({position(random), position(random), position(random)});
+        switch(i % 6) {
+            case 0: new Shape<Shapes::Sphere3D>(*objects.back(), {{}, 1.0f}, &shapes); break;
+            case 1: new Shape<Shapes::Point3D>(*objects.back(), {{}}, &shapes); break;
+            case 2: new Shape<Shapes::AxisAlignedBox3D>(*objects.back(), {Vector3(-1.0f), Vector3(1.0f)}, &shapes); break;
+            case 3: new Shape<Shapes::Capsule3D>(*objects.back(), {Vector3(-1.0f), Vector3(1.0f), 0.5f}, &shapes); break;
+            case 4: new Shape<Shapes::Box3D>(*objects.back(), {Matrix4::scaling({1.0f, 0.5f, 2.0f})}, &shapes); break;
+            case 5: new Shape<Shapes::Cylinder3D>(*objects.back(), {{}, Vector3::zAxis(), 0.5f}, &shapes); break;
+        }
+    }
+
+    /* Colliding pairs have collision data, the same as when computed one by
+       one */
+    const auto collisions = shapes.collisions();
+    const std::vector<Collision3D> data = shapes.collisionData(collisions);
+    CORRADE_COMPARE(data.size(), collisions.size());
+    CORRADE_VERIFY(!collisions.empty());
+    for(std::size_t i = 0; i != collisions.size(); ++i) {
+        const Collision3D expected = collisions[i].first->collision(*collisions[i].second);
+        CORRADE_VERIFY(data[i]);
+        CORRADE_COMPARE(data[i].position(), expected.position());
+        CORRADE_COMPARE(data[i].separationNormal(), expected.separationNormal());
+        CORRADE_COMPARE(data[i].separationDistance(), expected.separationDistance());
+    }
+}
+
+void ShapeTest::raycast() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    Object3D a(&scene);
+    Shape<Shapes::Sphere3D> aShape(a, {{0.0f, 0.0f, -10.0f}, 1.0f}, &shapes);
+
+    Object3D b(&scene);
+    b.rotateY(Deg(45.0f))
+     .translate({5.0f, 0.0f, -10.0f});
+    Shape<Shapes::Box3D> bShape(b, {Matrix4()}, &shapes);
+
+    Object3D c(&scene);
+    Shape<Shapes::Capsule3D> cShape(c, {{-5.0f, -1.0f, -10.0f}, {-5.0f, 1.0f, -10.0f}, 0.5f}, &shapes);
+
+    Object3D d(&scene);
+    Shape<Shapes::Plane> dShape(d, {{0.0f, -3.0f, 0.0f}, {0.0f, 2.0f, 0.0f}}, &shapes);
+
+    /* Sphere */
+    RaycastHit3D hit = shapes.raycast({}, Vector3::zAxis(-1.0f));
+    CORRADE_VERIFY(hit.shape() == &aShape);
+    CORRADE_COMPARE(hit.distance(), 9.0f);
+    CORRADE_COMPARE(hit.position(), Vector3(0.0f, 0.0f, -9.0f));
+    CORRADE_COMPARE(hit.normal(), Vector3::zAxis());
+
+    /* Rotated box */
+    hit = shapes.raycast({5.5f, 0.0f, 0.0f}, Vector3::zAxis(-1.0f));
+    CORRADE_VERIFY(hit.shape() == &bShape);
+    CORRADE_COMPARE(hit.distance(), 9.085786f);
+    CORRADE_COMPARE(hit.normal(), Vector3(1.0f, 0.0f, 1.0f).normalized());
+
+    /* Capsule */
+    hit = shapes.raycast({-5.0f, 0.5f, 0.0f}, Vector3::zAxis(-1.0f));
+    CORRADE_VERIFY(hit.shape() == &cShape);
+    CORRADE_COMPARE(hit.distance(), 9.5f);
+    CORRADE_COMPARE(hit.normal(), Vector3::zAxis());
+
+    /* Plane with unnormalized normal */
+    hit = shapes.raycast({0.0f, 5.0f, 0.0f}, Vector3::yAxis(-1.0f));
+    CORRADE_VERIFY(hit.shape() == &dShape);
+    CORRADE_COMPARE(hit.distance(), 8.0f);
+    CORRADE_COMPARE(hit.position(), Vector3(0.0f, -3.0f, 0.0f));
+    CORRADE_COMPARE(hit.normal(), Vector3::yAxis());
+
+    /* Origin inside the shape */
+    hit = shapes.raycast({0.0f, 0.0f, -10.0f}, Vector3::zAxis(-1.0f));
+    CORRADE_VERIFY(hit.shape() == &aShape);
+    CORRADE_COMPARE(hit.distance(), 0.0f);
+
+    /* Nothing hit */
+    CORRADE_VERIFY(!shapes.raycast({}, Vector3::xAxis()));
+    CORRADE_VERIFY(!shapes.raycast({}, Vector3::zAxis(-1.0f), 5.0f));
+    CORRADE_VERIFY(!shapes.raycast({}, Vector3::zAxis()));
+
+    /* The hierarchy is updated after moving */
+    a.translate(Vector3::xAxis(3.0f));
+    CORRADE_VERIFY(!shapes.raycast({}, Vector3::zAxis(-1.0f)));
+    hit = shapes.raycast({3.0f, 0.0f, 0.0f}, Vector3::zAxis(-1.0f));
+    CORRADE_VERIFY(hit.shape() == &aShape);
+    CORRADE_COMPARE(hit.distance(), 9.0f);
+}
+
+void ShapeTest::raycastAll() {
+    Scene2D scene;
+    ShapeGroup2D shapes;
+
+    Object2D a(&scene);
+    Shape<Shapes::Sphere2D> aShape(a, {{6.0f, 0.0f}, 1.0f}, &shapes);
+
+    Object2D b(&scene);
+    Shape<Shapes::AxisAlignedBox2D> bShape(b, {{2.0f, -1.0f}, {3.0f, 1.0f}}, &shapes);
+
+    Object2D c(&scene);
+    Shape<Shapes::Sphere2D> cShape(c, {{6.0f, 3.0f}, 1.0f}, &shapes);
+
+    Object2D d(&scene);
+    Shape<Shapes::Capsule2D> dShape(d, {{9.0f, -1.0f}, {9.0f, 1.0f}, 0.5f}, &shapes);
+
+    /* Sorted by distance */
+    std::vector<RaycastHit2D> hits = shapes.raycastAll({}, Vector2::xAxis());
+    CORRADE_COMPARE(hits.size(), 3);
+    CORRADE_VERIFY(hits[0].shape() == &bShape);
+    CORRADE_COMPARE(hits[0].distance(), 2.0f);
+    CORRADE_COMPARE(hits[0].normal(), Vector2::xAxis(-1.0f));
+    CORRADE_VERIFY(hits[1].shape() == &aShape);
+    CORRADE_COMPARE(hits[1].distance(), 5.0f);
+    CORRADE_VERIFY(hits[2].shape() == &dShape);
+    CORRADE_COMPARE(hits[2].distance(), 8.5f);
+
+    /* Limited distance */
+    hits = shapes.raycastAll({}, Vector2::xAxis(), 6.0f);
+    CORRADE_COMPARE(hits.size(), 2);
+
+    /* Shape added to the group */
+    Object2D e(&scene);
+    Shape<Shapes::Point2D> eShape(e, {{4.0f, 0.0f}}, &shapes);
+    Shape<Shapes::Sphere2D> fShape(e, {{4.0f, 0.0f}, 0.5f}, &shapes);
+    hits = shapes.raycastAll({}, Vector2::xAxis(), 6.0f);
+    CORRADE_COMPARE(hits.size(), 3);
+    CORRADE_VERIFY(hits[1].shape() == &fShape);
+    CORRADE_COMPARE(hits[1].distance(), 3.5f);
+}
+
+void ShapeTest::sphereCast() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    Object3D a(&scene);
+    Shape<Shapes::AxisAlignedBox3D> aShape(a, {Vector3(-1.0f), Vector3(1.0f)}, &shapes);
+
+    Object3D b(&scene);
+    Shape<Shapes::Point3D> bShape(b, {{0.0f, 0.0f, -5.0f}}, &shapes);
+
+    /* Face */
+    RaycastHit3D hit = shapes.sphereCast({0.0f, 5.0f, 0.0f}, Vector3::yAxis(-1.0f), 0.5f);
+    CORRADE_VERIFY(hit.shape() == &aShape);
+    CORRADE_COMPARE(hit.distance(), 3.5f);
+    CORRADE_COMPARE(hit.position(), Vector3::yAxis());
+    CORRADE_COMPARE(hit.normal(), Vector3::yAxis());
+
+    /* Edge */
+    hit = shapes.sphereCast({3.0f, 3.0f, 0.0f}, Vector3(-1.0f, -1.0f, 0.0f).normalized(), 0.5f);
+    CORRADE_VERIFY(hit.shape() == &aShape);
+    CORRADE_COMPARE(hit.distance(), 2.328427f);
+    CORRADE_COMPARE(hit.position(), Vector3(1.0f, 1.0f, 0.0f));
+    CORRADE_COMPARE(hit.normal(), Vector3(1.0f, 1.0f, 0.0f).normalized());
+
+    /* Passing the corner in distance larger than radius */
+    CORRADE_VERIFY(!shapes.sphereCast({1.5f, 1.5f, 5.0f}, Vector3::zAxis(-1.0f), 0.5f));
+    CORRADE_VERIFY(shapes.sphereCast({1.5f, 1.5f, 5.0f}, Vector3::zAxis(-1.0f), 0.75f));
+
+    /* Point can't be hit by ray, only by sphere */
+    CORRADE_VERIFY(!shapes.raycast({0.0f, 0.0f, -2.5f}, Vector3::zAxis(-1.0f)));
+    hit = shapes.sphereCast({0.0f, 0.0f, -2.5f}, Vector3::zAxis(-1.0f), 1.0f);
+    CORRADE_VERIFY(hit.shape() == &bShape);
+    CORRADE_COMPARE(hit.distance(), 1.5f);
+    CORRADE_COMPARE(hit.position(), Vector3(0.0f, 0.0f, -5.0f));
+}
+
+void ShapeTest::sphereCastConvexHull() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    /* Unit cube */
+    Object3D a(&scene);
+    Shape<Shapes::ConvexHull3D> aShape(a, {{
+        {-1.0f, -1.0f, -1.0f}, { 1.0f, -1.0f, -1.0f}, {-1.0f,  1.0f, -1.0f}, { 1.0f,  1.0f, -1.0f},
+        {-1.0f, -1.0f,  1.0f}, { 1.0f, -1.0f,  1.0f}, {-1.0f,  1.0f,  1.0f}, { 1.0f,  1.0f,  1.0f}}}, &shapes);
+
+    /* Face */
+    RaycastHit3D hit = shapes.raycast({0.5f, 5.0f, 0.0f}, Vector3::yAxis(-1.0f));
+    CORRADE_VERIFY(hit.shape() == &aShape);
+    CORRADE_COMPARE(hit.distance(), 4.0f);
+    CORRADE_COMPARE(hit.normal(), Vector3::yAxis());
+    hit = shapes.sphereCast({0.5f, 5.0f, 0.0f}, Vector3::yAxis(-1.0f), 0.5f);
+    CORRADE_VERIFY(hit.shape() == &aShape);
+    CORRADE_COMPARE(hit.distance(), 3.5f);
+    CORRADE_COMPARE(hit.normal(), Vector3::yAxis());
+
+    /* Edge */
+    hit = shapes.sphereCast({3.0f, 3.0f, 0.0f}, Vector3(-1.0f, -1.0f, 0.0f).normalized(), 0.5f);
+    CORRADE_VERIFY(hit.shape() == &aShape);
+    CORRADE_VERIFY(Math::abs(hit.distance() - 2.328427f) < 1.0e-3f);
+    CORRADE_VERIFY((hit.normal() - Vector3(1.0f, 1.0f, 0.0f).normalized()).length() < 1.0e-3f);
+
+    /* Passing the corner in distance larger than radius */
+    CORRADE_VERIFY(!shapes.sphereCast({1.5f, 1.5f, 5.0f}, Vector3::zAxis(-1.0f), 0.5f));
+    CORRADE_VERIFY(shapes.sphereCast({1.5f, 1.5f, 5.0f}, Vector3::zAxis(-1.0f), 0.75f));
+
+    /* Pointing away, too far */
+    CORRADE_VERIFY(!shapes.raycast({0.0f, 5.0f, 0.0f}, Vector3::yAxis()));
+    CORRADE_VERIFY(!shapes.raycast({0.0f, 5.0f, 0.0f}, Vector3::yAxis(-1.0f), 3.5f));
+
+    /* Origin inside */
+    hit = shapes.raycast({0.0f, 0.5f, 0.0f}, Vector3::yAxis(-1.0f));
+    CORRADE_VERIFY(hit.shape() == &aShape);
+    CORRADE_COMPARE(hit.distance(), 0.0f);
+}
+
+void ShapeTest::raycastMoving() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    std::mt19937 random(5);
+    std::uniform_real_distribution<Float> position(-10.0f, 10.0f);
+    std::uniform_real_distribution<Float> step(-0.5f, 0.5f);
+
+    std::vector<std::unique_ptr<Object3D>> objects;
+    for(std::size_t i = 0; i != 200; ++i) {
+        objects.emplace_back(new Object3D(&scene));
+        objects.back()->translate({position(random), position(random), position(random)});
+        new Shape<Shapes::Sphere3D>(*objects.back(), {{}, 0.25f + (i % 3)*0.25f}, &shapes);
+    }
+
+    /* Compare with testing all shapes over multiple frames */
+    std::size_t count = 0;
+    for(std::size_t frame = 0; frame != 10; ++frame) {
+        for(auto& object: objects)
+            object->translate({step(random), step(random), step(random)});
+
+        for(std::size_t i = 0; i != 20; ++i) {
+            const Vector3 origin(position(random), position(random), position(random));
+            const Vector3 direction = Vector3(step(random), step(random), step(random)).normalized();
+            const Float radius = i % 2 ? 0.5f : 0.0f;
+
+            AbstractShape3D* expected = nullptr;
+            Float expectedDistance = std::numeric_limits<Float>::infinity();
+            for(std::size_t j = 0; j != shapes.size(); ++j) {
+                const Sphere3D& sphere = static_cast<Shape<Shapes::Sphere3D>&>(shapes[j]).transformedShape();
+                const Vector3 relative = origin - sphere.position();
+                const Float b = Vector3::dot(relative, direction);
+                const Float c = relative.dot() - (sphere.radius() + radius)*(sphere.radius() + radius);
+                if(c < 0.0f) {
+                    expected = &shapes[j];
+                    expectedDistance = 0.0f;
+                    break;
+                }
+                if(b > 0.0f || b*b - c < 0.0f) continue;
+                const Float distance = -b - std::sqrt(b*b - c);
+                if(distance < expectedDistance) {
+                    expected = &shapes[j];
+                    expectedDistance = distance;
+                }
+            }
+
+            const RaycastHit3D hit = shapes.sphereCast(origin, direction, radius);
+            CORRADE_VERIFY(hit.shape() == expected);
+            if(expected) {
+                CORRADE_COMPARE(hit.distance(), expectedDistance);
+                ++count;
+            }
+        }
+    }
+    CORRADE_VERIFY(count);
+}
+
+void ShapeTest::raycastAddRemove() {
+    Scene3D scene;
+    ShapeGroup3D shapes, other;
+
+    Object3D a(&scene);
+    Shape<Shapes::Sphere3D> aShape(a, {{0.0f, 0.0f, -10.0f}, 1.0f}, &shapes);
+    Object3D* b = new Object3D(&scene);
+    b->translate({0.0f, 0.0f, -5.0f});
+    new Shape<Shapes::Sphere3D>(*b, {{}, 1.0f}, &shapes);
+    Shape<Shapes::Sphere3D>* cShape = new Shape<Shapes::Sphere3D>(a, {{0.0f, 0.0f, -2.0f}, 0.5f}, &shapes);
+    CORRADE_VERIFY(shapes.raycast({}, Vector3::zAxis(-1.0f)).shape() == cShape);
+
+    /* Deleted shape */
+    delete cShape;
+    CORRADE_COMPARE(shapes.raycast({}, Vector3::zAxis(-1.0f)).distance(), 4.0f);
+
+    /* Deleted object with the shape */
+    delete b;
+    CORRADE_VERIFY(shapes.raycast({}, Vector3::zAxis(-1.0f)).shape() == &aShape);
+
+    /* Shape moved to another group */
+    other.add(aShape);
+    CORRADE_VERIFY(!shapes.raycast({}, Vector3::zAxis(-1.0f)));
+    CORRADE_VERIFY(other.raycast({}, Vector3::zAxis(-1.0f)).shape() == &aShape);
+
+    /* Shape removed from the group */
+    other.remove(aShape);
+    CORRADE_VERIFY(!other.raycast({}, Vector3::zAxis(-1.0f)));
+    shapes.add(aShape);
+    CORRADE_VERIFY(shapes.raycast({}, Vector3::zAxis(-1.0f)).shape() == &aShape);
+
+    /* Moved shape */
+    a.translate({0.0f, 3.0f, 0.0f});
+    CORRADE_VERIFY(!shapes.raycast({}, Vector3::zAxis(-1.0f)));
+
+    /* Shape is destroyed after the group */
+    {
+        ShapeGroup3D temporary;
+        temporary.add(aShape);
+        CORRADE_VERIFY(temporary.raycast({0.0f, 3.0f, 0.0f}, Vector3::zAxis(-1.0f)).shape() == &aShape);
+    }
+    CORRADE_VERIFY(!aShape.group());
+}
+
+void ShapeTest::timesOfImpact() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    /* Fast sphere passing through another sphere */
+    Object3D a(&scene);
+    a.translate(Vector3::xAxis(-10.0f));
+    Shape<Shapes::Sphere3D> aShape(a, {{}, 0.25f}, &shapes);
+    Object3D b(&scene);
+    Shape<Shapes::Sphere3D> bShape(b, {{}, 1.0f}, &shapes);
+
+    /* Sphere falling through plane */
+    Object3D c(&scene);
+    Shape<Shapes::Plane> cShape(c, {{0.0f, -5.0f, 0.0f}, Vector3::yAxis()}, &shapes);
+    Object3D d(&scene);
+    d.translate(Vector3::xAxis(30.0f));
+    Shape<Shapes::Sphere3D> dShape(d, {{}, 0.5f}, &shapes);
+
+    /* Capsule passing through box face */
+    Object3D e(&scene);
+    e.translate(Vector3::xAxis(60.0f));
+    Shape<Shapes::AxisAlignedBox3D> eShape(e, {Vector3(-1.0f), Vector3(1.0f)}, &shapes);
+    Object3D f(&scene);
+    f.translate({60.0f, 0.0f, -10.0f});
+    Shape<Shapes::Capsule3D> fShape(f, {Vector3::yAxis(-1.0f), Vector3::yAxis(1.0f), 0.25f}, &shapes);
+
+    /* Capsule touching box edge with its interior */
+    Object3D g(&scene);
+    g.rotateZ(Deg(45.0f))
+     .translate(Vector3::xAxis(90.0f));
+    Shape<Shapes::Box3D> gShape(g, {Matrix4()}, &shapes);
+    Object3D h(&scene);
+    h.translate({90.0f, 5.0f, 0.0f});
+    Shape<Shapes::Capsule3D> hShape(h, {Vector3::xAxis(-3.0f), Vector3::xAxis(3.0f), 0.25f}, &shapes);
+
+    /* Crossing capsules */
+    Object3D i(&scene);
+    i.translate(Vector3::xAxis(120.0f));
+    Shape<Shapes::Capsule3D> iShape(i, {Vector3::zAxis(-2.0f), Vector3::zAxis(2.0f), 0.5f}, &shapes);
+    Object3D j(&scene);
+    j.translate({120.0f, 5.0f, 0.0f});
+    Shape<Shapes::Capsule3D> jShape(j, {Vector3::xAxis(-2.0f), Vector3::xAxis(2.0f), 0.5f}, &shapes);
+
+    /* Sphere passing by */
+    Object3D k(&scene);
+    k.translate(Vector3::xAxis(150.0f));
+    Shape<Shapes::Sphere3D> kShape(k, {{}, 0.25f}, &shapes);
+    Object3D l(&scene);
+    l.translate({150.0f, 2.0f, 5.0f});
+    Shape<Shapes::Sphere3D> lShape(l, {{}, 1.0f}, &shapes);
+
+    shapes.savePositions();
+    a.translate(Vector3::xAxis(20.0f));
+    d.translate(Vector3::yAxis(-10.0f));
+    f.translate(Vector3::zAxis(20.0f));
+    h.translate(Vector3::yAxis(-8.0f));
+    j.translate(Vector3::yAxis(-8.0f));
+    k.translate(Vector3::zAxis(10.0f));
+
+    /* Discrete test misses the collision */
+    shapes.setClean();
+    CORRADE_VERIFY(!aShape.collides(bShape));
+
+    const std::vector<Float> times = shapes.timesOfImpact({
+        {&aShape, &bShape},
+        {&bShape, &aShape},
+        {&dShape, &cShape},
+        {&fShape, &eShape},
+        {&eShape, &fShape},
+        {&hShape, &gShape},
+        {&jShape, &iShape},
+        {&kShape, &lShape},
+        {&bShape, &lShape}});
+    CORRADE_COMPARE(times.size(), 9);
+    CORRADE_COMPARE(times[0], 0.4375f);
+    CORRADE_COMPARE(times[1], 0.4375f);
+    CORRADE_COMPARE(times[2], 0.45f);
+    CORRADE_COMPARE(times[3], 0.4375f);
+    CORRADE_COMPARE(times[4], 0.4375f);
+    CORRADE_COMPARE(times[5], 0.416973f);
+    CORRADE_COMPARE(times[6], 0.5f);
+    CORRADE_COMPARE(times[7], std::numeric_limits<Float>::infinity());
+    CORRADE_COMPARE(times[8], std::numeric_limits<Float>::infinity());
+
+    /* Overlapping already at the beginning */
+    Object3D m(&scene);
+    Shape<Shapes::Capsule3D> mShape(m, {Vector3::zAxis(-2.0f), Vector3::zAxis(2.0f), 0.5f}, &shapes);
+    CORRADE_COMPARE(shapes.timesOfImpact({{&mShape, &bShape}}), std::vector<Float>{0.0f});
+
+    /* Shapes added after saving positions are not moving */
+    m.translate(Vector3::xAxis(5.0f));
+    CORRADE_COMPARE(shapes.timesOfImpact({{&mShape, &bShape}}), std::vector<Float>{std::numeric_limits<Float>::infinity()});
+}
+
+void ShapeTest::timesOfImpact2D() {
+    Scene2D scene;
+    ShapeGroup2D shapes;
+
+    Object2D a(&scene);
+    a.translate(Vector2::yAxis(10.0f));
+    Shape<Shapes::Sphere2D> aShape(a, {{}, 0.5f}, &shapes);
+
+    Object2D b(&scene);
+    Shape<Shapes::AxisAlignedBox2D> bShape(b, {{-2.0f, -1.0f}, {2.0f, 1.0f}}, &shapes);
+
+    Object2D c(&scene);
+    c.translate({-10.0f, 1.0f});
+    Shape<Shapes::Capsule2D> cShape(c, {Vector2::yAxis(-1.0f), Vector2::yAxis(1.0f), 0.5f}, &shapes);
+
+    shapes.savePositions();
+    a.translate(Vector2::yAxis(-20.0f));
+    c.translate(Vector2::xAxis(20.0f));
+
+    /* Capsule touches box with its endpoint, box touches moving capsule with
+       its vertex */
+    const std::vector<Float> times = shapes.timesOfImpact({
+        {&aShape, &bShape},
+        {&cShape, &bShape},
+        {&bShape, &cShape}});
+    CORRADE_COMPARE(times[0], 0.425f);
+    CORRADE_COMPARE(times[1], 0.375f);
+    CORRADE_COMPARE(times[2], 0.375f);
+}
+
+void ShapeTest::timesOfImpactConvexHull() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    /* Unit cube */
+    Object3D a(&scene);
+    Shape<Shapes::ConvexHull3D> aShape(a, {{
+        {-1.0f, -1.0f, -1.0f}, { 1.0f, -1.0f, -1.0f}, {-1.0f,  1.0f, -1.0f}, { 1.0f,  1.0f, -1.0f},
+        {-1.0f, -1.0f,  1.0f}, { 1.0f, -1.0f,  1.0f}, {-1.0f,  1.0f,  1.0f}, { 1.0f,  1.0f,  1.0f}}}, &shapes);
+
+    /* Fast sphere passing through */
+    Object3D b(&scene);
+    b.translate(Vector3::xAxis(-10.0f));
+    Shape<Shapes::Sphere3D> bShape(b, {{}, 0.25f}, &shapes);
+
+    /* Fast capsule passing through */
+    Object3D c(&scene);
+    c.translate(Vector3::zAxis(-10.0f));
+    Shape<Shapes::Capsule3D> cShape(c, {Vector3::yAxis(-1.0f), Vector3::yAxis(1.0f), 0.25f}, &shapes);
+
+    /* Sphere passing by */
+    Object3D d(&scene);
+    d.translate({-10.0f, 2.0f, 0.0f});
+    Shape<Shapes::Sphere3D> dShape(d, {{}, 0.25f}, &shapes);
+
+    shapes.savePositions();
+    b.translate(Vector3::xAxis(20.0f));
+    c.translate(Vector3::zAxis(20.0f));
+    d.translate(Vector3::xAxis(20.0f));
+
+    /* Discrete test misses the collision */
+    shapes.setClean();
+    CORRADE_VERIFY(!aShape.collides(bShape));
+    CORRADE_VERIFY(!aShape.collides(cShape));
+
+    const std::vector<Float> times = shapes.timesOfImpact({
+        {&bShape, &aShape},
+        {&aShape, &bShape},
+        {&cShape, &aShape},
+        {&dShape, &aShape}});
+    CORRADE_COMPARE(times[0], 0.4375f);
+    CORRADE_COMPARE(times[1], 0.4375f);
+    CORRADE_COMPARE(times[2], 0.4375f);
+    CORRADE_COMPARE(times[3], std::numeric_limits<Float>::infinity());
+
+    /* Found also by the swept broadphase, the sphere and capsule cross each
+       other in the middle of the cube */
+    std::vector<std::pair<AbstractShape3D*, AbstractShape3D*>> collisions = shapes.sweptCollisions();
+    CORRADE_COMPARE(collisions.size(), 3);
+}
+
+void ShapeTest::sweptCollisions() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    std::mt19937 random(7);
+    std::uniform_real_distribution<Float> position(-10.0f, 10.0f);
+    std::uniform_real_distribution<Float> step(-3.0f, 3.0f);
+
+    std::vector<std::unique_ptr<Object3D>> objects;
+    for(std::size_t i = 0; i != 200; ++i) {
+        objects.emplace_back(new Object3D(&scene));
+        objects.back()->translate({position(random), position(random), position(random)});
+        switch(i % 4) {
+            case 0: new Shape<Shapes::Sphere3D>(*objects.back(), {{}, 0.25f}, &shapes); break;
+            case 1: new Shape<Shapes::Capsule3D>(*objects.back(), {Vector3(-0.5f), Vector3(0.5f), 0.25f}, &shapes); break;
+            case 2: new Shape<Shapes::AxisAlignedBox3D>(*objects.back(), {Vector3(-0.5f), Vector3(0.5f)}, &shapes); break;
+            case 3: new Shape<Shapes::Point3D>(*objects.back(), {{}}, &shapes); break;
+        }
+    }
+
+    /* Compare with computing times of impact for all pairs */
+    for(std::size_t frame = 0; frame != 5; ++frame) {
+        shapes.savePositions();
+        for(auto& object: objects)
+            object->translate({step(random), step(random), step(random)});
+
+        std::vector<std::pair<AbstractShape3D*, AbstractShape3D*>> collisions = shapes.sweptCollisions();
+        for(auto& collision: collisions)
+            if(collision.first > collision.second) std::swap(collision.first, collision.second);
+        std::sort(collisions.begin(), collisions.end());
+
+        std::vector<std::pair<AbstractShape3D*, AbstractShape3D*>> all;
+        for(std::size_t i = 0; i != shapes.size(); ++i) for(std::size_t j = i + 1; j != shapes.size(); ++j)
+            all.emplace_back(&shapes[i], &shapes[j]);
+        const std::vector<Float> times = shapes.timesOfImpact(all);
+
+        std::vector<std::pair<AbstractShape3D*, AbstractShape3D*>> expected;
+        std::size_t discrete = 0;
+        for(std::size_t i = 0; i != all.size(); ++i) {
+            if(all[i].first->collides(*all[i].second)) ++discrete;
+            if(times[i] > 1.0f) continue;
+            expected.emplace_back(std::min(all[i].first, all[i].second), std::max(all[i].first, all[i].second));
+        }
+        std::sort(expected.begin(), expected.end());
+
+        /* Swept test finds more collisions than the discrete one */
+        CORRADE_VERIFY(expected.size() > discrete);
+        CORRADE_VERIFY(collisions == expected);
+    }
+}
+
 void ShapeTest::shapeGroup() {
     Scene2D scene;
     ShapeGroup2D shapes;
@@ -137,6 +1020,10 @@ void ShapeTest::shapeGroup() {
     a.translate(Vector2::xAxis(5.0f));
     a.setClean();
     CORRADE_COMPARE(point.position(), Vector2(5.25f, -1.0f));
+
+    /* Verify the composition bounds are updated too */
+    CORRADE_VERIFY(shape->transformedShape() % Shapes::Sphere2D({5.25f, -1.0f}, 0.1f));
+    CORRADE_VERIFY(!(shape->transformedShape() % Shapes::Sphere2D({0.25f, -1.0f}, 0.1f)));
 }
 
 }}}
@@ -40,6 +40,7 @@ Debug operator<<(Debug debug, ShapeDimensionTraits<2>::Type value) {
         _val(Cylinder)
         _val(AxisAlignedBox)
         _val(Box)
+        _val(ConvexHull)
         _val(Composition)
         #undef _val
     }
@@ -60,6 +61,7 @@ Debug operator<<(Debug debug, ShapeDimensionTraits<3>::Type value) {
         _val(AxisAlignedBox)
         _val(Box)
         _val(Plane)
+        _val(ConvexHull)
         _val(Composition)
         #undef _val
     }
@@ -24,6 +24,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <new>
 #include <utility>
 #include <Utility/Assert.h>
 #include <corradeCompatibility.h>
@@ -49,7 +50,8 @@ namespace Magnum { namespace Shapes { namespace Implementation {
     Adding new collision detection implementation:
 
     1.  Update Implementation/CollisionDispatch.cpp with newly implemented
-        2D/3D pair
+        2D/3D pair. Convex shapes having support() function can be added to
+        generic GJK fallback in the same file instead.
 */
 
 /* Shape type for given dimension count */
@@ -67,7 +69,8 @@ template<> struct ShapeDimensionTraits<2> {
         Capsule = 13,
         AxisAlignedBox = 17,
         Box = 19,
-        Composition = 23
+        ConvexHull = 23,
+        Composition = 29
     };
 };
 
@@ -83,7 +86,8 @@ template<> struct ShapeDimensionTraits<3> {
         AxisAlignedBox = 17,
         Box = 19,
         Plane = 23,
-        Composition = 29
+        ConvexHull = 29,
+        Composition = 31
     };
 };
 
@@ -139,6 +143,11 @@ template<UnsignedInt dimensions> struct TypeOf<Shapes::Box<dimensions>> {
         return ShapeDimensionTraits<dimensions>::Type::Box;
     }
 };
+template<UnsignedInt dimensions> struct TypeOf<Shapes::ConvexHull<dimensions>> {
+    constexpr static typename ShapeDimensionTraits<dimensions>::Type type() {
+        return ShapeDimensionTraits<dimensions>::Type::ConvexHull;
+    }
+};
 template<> struct TypeOf<Shapes::Plane> {
     constexpr static ShapeDimensionTraits<3>::Type type() {
         return ShapeDimensionTraits<3>::Type::Plane;
@@ -157,7 +166,7 @@ template<UnsignedInt dimensions> struct MAGNUM_SHAPES_EXPORT AbstractShape {
     virtual ~AbstractShape();
 
     virtual typename ShapeDimensionTraits<dimensions>::Type MAGNUM_SHAPES_LOCAL type() const = 0;
-    virtual AbstractShape<dimensions> MAGNUM_SHAPES_LOCAL * clone() const = 0;
+    virtual AbstractShape<dimensions> MAGNUM_SHAPES_LOCAL * clone(void* storage) const = 0;
     virtual void MAGNUM_SHAPES_LOCAL transform(const typename DimensionTraits<dimensions, Float>::MatrixType& matrix, AbstractShape<dimensions>* result) const = 0;
 };
 
@@ -172,8 +181,9 @@ template<class T> struct Shape: AbstractShape<T::Dimensions> {
         return TypeOf<T>::type();
     }
 
-    AbstractShape<T::Dimensions>* clone() const override {
-        return new Shape<T>(shape);
+    /* Copy constructs the shape in given memory */
+    AbstractShape<T::Dimensions>* clone(void* storage) const override {
+        return new(storage) Shape<T>(shape);
     }
 
     void transform(const typename DimensionTraits<T::Dimensions, Float>::MatrixType& matrix, AbstractShape<T::Dimensions>* result) const override {
@@ -0,0 +1,84 @@
+#ifndef Magnum_Test_Benchmark_h
+#define Magnum_Test_Benchmark_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+
+#include "Magnum.h"
+
+namespace Magnum { namespace Test {
+
+/*
+Benchmark timer. Each function is called given count of times in one run,
+the runs are repeated and the fastest is taken, which filters out most of
+the noise from scheduling and cold caches. Benchmarked functions return a
+value computed from their output, which is accumulated so the computation
+can't be optimized out.
+
+Benchmarks are plain executables built only with BUILD_BENCHMARKS and they
+print speedups or, for operations without a baseline, durations:
+
+    int main() {
+        Magnum::Test::Benchmark benchmark;
+        benchmark.compare("Something", baseline, optimized);
+        benchmark.print("Something else", function);
+    }
+*/
+class Benchmark {
+    public:
+        explicit Benchmark(std::size_t iterations = 100, std::size_t repeats = 10): _iterations(iterations), _repeats(repeats), _sink(0.0f) {}
+
+        /* Duration of one call of given function in seconds */
+        template<class F> Double run(F f) {
+            std::chrono::high_resolution_clock::duration fastest = std::chrono::high_resolution_clock::duration::max();
+            for(std::size_t i = 0; i != _repeats; ++i) {
+                const auto begin = std::chrono::high_resolution_clock::now();
+                for(std::size_t j = 0; j != _iterations; ++j) _sink = _sink + f();
+                const auto duration = std::chrono::high_resolution_clock::now() - begin;
+                if(duration < fastest) fastest = duration;
+            }
+
+            return std::chrono::duration<Double>(fastest).count()/_iterations;
+        }
+
+        /* Print speedup of optimized function over the baseline */
+        template<class F, class G> void compare(const char* name, F baseline, G optimized) {
+            const Double baselineDuration = run(baseline);
+            Debug() << name << "speedup:" << baselineDuration/run(optimized);
+        }
+
+        /* Print duration of one call of given function in microseconds */
+        template<class F> void print(const char* name, F f) {
+            Debug() << name << "duration:" << run(f)*1.0e6 << "us";
+        }
+
+    private:
+        std::size_t _iterations, _repeats;
+        volatile Float _sink;
+};
+
+}}
+
+#endif
@@ -25,10 +25,11 @@
 #include "AbstractFont.h"
 
 #include <fstream>
+#include <unordered_set>
 #include <Containers/Array.h>
 #include <Utility/Unicode.h>
 
-#include "Text/GlyphCache.h"
+#include "Text/DynamicGlyphCache.h"
 
 namespace Magnum { namespace Text {
 
@@ -129,6 +130,28 @@ void AbstractFont::fillGlyphCache(GlyphCache& cache, const std::string& characte
     doFillGlyphCache(cache, Utility::Unicode::utf32(characters));
 }
 
+void AbstractFont::fillGlyphCache(DynamicGlyphCache& cache, const std::string& text) {
+    CORRADE_ASSERT(isOpened(),
+        "Text::AbstractFont::fillGlyphCache(): no font opened", );
+    CORRADE_ASSERT(!(features() & Feature::PreparedGlyphCache),
+        "Text::AbstractFont::fillGlyphCache(): feature not supported", );
+
+    /* Render only glyphs which are not in the cache yet, each just once */
+    #ifndef _WIN32
+    std::u32string missing;
+    #else
+    std::vector<char32_t> missing;
+    #endif
+    std::unordered_set<UnsignedInt> glyphs;
+    for(const char32_t character: Utility::Unicode::utf32(text)) {
+        const UnsignedInt glyph = doGlyphId(character);
+        if(glyphs.insert(glyph).second && !cache.use(glyph))
+            missing.push_back(character);
+    }
+
+    if(!missing.empty()) doFillGlyphCache(cache, missing);
+}
+
 #ifndef _WIN32
 void AbstractFont::doFillGlyphCache(GlyphCache&, const std::u32string&)
 #else
@@ -157,6 +180,13 @@ std::unique_ptr<AbstractLayouter> AbstractFont::layout(const GlyphCache& cache,
     return doLayout(cache, size, text);
 }
 
+std::unique_ptr<AbstractLayouter> AbstractFont::layout(DynamicGlyphCache& cache, const Float size, const std::string& text) {
+    CORRADE_ASSERT(isOpened(), "Text::AbstractFont::layout(): no font opened", nullptr);
+
+    fillGlyphCache(cache, text);
+    return doLayout(cache, size, text);
+}
+
 AbstractLayouter::AbstractLayouter(): _glyphCount(0) {}
 
 AbstractLayouter::~AbstractLayouter() {}
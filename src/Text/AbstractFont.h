@@ -178,6 +178,19 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
          */
         void fillGlyphCache(GlyphCache& cache, const std::string& characters);
 
+        /**
+         * @brief Fill dynamic glyph cache with glyphs for given text
+         * @param cache         Glyph cache instance
+         * @param text          UTF-8 text
+         *
+         * Marks glyphs for given text as used in current frame and renders
+         * only the ones which are not yet in the cache, each of them just
+         * once. Called implicitly from
+         * @ref layout(DynamicGlyphCache&, Float, const std::string&).
+         * @see DynamicGlyphCache::use()
+         */
+        void fillGlyphCache(DynamicGlyphCache& cache, const std::string& text);
+
         /**
          * @brief Create glyph cache
          *
@@ -198,6 +211,16 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
          */
         std::unique_ptr<AbstractLayouter> layout(const GlyphCache& cache, Float size, const std::string& text);
 
+        /**
+         * @brief Layout the text using dynamic glyph cache
+         *
+         * Renders glyphs missing in the cache using
+         * @ref fillGlyphCache(DynamicGlyphCache&, const std::string&) and
+         * then lays out the text as
+         * @ref layout(const GlyphCache&, Float, const std::string&).
+         */
+        std::unique_ptr<AbstractLayouter> layout(DynamicGlyphCache& cache, Float size, const std::string& text);
+
     #ifdef DOXYGEN_GENERATING_OUTPUT
     private:
     #else
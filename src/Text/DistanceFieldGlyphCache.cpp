@@ -24,9 +24,12 @@
 
 #include "DistanceFieldGlyphCache.h"
 
-#ifndef CORRADE_NO_ASSERT
-#include "ColorFormat.h"
+#include <vector>
+#if !defined(MAGNUM_TARGET_GLES) || defined(MAGNUM_TARGET_GLES3)
+#include <thread>
 #endif
+
+#include "ColorFormat.h"
 #include "Extensions.h"
 #include "ImageReference.h"
 #include "TextureFormat.h"
@@ -57,9 +60,17 @@ DistanceFieldGlyphCache::DistanceFieldGlyphCache(const Vector2i& originalSize, c
 
 void DistanceFieldGlyphCache::setImage(const Vector2i& offset, const ImageReference2D& image) {
     #if !defined(MAGNUM_TARGET_GLES) || defined(MAGNUM_TARGET_GLES3)
-    const TextureFormat internalFormat = TextureFormat::R8;
     CORRADE_ASSERT(image.format() == ColorFormat::Red,
         "Text::DistanceFieldGlyphCache::setImage(): expected" << ColorFormat::Red << "but got" << image.format(), );
+
+    /* Create distance field on CPU and upload it, no need to render it. Rows
+       of the output are aligned to four bytes, the same as the default
+       GL_UNPACK_ALIGNMENT. */
+    const Vector2i size = image.size()*scale;
+    std::vector<unsigned char> data((size.x() + 3)/4*4*size.y());
+    ImageReference2D output(ColorFormat::Red, ColorType::UnsignedByte, size, data.data());
+    TextureTools::distanceField(image, output, {{}, size}, radius, std::thread::hardware_concurrency());
+    texture().setSubImage(0, offset*scale, output);
     #else
     TextureFormat internalFormat;
     if(Context::current()->isExtensionSupported<Extensions::GL::EXT::texture_rg>()) {
@@ -71,7 +82,6 @@ void DistanceFieldGlyphCache::setImage(const Vector2i& offset, const ImageRefere
         CORRADE_ASSERT(image.format() == ColorFormat::Luminance,
             "Text::DistanceFieldGlyphCache::setImage(): expected" << ColorFormat::Luminance << "but got" << image.format(), );
     }
-    #endif
 
     Texture2D input;
     input.setWrapping(Sampler::Wrapping::ClampToEdge)
@@ -81,6 +91,7 @@ void DistanceFieldGlyphCache::setImage(const Vector2i& offset, const ImageRefere
 
     /* Create distance field from input texture */
     TextureTools::distanceField(input, texture(), Rectanglei::fromSize(offset*scale, image.size()*scale), radius, image.size());
+    #endif
 }
 
 void DistanceFieldGlyphCache::setDistanceFieldImage(const Vector2i& offset, const ImageReference2D& image) {
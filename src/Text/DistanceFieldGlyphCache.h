@@ -77,6 +77,9 @@ class MAGNUM_TEXT_EXPORT DistanceFieldGlyphCache: public GlyphCache {
          *
          * Uploads image for one or more glyphs to given offset in original
          * cache texture. The texture is then converted to distance field.
+         * On desktop OpenGL and OpenGL ES 3.0 the distance field is computed
+         * on CPU using all available threads, in OpenGL ES 2.0 it is
+         * rendered on GPU.
          */
         void setImage(const Vector2i& offset, const ImageReference2D& image) override;
 
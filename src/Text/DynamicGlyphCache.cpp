@@ -0,0 +1,149 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "DynamicGlyphCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+
+#include "ColorFormat.h"
+#include "ImageReference.h"
+
+namespace Magnum { namespace Text {
+
+namespace {
+    /* Pixel rows are aligned to four bytes, which is the default
+       GL_UNPACK_ALIGNMENT */
+    std::size_t alignedRowSize(const std::size_t rowSize) {
+        return (rowSize + 3)/4*4;
+    }
+}
+
+DynamicGlyphCache::DynamicGlyphCache(const TextureFormat internalFormat, const Vector2i& size, const Vector2i& padding): GlyphCache(internalFormat, size, size, padding), _frame(1), _hitCount(0), _missCount(0), _evictionCount(0), _format(), _type() {}
+
+DynamicGlyphCache::DynamicGlyphCache(const Vector2i& size, const Vector2i& padding): GlyphCache(size, size, padding), _frame(1), _hitCount(0), _missCount(0), _evictionCount(0), _format(), _type() {}
+
+DynamicGlyphCache::~DynamicGlyphCache() = default;
+
+void DynamicGlyphCache::resetStatistics() {
+    _hitCount = _missCount = _evictionCount = 0;
+}
+
+bool DynamicGlyphCache::use(const UnsignedInt glyph) {
+    /* Mark also missing glyph, so it isn't evicted right after rendering */
+    _lastUsed[glyph] = _frame;
+
+    const bool found = contains(glyph);
+    ++(found ? _hitCount : _missCount);
+    return found;
+}
+
+std::vector<Rectanglei> DynamicGlyphCache::reserve(const std::vector<Vector2i>& sizes) {
+    std::vector<Rectanglei> reserved = tryReserve(sizes);
+    if(!reserved.empty() || sizes.empty()) return reserved;
+
+    /* Glyphs not used in current frame, least recently used first */
+    std::vector<std::tuple<UnsignedInt, UnsignedInt, Int>> candidates;
+    for(const auto& glyph: *this) {
+        if(glyph.first == 0) continue;
+
+        const auto found = _lastUsed.find(glyph.first);
+        const UnsignedInt lastUsed = found == _lastUsed.end() ? 0 : found->second;
+        if(lastUsed != _frame)
+            candidates.emplace_back(lastUsed, glyph.first, glyph.second.second.size().product());
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    /* Evict until the freed area is at least the requested one, then try
+       again and double the area on failure, as the free space might be
+       fragmented */
+    Long requested = 0;
+    for(const Vector2i& size: sizes)
+        requested += Long(size.x() + 2*padding().x())*(size.y() + 2*padding().y());
+    Long evicted = 0;
+    for(const auto& candidate: candidates) {
+        erase(std::get<1>(candidate));
+        _lastUsed.erase(std::get<1>(candidate));
+        ++_evictionCount;
+
+        if((evicted += std::get<2>(candidate)) < requested) continue;
+        reserved = tryReserve(sizes);
+        if(!reserved.empty()) return reserved;
+        requested *= 2;
+    }
+
+    reserved = tryReserve(sizes);
+    if(reserved.empty())
+        Error() << "Text::DynamicGlyphCache::reserve(): cache size" << textureSize() << "is too small to fit" << sizes.size() << "glyphs used in current frame";
+    return reserved;
+}
+
+void DynamicGlyphCache::setImage(const Vector2i& offset, const ImageReference2D& image) {
+    /* Allocate local copy of the texture on first use */
+    if(_image.empty()) {
+        _format = image.format();
+        _type = image.type();
+        _image.resize(textureSize().product()*image.pixelSize());
+    }
+
+    CORRADE_ASSERT(image.format() == _format && image.type() == _type,
+        "Text::DynamicGlyphCache::setImage(): expected format" << _format << "and type" << _type << "but got" << image.format() << "and" << image.type(), );
+    CORRADE_ASSERT(offset.x() >= 0 && offset.y() >= 0 && offset.x() + image.size().x() <= textureSize().x() && offset.y() + image.size().y() <= textureSize().y(),
+        "Text::DynamicGlyphCache::setImage(): image of size" << image.size() << "at offset" << offset << "doesn't fit into cache of size" << textureSize(), );
+
+    const std::size_t pixelSize = image.pixelSize();
+    const std::size_t rowSize = image.size().x()*pixelSize;
+    const std::size_t rowStride = alignedRowSize(rowSize);
+    for(Int y = 0; y != image.size().y(); ++y)
+        std::memcpy(_image.data() + ((offset.y() + y)*textureSize().x() + offset.x())*pixelSize,
+                    image.data() + y*rowStride, rowSize);
+
+    /* Extend the region to upload */
+    const Rectanglei region = Rectanglei::fromSize(offset, image.size());
+    _dirty = !_dirty.size().product() ? region :
+        Rectanglei(Math::min(_dirty.bottomLeft(), region.bottomLeft()),
+                   Math::max(_dirty.topRight(), region.topRight()));
+}
+
+void DynamicGlyphCache::flush() {
+    /* Upload the changed region in one batch */
+    if(_dirty.size().product()) {
+        const std::size_t pixelSize = ImageReference2D::pixelSize(_format, _type);
+        const std::size_t rowSize = _dirty.width()*pixelSize;
+        const std::size_t rowStride = alignedRowSize(rowSize);
+        std::vector<unsigned char> data(_dirty.height()*rowStride);
+        for(Int y = 0; y != _dirty.height(); ++y)
+            std::memcpy(data.data() + y*rowStride,
+                        _image.data() + ((_dirty.bottom() + y)*textureSize().x() + _dirty.left())*pixelSize, rowSize);
+
+        GlyphCache::setImage(_dirty.bottomLeft(), ImageReference2D(_format, _type, _dirty.size(), data.data()));
+        _dirty = {};
+    }
+
+    ++_frame;
+}
+
+}}
@@ -0,0 +1,181 @@
+#ifndef Magnum_Text_DynamicGlyphCache_h
+#define Magnum_Text_DynamicGlyphCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::Text::DynamicGlyphCache
+ */
+
+#include "Text/GlyphCache.h"
+
+namespace Magnum { namespace Text {
+
+/**
+@brief Glyph cache with on-demand glyph rendering
+
+Unlike original GlyphCache doesn't need to have all glyphs prerendered up
+front, which is not possible e.g. for CJK scripts. Glyphs missing in the cache
+are rendered on first use in @ref AbstractFont::layout() or
+@ref AbstractFont::fillGlyphCache(DynamicGlyphCache&, const std::string&) and
+packed into free space in the texture. When the texture is full, glyphs which
+were least recently used are evicted to make room for the new ones.
+
+@section DynamicGlyphCache-usage Usage
+
+Glyph images are not uploaded to the texture immediately, but collected in
+local copy of the texture and uploaded in one batch in @ref flush(), which
+should be called once per frame before drawing the text:
+@code
+Text::AbstractFont* font;
+Text::DynamicGlyphCache cache(Vector2i(512));
+
+// in draw event
+std::unique_ptr<Text::AbstractLayouter> layouter = font->layout(cache, 0.15f, text);
+// ...
+cache.flush();
+@endcode
+
+Glyphs used since last call to @ref flush() are never evicted. Glyphs used
+only in earlier frames may be evicted and their place in the texture reused,
+thus text which is drawn in current frame must be laid out again (or its
+glyphs ensured with @ref AbstractFont::fillGlyphCache(DynamicGlyphCache&, const std::string&))
+in every frame. @ref Renderer takes the cache as `const` and doesn't render
+missing glyphs, call @ref AbstractFont::fillGlyphCache(DynamicGlyphCache&, const std::string&)
+with the text before rendering it.
+
+Cache efficiency can be monitored using @ref hitCount(), @ref missCount() and
+@ref evictionCount().
+*/
+class MAGNUM_TEXT_EXPORT DynamicGlyphCache: public GlyphCache {
+    public:
+        /**
+         * @brief Constructor
+         * @param internalFormat    Internal texture format
+         * @param size              Glyph cache texture size
+         * @param padding           Padding around every glyph
+         *
+         * See GlyphCache::GlyphCache() for more information.
+         */
+        explicit DynamicGlyphCache(TextureFormat internalFormat, const Vector2i& size, const Vector2i& padding = Vector2i());
+
+        /**
+         * @brief Constructor
+         *
+         * Sets internal texture format to red channel only. See
+         * GlyphCache::GlyphCache() for more information.
+         */
+        explicit DynamicGlyphCache(const Vector2i& size, const Vector2i& padding = Vector2i());
+
+        ~DynamicGlyphCache();
+
+        /**
+         * @brief Current frame
+         *
+         * Incremented on every @ref flush(), starts at `1`.
+         */
+        UnsignedInt frame() const { return _frame; }
+
+        /**
+         * @brief Count of cache hits
+         *
+         * Count of glyph lookups in @ref use() which found the glyph in the
+         * cache.
+         * @see resetStatistics()
+         */
+        std::size_t hitCount() const { return _hitCount; }
+
+        /**
+         * @brief Count of cache misses
+         *
+         * Count of glyph lookups in @ref use() which didn't find the glyph in
+         * the cache.
+         * @see resetStatistics()
+         */
+        std::size_t missCount() const { return _missCount; }
+
+        /**
+         * @brief Count of evicted glyphs
+         *
+         * @see reserve(), resetStatistics()
+         */
+        std::size_t evictionCount() const { return _evictionCount; }
+
+        /** @brief Reset hit, miss and eviction counters */
+        void resetStatistics();
+
+        /**
+         * @brief Mark glyph as used in current frame
+         * @param glyph         Glyph ID
+         *
+         * Returns `true` if the glyph is in the cache, `false` if it needs to
+         * be rendered. In both cases the glyph is protected from eviction
+         * until next @ref flush(). Called from @ref AbstractFont::layout().
+         * @see hitCount(), missCount()
+         */
+        bool use(UnsignedInt glyph);
+
+        /**
+         * @brief Upload pending glyph images and advance to next frame
+         *
+         * Uploads all images passed to @ref setImage() since last call in
+         * one batch and increments @ref frame().
+         */
+        void flush();
+
+        /**
+         * @brief Layout glyphs with given sizes to the cache
+         *
+         * If the glyphs don't fit into remaining space, least recently used
+         * glyphs which weren't used in current frame are evicted until they
+         * fit. If they don't fit even after that, error message is printed
+         * and empty vector is returned.
+         * @see GlyphCache::reserve()
+         */
+        std::vector<Rectanglei> reserve(const std::vector<Vector2i>& sizes) override;
+
+        /**
+         * @brief Set cache image
+         *
+         * Copies the image to local copy of the texture, it is uploaded on
+         * next @ref flush(). All images are expected to have the same format
+         * and type. Rows of the image are expected to be aligned to four
+         * bytes, the same as when uploading directly to the texture.
+         */
+        void setImage(const Vector2i& offset, const ImageReference2D& image) override;
+
+    private:
+        UnsignedInt _frame;
+        std::size_t _hitCount, _missCount, _evictionCount;
+        std::unordered_map<UnsignedInt, UnsignedInt> _lastUsed;
+
+        ColorFormat _format;
+        ColorType _type;
+        std::vector<unsigned char> _image;
+        Rectanglei _dirty;
+};
+
+}}
+
+#endif
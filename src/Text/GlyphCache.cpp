@@ -33,19 +33,19 @@ namespace Magnum { namespace Text {
 
 /** @todo Do this using delegating constructors when support for GCC 4.6 is dropped */
 
-GlyphCache::GlyphCache(const TextureFormat internalFormat, const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding) {
+GlyphCache::GlyphCache(const TextureFormat internalFormat, const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding), _atlas(_size, padding) {
     initialize(internalFormat, size);
 }
 
-GlyphCache::GlyphCache(const TextureFormat internalFormat, const Vector2i& size, const Vector2i& padding): _size(size), _padding(padding) {
+GlyphCache::GlyphCache(const TextureFormat internalFormat, const Vector2i& size, const Vector2i& padding): _size(size), _padding(padding), _atlas(_size, padding) {
     initialize(internalFormat, size);
 }
 
-GlyphCache::GlyphCache(const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding) {
+GlyphCache::GlyphCache(const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding), _atlas(_size, padding) {
     initialize(size);
 }
 
-GlyphCache::GlyphCache(const Vector2i& size, const Vector2i& padding): _size(size), _padding(padding) {
+GlyphCache::GlyphCache(const Vector2i& size, const Vector2i& padding): _size(size), _padding(padding), _atlas(_size, padding) {
     initialize(size);
 }
 
@@ -79,10 +79,22 @@ void GlyphCache::initialize(const TextureFormat internalFormat, const Vector2i&
 }
 
 std::vector<Rectanglei> GlyphCache::reserve(const std::vector<Vector2i>& sizes) {
-    CORRADE_ASSERT((glyphs.size() == 1 && glyphs.at(0) == std::pair<Vector2i, Rectanglei>()),
-        "Text::GlyphCache::reserve(): reserving space in non-empty cache is not yet implemented", {});
-    glyphs.reserve(glyphs.size() + sizes.size());
-    return TextureTools::atlas(_size, sizes, _padding);
+    std::vector<Rectanglei> reserved = tryReserve(sizes);
+    if(reserved.empty() && !sizes.empty())
+        Error() << "Text::GlyphCache::reserve(): cache size" << _size << "is too small to fit" << sizes.size() << "more glyphs";
+    return reserved;
+}
+
+std::vector<Rectanglei> GlyphCache::tryReserve(const std::vector<Vector2i>& sizes) {
+    const std::vector<TextureTools::AtlasPacker::Item> items = _atlas.add(sizes);
+
+    std::vector<Rectanglei> reserved;
+    reserved.reserve(items.size());
+    for(const TextureTools::AtlasPacker::Item& item: items)
+        reserved.push_back(item.rectangle);
+
+    glyphs.reserve(glyphs.size() + reserved.size());
+    return reserved;
 }
 
 void GlyphCache::insert(const UnsignedInt glyph, Vector2i position, Rectanglei rectangle) {
@@ -97,6 +109,19 @@ void GlyphCache::insert(const UnsignedInt glyph, Vector2i position, Rectanglei r
     else CORRADE_INTERNAL_ASSERT_OUTPUT(glyphs.insert({glyph, {position, rectangle}}).second);
 }
 
+void GlyphCache::erase(const UnsignedInt glyph) {
+    CORRADE_ASSERT(glyph != 0,
+        "Text::GlyphCache::erase(): can't remove \"Not Found\" glyph", );
+    auto it = glyphs.find(glyph);
+    CORRADE_ASSERT(it != glyphs.end(),
+        "Text::GlyphCache::erase(): glyph" << glyph << "is not in the cache", );
+
+    /* Stored rectangle includes padding, the packer adds it by itself */
+    const Rectanglei rectangle(it->second.second.bottomLeft() + _padding, it->second.second.topRight() - _padding);
+    _atlas.remove({rectangle, 0, false});
+    glyphs.erase(it);
+}
+
 void GlyphCache::setImage(const Vector2i& offset, const ImageReference2D& image) {
     /** @todo some internalformat/format checking also here (if querying internal format is not slow) */
     _texture.setSubImage(0, offset, image);
@@ -34,6 +34,7 @@
 #include "Math/Geometry/Rectangle.h"
 #include "Texture.h"
 #include "Text/magnumTextVisibility.h"
+#include "TextureTools/Atlas.h"
 
 namespace Magnum { namespace Text {
 
@@ -54,6 +55,10 @@ font->createGlyphCache(cache, "abcdefghijklmnopqrstuvwxyz"
                               "0123456789 ");
 @endcode
 
+Glyphs can be added to the cache also later, for example when new characters
+are needed. See @ref DynamicGlyphCache for cache which renders missing glyphs
+on demand and evicts unused ones when it is full.
+
 See @ref Renderer for information about text rendering.
 @todo Some way for Font to negotiate or check internal texture format
 @todo Default glyph 0 with rect 0 0 0 0 will result in negative dimensions when
@@ -113,6 +118,11 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
         /** @brief Count of glyphs in the cache */
         std::size_t glyphCount() const { return glyphs.size(); }
 
+        /** @brief Whether given glyph is in the cache */
+        bool contains(UnsignedInt glyph) const {
+            return glyphs.find(glyph) != glyphs.end();
+        }
+
         /** @brief Cache texture */
         Texture2D& texture() { return _texture; }
 
@@ -148,18 +158,17 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
         /**
          * @brief Layout glyphs with given sizes to the cache
          *
-         * Returns non-overlapping regions in cache texture to store glyphs.
-         * The reserved space is reused on next call to reserve() if no glyph
-         * was stored there, use insert() to store actual glyph on given
+         * Returns regions in cache texture to store glyphs, not overlapping
+         * each other nor any region reserved previously, so the cache can be
+         * filled incrementally. Use insert() to store actual glyph on given
          * position and setImage() to upload glyph image.
          *
-         * Glyph @p sizes are expected to be without padding.
-         *
-         * @attention Cache size must be large enough to contain all rendered
-         *      glyphs.
-         * @see padding()
+         * Glyph @p sizes are expected to be without padding. If the glyphs
+         * don't fit into remaining space in the cache, error message is
+         * printed and empty vector is returned.
+         * @see padding(), erase()
          */
-        std::vector<Rectanglei> reserve(const std::vector<Vector2i>& sizes);
+        virtual std::vector<Rectanglei> reserve(const std::vector<Vector2i>& sizes);
 
         /**
          * @brief Insert glyph to cache
@@ -178,6 +187,18 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
          */
         void insert(UnsignedInt glyph, Vector2i position, Rectanglei rectangle);
 
+        /**
+         * @brief Remove glyph from cache
+         * @param glyph         Glyph ID
+         *
+         * Region of the glyph in texture atlas is given back for subsequent
+         * reserve() calls, the texture contents are left untouched. The
+         * glyph is expected to be in the cache and its region previously
+         * obtained with reserve(). The "Not Found" glyph `0` can't be
+         * removed.
+         */
+        void erase(UnsignedInt glyph);
+
         /**
          * @brief Set cache image
          *
@@ -186,12 +207,22 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
          */
         virtual void setImage(const Vector2i& offset, const ImageReference2D& image);
 
+    protected:
+        /**
+         * @brief Try to layout glyphs with given sizes to the cache
+         *
+         * Same as reserve(), but doesn't print any error message if the
+         * glyphs don't fit.
+         */
+        std::vector<Rectanglei> tryReserve(const std::vector<Vector2i>& sizes);
+
     private:
         void MAGNUM_LOCAL initialize(const Vector2i& size);
         void MAGNUM_LOCAL initialize(TextureFormat internalFormat, const Vector2i& size);
 
         Vector2i _size, _padding;
         Texture2D _texture;
+        TextureTools::AtlasPacker _atlas;
 
         std::unordered_map<UnsignedInt, std::pair<Vector2i, Rectanglei>> glyphs;
 };
@@ -26,6 +26,7 @@
 
 #include "Context.h"
 #include "Extensions.h"
+#include "Math/Batch.h"
 #include "Mesh.h"
 #include "Shaders/AbstractVector.h"
 #include "Text/AbstractFont.h"
@@ -86,6 +87,10 @@ struct Vertex {
     Vector2 position, texcoords;
 };
 
+Math::Batch::StridedArrayReference<Vector2> vertexPositions(Vertex* vertices, std::size_t count) {
+    return {count ? &vertices->position : nullptr, count, sizeof(Vertex)};
+}
+
 }
 
 std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>, Rectangle> AbstractRenderer::render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Alignment alignment) {
@@ -141,7 +146,7 @@ std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>,
 
     /* Respect the alignment */
     const Vector2 offset = alignmentOffset(rectangle, alignment);
-    for(auto& p: positions) p += offset;
+    Math::Batch::translateInPlace(offset, {positions.data(), positions.size()});
 
     /* Create indices */
     std::vector<UnsignedInt> indices(layouter->glyphCount()*6);
@@ -192,7 +197,7 @@ std::tuple<Mesh, Rectangle> AbstractRenderer::render(AbstractFont& font, const G
 
     /* Respect the alignment */
     const Vector2 offset = alignmentOffset(rectangle, alignment);
-    for(auto& v: vertices) v.position += offset;
+    Math::Batch::translateInPlace(offset, vertexPositions(vertices.data(), vertices.size()));
 
     vertexBuffer.setData(vertices, usage);
 
@@ -404,7 +409,7 @@ void AbstractRenderer::render(const std::string& text) {
 
     /* Respect the alignment */
     const Vector2 offset = alignmentOffset(_rectangle, _alignment);
-    for(auto& v: vertices) v.position += offset;
+    Math::Batch::translateInPlace(offset, vertexPositions(vertices.data(), vertices.size()));
 
     bufferUnmapImplementation(_vertexBuffer);
 
@@ -0,0 +1,226 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+
+#include "ColorFormat.h"
+#include "Image.h"
+#include "Test/AbstractOpenGLTester.h"
+#include "Text/AbstractFont.h"
+#include "Text/DynamicGlyphCache.h"
+
+namespace Magnum { namespace Text { namespace Test {
+
+class DynamicGlyphCacheGLTest: public Magnum::Test::AbstractOpenGLTester {
+    public:
+        explicit DynamicGlyphCacheGLTest();
+
+        void fill();
+        void evict();
+        void evictUsedInCurrentFrame();
+        void flush();
+        void flushOddSize();
+};
+
+DynamicGlyphCacheGLTest::DynamicGlyphCacheGLTest() {
+    addTests({&DynamicGlyphCacheGLTest::fill,
+              &DynamicGlyphCacheGLTest::evict,
+              &DynamicGlyphCacheGLTest::evictUsedInCurrentFrame,
+              &DynamicGlyphCacheGLTest::flush,
+              &DynamicGlyphCacheGLTest::flushOddSize});
+}
+
+namespace {
+
+/* Each glyph is a square filled with its character, 4x4 by default */
+class SquareFont: public Text::AbstractFont {
+    public:
+        explicit SquareFont(const Int size = 4): rendered(0), _size(size) {}
+
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doGlyphId(const char32_t character) override { return character; }
+
+        Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+
+        #ifndef _WIN32
+        void doFillGlyphCache(GlyphCache& cache, const std::u32string& characters) override
+        #else
+        void doFillGlyphCache(GlyphCache& cache, const std::vector<char32_t>& characters) override
+        #endif
+        {
+            const std::vector<Rectanglei> positions = cache.reserve(std::vector<Vector2i>(characters.size(), Vector2i(_size)));
+            if(positions.empty()) return;
+
+            for(std::size_t i = 0; i != characters.size(); ++i) {
+                cache.insert(characters[i], {}, positions[i]);
+
+                /* Rows are aligned to four bytes */
+                std::vector<unsigned char> data((_size + 3)/4*4*_size, characters[i]);
+                cache.setImage(positions[i].bottomLeft(), ImageReference2D(ColorFormat::Red, ColorType::UnsignedByte, Vector2i(_size), data.data()));
+                ++rendered;
+            }
+        }
+
+        std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, Float, const std::string&) override {
+            return nullptr;
+        }
+
+        std::size_t rendered;
+
+    private:
+        Int _size;
+};
+
+}
+
+void DynamicGlyphCacheGLTest::fill() {
+    SquareFont font;
+    Text::DynamicGlyphCache cache(Vector2i(16));
+
+    /* Each missing glyph is rendered just once */
+    font.fillGlyphCache(cache, "abcab");
+    CORRADE_COMPARE(font.rendered, 3);
+    CORRADE_COMPARE(cache.glyphCount(), 4);
+    CORRADE_VERIFY(cache.contains('c'));
+    CORRADE_COMPARE(cache.hitCount(), 0);
+    CORRADE_COMPARE(cache.missCount(), 3);
+
+    /* Glyphs already in the cache are not rendered again */
+    font.fillGlyphCache(cache, "bad");
+    CORRADE_COMPARE(font.rendered, 4);
+    CORRADE_COMPARE(cache.glyphCount(), 5);
+    CORRADE_COMPARE(cache.hitCount(), 2);
+    CORRADE_COMPARE(cache.missCount(), 4);
+    CORRADE_COMPARE(cache.evictionCount(), 0);
+
+    cache.resetStatistics();
+    CORRADE_COMPARE(cache.hitCount(), 0);
+    CORRADE_COMPARE(cache.missCount(), 0);
+}
+
+void DynamicGlyphCacheGLTest::evict() {
+    SquareFont font;
+    Text::DynamicGlyphCache cache(Vector2i(8));
+
+    /* Fill the whole cache */
+    font.fillGlyphCache(cache, "abcd");
+    CORRADE_COMPARE(cache.glyphCount(), 5);
+    cache.flush();
+    CORRADE_COMPARE(cache.frame(), 2);
+
+    /* Least recently used glyph is evicted */
+    font.fillGlyphCache(cache, "ab");
+    cache.flush();
+    font.fillGlyphCache(cache, "d");
+    font.fillGlyphCache(cache, "e");
+    CORRADE_COMPARE(cache.evictionCount(), 1);
+    CORRADE_COMPARE(cache.glyphCount(), 5);
+    CORRADE_VERIFY(!cache.contains('c'));
+    CORRADE_VERIFY(cache.contains('a'));
+    CORRADE_VERIFY(cache.contains('d'));
+    CORRADE_VERIFY(cache.contains('e'));
+
+    /* Evicted glyph is rendered again when needed */
+    cache.flush();
+    font.fillGlyphCache(cache, "c");
+    CORRADE_COMPARE(cache.evictionCount(), 2);
+    CORRADE_VERIFY(cache.contains('c'));
+    CORRADE_VERIFY(!cache.contains('a'));
+}
+
+void DynamicGlyphCacheGLTest::evictUsedInCurrentFrame() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    SquareFont font;
+    Text::DynamicGlyphCache cache(Vector2i(8));
+
+    /* Glyphs used in current frame are never evicted */
+    font.fillGlyphCache(cache, "abcde");
+    CORRADE_COMPARE(font.rendered, 0);
+    CORRADE_COMPARE(cache.glyphCount(), 1);
+    CORRADE_COMPARE(cache.evictionCount(), 0);
+    CORRADE_COMPARE(out.str(), "Text::DynamicGlyphCache::reserve(): cache size Vector(8, 8) is too small to fit 5 glyphs used in current frame\n");
+}
+
+void DynamicGlyphCacheGLTest::flush() {
+    SquareFont font;
+    Text::DynamicGlyphCache cache(Vector2i(8));
+
+    font.fillGlyphCache(cache, "ab");
+    cache.flush();
+    font.fillGlyphCache(cache, "c");
+    cache.flush();
+    MAGNUM_VERIFY_NO_ERROR();
+
+    #ifndef MAGNUM_TARGET_GLES
+    Image2D image(ColorFormat::Red, ColorType::UnsignedByte);
+    cache.texture().image(0, image);
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Glyphs uploaded in both batches are in the texture */
+    for(const char glyph: {'a', 'b', 'c'}) {
+        const Rectanglei rectangle = cache[glyph].second;
+        CORRADE_COMPARE(image.data()[rectangle.bottom()*8 + rectangle.left()], UnsignedByte(glyph));
+        CORRADE_COMPARE(image.data()[(rectangle.top() - 1)*8 + rectangle.right() - 1], UnsignedByte(glyph));
+    }
+    #else
+    CORRADE_SKIP("Texture image queries are not available on OpenGL ES.");
+    #endif
+}
+
+void DynamicGlyphCacheGLTest::flushOddSize() {
+    SquareFont font(3);
+    Text::DynamicGlyphCache cache(Vector2i(8));
+
+    /* Glyph rows are three bytes wide, which isn't a multiple of the default
+       pixel unpack alignment */
+    font.fillGlyphCache(cache, "abc");
+    cache.flush();
+    MAGNUM_VERIFY_NO_ERROR();
+
+    #ifndef MAGNUM_TARGET_GLES
+    Image2D image(ColorFormat::Red, ColorType::UnsignedByte);
+    cache.texture().image(0, image);
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* All pixels of all glyphs are in place */
+    for(const char glyph: {'a', 'b', 'c'}) {
+        const Rectanglei rectangle = cache[glyph].second;
+        CORRADE_COMPARE(rectangle.size(), Vector2i(3));
+        for(Int y = rectangle.bottom(); y != rectangle.top(); ++y)
+            for(Int x = rectangle.left(); x != rectangle.right(); ++x)
+                CORRADE_COMPARE(image.data()[y*8 + x], UnsignedByte(glyph));
+    }
+    #else
+    CORRADE_SKIP("Texture image queries are not available on OpenGL ES.");
+    #endif
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::DynamicGlyphCacheGLTest)
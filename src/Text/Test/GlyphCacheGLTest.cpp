@@ -22,6 +22,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
+
 #include "Test/AbstractOpenGLTester.h"
 #include "Text/GlyphCache.h"
 
@@ -86,7 +88,23 @@ void GlyphCacheGLTest::reserve() {
     Text::GlyphCache cache(Vector2i(236));
 
     /* Verify that this works for "empty" cache */
-    CORRADE_VERIFY(!cache.reserve({{5, 3}}).empty());
+    std::vector<Rectanglei> first = cache.reserve({{5, 3}});
+    CORRADE_COMPARE(first.size(), 1);
+    cache.insert(3, {}, first[0]);
+
+    /* Reserving in non-empty cache doesn't overlap previous regions */
+    std::vector<Rectanglei> second = cache.reserve({{236, 233}});
+    CORRADE_COMPARE(second.size(), 1);
+    CORRADE_VERIFY(second[0].bottom() >= first[0].top());
+
+    /* Space of erased glyph can be reused */
+    std::ostringstream out;
+    Error::setOutput(&out);
+    CORRADE_VERIFY(cache.reserve({{5, 4}}).empty());
+    CORRADE_COMPARE(out.str(), "Text::GlyphCache::reserve(): cache size Vector(236, 236) is too small to fit 1 more glyphs\n");
+    cache.erase(3);
+    CORRADE_VERIFY(!cache.contains(3));
+    CORRADE_COMPARE(cache.reserve({{5, 3}}), first);
 }
 
 }}}
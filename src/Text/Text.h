@@ -38,6 +38,7 @@ class AbstractFont;
 class AbstractFontConverter;
 class AbstractLayouter;
 class DistanceFieldGlyphCache;
+class DynamicGlyphCache;
 class GlyphCache;
 
 #ifndef MAGNUM_GCC46_COMPATIBILITY
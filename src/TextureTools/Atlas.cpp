@@ -24,36 +24,220 @@
 
 #include "Atlas.h"
 
+#include <algorithm>
+#include <numeric>
+#include <Utility/Assert.h>
+#include <Utility/Debug.h>
+
 #include "Math/Functions.h"
-#include "Math/Geometry/Rectangle.h"
 
 namespace Magnum { namespace TextureTools {
 
-std::vector<Rectanglei> atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding) {
-    if(sizes.empty()) return {};
+namespace {
+    inline bool contains(const Rectanglei& a, const Rectanglei& b) {
+        return a.left() <= b.left() && a.bottom() <= b.bottom() &&
+               a.right() >= b.right() && a.top() >= b.top();
+    }
 
-    /* Size of largest texture */
-    Vector2i maxSize;
-    for(const Vector2i& size: sizes)
-        maxSize = Math::max(maxSize, size);
+    inline bool overlaps(const Rectanglei& a, const Rectanglei& b) {
+        return a.left() < b.right() && a.right() > b.left() &&
+               a.bottom() < b.top() && a.top() > b.bottom();
+    }
 
-    std::vector<Rectanglei> atlas;
+    /* Splits free rectangles overlapped by the used one and removes the ones
+       which are contained in others */
+    void occupy(std::vector<Rectanglei>& free, const Rectanglei& used) {
+        const std::size_t count = free.size();
+        for(std::size_t i = 0; i != count; ++i) {
+            const Rectanglei f = free[i];
+            if(!overlaps(f, used)) continue;
+
+            if(used.left() > f.left())
+                free.push_back({f.bottomLeft(), {used.left(), f.top()}});
+            if(used.right() < f.right())
+                free.push_back({{used.right(), f.bottom()}, f.topRight()});
+            if(used.bottom() > f.bottom())
+                free.push_back({f.bottomLeft(), {f.right(), used.bottom()}});
+            if(used.top() < f.top())
+                free.push_back({{f.left(), used.top()}, f.topRight()});
+
+            /* Mark for removal */
+            free[i] = {};
+        }
+
+        /* Remove the split ones and the ones contained in others. The
+           original rectangles weren't contained in each other, so only pairs
+           with at least one new rectangle need to be checked. If two
+           rectangles are the same, only the latter is removed. */
+        std::vector<Rectanglei> pruned;
+        pruned.reserve(free.size());
+        for(std::size_t i = 0; i != free.size(); ++i) {
+            const Rectanglei& f = free[i];
+            if(!f.width() || !f.height()) continue;
+
+            bool contained = false;
+            for(std::size_t j = i < count ? count : 0; j != free.size() && !contained; ++j)
+                contained = i != j && contains(free[j], f) && (free[j] != f || j < i);
+            if(!contained) pruned.push_back(f);
+        }
+
+        free = std::move(pruned);
+    }
+
+    /* Adds the rectangle back to free ones, merging it with free rectangles
+       sharing whole edge with it */
+    void release(std::vector<Rectanglei>& free, Rectanglei released) {
+        for(bool merged = true; merged; ) {
+            merged = false;
+            for(auto it = free.begin(); it != free.end(); ++it) {
+                const Rectanglei& f = *it;
+                const bool horizontal = f.bottom() == released.bottom() && f.top() == released.top() &&
+                    (f.right() == released.left() || f.left() == released.right());
+                const bool vertical = f.left() == released.left() && f.right() == released.right() &&
+                    (f.top() == released.bottom() || f.bottom() == released.top());
+                if(!horizontal && !vertical) continue;
+
+                released = {Math::min(f.bottomLeft(), released.bottomLeft()),
+                            Math::max(f.topRight(), released.topRight())};
+                free.erase(it);
+                merged = true;
+                break;
+            }
+        }
+
+        /* Remove free rectangles contained in the merged one */
+        free.erase(std::remove_if(free.begin(), free.end(), [&released](const Rectanglei& f) {
+            return contains(released, f);
+        }), free.end());
+        free.push_back(released);
+    }
+}
+
+AtlasPacker::AtlasPacker(const Vector2i& pageSize, const Vector2i& padding, const Flags flags): _pageSize(pageSize), _padding(padding), _flags(flags), _sorting(Sorting::LongerSide), _usedArea(0) {
+    clear();
+}
+
+Float AtlasPacker::efficiency() const {
+    return Float(Double(_usedArea)/(Double(_pageSize.product())*_pages.size()));
+}
+
+void AtlasPacker::clear() {
+    _pages.assign(1, Page{{Rectanglei({}, _pageSize)}});
+    _usedArea = 0;
+}
+
+std::vector<AtlasPacker::Item> AtlasPacker::add(const std::vector<Vector2i>& sizes) {
+    /* Packing order, equal items stay in original order */
+    std::vector<std::size_t> order(sizes.size());
+    std::iota(order.begin(), order.end(), 0);
+    if(_sorting != Sorting::None) std::stable_sort(order.begin(), order.end(), [this, &sizes](std::size_t a, std::size_t b) {
+        const Vector2i& sizeA = sizes[a];
+        const Vector2i& sizeB = sizes[b];
+        switch(_sorting) {
+            case Sorting::Area:
+                return sizeA.product() > sizeB.product();
+            case Sorting::LongerSide:
+                return sizeA.max() > sizeB.max() ||
+                    (sizeA.max() == sizeB.max() && sizeA.min() > sizeB.min());
+            case Sorting::Height:
+                return sizeA.y() > sizeB.y() ||
+                    (sizeA.y() == sizeB.y() && sizeA.x() > sizeB.x());
+            case Sorting::None:
+                break;
+        }
 
-    /* Columns and rows */
-    const Vector2i paddedSize = maxSize+2*padding;
-    const Vector2i gridSize = atlasSize/paddedSize;
-    if(std::size_t(gridSize.product()) < sizes.size()) {
+        return false;
+    });
+
+    /* Pack into copy of the pages to leave the atlas untouched on failure */
+    std::vector<Page> pages = _pages;
+    std::vector<Item> items(sizes.size());
+    Long usedArea = 0;
+    for(std::size_t i: order) {
+        const Vector2i paddedSize = sizes[i] + 2*_padding;
+        if(!place(pages, paddedSize, items[i])) return {};
+
+        items[i].rectangle = Rectanglei::fromSize(items[i].rectangle.bottomLeft() + _padding,
+            items[i].rotated ? Vector2i(sizes[i].y(), sizes[i].x()) : sizes[i]);
+        usedArea += Long(paddedSize.x())*paddedSize.y();
+    }
+
+    _pages = std::move(pages);
+    _usedArea += usedArea;
+    return items;
+}
+
+void AtlasPacker::remove(const Item& item) {
+    CORRADE_ASSERT(item.page < _pages.size(),
+        "TextureTools::AtlasPacker::remove(): page" << item.page << "out of range for" << _pages.size() << "pages", );
+
+    const Rectanglei padded(item.rectangle.bottomLeft() - _padding, item.rectangle.topRight() + _padding);
+    release(_pages[item.page].free, padded);
+    _usedArea -= Long(padded.width())*padded.height();
+}
+
+bool AtlasPacker::place(std::vector<Page>& pages, const Vector2i& size, Item& item) const {
+    const Vector2i rotatedSize(size.y(), size.x());
+    const bool tryRotated = (_flags & Flag::AllowRotation) && size.x() != size.y();
+    const bool fitsEmptyPage = (size.x() <= _pageSize.x() && size.y() <= _pageSize.y()) ||
+        (tryRotated && rotatedSize.x() <= _pageSize.x() && rotatedSize.y() <= _pageSize.y());
+
+    for(std::size_t page = 0; page <= pages.size(); ++page) {
+        /* Add new page if not fitting into any of the existing ones */
+        if(page == pages.size()) {
+            if(!(_flags & Flag::MultiplePages) || !fitsEmptyPage) return false;
+            pages.push_back(Page{{Rectanglei({}, _pageSize)}});
+        }
+
+        /* Best short side fit */
+        std::vector<Rectanglei>& free = pages[page].free;
+        Int bestShortSide = 0, bestLongSide = 0;
+        const Rectanglei* best = nullptr;
+        bool bestRotated = false;
+        for(const Rectanglei& f: free) for(bool rotated: {false, true}) {
+            if(rotated && !tryRotated) continue;
+
+            const Vector2i leftover = f.size() - (rotated ? rotatedSize : size);
+            if(leftover.x() < 0 || leftover.y() < 0) continue;
+
+            const Int shortSide = leftover.min();
+            const Int longSide = leftover.max();
+            if(!best || shortSide < bestShortSide || (shortSide == bestShortSide && longSide < bestLongSide)) {
+                best = &f;
+                bestShortSide = shortSide;
+                bestLongSide = longSide;
+                bestRotated = rotated;
+            }
+        }
+
+        if(!best) continue;
+
+        item.rectangle = Rectanglei::fromSize(best->bottomLeft(), bestRotated ? rotatedSize : size);
+        item.page = page;
+        item.rotated = bestRotated;
+        occupy(free, item.rectangle);
+        return true;
+    }
+
+    return false;
+}
+
+std::vector<Rectanglei> atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding) {
+    if(sizes.empty()) return {};
+
+    AtlasPacker packer(atlasSize, padding);
+    const std::vector<AtlasPacker::Item> items = packer.add(sizes);
+    if(items.empty()) {
         Error() << "TextureTools::atlas(): requested atlas size" << atlasSize
-                << "is too small to fit" << sizes.size() << paddedSize
+                << "is too small to fit" << sizes.size()
                 << "textures. Generated atlas will be empty.";
-        return atlas;
+        return {};
     }
 
-    /** @todo actual magic implementation, not this joke */
-
-    atlas.reserve(sizes.size());
-    for(std::size_t i = 0; i != sizes.size(); ++i)
-        atlas.push_back(Rectanglei::fromSize(Vector2i(i%gridSize.x(), i/gridSize.x())*paddedSize+padding, sizes[i]));
+    std::vector<Rectanglei> atlas;
+    atlas.reserve(items.size());
+    for(const AtlasPacker::Item& item: items)
+        atlas.push_back(item.rectangle);
 
     return atlas;
 }
@@ -25,26 +25,196 @@
 */
 
 /** @file
- * @brief Function Magnum::TextureTools::atlas()
+ * @brief Class Magnum::TextureTools::AtlasPacker, function Magnum::TextureTools::atlas()
  */
 
 #include <vector>
+#include <Containers/EnumSet.h>
 
 #include "Math/Vector2.h"
+#include "Math/Geometry/Rectangle.h"
 #include "Magnum.h"
 
 #include "magnumTextureToolsVisibility.h"
 
 namespace Magnum { namespace TextureTools {
 
+/**
+@brief Texture atlas packer
+
+Packs rectangles of arbitrary sizes into one or more pages of given size using
+MaxRects algorithm -- the packer keeps list of maximal free rectangles in each
+page and places each item into the free rectangle which leaves least space on
+its shorter side. Unlike fixed grid, items of mixed sizes (e.g. glyphs) are
+packed tightly and more items can be added to already packed atlas later.
+@code
+TextureTools::AtlasPacker packer({512, 512}, {1, 1});
+std::vector<TextureTools::AtlasPacker::Item> glyphs = packer.add(glyphSizes);
+
+// Later, with glyphs not yet in the atlas
+std::vector<TextureTools::AtlasPacker::Item> moreGlyphs = packer.add(otherGlyphSizes);
+@endcode
+
+Items are placed in the order given by @ref setSorting(), largest first by
+default. Items can be rotated by 90° to fit better if
+@ref Flag::AllowRotation is set, if @ref Flag::MultiplePages is set, new page
+is added when items don't fit into existing ones.
+@see atlas()
+*/
+class MAGNUM_TEXTURETOOLS_EXPORT AtlasPacker {
+    public:
+        /**
+         * @brief Packing flag
+         *
+         * @see Flags, flags()
+         */
+        enum class Flag: UnsignedByte {
+            /** Allow rotating items by 90° if they fit better that way */
+            AllowRotation = 1 << 0,
+
+            /** Add new page if the items don't fit into existing pages */
+            MultiplePages = 1 << 1
+        };
+
+        /**
+         * @brief Packing flags
+         *
+         * @see flags()
+         */
+        typedef Containers::EnumSet<Flag, UnsignedByte> Flags;
+
+        /**
+         * @brief Order in which items are packed
+         *
+         * Packing larger items first generally results in better
+         * efficiency.
+         * @see setSorting()
+         */
+        enum class Sorting: UnsignedByte {
+            None,           /**< In the order they were passed */
+            Area,           /**< Largest area first */
+            LongerSide,     /**< Longest longer side first */
+            Height          /**< Highest first */
+        };
+
+        /** @brief Packed item */
+        struct Item {
+            /**
+             * @brief Region in the page
+             *
+             * Without padding. If the item is rotated, width and height are
+             * swapped compared to the original size.
+             */
+            Rectanglei rectangle;
+
+            /** @brief Page index */
+            UnsignedInt page;
+
+            /** @brief Whether the item is rotated by 90° */
+            bool rotated;
+        };
+
+        /**
+         * @brief Constructor
+         * @param pageSize  Size of each page
+         * @param padding   Padding around each item
+         * @param flags     Packing flags
+         *
+         * Padding is added twice to each item size and the items are laid
+         * out so the padding doesn't overlap. One empty page is created.
+         */
+        explicit AtlasPacker(const Vector2i& pageSize, const Vector2i& padding = Vector2i(), Flags flags = Flags());
+
+        /** @brief Page size */
+        Vector2i pageSize() const { return _pageSize; }
+
+        /** @brief Padding around each item */
+        Vector2i padding() const { return _padding; }
+
+        /** @brief Packing flags */
+        Flags flags() const { return _flags; }
+
+        /** @brief Packing order */
+        Sorting sorting() const { return _sorting; }
+
+        /**
+         * @brief Set packing order
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @ref Sorting::LongerSide.
+         */
+        AtlasPacker& setSorting(Sorting sorting) {
+            _sorting = sorting;
+            return *this;
+        }
+
+        /** @brief Page count */
+        UnsignedInt pageCount() const { return _pages.size(); }
+
+        /**
+         * @brief Packing efficiency
+         *
+         * Ratio of area covered by items (including padding) to area of
+         * all pages.
+         */
+        Float efficiency() const;
+
+        /**
+         * @brief Add items
+         * @param sizes     Item sizes, without padding
+         *
+         * Returns placement of each item in the same order as @p sizes. If
+         * any of the items cannot be placed, the atlas is left unchanged
+         * and empty vector is returned.
+         */
+        std::vector<Item> add(const std::vector<Vector2i>& sizes);
+
+        /**
+         * @brief Remove item
+         *
+         * Returns space occupied by given item (including padding) back to
+         * its page so it can be reused by subsequent @ref add() calls. The
+         * item is expected to be previously returned from @ref add() and
+         * not yet removed. Adjacent free rectangles are merged back
+         * together, but the free space is generally more fragmented than if
+         * the remaining items were packed from scratch.
+         */
+        void remove(const Item& item);
+
+        /**
+         * @brief Clear the atlas
+         *
+         * Removes all items and pages except for the first one, which is
+         * empty afterwards.
+         */
+        void clear();
+
+    private:
+        /* Maximal free rectangles, including padding */
+        struct Page {
+            std::vector<Rectanglei> free;
+        };
+
+        bool MAGNUM_LOCAL place(std::vector<Page>& pages, const Vector2i& size, Item& item) const;
+
+        Vector2i _pageSize, _padding;
+        Flags _flags;
+        Sorting _sorting;
+        std::vector<Page> _pages;
+        Long _usedArea;
+};
+
+CORRADE_ENUMSET_OPERATORS(AtlasPacker::Flags)
+
 /**
 @brief Pack textures into texture atlas
 @param atlasSize    Size of resulting atlas
 @param sizes        Sizes of all textures in the atlas
 @param padding      Padding around each texture
 
-Packs many small textures into one larger. If the textures cannot be packed
-into required size, empty vector is returned.
+Packs many small textures into one larger using @ref AtlasPacker, without
+rotation. If the textures cannot be packed into required size, empty vector
+is returned.
 
 Padding is added twice to each size and the atlas is laid out so the padding
 don't overlap. Returned sizes are the same as original sizes, i.e. without the
@@ -24,11 +24,16 @@
 
 #include "TextureTools/DistanceField.h"
 
+#include <cmath>
+#include <vector>
 #include <Utility/Resource.h>
+#include "Math/Batch.h"
 #include "Math/Geometry/Rectangle.h"
 #include "AbstractShaderProgram.h"
+#include "ColorFormat.h"
 #include "Extensions.h"
 #include "Framebuffer.h"
+#include "ImageReference.h"
 #include "Mesh.h"
 #include "Shader.h"
 #include "Texture.h"
@@ -197,4 +202,138 @@ void distanceField(Texture2D& input, Texture2D& output, const Rectanglei& rectan
     mesh.draw();
 }
 
+namespace {
+    inline bool isOneChannel(const ImageReference2D& image) {
+        return (image.format() == ColorFormat::Red
+            #ifdef MAGNUM_TARGET_GLES2
+            || image.format() == ColorFormat::Luminance
+            #endif
+            ) && image.type() == ColorType::UnsignedByte;
+    }
+
+    /* Rows of one-byte images are aligned to four bytes, the same as with
+       default GL_PACK_ALIGNMENT and GL_UNPACK_ALIGNMENT */
+    inline std::size_t rowLength(const Int width) {
+        return (width + 3)/4*4;
+    }
+
+    /* Floor of integer division with positive divisor */
+    inline Int floorDivide(const Int a, const Int b) {
+        return a >= 0 ? a/b : -((-a + b - 1)/b);
+    }
+
+    /* Second phase of Meijster's algorithm for one row. The squared
+       distances are bounded, so the division never overflows. */
+    void transformRow(const Int* const g, const Int size, Int* const s, Int* const t, Int* const out) {
+        const auto f = [g](const Int x, const Int i) { return (x - i)*(x - i) + g[i]*g[i]; };
+
+        Int q = 0;
+        s[0] = t[0] = 0;
+        for(Int u = 1; u != size; ++u) {
+            while(q >= 0 && f(t[q], s[q]) > f(t[q], u)) --q;
+
+            if(q < 0) {
+                q = 0;
+                s[0] = u;
+            } else {
+                const Int w = 1 + floorDivide(u*u - s[q]*s[q] + g[u]*g[u] - g[s[q]]*g[s[q]], 2*(u - s[q]));
+                if(w < size) {
+                    ++q;
+                    s[q] = u;
+                    t[q] = w;
+                }
+            }
+        }
+
+        for(Int u = size - 1; u >= 0; --u) {
+            out[u] = f(u, s[q]);
+            if(u == t[q]) --q;
+        }
+    }
+}
+
+void distanceField(const ImageReference2D& input, ImageReference2D& output, const Rectanglei& rectangle, const Int radius, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(isOneChannel(input),
+        "TextureTools::distanceField(): expected one-channel one-byte input image, got" << input.format() << input.type(), );
+    CORRADE_ASSERT(isOneChannel(output),
+        "TextureTools::distanceField(): expected one-channel one-byte output image, got" << output.format() << output.type(), );
+    CORRADE_ASSERT(rectangle.left() >= 0 && rectangle.bottom() >= 0 && rectangle.right() <= output.size().x() && rectangle.top() <= output.size().y(),
+        "TextureTools::distanceField(): rectangle" << rectangle << "is out of output image of size" << output.size(), );
+
+    /* Input with one pixel of black border, emulating lookups outside of the
+       texture in the shader */
+    const Vector2i size = input.size() + Vector2i(2);
+    const std::size_t inputRowLength = rowLength(input.size().x());
+    std::vector<bool> inside(size.product(), false);
+    for(Int y = 0; y != input.size().y(); ++y)
+        for(Int x = 0; x != input.size().x(); ++x)
+            inside[(y + 1)*size.x() + x + 1] = input.data()[y*inputRowLength + x] > 127;
+
+    /* The shader doesn't look farther than the radius, so all distances are
+       clamped to radius + 1. That doesn't change the values below the bound
+       and keeps the squared distances small. */
+    const Int bound = radius + 1;
+
+    /* First phase: distance to nearest pixel of opposite color in the same
+       column, for inside pixels to outside ones and vice versa */
+    std::vector<Int> g(size.product());
+    Math::Batch::Implementation::parallelRanges(size.x(), 16, threadCount, [&](std::size_t, std::size_t begin, std::size_t end) {
+        for(Int x = begin; x != Int(end); ++x) {
+            /* Top-down and bottom-up scan for both colors at once, opposite
+               color of the pixel is at distance 0 for the other color */
+            Int distance[2]{bound, bound};
+            for(Int y = 0; y != size.y(); ++y) {
+                const bool in = inside[y*size.x() + x];
+                distance[in] = 0;
+                distance[!in] = Math::min(distance[!in] + 1, bound);
+                g[y*size.x() + x] = distance[!in];
+            }
+
+            distance[0] = distance[1] = bound;
+            for(Int y = size.y() - 1; y >= 0; --y) {
+                const bool in = inside[y*size.x() + x];
+                distance[in] = 0;
+                distance[!in] = Math::min(distance[!in] + 1, bound);
+                Int& column = g[y*size.x() + x];
+                column = Math::min(column, distance[!in]);
+            }
+        }
+    });
+
+    /* Second phase: squared distance in whole image. Each row is transformed
+       for both colors, pixels of the other color are at zero distance from
+       it. */
+    std::vector<Int> distances(size.product());
+    Math::Batch::Implementation::parallelRanges(input.size().y(), 16, threadCount, [&](std::size_t, std::size_t begin, std::size_t end) {
+        std::vector<Int> colorG(size.x()), s(size.x()), t(size.x()), out(size.x());
+        for(Int y = begin + 1; y != Int(end) + 1; ++y) {
+            const std::size_t row = y*size.x();
+            for(const bool in: {false, true}) {
+                for(Int x = 0; x != size.x(); ++x)
+                    colorG[x] = inside[row + x] == in ? g[row + x] : 0;
+                transformRow(colorG.data(), size.x(), s.data(), t.data(), out.data());
+                for(Int x = 0; x != size.x(); ++x)
+                    if(inside[row + x] == in) distances[row + x] = out[x];
+            }
+        }
+    });
+
+    /* Signed distance normalized from [-radius-1, radius+1] to [0, 1] */
+    const Vector2 scaling = Vector2(input.size())/Vector2(rectangle.size());
+    const std::size_t outputRowLength = rowLength(output.size().x());
+    Math::Batch::Implementation::parallelRanges(rectangle.size().y(), 16, threadCount, [&](std::size_t, std::size_t begin, std::size_t end) {
+        for(Int y = begin; y != Int(end); ++y) {
+            const Int inputY = Math::min(Int(Float(y)*scaling.y()), input.size().y() - 1) + 1;
+            unsigned char* const row = output.data() + (rectangle.bottom() + y)*outputRowLength + rectangle.left();
+            for(Int x = 0; x != rectangle.size().x(); ++x) {
+                const Int inputX = Math::min(Int(Float(x)*scaling.x()), input.size().x() - 1) + 1;
+                const std::size_t i = inputY*size.x() + inputX;
+                const Float distance = std::sqrt(Float(Math::min(distances[i], bound*bound)));
+                const Float value = (inside[i] ? distance : -distance)/Float(bound*2) + 0.5f;
+                row[x] = UnsignedByte(value*255.0f + 0.5f);
+            }
+        }
+    });
+}
+
 }}
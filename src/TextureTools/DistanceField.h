@@ -71,7 +71,9 @@ Based on: *Chris Green - Improved Alpha-Tested Magnification for Vector Textures
 and Special Effects, SIGGRAPH 2007,
 http://www.valvesoftware.com/publications/2007/SIGGRAPH2007_AlphaTestedMagnification.pdf*
 
-@attention This is GPU-only implementation, so it expects active context.
+@attention This is GPU implementation, so it expects active context. See
+    @ref distanceField(const ImageReference2D&, ImageReference2D&, const Rectanglei&, Int, UnsignedInt)
+    for CPU implementation.
 
 @note If internal format of @p output texture is not renderable, this function
     prints message to error output and does nothing. In desktop OpenGL and
@@ -90,6 +92,37 @@ void MAGNUM_TEXTURETOOLS_EXPORT distanceField(Texture2D& input, Texture2D& outpu
 void MAGNUM_TEXTURETOOLS_EXPORT distanceField(Texture2D& input, Texture2D& output, const Rectanglei& rectangle, Int radius, const Vector2i& imageSize);
 #endif
 
+/**
+@brief Create signed distance field on CPU
+@param input        Input image
+@param output       Output image
+@param rectangle    Rectangle in output image where to render
+@param radius       Max lookup radius in input image
+@param threadCount  Count of threads to use
+
+Same as @ref distanceField(Texture2D&, Texture2D&, const Rectanglei&, Int, const Vector2i&),
+but doesn't need any GL context. Both images are expected to have
+@ref ColorType::UnsignedByte type and @ref ColorFormat::Red format (or
+@ref ColorFormat::Luminance in OpenGL ES 2.0) with rows aligned to four
+bytes, the same as with default pixel pack and unpack alignment. Pixel of
+@p rectangle at position @f$ \boldsymbol{p} @f$ (relative to the rectangle)
+corresponds to input pixel at @f$ \lfloor \boldsymbol{p} s \rfloor @f$,
+where @f$ s @f$ is ratio of input image size and rectangle size. Pixels
+outside of the input image are treated as black, the same as in the GPU
+implementation.
+
+Instead of searching @p radius-sized neighborhood of each pixel, exact
+Euclidean distance transform of whole input image is computed, which is
+linear in pixel count regardless of @p radius. The transform is done first
+for all columns and then for all rows, both split among @p threadCount
+threads.
+
+Based on: *A. Meijster, J. B. T. M. Roerdink, W. H. Hesselink - A General
+Algorithm for Computing Distance Transforms in Linear Time, Mathematical
+Morphology and its Applications to Image and Signal Processing, 2002*
+*/
+void MAGNUM_TEXTURETOOLS_EXPORT distanceField(const ImageReference2D& input, ImageReference2D& output, const Rectanglei& rectangle, Int radius, UnsignedInt threadCount = 1);
+
 }}
 
 #endif
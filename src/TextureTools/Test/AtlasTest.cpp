@@ -38,13 +38,31 @@ class AtlasTest: public TestSuite::Tester {
         void createPadding();
         void createEmpty();
         void createTooSmall();
+
+        void packerIncremental();
+        void packerTooLarge();
+        void packerRotation();
+        void packerMultiplePages();
+        void packerSorting();
+        void packerClear();
+        void packerRemove();
+        void packerGlyphs();
 };
 
 AtlasTest::AtlasTest() {
     addTests({&AtlasTest::create,
               &AtlasTest::createPadding,
               &AtlasTest::createEmpty,
-              &AtlasTest::createTooSmall});
+              &AtlasTest::createTooSmall,
+
+              &AtlasTest::packerIncremental,
+              &AtlasTest::packerTooLarge,
+              &AtlasTest::packerRotation,
+              &AtlasTest::packerMultiplePages,
+              &AtlasTest::packerSorting,
+              &AtlasTest::packerClear,
+              &AtlasTest::packerRemove,
+              &AtlasTest::packerGlyphs});
 }
 
 void AtlasTest::create() {
@@ -56,9 +74,9 @@ void AtlasTest::create() {
 
     CORRADE_COMPARE(atlas.size(), 3);
     CORRADE_COMPARE(atlas, (std::vector<Rectanglei>{
-        Rectanglei::fromSize({0, 0}, {12, 18}),
-        Rectanglei::fromSize({32, 0}, {32, 15}),
-        Rectanglei::fromSize({0, 25}, {23, 25})}));
+        Rectanglei::fromSize({0, 15}, {12, 18}),
+        Rectanglei::fromSize({0, 0}, {32, 15}),
+        Rectanglei::fromSize({32, 0}, {23, 25})}));
 }
 
 void AtlasTest::createPadding() {
@@ -70,9 +88,9 @@ void AtlasTest::createPadding() {
 
     CORRADE_COMPARE(atlas.size(), 3);
     CORRADE_COMPARE(atlas, (std::vector<Rectanglei>{
-        Rectanglei::fromSize({2, 1}, {8, 16}),
-        Rectanglei::fromSize({34, 1}, {28, 13}),
-        Rectanglei::fromSize({2, 26}, {19, 23})}));
+        Rectanglei::fromSize({2, 16}, {8, 16}),
+        Rectanglei::fromSize({2, 1}, {28, 13}),
+        Rectanglei::fromSize({34, 1}, {19, 23})}));
 }
 
 void AtlasTest::createEmpty() {
@@ -84,13 +102,163 @@ void AtlasTest::createTooSmall() {
     std::ostringstream o;
     Error::setOutput(&o);
 
-    std::vector<Rectanglei> atlas = TextureTools::atlas({64, 32}, {
+    std::vector<Rectanglei> atlas = TextureTools::atlas({32, 32}, {
         {8, 16},
         {21, 13},
         {19, 29}
     }, {2, 1});
     CORRADE_VERIFY(atlas.empty());
-    CORRADE_COMPARE(o.str(), "TextureTools::atlas(): requested atlas size Vector(64, 32) is too small to fit 3 Vector(25, 31) textures. Generated atlas will be empty.\n");
+    CORRADE_COMPARE(o.str(), "TextureTools::atlas(): requested atlas size Vector(32, 32) is too small to fit 3 textures. Generated atlas will be empty.\n");
+}
+
+void AtlasTest::packerIncremental() {
+    AtlasPacker packer({64, 64});
+
+    std::vector<AtlasPacker::Item> first = packer.add({{40, 40}});
+    CORRADE_COMPARE(first.size(), 1);
+    CORRADE_COMPARE(first[0].rectangle, Rectanglei::fromSize({}, {40, 40}));
+    CORRADE_COMPARE(first[0].page, 0);
+    CORRADE_VERIFY(!first[0].rotated);
+
+    /* Doesn't fit, the atlas is left unchanged */
+    CORRADE_VERIFY(packer.add({{24, 24}, {40, 40}}).empty());
+
+    /* The whole space on the right is still free */
+    std::vector<AtlasPacker::Item> second = packer.add({{24, 64}});
+    CORRADE_COMPARE(second.size(), 1);
+    CORRADE_COMPARE(second[0].rectangle, Rectanglei::fromSize({40, 0}, {24, 64}));
+
+    std::vector<AtlasPacker::Item> third = packer.add({{40, 24}});
+    CORRADE_COMPARE(third.size(), 1);
+    CORRADE_COMPARE(third[0].rectangle, Rectanglei::fromSize({0, 40}, {40, 24}));
+
+    /* Full */
+    CORRADE_COMPARE(packer.pageCount(), 1);
+    CORRADE_COMPARE(packer.efficiency(), 1.0f);
+    CORRADE_VERIFY(packer.add({{1, 1}}).empty());
+}
+
+void AtlasTest::packerTooLarge() {
+    AtlasPacker packer({64, 64}, {2, 2}, AtlasPacker::Flag::MultiplePages|AtlasPacker::Flag::AllowRotation);
+
+    /* Doesn't fit in any orientation including padding, no page is added */
+    CORRADE_VERIFY(packer.add({{62, 4}}).empty());
+    CORRADE_COMPARE(packer.pageCount(), 1);
+    CORRADE_COMPARE(packer.add({{60, 4}}).size(), 1);
+}
+
+void AtlasTest::packerRotation() {
+    AtlasPacker packer({64, 24});
+    CORRADE_VERIFY(packer.add({{16, 64}}).empty());
+
+    AtlasPacker rotating({64, 24}, {}, AtlasPacker::Flag::AllowRotation);
+    std::vector<AtlasPacker::Item> items = rotating.add({{16, 64}, {8, 8}});
+    CORRADE_COMPARE(items.size(), 2);
+    CORRADE_VERIFY(items[0].rotated);
+    CORRADE_COMPARE(items[0].rectangle, Rectanglei::fromSize({}, {64, 16}));
+    CORRADE_VERIFY(!items[1].rotated);
+    CORRADE_COMPARE(items[1].rectangle, Rectanglei::fromSize({0, 16}, {8, 8}));
+}
+
+void AtlasTest::packerMultiplePages() {
+    AtlasPacker packer({32, 32}, {}, AtlasPacker::Flag::MultiplePages);
+    CORRADE_COMPARE(packer.flags(), AtlasPacker::Flag::MultiplePages);
+
+    std::vector<AtlasPacker::Item> items = packer.add({{16, 16}, {16, 16}, {16, 16}, {16, 16}, {16, 16}});
+    CORRADE_COMPARE(items.size(), 5);
+    CORRADE_COMPARE(packer.pageCount(), 2);
+    for(std::size_t i = 0; i != 4; ++i)
+        CORRADE_COMPARE(items[i].page, 0);
+    CORRADE_COMPARE(items[4].page, 1);
+    CORRADE_COMPARE(items[4].rectangle, Rectanglei::fromSize({}, {16, 16}));
+    CORRADE_COMPARE(packer.efficiency(), 0.625f);
+
+    /* Existing pages are filled first */
+    std::vector<AtlasPacker::Item> more = packer.add({{16, 16}});
+    CORRADE_COMPARE(more.size(), 1);
+    CORRADE_COMPARE(more[0].page, 1);
+}
+
+void AtlasTest::packerSorting() {
+    AtlasPacker packer({64, 64});
+    CORRADE_VERIFY(packer.sorting() == AtlasPacker::Sorting::LongerSide);
+
+    /* Largest is placed first */
+    std::vector<AtlasPacker::Item> sorted = packer.add({{8, 8}, {32, 8}});
+    CORRADE_COMPARE(sorted.size(), 2);
+    CORRADE_COMPARE(sorted[1].rectangle.bottomLeft(), Vector2i());
+
+    packer.clear();
+    packer.setSorting(AtlasPacker::Sorting::None);
+    std::vector<AtlasPacker::Item> unsorted = packer.add({{8, 8}, {32, 8}});
+    CORRADE_COMPARE(unsorted.size(), 2);
+    CORRADE_COMPARE(unsorted[0].rectangle.bottomLeft(), Vector2i());
+}
+
+void AtlasTest::packerClear() {
+    AtlasPacker packer({32, 32}, {}, AtlasPacker::Flag::MultiplePages);
+    packer.add({{32, 32}, {32, 32}});
+    CORRADE_COMPARE(packer.pageCount(), 2);
+
+    packer.clear();
+    CORRADE_COMPARE(packer.pageCount(), 1);
+    CORRADE_COMPARE(packer.efficiency(), 0.0f);
+    CORRADE_COMPARE(packer.add({{32, 32}}).size(), 1);
+}
+
+void AtlasTest::packerRemove() {
+    AtlasPacker packer({32, 32}, {1, 1});
+    std::vector<AtlasPacker::Item> items = packer.add({{14, 14}, {14, 14}, {14, 14}, {14, 14}});
+    CORRADE_COMPARE(items.size(), 4);
+    CORRADE_COMPARE(packer.efficiency(), 1.0f);
+    CORRADE_VERIFY(packer.add({{2, 2}}).empty());
+
+    /* Space of removed item can be reused */
+    packer.remove(items[1]);
+    CORRADE_COMPARE(packer.efficiency(), 0.75f);
+    std::vector<AtlasPacker::Item> replaced = packer.add({{14, 14}});
+    CORRADE_COMPARE(replaced.size(), 1);
+    CORRADE_COMPARE(replaced[0].rectangle, items[1].rectangle);
+
+    /* Space of adjacent removed items is merged */
+    packer.remove(items[0]);
+    packer.remove(replaced[0]);
+    CORRADE_COMPARE(packer.efficiency(), 0.5f);
+    std::vector<AtlasPacker::Item> merged = packer.add({{30, 14}});
+    CORRADE_COMPARE(merged.size(), 1);
+    CORRADE_COMPARE(packer.efficiency(), 1.0f);
+}
+
+void AtlasTest::packerGlyphs() {
+    /* Glyph-like sizes, the original grid layout would need 345x345 for
+       these, i.e. more than twice the area */
+    std::vector<Vector2i> sizes;
+    UnsignedInt seed = 7;
+    for(std::size_t i = 0; i != 300; ++i) {
+        seed = seed*1103515245 + 12345;
+        const Int width = 4 + (seed >> 16)%13;
+        seed = seed*1103515245 + 12345;
+        const Int height = 6 + (seed >> 16)%15;
+        sizes.push_back({width, height});
+    }
+
+    AtlasPacker packer({240, 240}, {1, 1});
+    std::vector<AtlasPacker::Item> items = packer.add(sizes);
+    CORRADE_COMPARE(items.size(), 300);
+    CORRADE_VERIFY(packer.efficiency() > 0.85f);
+
+    /* Items with padding are inside the page and don't overlap */
+    for(std::size_t i = 0; i != items.size(); ++i) {
+        const Rectanglei a = items[i].rectangle;
+        CORRADE_COMPARE(a.size(), sizes[i]);
+        CORRADE_VERIFY(a.left() >= 1 && a.bottom() >= 1 && a.right() <= 239 && a.top() <= 239);
+
+        for(std::size_t j = 0; j != i; ++j) {
+            const Rectanglei b = items[j].rectangle;
+            CORRADE_VERIFY(a.left() - 1 >= b.right() + 1 || a.right() + 1 <= b.left() - 1 ||
+                           a.bottom() - 1 >= b.top() + 1 || a.top() + 1 <= b.bottom() - 1);
+        }
+    }
 }
 
 }}}
@@ -0,0 +1,199 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <vector>
+#include <TestSuite/Tester.h>
+
+#include "Math/Functions.h"
+#include "Math/Geometry/Rectangle.h"
+#include "ColorFormat.h"
+#include "ImageReference.h"
+#include "TextureTools/DistanceField.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+class DistanceFieldTest: public TestSuite::Tester {
+    public:
+        explicit DistanceFieldTest();
+
+        void shader();
+        void scaled();
+        void empty();
+        void oddWidth();
+        void threads();
+};
+
+DistanceFieldTest::DistanceFieldTest() {
+    addTests({&DistanceFieldTest::shader,
+              &DistanceFieldTest::scaled,
+              &DistanceFieldTest::empty,
+              &DistanceFieldTest::oddWidth,
+              &DistanceFieldTest::threads});
+}
+
+namespace {
+
+/* Rows of the images are aligned to four bytes */
+std::size_t rowLength(const Int width) { return (width + 3)/4*4; }
+
+/* Few overlapping circles and rectangles */
+std::vector<unsigned char> shapes(const Vector2i& size) {
+    std::vector<unsigned char> data(rowLength(size.x())*size.y());
+    for(Int y = 0; y != size.y(); ++y) for(Int x = 0; x != size.x(); ++x) {
+        const Vector2 p = Vector2(x, y)/Vector2(size);
+        const bool inside = (p - Vector2(0.3f, 0.4f)).dot() < 0.04f ||
+            (p - Vector2(0.75f, 0.7f)).dot() < 0.01f ||
+            (p.x() > 0.55f && p.x() < 0.95f && p.y() > 0.1f && p.y() < 0.3f) ||
+            (p.x() > 0.1f && p.x() < 0.15f && p.y() > 0.7f);
+        data[y*rowLength(size.x()) + x] = inside ? 255 : 0;
+    }
+    return data;
+}
+
+/* Brute-force lookup done the same way as in the shader */
+UnsignedByte shaderValue(const ImageReference2D& input, const Vector2i& position, const Int radius) {
+    const auto hasValue = [&input](const Vector2i& p) {
+        return p.x() >= 0 && p.y() >= 0 && p.x() < input.size().x() && p.y() < input.size().y() &&
+            input.data()[p.y()*rowLength(input.size().x()) + p.x()] > 127;
+    };
+
+    const bool isInside = hasValue(position);
+    Float minDistanceSquared = Float((radius + 1)*(radius + 1));
+    Int radiusLimit = radius;
+    for(Int i = 1; i <= radiusLimit; ++i) for(Int j = 0; j != i*2; ++j) {
+        const Vector2i offset(-i + j, i);
+        if(hasValue(position + offset) == !isInside ||
+           hasValue(position + Vector2i(-offset.y(), offset.x())) == !isInside ||
+           hasValue(position - offset) == !isInside ||
+           hasValue(position + Vector2i(offset.y(), -offset.x())) == !isInside) {
+            const Float distanceSquared = Float(offset.dot());
+            if(minDistanceSquared < distanceSquared) continue;
+            minDistanceSquared = distanceSquared;
+            radiusLimit = Math::min(radius, Int(std::floor(std::sqrt(distanceSquared))));
+        }
+    }
+
+    const Float value = (isInside ? 1.0f : -1.0f)*std::sqrt(minDistanceSquared)/Float(radius*2 + 2) + 0.5f;
+    return UnsignedByte(value*255.0f + 0.5f);
+}
+
+}
+
+void DistanceFieldTest::shader() {
+    const Vector2i size(68, 45);
+    std::vector<unsigned char> inputData = shapes(size);
+    std::vector<unsigned char> outputData(size.product());
+    const ImageReference2D input(ColorFormat::Red, ColorType::UnsignedByte, size, inputData.data());
+    ImageReference2D output(ColorFormat::Red, ColorType::UnsignedByte, size, outputData.data());
+
+    distanceField(input, output, {{}, size}, 7);
+
+    std::size_t mismatches = 0;
+    for(Int y = 0; y != size.y(); ++y) for(Int x = 0; x != size.x(); ++x)
+        if(outputData[y*size.x() + x] != shaderValue(input, {x, y}, 7)) ++mismatches;
+    CORRADE_COMPARE(mismatches, 0);
+
+    /* Far from edges the value is saturated */
+    CORRADE_COMPARE(outputData[0], 0);
+    CORRADE_COMPARE(outputData[Int(0.4f*size.y())*size.x() + Int(0.3f*size.x())], 255);
+}
+
+void DistanceFieldTest::scaled() {
+    const Vector2i inputSize(128, 96);
+    std::vector<unsigned char> inputData = shapes(inputSize);
+    std::vector<unsigned char> outputData(48*40, 0x5a);
+    const ImageReference2D input(ColorFormat::Red, ColorType::UnsignedByte, inputSize, inputData.data());
+    ImageReference2D output(ColorFormat::Red, ColorType::UnsignedByte, {48, 40}, outputData.data());
+
+    const Rectanglei rectangle = Rectanglei::fromSize({8, 4}, {32, 24});
+    distanceField(input, output, rectangle, 12);
+
+    std::size_t mismatches = 0, untouched = 0;
+    for(Int y = 0; y != 40; ++y) for(Int x = 0; x != 48; ++x) {
+        const UnsignedByte value = outputData[y*48 + x];
+        if(x < rectangle.left() || x >= rectangle.right() || y < rectangle.bottom() || y >= rectangle.top()) {
+            if(value == 0x5a) ++untouched;
+        } else if(value != shaderValue(input, (Vector2i(x, y) - rectangle.bottomLeft())*4, 12)) ++mismatches;
+    }
+    CORRADE_COMPARE(mismatches, 0);
+    CORRADE_COMPARE(untouched, 48*40 - 32*24);
+}
+
+void DistanceFieldTest::empty() {
+    std::vector<unsigned char> inputData(16*16, 0);
+    std::vector<unsigned char> outputData(8*8);
+    const ImageReference2D input(ColorFormat::Red, ColorType::UnsignedByte, Vector2i(16), inputData.data());
+    ImageReference2D output(ColorFormat::Red, ColorType::UnsignedByte, Vector2i(8), outputData.data());
+
+    /* No inside pixel anywhere */
+    distanceField(input, output, {{}, Vector2i(8)}, 4);
+    CORRADE_COMPARE(outputData, std::vector<unsigned char>(8*8, 0));
+
+    /* Everything inside, only the border outside of the image is black */
+    inputData.assign(16*16, 255);
+    distanceField(input, output, {{}, Vector2i(8)}, 4);
+    CORRADE_COMPARE(outputData[0], shaderValue(input, {}, 4));
+    CORRADE_COMPARE(outputData[4*8 + 4], 255);
+}
+
+void DistanceFieldTest::oddWidth() {
+    /* Rows of both images are padded to four bytes, padding of the input is
+       filled with garbage which shouldn't affect the result */
+    const Vector2i size(67, 45);
+    std::vector<unsigned char> inputData = shapes(size);
+    for(Int y = 0; y != size.y(); ++y)
+        inputData[y*68 + 67] = 255;
+    std::vector<unsigned char> outputData(68*45, 0x5a);
+    const ImageReference2D input(ColorFormat::Red, ColorType::UnsignedByte, size, inputData.data());
+    ImageReference2D output(ColorFormat::Red, ColorType::UnsignedByte, size, outputData.data());
+
+    distanceField(input, output, {{}, size}, 7);
+
+    std::size_t mismatches = 0, untouched = 0;
+    for(Int y = 0; y != size.y(); ++y) {
+        for(Int x = 0; x != size.x(); ++x)
+            if(outputData[y*68 + x] != shaderValue(input, {x, y}, 7)) ++mismatches;
+        if(outputData[y*68 + 67] == 0x5a) ++untouched;
+    }
+    CORRADE_COMPARE(mismatches, 0);
+    CORRADE_COMPARE(untouched, 45);
+}
+
+void DistanceFieldTest::threads() {
+    const Vector2i size(256, 200);
+    std::vector<unsigned char> inputData = shapes(size);
+    std::vector<unsigned char> single(size.product()), multiple(size.product());
+    const ImageReference2D input(ColorFormat::Red, ColorType::UnsignedByte, size, inputData.data());
+    ImageReference2D singleOutput(ColorFormat::Red, ColorType::UnsignedByte, size, single.data());
+    ImageReference2D multipleOutput(ColorFormat::Red, ColorType::UnsignedByte, size, multiple.data());
+
+    distanceField(input, singleOutput, {{}, size}, 16);
+    distanceField(input, multipleOutput, {{}, size}, 16, 4);
+    CORRADE_VERIFY(single == multiple);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::DistanceFieldTest)
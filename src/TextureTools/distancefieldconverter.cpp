@@ -22,12 +22,15 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <thread>
+#include <vector>
 #include <Utility/Arguments.h>
 #include <PluginManager/Manager.h>
 
 #include "Math/Geometry/Rectangle.h"
 #include "ColorFormat.h"
 #include "Image.h"
+#include "ImageReference.h"
 #include "Renderer.h"
 #include "Texture.h"
 #include "TextureFormat.h"
@@ -58,10 +61,13 @@ DistanceFieldConverter::DistanceFieldConverter(const Arguments& arguments): Wind
         .addOption("converter", "TgaImageConverter").setHelp("image converter plugin")
         .addNamedArgument("output-size").setHelpKey("output-size", "\"X Y\"").setHelp("output-size", "size of output image")
         .addNamedArgument("radius").setHelpKey("radius", "N").setHelp("radius", "distance field computation radius")
+        .addOption("threads", "0").setHelpKey("threads", "N").setHelp("threads", "thread count for computation on CPU, 0 for all available")
+        .addBooleanOption("gpu").setHelp("gpu", "compute the distance field on GPU instead of CPU")
         .setHelp("Converts black&white image to distance-field representation.")
         .parse(arguments.argc, arguments.argv);
 
-    createContext({});
+    /* Computation on CPU doesn't need any GL context */
+    if(args.isSet("gpu")) createContext({});
 }
 
 int DistanceFieldConverter::exec() {
@@ -95,6 +101,25 @@ int DistanceFieldConverter::exec() {
         return 1;
     }
 
+    const Vector2i outputSize = args.value<Vector2i>("output-size");
+    Debug() << "Converting image of size" << image->size() << "to distance field...";
+
+    /* Compute on CPU */
+    if(!args.isSet("gpu")) {
+        const UnsignedInt threads = args.value<UnsignedInt>("threads");
+        std::vector<unsigned char> data((outputSize.x() + 3)/4*4*outputSize.y());
+        ImageReference2D result(ColorFormat::Red, ColorType::UnsignedByte, outputSize, data.data());
+        TextureTools::distanceField(*image, result, {{}, outputSize}, args.value<Int>("radius"),
+            threads ? threads : std::thread::hardware_concurrency());
+
+        if(!converter->exportToFile(result, args.value("output"))) {
+            Error() << "Cannot save file" << args.value("output");
+            return 1;
+        }
+
+        return 0;
+    }
+
     /* Input texture */
     Texture2D input;
     input.setMinificationFilter(Sampler::Filter::Linear)
@@ -104,13 +129,12 @@ int DistanceFieldConverter::exec() {
 
     /* Output texture */
     Texture2D output;
-    output.setStorage(1, TextureFormat::R8, args.value<Vector2i>("output-size"));
+    output.setStorage(1, TextureFormat::R8, outputSize);
 
     CORRADE_INTERNAL_ASSERT(Renderer::error() == Renderer::Error::NoError);
 
     /* Do it */
-    Debug() << "Converting image of size" << image->size() << "to distance field...";
-    TextureTools::distanceField(input, output, {{}, args.value<Vector2i>("output-size")}, args.value<Int>("radius"), image->size());
+    TextureTools::distanceField(input, output, {{}, outputSize}, args.value<Int>("radius"), image->size());
 
     /* Save image */
     Image2D result(ColorFormat::Red, ColorType::UnsignedByte);
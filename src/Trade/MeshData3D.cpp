@@ -24,7 +24,7 @@
 
 #include "MeshData3D.h"
 
-#include "Math/Vector3.h"
+#include "Math/Vector4.h"
 
 namespace Magnum { namespace Trade {
 
@@ -32,6 +32,11 @@ MeshData3D::MeshData3D(Mesh::Primitive primitive, std::vector<UnsignedInt> indic
     CORRADE_ASSERT(!_positions.empty(), "Trade::MeshData3D: no position array specified", );
 }
 
+MeshData3D::MeshData3D(Mesh::Primitive primitive, std::vector<UnsignedInt> indices, std::vector<std::vector<Vector3>> positions, std::vector<std::vector<Vector3>> normals, std::vector<std::vector<Vector2>> textureCoords2D, std::vector<Vector4ui> jointIds, std::vector<Vector4> jointWeights): _primitive(primitive), _indices(std::move(indices)), _positions(std::move(positions)), _normals(std::move(normals)), _textureCoords2D(std::move(textureCoords2D)), _jointIds(std::move(jointIds)), _jointWeights(std::move(jointWeights)) {
+    CORRADE_ASSERT(!_positions.empty(), "Trade::MeshData3D: no position array specified", );
+    CORRADE_ASSERT(_jointIds.size() == _jointWeights.size(), "Trade::MeshData3D: count of joint IDs and weights doesn't match", );
+}
+
 MeshData3D::MeshData3D(MeshData3D&&) = default;
 
 MeshData3D::~MeshData3D() = default;
@@ -78,4 +83,24 @@ const std::vector<Vector2>& MeshData3D::textureCoords2D(const UnsignedInt id) co
     return _textureCoords2D[id];
 }
 
+std::vector<Vector4ui>& MeshData3D::jointIds() {
+    CORRADE_ASSERT(isSkinned(), "Trade::MeshData3D::jointIds(): the mesh is not skinned", _jointIds);
+    return _jointIds;
+}
+
+const std::vector<Vector4ui>& MeshData3D::jointIds() const {
+    CORRADE_ASSERT(isSkinned(), "Trade::MeshData3D::jointIds(): the mesh is not skinned", _jointIds);
+    return _jointIds;
+}
+
+std::vector<Vector4>& MeshData3D::jointWeights() {
+    CORRADE_ASSERT(isSkinned(), "Trade::MeshData3D::jointWeights(): the mesh is not skinned", _jointWeights);
+    return _jointWeights;
+}
+
+const std::vector<Vector4>& MeshData3D::jointWeights() const {
+    CORRADE_ASSERT(isSkinned(), "Trade::MeshData3D::jointWeights(): the mesh is not skinned", _jointWeights);
+    return _jointWeights;
+}
+
 }}
@@ -56,6 +56,25 @@ class MAGNUM_EXPORT MeshData3D {
          */
         explicit MeshData3D(Mesh::Primitive primitive, std::vector<UnsignedInt> indices, std::vector<std::vector<Vector3>> positions, std::vector<std::vector<Vector3>> normals, std::vector<std::vector<Vector2>> textureCoords2D);
 
+        /**
+         * @brief Constructor for skinned mesh
+         * @param primitive         Primitive
+         * @param indices           Index array or empty array, if the mesh is
+         *      not indexed
+         * @param positions         Position arrays. At least one position
+         *      array should be present.
+         * @param normals           Normal arrays, if present
+         * @param textureCoords2D   Two-dimensional texture coordinate arrays,
+         *      if present
+         * @param jointIds          IDs of up to four joints affecting each
+         *      vertex
+         * @param jointWeights      Weights of the joints for each vertex
+         *
+         * Count of joint IDs must be the same as count of joint weights.
+         * Unused joints should have zero weight.
+         */
+        explicit MeshData3D(Mesh::Primitive primitive, std::vector<UnsignedInt> indices, std::vector<std::vector<Vector3>> positions, std::vector<std::vector<Vector3>> normals, std::vector<std::vector<Vector2>> textureCoords2D, std::vector<Vector4ui> jointIds, std::vector<Vector4> jointWeights);
+
         /** @brief Copying is not allowed */
         MeshData3D(const MeshData3D&) = delete;
 
@@ -120,12 +139,39 @@ class MAGNUM_EXPORT MeshData3D {
         std::vector<Vector2>& textureCoords2D(UnsignedInt id);
         const std::vector<Vector2>& textureCoords2D(UnsignedInt id) const; /**< @overload */
 
+        /**
+         * @brief Whether the mesh is skinned
+         *
+         * @see @ref jointIds(), @ref jointWeights()
+         */
+        bool isSkinned() const { return !_jointIds.empty(); }
+
+        /**
+         * @brief Joint IDs
+         *
+         * IDs of up to four joints affecting each vertex.
+         * @see @ref isSkinned(), @ref MeshTools::skinPointsInPlace()
+         */
+        std::vector<Vector4ui>& jointIds();
+        const std::vector<Vector4ui>& jointIds() const; /**< @overload */
+
+        /**
+         * @brief Joint weights
+         *
+         * Weights of joints specified in @ref jointIds().
+         * @see @ref isSkinned()
+         */
+        std::vector<Vector4>& jointWeights();
+        const std::vector<Vector4>& jointWeights() const; /**< @overload */
+
     private:
         Mesh::Primitive _primitive;
         std::vector<UnsignedInt> _indices;
         std::vector<std::vector<Vector3>> _positions;
         std::vector<std::vector<Vector3>> _normals;
         std::vector<std::vector<Vector2>> _textureCoords2D;
+        std::vector<Vector4ui> _jointIds;
+        std::vector<Vector4> _jointWeights;
 };
 
 }}
@@ -24,7 +24,9 @@
 
 #cmakedefine MAGNUM_BUILD_DEPRECATED
 #cmakedefine MAGNUM_BUILD_STATIC
+#cmakedefine MAGNUM_BUILD_THREADS
 #cmakedefine MAGNUM_TARGET_GLES
 #cmakedefine MAGNUM_TARGET_GLES2
 #cmakedefine MAGNUM_TARGET_GLES3
 #cmakedefine MAGNUM_TARGET_DESKTOP_GLES
+#cmakedefine MAGNUM_TARGET_SSE2